@@ -20,7 +20,7 @@ static constexpr size_t Repetitions = 10;
 //
 static void AutoTexturization_AutoTexturizeInto(benchmark::State& state)
 {
-    GameAssetManager const gameAssetManager = GameAssetManager((std::filesystem::current_path() / "Data").string());
+    GameAssetManager const gameAssetManager = GameAssetManager((std::filesystem::path(TESTING_GAME_ROOT) / "Data").string());
     MaterialDatabase const materialDatabase = MaterialDatabase::Load(gameAssetManager);
     ShipTexturizer texturizer(materialDatabase, gameAssetManager);
 
@@ -84,7 +84,7 @@ BENCHMARK(AutoTexturization_AutoTexturizeInto);
 //
 static void AutoTexturization_RenderShipInto(benchmark::State & state)
 {
-    GameAssetManager const gameAssetManager = GameAssetManager((std::filesystem::current_path() / "Data").string());
+    GameAssetManager const gameAssetManager = GameAssetManager((std::filesystem::path(TESTING_GAME_ROOT) / "Data").string());
     MaterialDatabase const materialDatabase = MaterialDatabase::Load(gameAssetManager);
     ShipTexturizer texturizer(materialDatabase, gameAssetManager);
 
@@ -5,6 +5,7 @@
 #include <benchmark/benchmark.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
 static constexpr size_t SampleSize = 200000;
@@ -73,3 +74,114 @@ static void DiffuseLight_Vectorized(benchmark::State & state)
     benchmark::DoNotOptimize(outLightBuffer);
 }
 BENCHMARK(DiffuseLight_Vectorized)->Arg(4)->Arg(8)->Arg(16)->Arg(32)->Arg(128);
+
+//
+// Lamps scattered over a ship-like grid of points, each lamp lighting a small area
+//
+
+static void MakeShipLightingScenario(
+    size_t lampCount,
+    unique_aligned_buffer<vec2f> & pointPositions,
+    unique_aligned_buffer<PlaneId> & pointPlaneIds,
+    unique_aligned_buffer<vec2f> & lampPositions,
+    unique_aligned_buffer<PlaneId> & lampPlaneIds,
+    unique_aligned_buffer<float> & lampDistanceCoeffs,
+    unique_aligned_buffer<float> & lampSpreadMaxDistances)
+{
+    size_t constexpr ShipWidth = 500;
+
+    auto const pointsSize = MakeSize(SampleSize);
+    auto const lampsSize = MakeSize(lampCount);
+
+    pointPositions = make_unique_buffer_aligned_to_vectorization_word<vec2f>(pointsSize);
+    pointPlaneIds = make_unique_buffer_aligned_to_vectorization_word<PlaneId>(pointsSize);
+    for (size_t p = 0; p < pointsSize; ++p)
+    {
+        pointPositions[p] = vec2f(static_cast<float>(p % ShipWidth), static_cast<float>(p / ShipWidth));
+        pointPlaneIds[p] = 0;
+    }
+
+    float const shipHeight = static_cast<float>(pointsSize / ShipWidth);
+
+    lampPositions = make_unique_buffer_aligned_to_vectorization_word<vec2f>(lampsSize);
+    lampPlaneIds = make_unique_buffer_aligned_to_vectorization_word<PlaneId>(lampsSize);
+    lampDistanceCoeffs = make_unique_buffer_aligned_to_vectorization_word<float>(lampsSize);
+    lampSpreadMaxDistances = make_unique_buffer_aligned_to_vectorization_word<float>(lampsSize);
+    for (size_t l = 0; l < lampsSize; ++l)
+    {
+        lampPositions[l] = vec2f(
+            static_cast<float>((l * 7919) % ShipWidth),
+            std::fmod(static_cast<float>(l * 104729), shipHeight));
+        lampPlaneIds[l] = 1;
+        lampSpreadMaxDistances[l] = (l < lampCount) ? 10.5f : 0.0f;
+        lampDistanceCoeffs[l] = (l < lampCount) ? 1.0f / lampSpreadMaxDistances[l] : 0.0f;
+    }
+}
+
+static void DiffuseLight_Ship_AllLamps(benchmark::State & state)
+{
+    auto const lampCount = static_cast<size_t>(state.range(0));
+
+    unique_aligned_buffer<vec2f> pointPositions, lampPositions;
+    unique_aligned_buffer<PlaneId> pointPlaneIds, lampPlaneIds;
+    unique_aligned_buffer<float> lampDistanceCoeffs, lampSpreadMaxDistances;
+    MakeShipLightingScenario(lampCount, pointPositions, pointPlaneIds, lampPositions, lampPlaneIds, lampDistanceCoeffs, lampSpreadMaxDistances);
+
+    auto const pointsSize = MakeSize(SampleSize);
+    auto outLightBuffer = make_unique_buffer_aligned_to_vectorization_word<float>(pointsSize);
+
+    for (auto _ : state)
+    {
+        Algorithms::DiffuseLight(
+            0,
+            ElementIndex(pointsSize),
+            pointPositions.get(),
+            pointPlaneIds.get(),
+            lampPositions.get(),
+            lampPlaneIds.get(),
+            lampDistanceCoeffs.get(),
+            lampSpreadMaxDistances.get(),
+            ElementIndex(MakeSize(lampCount)),
+            outLightBuffer.get());
+    }
+
+    benchmark::DoNotOptimize(outLightBuffer);
+}
+BENCHMARK(DiffuseLight_Ship_AllLamps)->Arg(10)->Arg(100)->Arg(1000);
+
+static void DiffuseLight_Ship_Binned(benchmark::State & state)
+{
+    auto const lampCount = static_cast<size_t>(state.range(0));
+
+    unique_aligned_buffer<vec2f> pointPositions, lampPositions;
+    unique_aligned_buffer<PlaneId> pointPlaneIds, lampPlaneIds;
+    unique_aligned_buffer<float> lampDistanceCoeffs, lampSpreadMaxDistances;
+    MakeShipLightingScenario(lampCount, pointPositions, pointPlaneIds, lampPositions, lampPlaneIds, lampDistanceCoeffs, lampSpreadMaxDistances);
+
+    auto const pointsSize = MakeSize(SampleSize);
+    auto outLightBuffer = make_unique_buffer_aligned_to_vectorization_word<float>(pointsSize);
+
+    LampGrid lampGrid(64);
+
+    for (auto _ : state)
+    {
+        // Includes binning, as it's done at each simulation step
+        lampGrid.Rebuild(
+            lampPositions.get(),
+            lampPlaneIds.get(),
+            lampDistanceCoeffs.get(),
+            lampSpreadMaxDistances.get(),
+            ElementCount(MakeSize(lampCount)));
+
+        Algorithms::DiffuseLight_Binned(
+            0,
+            ElementIndex(pointsSize),
+            pointPositions.get(),
+            pointPlaneIds.get(),
+            lampGrid,
+            outLightBuffer.get());
+    }
+
+    benchmark::DoNotOptimize(outLightBuffer);
+}
+BENCHMARK(DiffuseLight_Ship_Binned)->Arg(10)->Arg(100)->Arg(1000);
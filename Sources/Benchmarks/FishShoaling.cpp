@@ -0,0 +1,246 @@
+#include "Utils.h"
+
+#include <Core/UniformPointGrid.h>
+#include <Core/Vectors.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+//
+// The neighbor search of one shoaling step: fishes are grouped in contiguous shoals, and at
+// each step only the fishes whose shoaling cycle has expired - about one every 121 - look for
+// the closest and furthest neighbors in their shoal.
+//
+// Fishes as an array of structs, scanning the whole shoal (as it used to be) vs fishes' hot
+// state in SoA buffers, with a grid for large shoals
+//
+
+static constexpr size_t ShoalingCycleSteps = 121; // ShoalingTimerCycleDuration / SimulationStepTimeDuration
+static constexpr float ShoalRadius = 1.6f;
+
+static std::vector<vec2f> MakeFishPositions(
+    size_t fishCount,
+    size_t shoalSize)
+{
+    std::vector<vec2f> positions;
+    for (size_t f = 0; f < fishCount; ++f)
+    {
+        // Shoals are spread along x, and their fishes in an area growing with the shoal's size
+        float const shoalExtent = std::sqrt(static_cast<float>(shoalSize)) * 0.6f;
+        size_t const shoal = f / shoalSize;
+        positions.emplace_back(
+            static_cast<float>(shoal) * 50.0f + static_cast<float>((f * 7919) % 1000) / 1000.0f * shoalExtent,
+            -20.0f - static_cast<float>((f * 104729) % 1000) / 1000.0f * shoalExtent);
+    }
+
+    return positions;
+}
+
+struct NeighborSearchResult
+{
+    ElementIndex ClosestFishIndex;
+    ElementIndex FurthestFishIndex;
+};
+
+static void FishShoaling_AoS_Scan(benchmark::State & state)
+{
+    size_t const fishCount = static_cast<size_t>(state.range(0));
+    size_t const shoalSize = static_cast<size_t>(state.range(1));
+
+    // Mimics the old fish
+    struct Fish
+    {
+        size_t ShoalId;
+        float PersonalitySeed;
+        vec2f CurrentPosition;
+        vec2f TargetPosition;
+        vec2f CurrentVelocity;
+        vec2f TargetVelocity;
+        vec2f ShoalingVelocity;
+        vec2f CurrentRenderVector;
+        float OtherState[6];
+        std::optional<std::array<float, 6>> CruiseSteeringState;
+        float LastSteeringSimulationTime;
+        bool IsInFreefall;
+        std::uint32_t RenderTextureFrameId;
+    };
+
+    auto const positions = MakeFishPositions(fishCount, shoalSize);
+    std::vector<Fish> fishes(fishCount);
+    for (size_t f = 0; f < fishCount; ++f)
+    {
+        fishes[f].PersonalitySeed = static_cast<float>(f % 10) / 10.0f;
+        fishes[f].CurrentPosition = positions[f];
+    }
+
+    std::vector<NeighborSearchResult> results(fishCount);
+
+    size_t step = 0;
+    for (auto _ : state)
+    {
+        for (size_t shoalStart = 0; shoalStart < fishCount; shoalStart += shoalSize)
+        {
+            size_t const shoalEnd = std::min(shoalStart + shoalSize, fishCount);
+            for (size_t f = shoalStart; f < shoalEnd; ++f)
+            {
+                if ((f % ShoalingCycleSteps) != (step % ShoalingCycleSteps))
+                    continue;
+
+                float const fishShoalRadius = ShoalRadius + fishes[f].PersonalitySeed;
+                float const fishShoalSpacing = 0.7f * fishShoalRadius;
+
+                NeighborSearchResult result{ NoneElementIndex, NoneElementIndex };
+                float closestFishDistance = std::numeric_limits<float>::max();
+                float furthestFishDistance = std::numeric_limits<float>::lowest();
+
+                for (size_t n = shoalStart; n < shoalEnd; ++n)
+                {
+                    if (n != f)
+                    {
+                        if (float const distance = (fishes[n].CurrentPosition - fishes[f].CurrentPosition).length();
+                            distance < fishShoalRadius)
+                        {
+                            if (distance < fishShoalSpacing)
+                            {
+                                if (distance < closestFishDistance)
+                                {
+                                    result.ClosestFishIndex = static_cast<ElementIndex>(n);
+                                    closestFishDistance = distance;
+                                }
+                            }
+                            else if (distance > furthestFishDistance)
+                            {
+                                result.FurthestFishIndex = static_cast<ElementIndex>(n);
+                                furthestFishDistance = distance;
+                            }
+                        }
+                    }
+                }
+
+                results[f] = result;
+            }
+        }
+
+        ++step;
+    }
+
+    benchmark::DoNotOptimize(results);
+}
+BENCHMARK(FishShoaling_AoS_Scan)->ArgsProduct({ { 100, 1000, 5000, 10000, 50000 }, { 32, 1024, 4096 } });
+
+static void FishShoaling_SoA_Grid(benchmark::State & state)
+{
+    size_t const fishCount = static_cast<size_t>(state.range(0));
+    size_t const shoalSize = static_cast<size_t>(state.range(1));
+
+    static ElementCount constexpr MinShoalSizeForGrid = 1536;
+
+    auto const positions = MakeFishPositions(fishCount, shoalSize);
+    std::vector<float> personalitySeeds(fishCount);
+    for (size_t f = 0; f < fishCount; ++f)
+    {
+        personalitySeeds[f] = static_cast<float>(f % 10) / 10.0f;
+    }
+
+    UniformPointGrid grid(1.0f, 64);
+
+    std::vector<NeighborSearchResult> results(fishCount);
+
+    size_t step = 0;
+    for (auto _ : state)
+    {
+        for (size_t shoalStart = 0; shoalStart < fishCount; shoalStart += shoalSize)
+        {
+            size_t const shoalEnd = std::min(shoalStart + shoalSize, fishCount);
+            ElementCount const shoalMemberCount = static_cast<ElementCount>(shoalEnd - shoalStart);
+            vec2f const * const shoalPositions = positions.data() + shoalStart;
+
+            grid.Invalidate();
+
+            for (size_t f = shoalStart; f < shoalEnd; ++f)
+            {
+                if ((f % ShoalingCycleSteps) != (step % ShoalingCycleSteps))
+                    continue;
+
+                float const fishShoalRadius = ShoalRadius + personalitySeeds[f];
+                float const fishShoalSpacing = 0.7f * fishShoalRadius;
+
+                NeighborSearchResult result{ NoneElementIndex, NoneElementIndex };
+                float closestFishDistance = std::numeric_limits<float>::max();
+                float furthestFishDistance = std::numeric_limits<float>::lowest();
+
+                auto const visitor = [&](size_t n, float distance)
+                {
+                    if (distance < fishShoalSpacing)
+                    {
+                        if (distance < closestFishDistance)
+                        {
+                            result.ClosestFishIndex = static_cast<ElementIndex>(n);
+                            closestFishDistance = distance;
+                        }
+                    }
+                    else if (distance > furthestFishDistance)
+                    {
+                        result.FurthestFishIndex = static_cast<ElementIndex>(n);
+                        furthestFishDistance = distance;
+                    }
+                };
+
+                if (shoalMemberCount >= MinShoalSizeForGrid)
+                {
+                    if (!grid.IsValid())
+                    {
+                        grid.Rebuild(
+                            shoalPositions,
+                            shoalMemberCount,
+                            [](ElementIndex)
+                            {
+                                return true;
+                            });
+                    }
+
+                    grid.VisitPointsInRadius(
+                        shoalPositions,
+                        positions[f],
+                        fishShoalRadius,
+                        [&](ElementIndex shoalFishIndex, float squareDistance)
+                        {
+                            size_t const n = shoalStart + shoalFishIndex;
+                            if (n != f)
+                            {
+                                visitor(n, std::sqrt(squareDistance));
+                            }
+                        });
+                }
+                else
+                {
+                    for (size_t n = shoalStart; n < shoalEnd; ++n)
+                    {
+                        if (n != f)
+                        {
+                            if (float const distance = (positions[n] - positions[f]).length();
+                                distance < fishShoalRadius)
+                            {
+                                visitor(n, distance);
+                            }
+                        }
+                    }
+                }
+
+                results[f] = result;
+            }
+        }
+
+        ++step;
+    }
+
+    benchmark::DoNotOptimize(results);
+}
+BENCHMARK(FishShoaling_SoA_Grid)->ArgsProduct({ { 100, 1000, 5000, 10000, 50000 }, { 32, 1024, 4096 } });
@@ -0,0 +1,214 @@
+#include "Utils.h"
+
+#include <Simulation/Physics/Npcs/NpcSprings.h>
+
+#include <Core/SysSpecifics.h>
+#include <Core/Vectors.h>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <optional>
+#include <vector>
+
+//
+// Spring forces of all NPCs, with the springs embedded in each NPC's state (as it
+// used to be) vs in NpcSprings; a quarter of the NPCs are furniture quads (4 particles,
+// 6 springs), the others are humans (2 particles, 1 spring)
+//
+
+static constexpr size_t MaxParticlesPerNpc = SimulationParameters::MaxParticlesPerNpc;
+static constexpr size_t MaxSpringsPerNpc = SimulationParameters::MaxSpringsPerNpc;
+
+struct NpcParticleBuffers
+{
+    std::vector<vec2f> Positions;
+    std::vector<vec2f> Velocities;
+    std::vector<vec2f> Forces;
+
+    explicit NpcParticleBuffers(size_t npcCount)
+        : Positions(npcCount * MaxParticlesPerNpc)
+        , Velocities(npcCount * MaxParticlesPerNpc)
+        , Forces(npcCount * MaxParticlesPerNpc, vec2f::zero())
+    {
+        for (size_t p = 0; p < Positions.size(); ++p)
+        {
+            Positions[p] = vec2f(static_cast<float>(p % 97), static_cast<float>(p % 89) * 0.5f);
+            Velocities[p] = vec2f(static_cast<float>(p % 7) * 0.1f, -static_cast<float>(p % 5) * 0.1f);
+        }
+    }
+};
+
+static size_t GetParticleCount(size_t npcId)
+{
+    return (npcId % 4) == 0 ? 4 : 2;
+}
+
+static std::vector<std::array<size_t, 2>> GetSpringOrdinals(size_t npcId)
+{
+    if (GetParticleCount(npcId) == 4)
+        return { { 0, 1 }, { 0, 3 }, { 0, 2 }, { 1, 2 }, { 2, 3 }, { 1, 3 } };
+    else
+        return { { 0, 1 } };
+}
+
+static inline void CalculateSpringForce(
+    ElementIndex endpointAIndex,
+    ElementIndex endpointBIndex,
+    float restLength,
+    float stiffnessFactor,
+    float dampingFactor,
+    NpcParticleBuffers & particles)
+{
+    vec2f const springDisplacement = particles.Positions[endpointAIndex] - particles.Positions[endpointBIndex];
+    float const springDisplacementLength = springDisplacement.length();
+    vec2f const springDir = springDisplacement.normalise_approx(springDisplacementLength);
+
+    float const fSpring = (springDisplacementLength - restLength) * stiffnessFactor;
+    vec2f const relVelocity = particles.Velocities[endpointAIndex] - particles.Velocities[endpointBIndex];
+    float const fDamp = relVelocity.dot(springDir) * dampingFactor;
+
+    vec2f const springForce = springDir * (fSpring + fDamp);
+    particles.Forces[endpointAIndex] -= springForce;
+    particles.Forces[endpointBIndex] += springForce;
+}
+
+static void NpcSpringForces_AoS(benchmark::State & state)
+{
+    auto const npcCount = static_cast<size_t>(state.range(0));
+
+    // Mimics the old NPC state: springs live in the (large) state, next to everything else
+    struct NpcSpringStateType
+    {
+        ElementIndex EndpointAIndex;
+        ElementIndex EndpointBIndex;
+        float BaseRestLength;
+        float BaseSpringReductionFraction;
+        float BaseSpringDampingCoefficient;
+        float RestLength;
+        float SpringStiffnessFactor;
+        float SpringDampingFactor;
+    };
+
+    struct StateType
+    {
+        bool IsActive;
+        std::array<std::uint8_t, 480> KindSpecificState;
+        std::array<ElementIndex, MaxParticlesPerNpc> ParticleIndices;
+        size_t ParticleCount;
+        std::array<NpcSpringStateType, MaxSpringsPerNpc> Springs;
+        size_t SpringCount;
+        std::array<std::uint8_t, 64> OtherState;
+    };
+
+    std::vector<std::optional<StateType>> npcs(npcCount);
+    for (size_t n = 0; n < npcCount; ++n)
+    {
+        npcs[n].emplace();
+        npcs[n]->IsActive = true;
+        npcs[n]->ParticleCount = GetParticleCount(n);
+        for (size_t p = 0; p < npcs[n]->ParticleCount; ++p)
+        {
+            npcs[n]->ParticleIndices[p] = static_cast<ElementIndex>(n * MaxParticlesPerNpc + p);
+        }
+
+        npcs[n]->SpringCount = 0;
+        for (auto const & ordinals : GetSpringOrdinals(n))
+        {
+            npcs[n]->Springs[npcs[n]->SpringCount++] = NpcSpringStateType({
+                npcs[n]->ParticleIndices[ordinals[0]],
+                npcs[n]->ParticleIndices[ordinals[1]],
+                1.0f, 0.5f, 0.5f,
+                1.0f, 100.0f, 10.0f });
+        }
+    }
+
+    NpcParticleBuffers particles(npcCount);
+
+    for (auto _ : state)
+    {
+        for (auto const & npc : npcs)
+        {
+            if (npc.has_value() && npc->IsActive)
+            {
+                for (size_t s = 0; s < npc->SpringCount; ++s)
+                {
+                    auto const & spring = npc->Springs[s];
+                    CalculateSpringForce(spring.EndpointAIndex, spring.EndpointBIndex, spring.RestLength, spring.SpringStiffnessFactor, spring.SpringDampingFactor, particles);
+                }
+            }
+        }
+    }
+
+    benchmark::DoNotOptimize(particles.Forces);
+}
+BENCHMARK(NpcSpringForces_AoS)->Arg(1000)->Arg(SimulationParameters::MaxMaxNpcs);
+
+static void NpcSpringForces_SoA(benchmark::State & state)
+{
+    auto const npcCount = static_cast<size_t>(state.range(0));
+
+    // The NPC state no longer holds springs
+    struct StateType
+    {
+        NpcId Id;
+        bool IsActive;
+        std::array<std::uint8_t, 480> KindSpecificState;
+        std::array<ElementIndex, MaxParticlesPerNpc> ParticleIndices;
+        size_t ParticleCount;
+        std::array<std::uint8_t, 64> OtherState;
+    };
+
+    std::vector<std::optional<StateType>> npcs(npcCount);
+    Physics::NpcSprings springs(npcCount);
+    for (size_t n = 0; n < npcCount; ++n)
+    {
+        npcs[n].emplace();
+        npcs[n]->Id = static_cast<NpcId>(n);
+        npcs[n]->IsActive = true;
+        npcs[n]->ParticleCount = GetParticleCount(n);
+        for (size_t p = 0; p < npcs[n]->ParticleCount; ++p)
+        {
+            npcs[n]->ParticleIndices[p] = static_cast<ElementIndex>(n * MaxParticlesPerNpc + p);
+        }
+
+        for (auto const & ordinals : GetSpringOrdinals(n))
+        {
+            ElementIndex const s = springs.Add(
+                static_cast<NpcId>(n),
+                npcs[n]->ParticleIndices[ordinals[0]],
+                npcs[n]->ParticleIndices[ordinals[1]],
+                1.0f, 0.5f, 0.5f);
+
+            springs.SetRestLength(s, 1.0f);
+            springs.SetStiffnessFactor(s, 100.0f);
+            springs.SetDampingFactor(s, 10.0f);
+        }
+    }
+
+    NpcParticleBuffers particles(npcCount);
+
+    for (auto _ : state)
+    {
+        auto const * restrict const endpointsBuffer = springs.GetEndpointsBuffer();
+        float const * restrict const restLengthBuffer = springs.GetRestLengthBuffer();
+        float const * restrict const stiffnessFactorBuffer = springs.GetStiffnessFactorBuffer();
+        float const * restrict const dampingFactorBuffer = springs.GetDampingFactorBuffer();
+
+        for (auto const & npc : npcs)
+        {
+            if (npc.has_value() && npc->IsActive)
+            {
+                ElementIndex const springStart = Physics::NpcSprings::GetSpringIndex(npc->Id, 0);
+                ElementIndex const springEnd = springStart + static_cast<ElementIndex>(springs.GetSpringCount(npc->Id));
+                for (ElementIndex s = springStart; s < springEnd; ++s)
+                {
+                    CalculateSpringForce(endpointsBuffer[s].EndpointAIndex, endpointsBuffer[s].EndpointBIndex, restLengthBuffer[s], stiffnessFactorBuffer[s], dampingFactorBuffer[s], particles);
+                }
+            }
+        }
+    }
+
+    benchmark::DoNotOptimize(particles.Forces);
+}
+BENCHMARK(NpcSpringForces_SoA)->Arg(1000)->Arg(SimulationParameters::MaxMaxNpcs);
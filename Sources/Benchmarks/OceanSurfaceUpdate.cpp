@@ -0,0 +1,273 @@
+#include "Utils.h"
+
+#include <Core/Algorithms.h>
+#include <Core/Buffer.h>
+#include <Core/PrecalculatedFunction.h>
+#include <Core/SysSpecifics.h>
+#include <Core/ThreadManager.h>
+#include <Core/ThreadPool.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <string>
+
+//
+// One update of the ocean surface - interactive waves, delta-height smoothing, SWE fields,
+// and samples generation - at different resolutions.
+//
+// Serial and scalar (as it used to be) vs SSE kernels, vs SSE kernels on multiple threads
+//
+
+static constexpr size_t BoundaryConditionsSamples = 3;
+static constexpr size_t SWEBufferPrefixSize = make_aligned_float_element_count(BoundaryConditionsSamples);
+static constexpr size_t SWEBufferAlignmentPrefixSize = SWEBufferPrefixSize - BoundaryConditionsSamples;
+static constexpr size_t DeltaHeightSmoothing = 5;
+static constexpr size_t DeltaHeightBufferPrefixSize = make_aligned_float_element_count(DeltaHeightSmoothing / 2);
+static constexpr size_t MinSamplesPerThread = 2048;
+
+static constexpr float SWEHeightFieldOffset = 50.0f;
+static constexpr float Dt = 1.0f / 64.0f;
+static constexpr float G = 9.80f;
+
+struct OceanSurfaceState
+{
+    size_t SamplesCount;
+    float Dx;
+
+    Buffer<float> SWEHeightField;
+    Buffer<float> SWEVelocityField;
+    Buffer<float> SWENextVelocityField;
+    Buffer<float> InteractiveWaveTargetHeight;
+    Buffer<float> InteractiveWaveCurrentHeightGrowthCoefficient;
+    Buffer<float> InteractiveWaveTargetHeightGrowthCoefficient;
+    Buffer<float> InteractiveWaveHeightGrowthCoefficientGrowthRate;
+    Buffer<float> DeltaHeightBuffer;
+    Buffer<float> SampleValues;
+    Buffer<float> SampleDeltas;
+    PrecalculatedFunction<8192> BasalWaveSin;
+
+    explicit OceanSurfaceState(size_t samplesCount)
+        : SamplesCount(samplesCount)
+        , Dx(10000.0f / static_cast<float>(samplesCount - 1))
+        , SWEHeightField(SWEBufferPrefixSize + samplesCount + BoundaryConditionsSamples)
+        , SWEVelocityField(SWEBufferPrefixSize + samplesCount + BoundaryConditionsSamples + 1)
+        , SWENextVelocityField(SWEBufferPrefixSize + samplesCount + BoundaryConditionsSamples + 1, 0, 0.0f)
+        , InteractiveWaveTargetHeight(samplesCount, 0, SWEHeightFieldOffset)
+        , InteractiveWaveCurrentHeightGrowthCoefficient(samplesCount, 0, 0.0f)
+        , InteractiveWaveTargetHeightGrowthCoefficient(samplesCount, 0, 0.0f)
+        , InteractiveWaveHeightGrowthCoefficientGrowthRate(samplesCount, 0, 0.1f)
+        , DeltaHeightBuffer(DeltaHeightBufferPrefixSize + samplesCount + DeltaHeightSmoothing / 2, 0, 0.0f)
+        , SampleValues(samplesCount + 1, 0, 0.0f)
+        , SampleDeltas(samplesCount + 1, 0, 0.0f)
+        , BasalWaveSin(
+            [](float x)
+            {
+                return 0.5f * std::sin(2.0f * Pi<float> * x);
+            })
+    {
+        for (size_t i = 0; i < SWEHeightField.GetSize(); ++i)
+        {
+            SWEHeightField[i] = SWEHeightFieldOffset + 0.01f * std::sin(static_cast<float>(i) * 0.01f);
+        }
+
+        for (size_t i = 0; i < SWEVelocityField.GetSize(); ++i)
+        {
+            SWEVelocityField[i] = 0.1f * std::cos(static_cast<float>(i) * 0.013f);
+        }
+    }
+
+    void DisplaceSome()
+    {
+        for (size_t i = 0; i < SamplesCount; i += 97)
+        {
+            DeltaHeightBuffer[DeltaHeightBufferPrefixSize + i] = 0.001f;
+        }
+    }
+
+    float CalculateSampleValue(size_t i, float sinArg1, float sinArg2) const
+    {
+        return
+            (SWEHeightField[SWEBufferPrefixSize + i] - SWEHeightFieldOffset) * 50.0f
+            + BasalWaveSin.GetLinearlyInterpolatedPeriodic(sinArg1)
+            + 0.75f * BasalWaveSin.GetLinearlyInterpolatedPeriodic(sinArg2);
+    }
+};
+
+static void OceanSurfaceUpdate_Serial(benchmark::State & state)
+{
+    OceanSurfaceState s(static_cast<size_t>(state.range(0)));
+
+    float const previousVWeight1 = 0.8f;
+    float const previousVWeight2 = 0.1f;
+    float const sinArg1Dx = 0.01f * s.Dx;
+    float const sinArg2Dx = 0.0066f * s.Dx;
+
+    for (auto _ : state)
+    {
+        s.DisplaceSome();
+
+        // Interactive waves
+        float * const restrict sweHeightFieldBody = s.SWEHeightField.data() + SWEBufferPrefixSize;
+        for (size_t i = 0; i < s.SamplesCount; ++i)
+        {
+            s.InteractiveWaveCurrentHeightGrowthCoefficient[i] +=
+                (s.InteractiveWaveTargetHeightGrowthCoefficient[i] - s.InteractiveWaveCurrentHeightGrowthCoefficient[i])
+                * s.InteractiveWaveHeightGrowthCoefficientGrowthRate[i];
+
+            sweHeightFieldBody[i] +=
+                (s.InteractiveWaveTargetHeight[i] - sweHeightFieldBody[i])
+                * s.InteractiveWaveCurrentHeightGrowthCoefficient[i];
+        }
+
+        // Delta-height
+        Algorithms::SmoothBufferAndAdd<DeltaHeightSmoothing>(
+            s.DeltaHeightBuffer.data() + DeltaHeightBufferPrefixSize,
+            sweHeightFieldBody,
+            s.SamplesCount);
+        s.DeltaHeightBuffer.fill(0.0f);
+
+        // SWE fields, with each velocity depending on the previous new one
+        float * const restrict heightField = s.SWEHeightField.data() + SWEBufferAlignmentPrefixSize;
+        float * const restrict velocityField = s.SWEVelocityField.data() + SWEBufferAlignmentPrefixSize;
+        heightField[0] *= 1.0f + Dt / s.Dx * (velocityField[0] - velocityField[1]);
+        for (size_t i = 1; i < BoundaryConditionsSamples + s.SamplesCount + BoundaryConditionsSamples; ++i)
+        {
+            heightField[i] *= 1.0f + Dt / s.Dx * (velocityField[i] - velocityField[i + 1]);
+
+            float const previousV =
+                previousVWeight1 * velocityField[i]
+                + previousVWeight2 * (velocityField[i - 1] + velocityField[i + 1]);
+
+            velocityField[i] = previousV - G * Dt / s.Dx * (heightField[i] - heightField[i - 1]);
+        }
+
+        // Samples
+        float sinArg1 = 0.1f;
+        float sinArg2 = 0.2f;
+        float previousSampleValue = s.CalculateSampleValue(0, sinArg1, sinArg2);
+        s.SampleValues[0] = previousSampleValue;
+        for (size_t i = 1; i < s.SamplesCount; ++i)
+        {
+            sinArg1 += sinArg1Dx;
+            sinArg2 += sinArg2Dx;
+            float const sampleValue = s.CalculateSampleValue(i, sinArg1, sinArg2);
+            s.SampleValues[i] = sampleValue;
+            s.SampleDeltas[i - 1] = sampleValue - previousSampleValue;
+            previousSampleValue = sampleValue;
+        }
+    }
+
+    benchmark::DoNotOptimize(s.SampleValues.data());
+}
+BENCHMARK(OceanSurfaceUpdate_Serial)->Arg(2048)->Arg(4096)->Arg(8192)->Arg(16384);
+
+static void RunOceanSurfaceUpdate(
+    benchmark::State & state,
+    size_t parallelism)
+{
+    OceanSurfaceState s(static_cast<size_t>(state.range(0)));
+
+    float const previousVWeight1 = 0.8f;
+    float const previousVWeight2 = 0.1f;
+    float const sinArg1Dx = 0.01f * s.Dx;
+    float const sinArg2Dx = 0.0066f * s.Dx;
+
+    ThreadManager threadManager(false, parallelism, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+    ThreadPool threadPool(ThreadManager::ThreadTaskKind::MainAndSimulation, parallelism, threadManager);
+
+    for (auto _ : state)
+    {
+        s.DisplaceSome();
+
+        // Boundaries
+        Algorithms::UpdateSWEHeightField_Naive(s.SWEHeightField.data() + SWEBufferAlignmentPrefixSize, s.SWEVelocityField.data() + SWEBufferAlignmentPrefixSize, BoundaryConditionsSamples, Dt / s.Dx);
+        Algorithms::UpdateSWEHeightField_Naive(s.SWEHeightField.data() + SWEBufferPrefixSize + s.SamplesCount, s.SWEVelocityField.data() + SWEBufferPrefixSize + s.SamplesCount, BoundaryConditionsSamples, Dt / s.Dx);
+
+        threadPool.ParallelFor(
+            0,
+            s.SamplesCount,
+            MinSamplesPerThread,
+            [&s](size_t start, size_t end)
+            {
+                float * const restrict sweHeightFieldBody = s.SWEHeightField.data() + SWEBufferPrefixSize;
+                for (size_t i = start; i < end; ++i)
+                {
+                    s.InteractiveWaveCurrentHeightGrowthCoefficient[i] +=
+                        (s.InteractiveWaveTargetHeightGrowthCoefficient[i] - s.InteractiveWaveCurrentHeightGrowthCoefficient[i])
+                        * s.InteractiveWaveHeightGrowthCoefficientGrowthRate[i];
+
+                    sweHeightFieldBody[i] +=
+                        (s.InteractiveWaveTargetHeight[i] - sweHeightFieldBody[i])
+                        * s.InteractiveWaveCurrentHeightGrowthCoefficient[i];
+                }
+
+                Algorithms::SmoothBufferAndAdd<DeltaHeightSmoothing>(
+                    s.DeltaHeightBuffer.data() + DeltaHeightBufferPrefixSize + start,
+                    sweHeightFieldBody + start,
+                    end - start);
+
+                Algorithms::UpdateSWEHeightField(
+                    sweHeightFieldBody + start,
+                    s.SWEVelocityField.data() + SWEBufferPrefixSize + start,
+                    end - start,
+                    Dt / s.Dx);
+            });
+
+        threadPool.ParallelFor(
+            0,
+            s.SamplesCount,
+            MinSamplesPerThread,
+            [&](size_t start, size_t end)
+            {
+                Algorithms::UpdateSWEVelocityField(
+                    s.SWEHeightField.data() + SWEBufferPrefixSize + start,
+                    s.SWEVelocityField.data() + SWEBufferPrefixSize + start,
+                    s.SWENextVelocityField.data() + SWEBufferPrefixSize + start,
+                    end - start,
+                    previousVWeight1,
+                    previousVWeight2,
+                    G * Dt / s.Dx);
+
+                std::fill(
+                    s.DeltaHeightBuffer.data() + DeltaHeightBufferPrefixSize + start,
+                    s.DeltaHeightBuffer.data() + DeltaHeightBufferPrefixSize + end,
+                    0.0f);
+
+                float previousSampleValue = s.CalculateSampleValue(start, 0.1f + sinArg1Dx * start, 0.2f + sinArg2Dx * start);
+                s.SampleValues[start] = previousSampleValue;
+                for (size_t i = start + 1; i < end; ++i)
+                {
+                    float const sampleValue = s.CalculateSampleValue(i, 0.1f + sinArg1Dx * i, 0.2f + sinArg2Dx * i);
+                    s.SampleValues[i] = sampleValue;
+                    s.SampleDeltas[i - 1] = sampleValue - previousSampleValue;
+                    previousSampleValue = sampleValue;
+                }
+
+                if (end < s.SamplesCount)
+                {
+                    s.SampleDeltas[end - 1] = s.CalculateSampleValue(end, 0.1f + sinArg1Dx * end, 0.2f + sinArg2Dx * end) - previousSampleValue;
+                }
+            });
+
+        // Boundaries
+        Algorithms::UpdateSWEVelocityField_Naive(s.SWEHeightField.data() + SWEBufferAlignmentPrefixSize + 1, s.SWEVelocityField.data() + SWEBufferAlignmentPrefixSize + 1, s.SWENextVelocityField.data() + SWEBufferAlignmentPrefixSize + 1, BoundaryConditionsSamples - 1, previousVWeight1, previousVWeight2, G * Dt / s.Dx);
+        Algorithms::UpdateSWEVelocityField_Naive(s.SWEHeightField.data() + SWEBufferPrefixSize + s.SamplesCount, s.SWEVelocityField.data() + SWEBufferPrefixSize + s.SamplesCount, s.SWENextVelocityField.data() + SWEBufferPrefixSize + s.SamplesCount, BoundaryConditionsSamples, previousVWeight1, previousVWeight2, G * Dt / s.Dx);
+
+        s.SWEVelocityField.swap(s.SWENextVelocityField);
+    }
+
+    benchmark::DoNotOptimize(s.SampleValues.data());
+}
+
+static void OceanSurfaceUpdate_Vectorized(benchmark::State & state)
+{
+    RunOceanSurfaceUpdate(state, 1);
+}
+BENCHMARK(OceanSurfaceUpdate_Vectorized)->Arg(2048)->Arg(4096)->Arg(8192)->Arg(16384);
+
+static void OceanSurfaceUpdate_Vectorized_4Threads(benchmark::State & state)
+{
+    RunOceanSurfaceUpdate(state, 4);
+}
+BENCHMARK(OceanSurfaceUpdate_Vectorized_4Threads)->Arg(2048)->Arg(4096)->Arg(8192)->Arg(16384)->UseRealTime();
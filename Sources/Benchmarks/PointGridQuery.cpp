@@ -0,0 +1,148 @@
+#include <Simulation/SimulationParameters.h>
+
+#include <Core/UniformPointGrid.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+//
+// Tool queries - points within a radius - on a ship with ~100K points plus its
+// ephemeral particles, as made at each simulation step while tools are in use;
+// the argument is the number of queries per step
+//
+
+static constexpr int ShipSize = 316; // Points per side => 99856 ship points
+
+static constexpr ElementCount ShipPointCount = static_cast<ElementCount>(ShipSize * ShipSize);
+
+static constexpr float ToolRadius = 5.0f;
+
+struct ShipPoints
+{
+    std::vector<vec2f> Positions;
+    std::vector<bool> IsEphemeralInUse;
+
+    // As Points::IsActive()
+    inline bool IsActive(ElementIndex p) const
+    {
+        return p < ShipPointCount
+            || IsEphemeralInUse[p - ShipPointCount];
+    }
+};
+
+static ShipPoints MakePoints()
+{
+    ShipPoints points;
+
+    for (int y = 0; y < ShipSize; ++y)
+    {
+        for (int x = 0; x < ShipSize; ++x)
+        {
+            points.Positions.emplace_back(static_cast<float>(x), static_cast<float>(y));
+        }
+    }
+
+    // A quarter of the ephemeral particles in use, scattered over the ship
+    for (ElementIndex e = 0; e < SimulationParameters::MaxEphemeralParticles; ++e)
+    {
+        points.Positions.emplace_back(
+            static_cast<float>((e * 7919) % 31500) / 100.0f,
+            static_cast<float>((e * 104729) % 31500) / 100.0f);
+        points.IsEphemeralInUse.push_back((e % 4) == 0);
+    }
+
+    return points;
+}
+
+static std::vector<vec2f> MakeToolPositions(size_t count)
+{
+    std::vector<vec2f> toolPositions;
+    for (size_t n = 0; n < count; ++n)
+    {
+        toolPositions.emplace_back(
+            static_cast<float>((n * 15485863) % 31500) / 100.0f,
+            static_cast<float>((n * 32452843) % 31500) / 100.0f);
+    }
+
+    return toolPositions;
+}
+
+static void PointGridQuery_FullScan(benchmark::State & state)
+{
+    auto const points = MakePoints();
+
+    auto const toolPositions = MakeToolPositions(static_cast<size_t>(state.range(0)));
+
+    float const squareRadius = ToolRadius * ToolRadius;
+
+    size_t visitCount = 0;
+
+    for (auto _ : state)
+    {
+        for (auto const & toolPosition : toolPositions)
+        {
+            for (ElementIndex p = 0; p < points.Positions.size(); ++p)
+            {
+                if (points.IsActive(p)
+                    && (points.Positions[p] - toolPosition).squareLength() < squareRadius)
+                {
+                    ++visitCount;
+                }
+            }
+        }
+    }
+
+    benchmark::DoNotOptimize(visitCount);
+}
+BENCHMARK(PointGridQuery_FullScan)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->Unit(benchmark::kMicrosecond);
+
+static void PointGridQuery_Grid(benchmark::State & state)
+{
+    auto const points = MakePoints();
+
+    auto const toolPositions = MakeToolPositions(static_cast<size_t>(state.range(0)));
+
+    float const squareRadius = ToolRadius * ToolRadius;
+
+    UniformPointGrid grid(2.0f, 1024);
+
+    size_t visitCount = 0;
+
+    for (auto _ : state)
+    {
+        // Includes rebuild, as it's done at each simulation step; the grid only
+        // has ship points, while ephemeral particles are checked directly
+        grid.Rebuild(
+            points.Positions.data(),
+            ShipPointCount,
+            [](ElementIndex)
+            {
+                return true;
+            });
+
+        for (auto const & toolPosition : toolPositions)
+        {
+            grid.VisitPointsInRadius(
+                points.Positions.data(),
+                toolPosition,
+                ToolRadius,
+                [&](ElementIndex, float)
+                {
+                    ++visitCount;
+                });
+
+            for (ElementIndex p = ShipPointCount; p < points.Positions.size(); ++p)
+            {
+                if (points.IsActive(p)
+                    && (points.Positions[p] - toolPosition).squareLength() < squareRadius)
+                {
+                    ++visitCount;
+                }
+            }
+        }
+    }
+
+    benchmark::DoNotOptimize(visitCount);
+}
+BENCHMARK(PointGridQuery_Grid)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->Unit(benchmark::kMicrosecond);
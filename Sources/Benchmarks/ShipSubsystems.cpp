@@ -0,0 +1,359 @@
+#include "SimulationFixture.h"
+
+#include <Simulation/Physics/Physics.h>
+
+#include <Core/GameWallClock.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+//
+// The hot paths of a ship's update, on synthetic ships of increasing size - from ~10K
+// to ~160K points
+//
+
+static ShipSpaceSize MakeShipSize(benchmark::State const & state)
+{
+    int const width = static_cast<int>(state.range(0));
+    return ShipSpaceSize(width, width * 3 / 10);
+}
+
+/*
+ * Reaches into the ship's internals.
+ */
+class ShipSubsystemsBenchmark
+{
+public:
+
+    static void UpdateWaterFlow(
+        Physics::Ship & ship,
+        SimulationFixture & fixture)
+    {
+        ship.PrepareWaterFlow(fixture.Parameters);
+
+        for (size_t p = 0; p < ship.mWaterFlowPartitions.size(); ++p)
+        {
+            ship.UpdateWaterVelocities(p);
+        }
+
+        ship.CompleteWaterFlow(fixture.Threads);
+    }
+
+    static void PropagateHeat(
+        Physics::Ship & ship,
+        float currentSimulationTime,
+        SimulationFixture & fixture)
+    {
+        ship.PropagateHeat(
+            currentSimulationTime,
+            SimulationParameters::SimulationStepTimeDuration<float>,
+            Physics::Storm::Parameters(),
+            fixture.Parameters,
+            fixture.Threads);
+    }
+
+    static void RunConnectivityVisit(Physics::Ship & ship)
+    {
+        ship.RunConnectivityVisit();
+    }
+
+    static void UpdateConnectivity(Physics::Ship & ship)
+    {
+        ship.UpdateConnectivity();
+    }
+
+    // Springs whose breaking alone neither splits the ship nor orphans points, and
+    // destroys no triangles, spread across the ship
+    static std::vector<ElementIndex> FindSingleBreakSprings(
+        Physics::Ship const & ship,
+        size_t count)
+    {
+        std::vector<ElementIndex> candidates;
+        for (auto springIndex : ship.mSprings)
+        {
+            if (ship.mSprings.GetSuperTriangles(springIndex).empty()
+                && ship.mPoints.GetConnectedSprings(ship.mSprings.GetEndpointAIndex(springIndex)).ConnectedSprings.size() > 1
+                && ship.mPoints.GetConnectedSprings(ship.mSprings.GetEndpointBIndex(springIndex)).ConnectedSprings.size() > 1)
+            {
+                candidates.push_back(springIndex);
+            }
+        }
+
+        std::vector<ElementIndex> springs;
+        size_t const stride = std::max(candidates.size() / count, size_t(1));
+        for (size_t c = stride / 2; c < candidates.size() && springs.size() < count; c += stride)
+        {
+            springs.push_back(candidates[c]);
+        }
+
+        return springs;
+    }
+
+    static void DestroySpring(
+        Physics::Ship & ship,
+        ElementIndex springIndex,
+        SimulationFixture & fixture)
+    {
+        ship.mSprings.Destroy(
+            springIndex,
+            Physics::Springs::DestroyOptions::DoNotFireBreakEvent
+            | Physics::Springs::DestroyOptions::DestroyOnlyConnectedTriangle,
+            0.0f,
+            fixture.Parameters,
+            ship.mPoints);
+    }
+
+    static void RestoreSpring(
+        Physics::Ship & ship,
+        ElementIndex springIndex,
+        SimulationFixture & fixture)
+    {
+        ship.mSprings.Restore(
+            springIndex,
+            fixture.Parameters,
+            ship.mPoints);
+    }
+
+    static void UpdateElectricalElements(
+        Physics::Ship & ship,
+        float currentSimulationTime,
+        SimulationFixture & fixture)
+    {
+        ++(ship.mCurrentElectricalVisitSequenceNumber);
+
+        ship.mElectricalElements.Update(
+            GameWallClock::GetInstance().Now(),
+            currentSimulationTime,
+            ship.mCurrentElectricalVisitSequenceNumber,
+            ship.mPoints,
+            ship.mSprings,
+            Physics::Formulae::CalculateAirDensity(fixture.Parameters.AirTemperature, fixture.Parameters),
+            Physics::Formulae::CalculateWaterDensity(fixture.Parameters.WaterTemperature, fixture.Parameters),
+            Physics::Storm::Parameters(),
+            fixture.Parameters);
+    }
+
+    static void SpawnAndUpdateEphemeralParticles(
+        Physics::Ship & ship,
+        size_t spawnCount,
+        float currentSimulationTime,
+        SimulationFixture & fixture)
+    {
+        auto & points = ship.mPoints;
+
+        // Spawn particles at ship points, alternating sparkles and debris
+        ElementIndex const pointStride = std::max(points.GetRawShipPointCount() / static_cast<ElementIndex>(spawnCount), ElementIndex(1));
+        for (size_t i = 0; i < spawnCount; ++i)
+        {
+            ElementIndex const pointIndex = static_cast<ElementIndex>((i * pointStride) % points.GetRawShipPointCount());
+
+            if (i % 2 == 0)
+            {
+                points.CreateEphemeralParticleSparkle(
+                    points.GetPosition(pointIndex),
+                    vec2f(1.0f, 5.0f),
+                    points.GetStructuralMaterial(pointIndex),
+                    1.0f,
+                    currentSimulationTime,
+                    1.0f,
+                    points.GetPlaneId(pointIndex));
+            }
+            else
+            {
+                points.CreateEphemeralParticleDebris(
+                    points.GetPosition(pointIndex),
+                    vec2f(-1.0f, 5.0f),
+                    1.0f,
+                    0.0f,
+                    points.GetStructuralMaterial(pointIndex),
+                    currentSimulationTime,
+                    1.0f,
+                    points.GetPlaneId(pointIndex));
+            }
+        }
+
+        points.UpdateEphemeralParticles(currentSimulationTime, fixture.Parameters);
+    }
+};
+
+//
+// Ship::UpdateWaterVelocities, for all partitions, together with the preparation
+// and completion of the water flow step
+//
+
+static void ShipSubsystems_UpdateWaterVelocities(benchmark::State & state)
+{
+    SimulationFixture fixture(MakeShipSize(state));
+
+    for (auto _ : state)
+    {
+        ShipSubsystemsBenchmark::UpdateWaterFlow(*fixture.Ship, fixture);
+    }
+
+    state.counters["Points"] = static_cast<double>(fixture.Ship->GetPointCount());
+}
+BENCHMARK(ShipSubsystems_UpdateWaterVelocities)->Arg(400)->Arg(800)->Arg(1600)->Unit(benchmark::kMicrosecond);
+
+static void ShipSubsystems_PropagateHeat(benchmark::State & state)
+{
+    SimulationFixture fixture(MakeShipSize(state));
+
+    float currentSimulationTime = 0.0f;
+    for (auto _ : state)
+    {
+        ShipSubsystemsBenchmark::PropagateHeat(*fixture.Ship, currentSimulationTime, fixture);
+        currentSimulationTime += SimulationParameters::SimulationStepTimeDuration<float>;
+    }
+
+    state.counters["Points"] = static_cast<double>(fixture.Ship->GetPointCount());
+}
+BENCHMARK(ShipSubsystems_PropagateHeat)->Arg(400)->Arg(800)->Arg(1600)->Unit(benchmark::kMicrosecond);
+
+static void ShipSubsystems_RunConnectivityVisit(benchmark::State & state)
+{
+    SimulationFixture fixture(MakeShipSize(state));
+
+    for (auto _ : state)
+    {
+        ShipSubsystemsBenchmark::RunConnectivityVisit(*fixture.Ship);
+    }
+
+    state.counters["Points"] = static_cast<double>(fixture.Ship->GetPointCount());
+}
+BENCHMARK(ShipSubsystems_RunConnectivityVisit)->Arg(400)->Arg(800)->Arg(1600)->Unit(benchmark::kMicrosecond);
+
+//
+// Connectivity updates after a single spring has broken - as happens at most steps with
+// breaks - which leaves planes as they are: incremental update vs full visit. The spring is
+// restored (untimed) afterwards, which requires a full visit that's also untimed
+//
+
+template<typename TUpdateConnectivity>
+static void RunSingleSpringBreaks(
+    benchmark::State & state,
+    TUpdateConnectivity && updateConnectivity)
+{
+    SimulationFixture fixture(MakeShipSize(state));
+
+    auto const springs = ShipSubsystemsBenchmark::FindSingleBreakSprings(*fixture.Ship, 64);
+
+    ShipSubsystemsBenchmark::UpdateConnectivity(*fixture.Ship);
+
+    size_t s = 0;
+    for (auto _ : state)
+    {
+        ShipSubsystemsBenchmark::DestroySpring(*fixture.Ship, springs[s], fixture);
+
+        updateConnectivity(*fixture.Ship);
+
+        state.PauseTiming();
+
+        ShipSubsystemsBenchmark::RestoreSpring(*fixture.Ship, springs[s], fixture);
+        ShipSubsystemsBenchmark::UpdateConnectivity(*fixture.Ship);
+
+        fixture.EventDispatcher.Flush();
+
+        s = (s + 1) % springs.size();
+
+        state.ResumeTiming();
+    }
+
+    state.counters["Points"] = static_cast<double>(fixture.Ship->GetPointCount());
+}
+
+static void ShipSubsystems_UpdateConnectivity_SingleSpringBreak_Incremental(benchmark::State & state)
+{
+    RunSingleSpringBreaks(state, ShipSubsystemsBenchmark::UpdateConnectivity);
+}
+BENCHMARK(ShipSubsystems_UpdateConnectivity_SingleSpringBreak_Incremental)->Arg(400)->Arg(800)->Arg(1600)->Unit(benchmark::kMicrosecond);
+
+static void ShipSubsystems_UpdateConnectivity_SingleSpringBreak_Full(benchmark::State & state)
+{
+    RunSingleSpringBreaks(state, ShipSubsystemsBenchmark::RunConnectivityVisit);
+}
+BENCHMARK(ShipSubsystems_UpdateConnectivity_SingleSpringBreak_Full)->Arg(400)->Arg(800)->Arg(1600)->Unit(benchmark::kMicrosecond);
+
+//
+// Frontiers' handling of destroyed triangles: a batch of triangles spread across the
+// ship is destroyed at each iteration, and restored (untimed) afterwards
+//
+
+static void ShipSubsystems_FrontiersTriangleDestroy(benchmark::State & state)
+{
+    SimulationFixture fixture(MakeShipSize(state));
+
+    size_t constexpr BatchSize = 256;
+
+    auto const & triangles = fixture.Ship->GetTriangles();
+    ElementIndex const triangleStride = std::max(triangles.GetElementCount() / static_cast<ElementIndex>(BatchSize), ElementIndex(1));
+
+    std::vector<GlobalElementId> batch;
+    for (ElementIndex t = triangleStride / 2; t < triangles.GetElementCount() && batch.size() < BatchSize; t += triangleStride)
+    {
+        batch.emplace_back(fixture.TheShipId, t);
+    }
+
+    for (auto _ : state)
+    {
+        for (auto const & triangleId : batch)
+        {
+            fixture.World->DestroyTriangle(triangleId);
+        }
+
+        state.PauseTiming();
+
+        for (auto const & triangleId : batch)
+        {
+            fixture.World->RestoreTriangle(triangleId);
+        }
+
+        fixture.EventDispatcher.Flush();
+
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * batch.size()));
+}
+BENCHMARK(ShipSubsystems_FrontiersTriangleDestroy)->Arg(400)->Arg(800)->Arg(1600)->Unit(benchmark::kMicrosecond);
+
+static void ShipSubsystems_UpdateElectricalElements(benchmark::State & state)
+{
+    SimulationFixture fixture(MakeShipSize(state));
+
+    float currentSimulationTime = 0.0f;
+    for (auto _ : state)
+    {
+        ShipSubsystemsBenchmark::UpdateElectricalElements(*fixture.Ship, currentSimulationTime, fixture);
+        currentSimulationTime += SimulationParameters::SimulationStepTimeDuration<float>;
+    }
+
+    fixture.EventDispatcher.Flush();
+}
+BENCHMARK(ShipSubsystems_UpdateElectricalElements)->Arg(400)->Arg(800)->Arg(1600)->Unit(benchmark::kMicrosecond);
+
+//
+// Ephemeral particles: a batch of sparkles and debris is spawned at each step, and all
+// live particles are updated; with particles living for one simulated second, the
+// particle pool eventually fills up and the oldest particles get recycled
+//
+
+static void ShipSubsystems_EphemeralParticles(benchmark::State & state)
+{
+    SimulationFixture fixture(ShipSpaceSize(400, 120));
+
+    size_t const spawnCount = static_cast<size_t>(state.range(0));
+
+    float currentSimulationTime = 0.0f;
+    for (auto _ : state)
+    {
+        ShipSubsystemsBenchmark::SpawnAndUpdateEphemeralParticles(*fixture.Ship, spawnCount, currentSimulationTime, fixture);
+        currentSimulationTime += SimulationParameters::SimulationStepTimeDuration<float>;
+    }
+
+    fixture.EventDispatcher.Flush();
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * spawnCount));
+}
+BENCHMARK(ShipSubsystems_EphemeralParticles)->Arg(16)->Arg(64)->Arg(256)->Unit(benchmark::kMicrosecond);
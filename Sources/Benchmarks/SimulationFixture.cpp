@@ -0,0 +1,11 @@
+#include "SimulationFixture.h"
+
+static constexpr size_t WarmupStepCount = 60;
+
+SimulationFixture::SimulationFixture(ShipSpaceSize const & shipSize)
+    : TestingWorld(SimulationParameters(), 1)
+    , Ship(&AddShip(shipSize, vec2f(0.0f, -static_cast<float>(shipSize.height) / 3.0f))) // Bottom third underwater
+    , TheShipId(Ship->GetId())
+{
+    Update(WarmupStepCount);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "TestingWorld.h"
+
+#include <Simulation/Physics/Physics.h>
+
+#include <Core/GameTypes.h>
+
+//
+// Fixture for benchmarking simulation subsystems: a testing world with one synthetic
+// ship, which starts with its bottom third underwater.
+//
+
+struct SimulationFixture : public TestingWorld
+{
+    Physics::Ship * Ship; // Owned by the world
+    ShipId TheShipId;
+
+    /*
+     * Creates the world and the ship, and runs the world for a few steps, so that the
+     * ship has settled and taken in some water.
+     *
+     * Single-threaded, so that numbers are comparable across machines.
+     */
+    explicit SimulationFixture(ShipSpaceSize const & shipSize);
+};
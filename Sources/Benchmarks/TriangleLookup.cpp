@@ -0,0 +1,142 @@
+#include "Utils.h"
+
+#include <Core/GameGeometry.h>
+#include <Core/UniformTriangleGrid.h>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <vector>
+
+//
+// Locating the triangles containing each of many NPCs, on a ship with ~100K triangles
+//
+
+static constexpr int ShipSize = 224; // Points per side => 2 * 223 * 223 = 99458 triangles
+
+using TriangleEndpoints = std::array<ElementIndex, 3>;
+
+static void MakeShip(
+    std::vector<vec2f> & positions,
+    std::vector<TriangleEndpoints> & triangles)
+{
+    for (int y = 0; y < ShipSize; ++y)
+    {
+        for (int x = 0; x < ShipSize; ++x)
+        {
+            positions.emplace_back(static_cast<float>(x), static_cast<float>(y));
+        }
+    }
+
+    for (int y = 0; y < ShipSize - 1; ++y)
+    {
+        for (int x = 0; x < ShipSize - 1; ++x)
+        {
+            ElementIndex const bl = static_cast<ElementIndex>(y * ShipSize + x);
+            ElementIndex const br = bl + 1;
+            ElementIndex const tl = bl + static_cast<ElementIndex>(ShipSize);
+            ElementIndex const tr = tl + 1;
+
+            triangles.push_back({ bl, tl, tr });
+            triangles.push_back({ bl, tr, br });
+        }
+    }
+}
+
+static std::vector<vec2f> MakeNpcPositions(size_t count)
+{
+    std::vector<vec2f> npcPositions;
+    for (size_t n = 0; n < count; ++n)
+    {
+        npcPositions.emplace_back(
+            static_cast<float>((n * 7919) % 22300) / 100.0f,
+            static_cast<float>((n * 104729) % 22300) / 100.0f);
+    }
+
+    return npcPositions;
+}
+
+static inline bool IsInTriangle(
+    vec2f const & position,
+    TriangleEndpoints const & triangle,
+    std::vector<vec2f> const & positions)
+{
+    return Geometry::IsPointInTriangle(position, positions[triangle[0]], positions[triangle[1]], positions[triangle[2]]);
+}
+
+static void TriangleLookup_FullScan(benchmark::State & state)
+{
+    std::vector<vec2f> positions;
+    std::vector<TriangleEndpoints> triangles;
+    MakeShip(positions, triangles);
+
+    auto const npcPositions = MakeNpcPositions(static_cast<size_t>(state.range(0)));
+
+    std::vector<ElementIndex> results(npcPositions.size());
+
+    for (auto _ : state)
+    {
+        for (size_t n = 0; n < npcPositions.size(); ++n)
+        {
+            results[n] = NoneElementIndex;
+
+            for (ElementIndex t = 0; t < triangles.size(); ++t)
+            {
+                if (IsInTriangle(npcPositions[n], triangles[t], positions))
+                {
+                    results[n] = t;
+                    break;
+                }
+            }
+        }
+    }
+
+    benchmark::DoNotOptimize(results);
+}
+BENCHMARK(TriangleLookup_FullScan)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+static void TriangleLookup_Grid(benchmark::State & state)
+{
+    std::vector<vec2f> positions;
+    std::vector<TriangleEndpoints> triangles;
+    MakeShip(positions, triangles);
+
+    auto const npcPositions = MakeNpcPositions(static_cast<size_t>(state.range(0)));
+
+    std::vector<ElementIndex> results(npcPositions.size());
+
+    UniformTriangleGrid grid(2.0f, 1024);
+
+    for (auto _ : state)
+    {
+        // Includes rebuild, as it's done at each simulation step
+        grid.Rebuild(
+            positions.data(),
+            static_cast<ElementCount>(triangles.size()),
+            [&](ElementIndex t) -> auto const &
+            {
+                return triangles[t];
+            },
+            [](ElementIndex)
+            {
+                return true;
+            });
+
+        for (size_t n = 0; n < npcPositions.size(); ++n)
+        {
+            results[n] = NoneElementIndex;
+
+            for (ElementIndex const t : grid.GetCellTriangles(npcPositions[n]))
+            {
+                if (IsInTriangle(npcPositions[n], triangles[t], positions))
+                {
+                    results[n] = t;
+                    break;
+                }
+            }
+        }
+    }
+
+    benchmark::DoNotOptimize(results);
+}
+BENCHMARK(TriangleLookup_Grid)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond);
@@ -1,5 +1,6 @@
 #include "Utils.h"
 
+#include <Core/Algorithms.h>
 #include <Core/SysSpecifics.h>
 
 #include <benchmark/benchmark.h>
@@ -74,6 +75,179 @@ static void UpdateSpringForces_Naive(benchmark::State& state)
 }
 BENCHMARK(UpdateSpringForces_Naive);
 
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+// Adapters for running the Algorithms kernels on the graph
+
+struct UpdateSpringForcesPoints
+{
+    vec2f const * GetPositionBufferAsVec2() const
+    {
+        return Position.data();
+    }
+
+    vec2f const * GetVelocityBufferAsVec2() const
+    {
+        return Velocity.data();
+    }
+
+    std::vector<vec2f> Position;
+    std::vector<vec2f> Velocity;
+};
+
+struct UpdateSpringForcesSprings
+{
+    using Endpoints = SpringEndpoints;
+
+    ElementCount GetPerfectSquareCount() const
+    {
+        return 0;
+    }
+
+    Endpoints const * GetEndpointsBuffer() const
+    {
+        return EndpointsBuffer.data();
+    }
+
+    float const * GetRestLengthBuffer() const
+    {
+        return RestLength.data();
+    }
+
+    float const * GetStiffnessCoefficientBuffer() const
+    {
+        return StiffnessCoefficient.data();
+    }
+
+    float const * GetDampingCoefficientBuffer() const
+    {
+        return DamperCoefficient.data();
+    }
+
+    std::vector<SpringEndpoints> EndpointsBuffer;
+    std::vector<float> StiffnessCoefficient;
+    std::vector<float> DamperCoefficient;
+    std::vector<float> RestLength;
+};
+
+template<typename TAlgorithm>
+static void RunUpdateSpringForces(
+    benchmark::State & state,
+    TAlgorithm algorithm)
+{
+    auto const size = MakeSize(SampleSize);
+
+    UpdateSpringForcesPoints points;
+    UpdateSpringForcesSprings springs;
+    std::vector<vec2f> pointsForce;
+
+    MakeGraph2(size, points.Position, points.Velocity, pointsForce,
+        springs.EndpointsBuffer, springs.StiffnessCoefficient, springs.DamperCoefficient, springs.RestLength);
+
+    for (auto _ : state)
+    {
+        algorithm(
+            points,
+            springs,
+            0,
+            static_cast<ElementIndex>(size),
+            pointsForce.data());
+    }
+
+    benchmark::DoNotOptimize(pointsForce);
+}
+
+static void UpdateSpringForces_SSEVectorized(benchmark::State & state)
+{
+    RunUpdateSpringForces(state, Algorithms::ApplySpringsForces_SSEVectorized<UpdateSpringForcesPoints, UpdateSpringForcesSprings>);
+}
+BENCHMARK(UpdateSpringForces_SSEVectorized);
+
+static void UpdateSpringForces_AVX2Vectorized(benchmark::State & state)
+{
+    if (!is_avx2_fma_supported())
+    {
+        state.SkipWithError("AVX2/FMA not supported");
+        return;
+    }
+
+    RunUpdateSpringForces(state, Algorithms::ApplySpringsForces_AVX2Vectorized<UpdateSpringForcesPoints, UpdateSpringForcesSprings>);
+}
+BENCHMARK(UpdateSpringForces_AVX2Vectorized);
+
+struct IntegratePoints
+{
+    float * GetPositionBufferAsFloat()
+    {
+        return reinterpret_cast<float *>(Position.get());
+    }
+
+    float * GetVelocityBufferAsFloat()
+    {
+        return reinterpret_cast<float *>(Velocity.get());
+    }
+
+    float const * GetStaticForceBufferAsFloat() const
+    {
+        return reinterpret_cast<float const *>(StaticForce.get());
+    }
+
+    float const * GetIntegrationFactorBufferAsFloat() const
+    {
+        return reinterpret_cast<float const *>(IntegrationFactor.get());
+    }
+
+    unique_aligned_buffer<vec2f> Position;
+    unique_aligned_buffer<vec2f> Velocity;
+    unique_aligned_buffer<vec2f> StaticForce;
+    unique_aligned_buffer<vec2f> IntegrationFactor;
+};
+
+template<typename TAlgorithm>
+static void RunIntegrateAndResetDynamicForces(
+    benchmark::State & state,
+    TAlgorithm algorithm)
+{
+    auto const size = MakeSize(SampleSize);
+
+    IntegratePoints points{ MakeVectors(size), MakeVectors(size), MakeVectors(size), MakeVectors(size) };
+    auto dynamicForces = MakeVectors(size);
+    float * const restrict dynamicForceBuffers[1] = { reinterpret_cast<float *>(dynamicForces.get()) };
+
+    for (auto _ : state)
+    {
+        algorithm(
+            points,
+            1,
+            0,
+            static_cast<ElementIndex>(size),
+            dynamicForceBuffers,
+            1.0f / 64.0f,
+            0.9f);
+    }
+
+    benchmark::DoNotOptimize(points.Position);
+}
+
+static void IntegrateAndResetDynamicForces_SSEVectorized(benchmark::State & state)
+{
+    RunIntegrateAndResetDynamicForces(state, Algorithms::IntegrateAndResetDynamicForces_SSEVectorized<IntegratePoints>);
+}
+BENCHMARK(IntegrateAndResetDynamicForces_SSEVectorized);
+
+static void IntegrateAndResetDynamicForces_AVX2Vectorized(benchmark::State & state)
+{
+    if (!is_avx2_fma_supported())
+    {
+        state.SkipWithError("AVX2/FMA not supported");
+        return;
+    }
+
+    RunIntegrateAndResetDynamicForces(state, Algorithms::IntegrateAndResetDynamicForces_AVX2Vectorized<IntegratePoints>);
+}
+BENCHMARK(IntegrateAndResetDynamicForces_AVX2Vectorized);
+#endif
+
 /* LibSimDpp has been purged
 static void UpdateSpringForces_LibSimdPpAndIntrinsics(benchmark::State& state)
 {
@@ -0,0 +1,99 @@
+#include "SimulationFixture.h"
+
+#include <Simulation/Physics/Physics.h>
+
+#include <benchmark/benchmark.h>
+
+//
+// The hot paths of the world's update, in a world with a mid-sized ship
+//
+
+static ShipSpaceSize const ShipSize(400, 120);
+
+static size_t constexpr WarmupStepCount = 60;
+
+static void WorldSubsystems_OceanSurfaceUpdate(benchmark::State & state)
+{
+    SimulationFixture fixture(ShipSize);
+
+    fixture.Parameters.OceanSurfaceSamplesCount = static_cast<size_t>(state.range(0));
+
+    Physics::Wind wind(fixture.EventDispatcher);
+    Physics::OceanSurface oceanSurface(*fixture.World, fixture.EventDispatcher, fixture.Parameters);
+
+    float currentSimulationTime = 0.0f;
+    for (auto _ : state)
+    {
+        oceanSurface.Update(currentSimulationTime, wind, fixture.Parameters, fixture.Threads);
+        currentSimulationTime += SimulationParameters::SimulationStepTimeDuration<float>;
+    }
+
+    fixture.EventDispatcher.Flush();
+}
+BENCHMARK(WorldSubsystems_OceanSurfaceUpdate)->Arg(2048)->Arg(4096)->Arg(8192)->Arg(16384)->Unit(benchmark::kMicrosecond);
+
+static void WorldSubsystems_FishesUpdate(benchmark::State & state)
+{
+    SimulationFixture fixture(ShipSize);
+
+    fixture.Parameters.NumberOfFishes = static_cast<unsigned int>(state.range(0));
+
+    Physics::Fishes fishes(fixture.Databases.FishSpecies, fixture.EventDispatcher);
+
+    auto const shipExternalAABBs = fixture.World->GetAllShipExternalAABBs();
+
+    float currentSimulationTime = 0.0f;
+    auto const updateFishes = [&]()
+    {
+        fishes.Update(
+            currentSimulationTime,
+            fixture.World->GetOceanSurface(),
+            fixture.World->GetOceanFloor(),
+            fixture.Parameters,
+            fixture.View.GetVisibleWorld(),
+            shipExternalAABBs);
+
+        currentSimulationTime += SimulationParameters::SimulationStepTimeDuration<float>;
+    };
+
+    // Let fishes enter the world and form their shoals
+    for (size_t s = 0; s < WarmupStepCount; ++s)
+    {
+        updateFishes();
+    }
+
+    for (auto _ : state)
+    {
+        updateFishes();
+    }
+
+    fixture.EventDispatcher.Flush();
+}
+BENCHMARK(WorldSubsystems_FishesUpdate)->Arg(160)->Arg(640)->Arg(2560)->Unit(benchmark::kMicrosecond);
+
+static void WorldSubsystems_NpcsUpdate(benchmark::State & state)
+{
+    SimulationFixture fixture(ShipSize);
+
+    fixture.Parameters.NpcsPerGroup = static_cast<size_t>(state.range(0));
+
+    fixture.World->AddNpcGroup(NpcKindType::Human, fixture.View.GetVisibleWorld(), fixture.Parameters);
+
+    // Let NPCs settle in the ship
+    fixture.Update(WarmupStepCount);
+
+    auto & npcs = fixture.World->GetNpcs();
+    Physics::Storm::Parameters const stormParameters;
+
+    float currentSimulationTime = 0.0f;
+    for (auto _ : state)
+    {
+        npcs.Update(currentSimulationTime, stormParameters, fixture.Parameters, fixture.Threads);
+        npcs.UpdateEnd();
+
+        currentSimulationTime += SimulationParameters::SimulationStepTimeDuration<float>;
+    }
+
+    fixture.EventDispatcher.Flush();
+}
+BENCHMARK(WorldSubsystems_NpcsUpdate)->Arg(64)->Arg(256)->Arg(1024)->Unit(benchmark::kMicrosecond);
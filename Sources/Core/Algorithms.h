@@ -8,6 +8,7 @@
 #include "AABB.h"
 #include "GameMath.h"
 #include "GameTypes.h"
+#include "LampGrid.h"
 #include "SysSpecifics.h"
 
 #include <algorithm>
@@ -463,18 +464,108 @@ inline void DiffuseLight(
 #endif
 }
 
+/*
+ * Same as DiffuseLight, but only evaluating - for each point - the lamps binned in the point's
+ * cell of the lamp grid; points outside of the grid receive no light.
+ */
+inline void DiffuseLight_Binned(
+    ElementIndex const pointStart,
+    ElementIndex const pointEnd,
+    vec2f const * restrict pointPositions,
+    PlaneId const * restrict pointPlaneIds,
+    LampGrid const & lampGrid,
+    float * restrict outLightBuffer) noexcept
+{
+    static_assert(vectorization_float_count<size_t> >= 4);
+
+    float const * const restrict lampPositionsX = lampGrid.GetLampPositionsX();
+    float const * const restrict lampPositionsY = lampGrid.GetLampPositionsY();
+    PlaneId const * const restrict lampPlaneIds = lampGrid.GetLampPlaneIds();
+    float const * const restrict lampDistanceCoeffs = lampGrid.GetLampDistanceCoeffs();
+    float const * const restrict lampSpreadMaxDistances = lampGrid.GetLampSpreadMaxDistances();
+
+    for (ElementIndex p = pointStart; p < pointEnd; ++p)
+    {
+        auto const [lampStart, lampEnd] = lampGrid.GetCellLamps(pointPositions[p]);
+        assert(((lampEnd - lampStart) % 4) == 0);
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+        //
+        // Visit the cell's lamps 4 by 4, against the point broadcast to all slots
+        //
+
+        __m128 const pointPosX_4 = _mm_set1_ps(pointPositions[p].x);
+        __m128 const pointPosY_4 = _mm_set1_ps(pointPositions[p].y);
+        __m128i const pointPlaneId_4 = _mm_set1_epi32(static_cast<int>(pointPlaneIds[p]));
+
+        __m128 pointLight_4 = _mm_setzero_ps();
+
+        for (ElementIndex l = lampStart; l < lampEnd; l += 4)
+        {
+            // Calculate distance
+            __m128 const displacementX_4 = _mm_sub_ps(pointPosX_4, _mm_loadu_ps(lampPositionsX + l));
+            __m128 const displacementY_4 = _mm_sub_ps(pointPosY_4, _mm_loadu_ps(lampPositionsY + l));
+            __m128 const distance_4 = _mm_sqrt_ps(
+                _mm_add_ps(
+                    _mm_mul_ps(displacementX_4, displacementX_4),
+                    _mm_mul_ps(displacementY_4, displacementY_4)));
+
+            // Calculate new light
+            __m128 newLight_4 = _mm_mul_ps(
+                _mm_loadu_ps(lampDistanceCoeffs + l),
+                _mm_sub_ps(_mm_loadu_ps(lampSpreadMaxDistances + l), distance_4));
+
+            // Mask with plane ID
+            __m128i const planeMask = _mm_cmpgt_epi32(pointPlaneId_4, _mm_loadu_si128(reinterpret_cast<__m128i const *>(lampPlaneIds + l)));
+            newLight_4 = _mm_andnot_ps(_mm_castsi128_ps(planeMask), newLight_4);
+
+            // Point light
+            pointLight_4 = _mm_max_ps(pointLight_4, newLight_4);
+        }
+
+        // Reduce to max across slots
+        pointLight_4 = _mm_max_ps(pointLight_4, _mm_shuffle_ps(pointLight_4, pointLight_4, _MM_SHUFFLE(2, 3, 0, 1)));
+        pointLight_4 = _mm_max_ps(pointLight_4, _mm_shuffle_ps(pointLight_4, pointLight_4, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        float const pointLight = _mm_cvtss_f32(pointLight_4);
+
+#else
+
+        float pointLight = 0.0f;
+
+        for (ElementIndex l = lampStart; l < lampEnd; ++l)
+        {
+            if (pointPlaneIds[p] <= lampPlaneIds[l])
+            {
+                float const distance = (pointPositions[p] - vec2f(lampPositionsX[l], lampPositionsY[l])).length();
+
+                pointLight = std::max(
+                    lampDistanceCoeffs[l] * (lampSpreadMaxDistances[l] - distance),
+                    pointLight);
+            }
+        }
+
+#endif
+
+        // Cap light to 1.0
+        outLightBuffer[p] = std::min(1.0f, pointLight);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // BufferSmoothing
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template<size_t BufferSize, size_t SmoothingSize>
+template<size_t SmoothingSize>
 inline void SmoothBufferAndAdd_Naive(
     float const * restrict inBuffer,
-    float * restrict outBuffer) noexcept
+    float * restrict outBuffer,
+    size_t bufferSize) noexcept
 {
     static_assert((SmoothingSize % 2) == 1);
 
-    for (size_t i = 0; i < BufferSize; ++i)
+    for (size_t i = 0; i < bufferSize; ++i)
     {
         // Central sample
         float accumulatedHeight = inBuffer[i] * static_cast<float>((SmoothingSize / 2) + 1);
@@ -497,16 +588,25 @@ inline void SmoothBufferAndAdd_Naive(
     }
 }
 
-#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
 template<size_t BufferSize, size_t SmoothingSize>
-inline void SmoothBufferAndAdd_SSEVectorized(
+inline void SmoothBufferAndAdd_Naive(
     float const * restrict inBuffer,
     float * restrict outBuffer) noexcept
+{
+    SmoothBufferAndAdd_Naive<SmoothingSize>(inBuffer, outBuffer, BufferSize);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+template<size_t SmoothingSize>
+inline void SmoothBufferAndAdd_SSEVectorized(
+    float const * restrict inBuffer,
+    float * restrict outBuffer,
+    size_t bufferSize) noexcept
 {
     // This code is vectorized for SSE = 4 floats
     static_assert(vectorization_float_count<size_t> >= 4);
-    static_assert(is_aligned_to_float_element_count(BufferSize));
     static_assert((SmoothingSize % 2) == 1);
+    assert(is_aligned_to_float_element_count(bufferSize));
     assert(is_aligned_to_vectorization_word(inBuffer));
     assert(is_aligned_to_vectorization_word(outBuffer));
 
@@ -515,7 +615,7 @@ inline void SmoothBufferAndAdd_SSEVectorized(
         (1.0f / static_cast<float>(SmoothingSize))
         * (1.0f / static_cast<float>(SmoothingSize)));
 
-    for (size_t i = 0; i < BufferSize; i += 4)
+    for (size_t i = 0; i < bufferSize; i += 4)
     {
         // Central sample
         __m128 accumulatedHeight = _mm_mul_ps(
@@ -546,18 +646,29 @@ inline void SmoothBufferAndAdd_SSEVectorized(
                     scaling)));
     }
 }
+
+template<size_t BufferSize, size_t SmoothingSize>
+inline void SmoothBufferAndAdd_SSEVectorized(
+    float const * restrict inBuffer,
+    float * restrict outBuffer) noexcept
+{
+    static_assert(is_aligned_to_float_element_count(BufferSize));
+
+    SmoothBufferAndAdd_SSEVectorized<SmoothingSize>(inBuffer, outBuffer, BufferSize);
+}
 #endif
 
 #if FS_IS_ARM_NEON() // Implies ARM anyways
-template<size_t BufferSize, size_t SmoothingSize>
+template<size_t SmoothingSize>
 inline void SmoothBufferAndAdd_NeonVectorized(
     float const * restrict inBuffer,
-    float * restrict outBuffer) noexcept
+    float * restrict outBuffer,
+    size_t bufferSize) noexcept
 {
     // This code is vectorized for Neon = 4 floats
     static_assert(vectorization_float_count<size_t> >= 4);
-    static_assert(is_aligned_to_float_element_count(BufferSize));
     static_assert((SmoothingSize % 2) == 1);
+    assert(is_aligned_to_float_element_count(bufferSize));
     assert(is_aligned_to_vectorization_word(inBuffer));
     assert(is_aligned_to_vectorization_word(outBuffer));
 
@@ -566,7 +677,7 @@ inline void SmoothBufferAndAdd_NeonVectorized(
         (1.0f / static_cast<float>(SmoothingSize))
         * (1.0f / static_cast<float>(SmoothingSize)));
 
-    for (size_t i = 0; i < BufferSize; i += 4)
+    for (size_t i = 0; i < bufferSize; i += 4)
     {
         // Central sample
         float32x4_t accumulatedHeight = vmulq_f32(
@@ -595,25 +706,199 @@ inline void SmoothBufferAndAdd_NeonVectorized(
                 scaling));
     }
 }
+
+template<size_t BufferSize, size_t SmoothingSize>
+inline void SmoothBufferAndAdd_NeonVectorized(
+    float const * restrict inBuffer,
+    float * restrict outBuffer) noexcept
+{
+    static_assert(is_aligned_to_float_element_count(BufferSize));
+
+    SmoothBufferAndAdd_NeonVectorized<SmoothingSize>(inBuffer, outBuffer, BufferSize);
+}
 #endif
 
 /*
  * Calculates a two-pass average on a window of width SmoothingSize,
  * centered on the sample.
  *
- * The input buffer is assumed to be extended left and right - outside of the BufferSize - with zeroes.
+ * The input buffer is assumed to be extended left and right - outside of the bufferSize - with zeroes,
+ * or with the neighboring samples when smoothing a section of a larger buffer.
  */
+template<size_t SmoothingSize>
+inline void SmoothBufferAndAdd(
+    float const * restrict inBuffer,
+    float * restrict outBuffer,
+    size_t bufferSize) noexcept
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    SmoothBufferAndAdd_SSEVectorized<SmoothingSize>(inBuffer, outBuffer, bufferSize);
+#elif FS_IS_ARM_NEON()
+    SmoothBufferAndAdd_NeonVectorized<SmoothingSize>(inBuffer, outBuffer, bufferSize);
+#else
+    SmoothBufferAndAdd_Naive<SmoothingSize>(inBuffer, outBuffer, bufferSize);
+#endif
+}
+
 template<size_t BufferSize, size_t SmoothingSize>
 inline void SmoothBufferAndAdd(
     float const * restrict inBuffer,
     float * restrict outBuffer) noexcept
 {
+    static_assert(is_aligned_to_float_element_count(BufferSize));
+
+    SmoothBufferAndAdd<SmoothingSize>(inBuffer, outBuffer, BufferSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// SWE (shallow water equations)
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void UpdateSWEHeightField_Naive(
+    float * restrict heightField,
+    float const * restrict velocityField,
+    size_t count,
+    float dtOverDx) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        heightField[i] *=
+            1.0f + dtOverDx * (velocityField[i] - velocityField[i + 1]);
+    }
+}
+
+inline void UpdateSWEVelocityField_Naive(
+    float const * restrict heightField,
+    float const * restrict velocityField,
+    float * restrict outVelocityField,
+    size_t count,
+    float previousVWeight1,
+    float previousVWeight2,
+    float gDtOverDx) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        // V @ t-1: mix of V[i] and of avg(V[i-1], V[i+1])
+        float const previousV =
+            previousVWeight1 * velocityField[i]
+            + previousVWeight2 * (velocityField[i - 1] + velocityField[i + 1]);
+
+        outVelocityField[i] = previousV - gDtOverDx * (heightField[i] - heightField[i - 1]);
+    }
+}
+
 #if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
-    SmoothBufferAndAdd_SSEVectorized<BufferSize, SmoothingSize>(inBuffer, outBuffer);
-#elif FS_IS_ARM_NEON()
-    SmoothBufferAndAdd_NeonVectorized<BufferSize, SmoothingSize>(inBuffer, outBuffer);
+inline void UpdateSWEHeightField_SSEVectorized(
+    float * restrict heightField,
+    float const * restrict velocityField,
+    size_t count,
+    float dtOverDx) noexcept
+{
+    // This code is vectorized for SSE = 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+    assert(is_aligned_to_float_element_count(count));
+    assert(is_aligned_to_vectorization_word(heightField));
+    assert(is_aligned_to_vectorization_word(velocityField));
+
+    __m128 const one = _mm_set_ps1(1.0f);
+    __m128 const dtOverDx_4 = _mm_set_ps1(dtOverDx);
+
+    for (size_t i = 0; i < count; i += 4)
+    {
+        __m128 const dv = _mm_sub_ps(
+            _mm_load_ps(velocityField + i),
+            _mm_loadu_ps(velocityField + i + 1));
+
+        _mm_store_ps(
+            heightField + i,
+            _mm_mul_ps(
+                _mm_load_ps(heightField + i),
+                _mm_add_ps(one, _mm_mul_ps(dtOverDx_4, dv))));
+    }
+}
+
+inline void UpdateSWEVelocityField_SSEVectorized(
+    float const * restrict heightField,
+    float const * restrict velocityField,
+    float * restrict outVelocityField,
+    size_t count,
+    float previousVWeight1,
+    float previousVWeight2,
+    float gDtOverDx) noexcept
+{
+    // This code is vectorized for SSE = 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+    assert(is_aligned_to_float_element_count(count));
+    assert(is_aligned_to_vectorization_word(heightField));
+    assert(is_aligned_to_vectorization_word(velocityField));
+    assert(is_aligned_to_vectorization_word(outVelocityField));
+
+    __m128 const previousVWeight1_4 = _mm_set_ps1(previousVWeight1);
+    __m128 const previousVWeight2_4 = _mm_set_ps1(previousVWeight2);
+    __m128 const gDtOverDx_4 = _mm_set_ps1(gDtOverDx);
+
+    for (size_t i = 0; i < count; i += 4)
+    {
+        // V @ t-1: mix of V[i] and of avg(V[i-1], V[i+1])
+        __m128 const previousV = _mm_add_ps(
+            _mm_mul_ps(previousVWeight1_4, _mm_load_ps(velocityField + i)),
+            _mm_mul_ps(
+                previousVWeight2_4,
+                _mm_add_ps(
+                    _mm_loadu_ps(velocityField + i - 1),
+                    _mm_loadu_ps(velocityField + i + 1))));
+
+        __m128 const dh = _mm_sub_ps(
+            _mm_load_ps(heightField + i),
+            _mm_loadu_ps(heightField + i - 1));
+
+        _mm_store_ps(
+            outVelocityField + i,
+            _mm_sub_ps(previousV, _mm_mul_ps(gDtOverDx_4, dh)));
+    }
+}
+#endif
+
+/*
+ * Advances the SWE height field by one step, over a section of the field; the height at i lies
+ * between velocities i and i + 1.
+ *
+ * Besides count needing to be a multiple of the vectorization word, the section of each
+ * buffer is expected to be aligned.
+ */
+inline void UpdateSWEHeightField(
+    float * restrict heightField,
+    float const * restrict velocityField,
+    size_t count,
+    float dtOverDx) noexcept
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    UpdateSWEHeightField_SSEVectorized(heightField, velocityField, count, dtOverDx);
+#else
+    UpdateSWEHeightField_Naive(heightField, velocityField, count, dtOverDx);
+#endif
+}
+
+/*
+ * Advances the SWE velocity field by one step, over a section of the field, out-of-place and
+ * from the already-updated height field; the velocity at i lies between heights i - 1 and i.
+ *
+ * Each velocity is a function of the velocities of the previous step only, which makes the
+ * samples independent of each other; same requirements as UpdateSWEHeightField.
+ */
+inline void UpdateSWEVelocityField(
+    float const * restrict heightField,
+    float const * restrict velocityField,
+    float * restrict outVelocityField,
+    size_t count,
+    float previousVWeight1,
+    float previousVWeight2,
+    float gDtOverDx) noexcept
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    UpdateSWEVelocityField_SSEVectorized(heightField, velocityField, outVelocityField, count, previousVWeight1, previousVWeight2, gDtOverDx);
 #else
-    SmoothBufferAndAdd_Naive<BufferSize, SmoothingSize>(inBuffer, outBuffer);
+    UpdateSWEVelocityField_Naive(heightField, velocityField, outVelocityField, count, previousVWeight1, previousVWeight2, gDtOverDx);
 #endif
 }
 
@@ -725,6 +1010,197 @@ inline void CalculateSpringVectors_SSEVectorized(
 }
 #endif
 
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+/*
+ * Loads the eight vectors at the specified indices, de-interleaving them into
+ * a register of x's and a register of y's.
+ */
+FS_AVX2_FMA_TARGET inline void LoadVec2fx8_AVX2(
+    vec2f const * restrict const buffer,
+    ElementIndex const * restrict const indices,
+    __m256 & outX,
+    __m256 & outY)
+{
+    // v0.x, v0.y, v1.x, v1.y | v4.x, v4.y, v5.x, v5.y
+    __m256 const v0v1v4v5 = _mm256_castpd_ps(
+        _mm256_insertf128_pd(
+            _mm256_castpd128_pd256(_mm_loadh_pd(_mm_load_sd(reinterpret_cast<double const *>(buffer + indices[0])), reinterpret_cast<double const *>(buffer + indices[1]))),
+            _mm_loadh_pd(_mm_load_sd(reinterpret_cast<double const *>(buffer + indices[4])), reinterpret_cast<double const *>(buffer + indices[5])),
+            1));
+
+    // v2.x, v2.y, v3.x, v3.y | v6.x, v6.y, v7.x, v7.y
+    __m256 const v2v3v6v7 = _mm256_castpd_ps(
+        _mm256_insertf128_pd(
+            _mm256_castpd128_pd256(_mm_loadh_pd(_mm_load_sd(reinterpret_cast<double const *>(buffer + indices[2])), reinterpret_cast<double const *>(buffer + indices[3]))),
+            _mm_loadh_pd(_mm_load_sd(reinterpret_cast<double const *>(buffer + indices[6])), reinterpret_cast<double const *>(buffer + indices[7])),
+            1));
+
+    // Shuffle works within 128-bit lanes, hence the lane layout above
+    outX = _mm256_shuffle_ps(v0v1v4v5, v2v3v6v7, 0x88);
+    outY = _mm256_shuffle_ps(v0v1v4v5, v2v3v6v7, 0xDD);
+}
+
+/*
+ * Interleaves eight x's and eight y's into eight consecutive vectors.
+ */
+FS_AVX2_FMA_TARGET inline void StoreVec2fx8_AVX2(
+    __m256 const & x,
+    __m256 const & y,
+    vec2f * restrict const buffer)
+{
+    __m256 const v0v1v4v5 = _mm256_unpacklo_ps(x, y);
+    __m256 const v2v3v6v7 = _mm256_unpackhi_ps(x, y);
+    _mm256_storeu_ps(reinterpret_cast<float *>(buffer), _mm256_permute2f128_ps(v0v1v4v5, v2v3v6v7, 0x20));
+    _mm256_storeu_ps(reinterpret_cast<float *>(buffer + 4), _mm256_permute2f128_ps(v0v1v4v5, v2v3v6v7, 0x31));
+}
+
+/*
+ * Calculates the total forces - Hooke's and damping - exerted by the eight springs
+ * starting at the specified index, on their A endpoints.
+ */
+template<typename TEndpoints>
+FS_AVX2_FMA_TARGET inline void CalculateSpringForcesOnA_AVX2(
+    ElementIndex springIndex,
+    vec2f const * restrict const positionBuffer,
+    vec2f const * restrict const velocityBuffer,
+    TEndpoints const * restrict const endpointsBuffer,
+    float const * restrict const restLengthBuffer,
+    float const * restrict const stiffnessCoefficientBuffer,
+    float const * restrict const dampingCoefficientBuffer,
+    vec2f * restrict const outForcesA)
+{
+    __m256 const Zero = _mm256_setzero_ps();
+
+    ElementIndex pointAIndices[8];
+    ElementIndex pointBIndices[8];
+    for (ElementIndex i = 0; i < 8; ++i)
+    {
+        pointAIndices[i] = endpointsBuffer[springIndex + i].PointAIndex;
+        pointBIndices[i] = endpointsBuffer[springIndex + i].PointBIndex;
+    }
+
+    // Displacements and spring lengths
+
+    __m256 pa_pos_x, pa_pos_y, pb_pos_x, pb_pos_y;
+    LoadVec2fx8_AVX2(positionBuffer, pointAIndices, pa_pos_x, pa_pos_y);
+    LoadVec2fx8_AVX2(positionBuffer, pointBIndices, pb_pos_x, pb_pos_y);
+
+    __m256 const dis_x = _mm256_sub_ps(pb_pos_x, pa_pos_x);
+    __m256 const dis_y = _mm256_sub_ps(pb_pos_y, pa_pos_y);
+
+    __m256 const sq_len = _mm256_fmadd_ps(dis_x, dis_x, _mm256_mul_ps(dis_y, dis_y));
+
+    __m256 const validMask = _mm256_cmp_ps(sq_len, Zero, _CMP_NEQ_UQ); // SL==0 => 1/SL==0, to maintain "normalized == (0, 0)", as in vec2f
+
+    __m256 const springLength_inv =
+        _mm256_and_ps(
+            _mm256_rsqrt_ps(sq_len),
+            validMask);
+
+    __m256 const springLength =
+        _mm256_and_ps(
+            _mm256_rcp_ps(springLength_inv),
+            validMask);
+
+    // Spring directions
+    __m256 const sdir_x = _mm256_mul_ps(dis_x, springLength_inv);
+    __m256 const sdir_y = _mm256_mul_ps(dis_y, springLength_inv);
+
+    //
+    // 1. Hooke's law:
+    //      (displacementLength[s] - restLength[s]) * stiffness[s]
+    //
+
+    __m256 const hooke_forceModuli =
+        _mm256_mul_ps(
+            _mm256_sub_ps(
+                springLength,
+                _mm256_loadu_ps(restLengthBuffer + springIndex)),
+            _mm256_loadu_ps(stiffnessCoefficientBuffer + springIndex));
+
+    //
+    // 2. Damper forces:
+    //      relVelocity.dot(springDir) * dampingCoeff[s]
+    //
+
+    __m256 pa_vel_x, pa_vel_y, pb_vel_x, pb_vel_y;
+    LoadVec2fx8_AVX2(velocityBuffer, pointAIndices, pa_vel_x, pa_vel_y);
+    LoadVec2fx8_AVX2(velocityBuffer, pointBIndices, pb_vel_x, pb_vel_y);
+
+    __m256 const rvel_x = _mm256_sub_ps(pb_vel_x, pa_vel_x);
+    __m256 const rvel_y = _mm256_sub_ps(pb_vel_y, pa_vel_y);
+
+    __m256 const damping_forceModuli =
+        _mm256_mul_ps(
+            _mm256_fmadd_ps(rvel_x, sdir_x, _mm256_mul_ps(rvel_y, sdir_y)), // Dot product
+            _mm256_loadu_ps(dampingCoefficientBuffer + springIndex));
+
+    //
+    // 3. Total force on A:
+    //      springDir * (hookeForce + dampingForce)
+    //
+
+    __m256 const tForceModuli = _mm256_add_ps(hooke_forceModuli, damping_forceModuli);
+
+    StoreVec2fx8_AVX2(
+        _mm256_mul_ps(sdir_x, tForceModuli),
+        _mm256_mul_ps(sdir_y, tForceModuli),
+        outForcesA);
+}
+
+template<typename TEndpoints>
+FS_AVX2_FMA_TARGET inline void CalculateSpringVectors_AVX2Vectorized(
+    ElementIndex springIndex,
+    vec2f const * restrict const positionBuffer,
+    TEndpoints const * restrict const endpointsBuffer,
+    float * restrict const outCachedLengthBuffer,
+    vec2f * restrict const outCachedNormalizedVectorBuffer)
+{
+    // This code calculates eight springs at a time
+    __m256 const Zero = _mm256_setzero_ps();
+
+    ElementIndex pointAIndices[8];
+    ElementIndex pointBIndices[8];
+    for (ElementIndex i = 0; i < 8; ++i)
+    {
+        pointAIndices[i] = endpointsBuffer[springIndex + i].PointAIndex;
+        pointBIndices[i] = endpointsBuffer[springIndex + i].PointBIndex;
+    }
+
+    __m256 pa_pos_x, pa_pos_y, pb_pos_x, pb_pos_y;
+    LoadVec2fx8_AVX2(positionBuffer, pointAIndices, pa_pos_x, pa_pos_y);
+    LoadVec2fx8_AVX2(positionBuffer, pointBIndices, pb_pos_x, pb_pos_y);
+
+    __m256 const displacement_x = _mm256_sub_ps(pb_pos_x, pa_pos_x);
+    __m256 const displacement_y = _mm256_sub_ps(pb_pos_y, pa_pos_y);
+
+    // Calculate spring lengths
+
+    __m256 const displacement_x2_p_y2 = _mm256_fmadd_ps(displacement_x, displacement_x, _mm256_mul_ps(displacement_y, displacement_y));
+
+    __m256 const validMask = _mm256_cmp_ps(displacement_x2_p_y2, Zero, _CMP_NEQ_UQ);
+
+    __m256 const springLength_inv =
+        _mm256_and_ps(
+            _mm256_rsqrt_ps(displacement_x2_p_y2),
+            validMask);
+
+    __m256 const springLength =
+        _mm256_and_ps(
+            _mm256_rcp_ps(springLength_inv),
+            validMask);
+
+    // Store length
+    _mm256_storeu_ps(outCachedLengthBuffer + springIndex, springLength);
+
+    // Calculate and store spring directions
+    StoreVec2fx8_AVX2(
+        _mm256_mul_ps(displacement_x, springLength_inv),
+        _mm256_mul_ps(displacement_y, springLength_inv),
+        outCachedNormalizedVectorBuffer + springIndex);
+}
+#endif
+
 #if FS_IS_ARM_NEON() // Implies ARM anyways
 template<typename TEndpoints>
 inline void CalculateSpringVectors_NeonVectorized(
@@ -815,21 +1291,37 @@ inline void CalculateSpringVectors_NeonVectorized(
 }
 #endif
 
+/*
+ * Calculates the vectors of the springs starting at the specified index, up to
+ * the end index; returns the number of springs calculated - four or eight.
+ */
+
 template<typename TEndpoints>
-inline void CalculateSpringVectors(
+inline ElementCount CalculateSpringVectors(
     ElementIndex springIndex,
+    ElementIndex endSpringIndex,
     vec2f const * restrict const positionBuffer,
     TEndpoints const * restrict const endpointsBuffer,
     float * restrict const outCachedLengthBuffer,
     vec2f * restrict const cachedNormalizedVectorBuffer)
 {
 #if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    if (springIndex + 8 <= endSpringIndex && is_avx2_fma_supported())
+    {
+        CalculateSpringVectors_AVX2Vectorized<TEndpoints>(springIndex, positionBuffer, endpointsBuffer, outCachedLengthBuffer, cachedNormalizedVectorBuffer);
+        return 8;
+    }
+
     CalculateSpringVectors_SSEVectorized<TEndpoints>(springIndex, positionBuffer, endpointsBuffer, outCachedLengthBuffer, cachedNormalizedVectorBuffer);
 #elif FS_IS_ARM_NEON()
+    (void)endSpringIndex;
     CalculateSpringVectors_NeonVectorized<TEndpoints>(springIndex, positionBuffer, endpointsBuffer, outCachedLengthBuffer, cachedNormalizedVectorBuffer);
 #else
+    (void)endSpringIndex;
     CalculateSpringVectors_Naive<TEndpoints>(springIndex, positionBuffer, endpointsBuffer, outCachedLengthBuffer, cachedNormalizedVectorBuffer);
 #endif
+
+    return 4;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1050,6 +1542,86 @@ inline void IntegrateAndResetDynamicForces_NeonVectorized(
 }
 #endif
 
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+template<typename TPoints>
+FS_AVX2_FMA_TARGET inline void IntegrateAndResetDynamicForces_AVX2Vectorized(
+    TPoints & points,
+    size_t nBuffers,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    float * const restrict * dynamicForceBuffers,
+    float dt,
+    float velocityFactor) noexcept
+{
+    // This implementation is for 8-float AVX2, and it falls back to SSE
+    // for the two points that might remain
+    static_assert(vectorization_float_count<int> >= 4);
+
+    assert(((endPointIndex - startPointIndex) % 2) == 0);
+
+    float * restrict const positionBuffer = points.GetPositionBufferAsFloat();
+    float * restrict const velocityBuffer = points.GetVelocityBufferAsFloat();
+    float const * const restrict staticForceBuffer = points.GetStaticForceBufferAsFloat();
+    float const * const restrict integrationFactorBuffer = points.GetIntegrationFactorBufferAsFloat();
+
+    float * const restrict * restrict const dynamicForceBufferOfBuffers = dynamicForceBuffers;
+
+    __m256 const zero_8 = _mm256_setzero_ps();
+    __m256 const dt_8 = _mm256_set1_ps(dt);
+    __m256 const velocityFactor_8 = _mm256_set1_ps(velocityFactor);
+
+    size_t i = startPointIndex * 2;
+    for (; i + 8 <= endPointIndex * 2; i += 8) // Two components per vector
+    {
+        __m256 springForce_4 = zero_8;
+        for (size_t b = 0; b < nBuffers; ++b)
+        {
+            springForce_4 =
+                _mm256_add_ps(
+                    springForce_4,
+                    _mm256_loadu_ps(dynamicForceBufferOfBuffers[b] + i));
+        }
+
+        // vec2f const deltaPos =
+        //    velocityBuffer[i] * dt
+        //    + (springForceBuffer[i] + externalForceBuffer[i]) * integrationFactorBuffer[i];
+        __m256 const deltaPos_4 =
+            _mm256_fmadd_ps(
+                _mm256_loadu_ps(velocityBuffer + i),
+                dt_8,
+                _mm256_mul_ps(
+                    _mm256_add_ps(
+                        springForce_4,
+                        _mm256_loadu_ps(staticForceBuffer + i)),
+                    _mm256_loadu_ps(integrationFactorBuffer + i)));
+
+        // positionBuffer[i] += deltaPos;
+        __m256 pos_4 = _mm256_loadu_ps(positionBuffer + i);
+        pos_4 = _mm256_add_ps(pos_4, deltaPos_4);
+        _mm256_storeu_ps(positionBuffer + i, pos_4);
+
+        // velocityBuffer[i] = deltaPos * velocityFactor;
+        __m256 const vel_4 =
+            _mm256_mul_ps(
+                deltaPos_4,
+                velocityFactor_8);
+        _mm256_storeu_ps(velocityBuffer + i, vel_4);
+
+        // Zero out spring forces now that we've integrated them
+        for (size_t b = 0; b < nBuffers; ++b)
+        {
+            _mm256_storeu_ps(dynamicForceBufferOfBuffers[b] + i, zero_8);
+        }
+    }
+
+    if (i < endPointIndex * 2)
+    {
+        // Two points left
+        IntegrateAndResetDynamicForces_SSEVectorized<TPoints>(points, nBuffers, static_cast<ElementIndex>(i / 2), endPointIndex, dynamicForceBuffers, dt, velocityFactor);
+    }
+}
+#endif
+
 /*
  * Integrates forces and resets dynamic forces.
  */
@@ -1065,7 +1637,10 @@ inline void IntegrateAndResetDynamicForces(
     float velocityFactor) noexcept
 {
 #if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
-    IntegrateAndResetDynamicForces_SSEVectorized<TPoints>(points, nBuffers, startPointIndex, endPointIndex, dynamicForceBuffers, dt, velocityFactor);
+    if (is_avx2_fma_supported())
+        IntegrateAndResetDynamicForces_AVX2Vectorized<TPoints>(points, nBuffers, startPointIndex, endPointIndex, dynamicForceBuffers, dt, velocityFactor);
+    else
+        IntegrateAndResetDynamicForces_SSEVectorized<TPoints>(points, nBuffers, startPointIndex, endPointIndex, dynamicForceBuffers, dt, velocityFactor);
 #elif FS_IS_ARM_NEON()
     IntegrateAndResetDynamicForces_NeonVectorized<TPoints>(points, nBuffers, startPointIndex, endPointIndex, dynamicForceBuffers, dt, velocityFactor);
 #else
@@ -2301,6 +2876,119 @@ inline void ApplySpringsForces_NeonVectorized(
 }
 #endif
 
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+template<typename TPoints, typename TSprings>
+FS_AVX2_FMA_TARGET inline void ApplySpringsForces_AVX2Vectorized(
+    TPoints const & points,
+    TSprings const & springs,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex,
+    vec2f * restrict dynamicForceBuffer)
+{
+    // This implementation is for 8-float AVX2, and it falls back to SSE
+    // for the 4-by-4's and the one-by-one's that remain
+    static_assert(vectorization_float_count<int> >= 4);
+
+    vec2f const * restrict const positionBuffer = points.GetPositionBufferAsVec2();
+    vec2f const * restrict const velocityBuffer = points.GetVelocityBufferAsVec2();
+
+    typename TSprings::Endpoints const * restrict const endpointsBuffer = springs.GetEndpointsBuffer();
+    float const * restrict const restLengthBuffer = springs.GetRestLengthBuffer();
+    float const * restrict const stiffnessCoefficientBuffer = springs.GetStiffnessCoefficientBuffer();
+    float const * restrict const dampingCoefficientBuffer = springs.GetDampingCoefficientBuffer();
+
+    aligned_to_vword vec2f tmpSpringForces[8];
+
+    ElementIndex s = startSpringIndex;
+
+    //
+    // 1. Perfect squares, two at a time
+    //
+
+    ElementCount const endSpringIndexPerfectSquare = std::min(endSpringIndex, springs.GetPerfectSquareCount() * 4);
+
+    for (; s + 8 <= endSpringIndexPerfectSquare; s += 8)
+    {
+        CalculateSpringForcesOnA_AVX2(
+            s,
+            positionBuffer,
+            velocityBuffer,
+            endpointsBuffer,
+            restLengthBuffer,
+            stiffnessCoefficientBuffer,
+            dampingCoefficientBuffer,
+            tmpSpringForces);
+
+        //
+        // Add forces, square by square (see SSE implementation for the geometry):
+        //
+        // j_sforce += s0_a_tforce + s2_a_tforce
+        // m_sforce += s1_a_tforce + s3_a_tforce
+        //
+        // l_sforce -= s0_a_tforce + s3_a_tforce
+        // k_sforce -= s1_a_tforce + s2_a_tforce
+        //
+
+        for (ElementIndex sq = 0; sq < 8; sq += 4)
+        {
+            ElementIndex const pointJIndex = endpointsBuffer[s + sq + 0].PointAIndex;
+            ElementIndex const pointKIndex = endpointsBuffer[s + sq + 1].PointBIndex;
+            ElementIndex const pointLIndex = endpointsBuffer[s + sq + 0].PointBIndex;
+            ElementIndex const pointMIndex = endpointsBuffer[s + sq + 1].PointAIndex;
+
+            assert(pointJIndex == endpointsBuffer[s + sq + 2].PointAIndex);
+            assert(pointKIndex == endpointsBuffer[s + sq + 2].PointBIndex);
+            assert(pointLIndex == endpointsBuffer[s + sq + 3].PointBIndex);
+            assert(pointMIndex == endpointsBuffer[s + sq + 3].PointAIndex);
+
+            dynamicForceBuffer[pointJIndex] += tmpSpringForces[sq + 0] + tmpSpringForces[sq + 2];
+            dynamicForceBuffer[pointMIndex] += tmpSpringForces[sq + 1] + tmpSpringForces[sq + 3];
+            dynamicForceBuffer[pointLIndex] -= tmpSpringForces[sq + 0] + tmpSpringForces[sq + 3];
+            dynamicForceBuffer[pointKIndex] -= tmpSpringForces[sq + 1] + tmpSpringForces[sq + 2];
+        }
+    }
+
+    if (s < endSpringIndexPerfectSquare)
+    {
+        // One perfect square left
+        ApplySpringsForces_SSEVectorized<TPoints, TSprings>(points, springs, s, endSpringIndexPerfectSquare, dynamicForceBuffer);
+        s = endSpringIndexPerfectSquare;
+    }
+
+    //
+    // 2. Remaining eight-by-eight's
+    //
+
+    for (; s + 8 <= endSpringIndex; s += 8)
+    {
+        CalculateSpringForcesOnA_AVX2(
+            s,
+            positionBuffer,
+            velocityBuffer,
+            endpointsBuffer,
+            restLengthBuffer,
+            stiffnessCoefficientBuffer,
+            dampingCoefficientBuffer,
+            tmpSpringForces);
+
+        for (ElementIndex i = 0; i < 8; ++i)
+        {
+            dynamicForceBuffer[endpointsBuffer[s + i].PointAIndex] += tmpSpringForces[i];
+            dynamicForceBuffer[endpointsBuffer[s + i].PointBIndex] -= tmpSpringForces[i];
+        }
+    }
+
+    //
+    // 3. Remaining four-by-four's and one-by-one's
+    //
+
+    if (s < endSpringIndex)
+    {
+        ApplySpringsForces_SSEVectorized<TPoints, TSprings>(points, springs, s, endSpringIndex, dynamicForceBuffer);
+    }
+}
+#endif
+
 /*
  * Applies spring forces to the specified points.
  */
@@ -2314,7 +3002,10 @@ inline void ApplySpringsForces(
     vec2f * restrict dynamicForceBuffer)
 {
 #if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
-    ApplySpringsForces_SSEVectorized<TPoints>(points, springs, startSpringIndex, endSpringIndex, dynamicForceBuffer);
+    if (is_avx2_fma_supported())
+        ApplySpringsForces_AVX2Vectorized<TPoints>(points, springs, startSpringIndex, endSpringIndex, dynamicForceBuffer);
+    else
+        ApplySpringsForces_SSEVectorized<TPoints>(points, springs, startSpringIndex, endSpringIndex, dynamicForceBuffer);
 #elif FS_IS_ARM_NEON()
     ApplySpringsForces_NeonVectorized<TPoints>(points, springs, startSpringIndex, endSpringIndex, dynamicForceBuffer);
 #else
@@ -19,6 +19,7 @@ public:
     using element_type = TElement;
     using coordinates_type = _IntegralCoordinates<TIntegralTag>;
     using size_type = _IntegralSize<TIntegralTag>;
+    using rect_type = _IntegralRect<TIntegralTag>;
 
 public:
 
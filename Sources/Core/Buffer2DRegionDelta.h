@@ -0,0 +1,156 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2025-07-24
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "Buffer2D.h"
+#include "GameTypes.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/*
+ * A region of a Buffer2D, stored as its difference with the same region of
+ * another - "reference" - buffer.
+ *
+ * Only the elements that differ from the reference are stored, as alternating
+ * runs of unchanged and changed elements. The region is rebuilt by taking the
+ * unchanged elements from the reference, which for the result to be the
+ * original region must hence be - at least at those elements - as it was when
+ * the delta was made.
+ */
+template <typename TBuffer>
+class Buffer2DRegionDelta final
+{
+public:
+
+    using buffer_type = TBuffer;
+    using element_type = typename buffer_type::element_type;
+    using coordinates_type = typename buffer_type::coordinates_type;
+    using size_type = typename buffer_type::size_type;
+
+    static_assert(std::is_trivially_copyable_v<element_type>);
+
+public:
+
+    static Buffer2DRegionDelta Make(
+        buffer_type const & regionBuffer,
+        buffer_type const & referenceBuffer,
+        coordinates_type const & regionOrigin) // Position of the region in the reference buffer
+    {
+        assert(regionOrigin.x >= 0 && regionOrigin.x + regionBuffer.Size.width <= referenceBuffer.Size.width);
+        assert(regionOrigin.y >= 0 && regionOrigin.y + regionBuffer.Size.height <= referenceBuffer.Size.height);
+
+        Buffer2DRegionDelta delta(regionBuffer.Size);
+
+        std::uint32_t unchangedCount = 0;
+        std::uint32_t changedCount = 0;
+
+        for (int y = 0; y < regionBuffer.Size.height; ++y)
+        {
+            element_type const * const regionRow = regionBuffer.Data.get() + static_cast<size_t>(y) * regionBuffer.Size.width;
+            element_type const * const referenceRow = referenceBuffer.Data.get() + static_cast<size_t>(regionOrigin.y + y) * referenceBuffer.Size.width + regionOrigin.x;
+
+            for (int x = 0; x < regionBuffer.Size.width; ++x)
+            {
+                // Compare bytes, consistently with Buffer2D's equality
+                if (std::memcmp(&(regionRow[x]), &(referenceRow[x]), sizeof(element_type)) == 0)
+                {
+                    if (changedCount > 0)
+                    {
+                        // Close current run
+                        delta.mRuns.push_back({ unchangedCount, changedCount });
+                        unchangedCount = 0;
+                        changedCount = 0;
+                    }
+
+                    ++unchangedCount;
+                }
+                else
+                {
+                    delta.mChangedElements.push_back(regionRow[x]);
+                    ++changedCount;
+                }
+            }
+        }
+
+        if (changedCount > 0)
+        {
+            delta.mRuns.push_back({ unchangedCount, changedCount });
+        }
+
+        // Trailing unchanged elements are implied by the size
+
+        delta.mRuns.shrink_to_fit();
+        delta.mChangedElements.shrink_to_fit();
+
+        return delta;
+    }
+
+    buffer_type MakeRegionBuffer(
+        buffer_type const & referenceBuffer,
+        coordinates_type const & regionOrigin) const // Position of the region in the reference buffer
+    {
+        // Start from the reference...
+        buffer_type regionBuffer = referenceBuffer.CloneRegion(typename buffer_type::rect_type(regionOrigin, mSize));
+
+        // ...and overwrite the changed elements
+        size_t linearIndex = 0;
+        element_type const * changedElements = mChangedElements.data();
+        for (Run const & run : mRuns)
+        {
+            linearIndex += run.UnchangedCount;
+
+            std::memcpy(
+                regionBuffer.Data.get() + linearIndex,
+                changedElements,
+                run.ChangedCount * sizeof(element_type));
+
+            linearIndex += run.ChangedCount;
+            changedElements += run.ChangedCount;
+        }
+
+        assert(linearIndex <= mSize.GetLinearSize());
+        assert(changedElements == mChangedElements.data() + mChangedElements.size());
+
+        return regionBuffer;
+    }
+
+    size_type const & GetSize() const
+    {
+        return mSize;
+    }
+
+    size_t GetChangedElementCount() const
+    {
+        return mChangedElements.size();
+    }
+
+    size_t GetByteSize() const
+    {
+        return mRuns.size() * sizeof(Run) + mChangedElements.size() * sizeof(element_type);
+    }
+
+private:
+
+    struct Run
+    {
+        std::uint32_t UnchangedCount;
+        std::uint32_t ChangedCount;
+    };
+
+    explicit Buffer2DRegionDelta(size_type const & size)
+        : mSize(size)
+        , mRuns()
+        , mChangedElements()
+    {}
+
+    size_type mSize;
+    std::vector<Run> mRuns;
+    std::vector<element_type> mChangedElements;
+};
@@ -8,10 +8,16 @@
 #include "Buffer.h"
 
 #include <cassert>
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <mutex>
 #include <vector>
 
+/*
+ * Recycles buffers - and the control blocks of the shared pointers handed out for them -
+ * so that in steady state allocating a buffer does not touch the heap.
+ */
 template <typename TElement>
 class BufferAllocator
 {
@@ -20,6 +26,8 @@ public:
     BufferAllocator(size_t bufferSize)
         : mBufferSize(bufferSize)
         , mPool()
+        , mControlBlockPool()
+        , mControlBlockSize(0)
         , mLock()
     {
     }
@@ -27,8 +35,19 @@ public:
     BufferAllocator(BufferAllocator && other) noexcept
         : mBufferSize(other.mBufferSize)
         , mPool(std::move(other.mPool))
+        , mControlBlockPool(std::move(other.mControlBlockPool))
+        , mControlBlockSize(other.mControlBlockSize)
         , mLock() // We make our own, new lock - assuming we're not moving synchronization state here
     {
+        other.mControlBlockPool.clear();
+    }
+
+    ~BufferAllocator()
+    {
+        for (void * controlBlock : mControlBlockPool)
+        {
+            ::operator delete(controlBlock);
+        }
     }
 
     std::shared_ptr<Buffer<TElement>> Allocate()
@@ -52,11 +71,87 @@ public:
             [this](auto p)
             {
                 this->Release(p);
-            });
+            },
+            ControlBlockAllocator<Buffer<TElement>>(this));
     }
 
 private:
 
+    // Allocates shared pointer control blocks out of our pool
+    template<typename T>
+    struct ControlBlockAllocator
+    {
+        using value_type = T;
+
+        BufferAllocator * Owner;
+
+        explicit ControlBlockAllocator(BufferAllocator * owner)
+            : Owner(owner)
+        {}
+
+        template<typename U>
+        ControlBlockAllocator(ControlBlockAllocator<U> const & other)
+            : Owner(other.Owner)
+        {}
+
+        T * allocate(size_t n)
+        {
+            return static_cast<T *>(Owner->AllocateControlBlock(n * sizeof(T)));
+        }
+
+        void deallocate(T * p, size_t n)
+        {
+            Owner->ReleaseControlBlock(p, n * sizeof(T));
+        }
+
+        template<typename U>
+        bool operator==(ControlBlockAllocator<U> const & other) const
+        {
+            return Owner == other.Owner;
+        }
+
+        template<typename U>
+        bool operator!=(ControlBlockAllocator<U> const & other) const
+        {
+            return Owner != other.Owner;
+        }
+    };
+
+    void * AllocateControlBlock(size_t size)
+    {
+        {
+            std::lock_guard lock{ mLock };
+
+            // All of our control blocks have the same size
+            if (mControlBlockSize == 0)
+            {
+                mControlBlockSize = size;
+            }
+
+            if (size == mControlBlockSize && !mControlBlockPool.empty())
+            {
+                void * const controlBlock = mControlBlockPool.back();
+                mControlBlockPool.pop_back();
+                return controlBlock;
+            }
+        }
+
+        return ::operator new(size);
+    }
+
+    void ReleaseControlBlock(
+        void * controlBlock,
+        size_t size)
+    {
+        if (std::lock_guard lock{ mLock }; size == mControlBlockSize)
+        {
+            mControlBlockPool.push_back(controlBlock);
+            return;
+        }
+
+        ::operator delete(controlBlock);
+    }
+
     void Release(Buffer<TElement> * buffer)
     {
         std::lock_guard lock{ mLock };
@@ -67,6 +162,9 @@ private:
     size_t const mBufferSize;
     std::vector<std::unique_ptr<Buffer<TElement>>> mPool;
 
+    std::vector<void *> mControlBlockPool;
+    size_t mControlBlockSize;
+
     // The mutex guarding concurrency-sensitive operations
     std::mutex mLock;
 };
\ No newline at end of file
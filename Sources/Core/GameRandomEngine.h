@@ -8,15 +8,27 @@
 #include "GameMath.h"
 #include "Vectors.h"
 
+#include <atomic>
 #include <random>
 
 /*
  * The random engine for the entire game.
  *
  * Not so random - always uses the same seed. On purpose! We want two instances
- * of the game to be identical to each other.
+ * of the game to be identical to each other - as long as the simulation is updated
+ * serially, as the order in which concurrent updates interact is arbitrary (see the
+ * concurrency switches in SimulationParameters).
  *
- * Singleton.
+ * One instance per thread, as parts of the simulation run concurrently; the first
+ * thread asking for an instance - the main thread - gets the canonical seed, while
+ * the others get seeds of their own.
+ *
+ * Simulation objects that may be updated on any thread - e.g. ships - own an engine
+ * with a seed of their own, and install it on the thread for the duration of their
+ * update (see ScopedThreadInstance); their draws thus do not depend on the thread
+ * they happen to be updated on.
+ *
+ * Singleton, per thread.
  */
 class GameRandomEngine
 {
@@ -24,11 +36,53 @@ public:
 
     static GameRandomEngine & GetInstance()
     {
-        static GameRandomEngine * instance = new GameRandomEngine();
+        if (ThreadInstanceOverride != nullptr)
+        {
+            return *ThreadInstanceOverride;
+        }
 
-        return *instance;
+        static std::atomic<unsigned int> threadOrdinalCounter{ 0 };
+        thread_local GameRandomEngine instance = MakeThreadInstance(threadOrdinalCounter.fetch_add(1));
+
+        return instance;
+    }
+
+    /*
+     * Makes an engine of its own for an object, e.g. a ship.
+     */
+    static GameRandomEngine MakeObjectInstance(unsigned int objectSeed)
+    {
+        std::seed_seq seed_seq({ 2u, 242u, 19730528u, objectSeed });
+        return GameRandomEngine(seed_seq);
     }
 
+    /*
+     * Makes GetInstance() return the specified engine on this thread, for as
+     * long as this object lives. Scopes may nest.
+     */
+    class ScopedThreadInstance final
+    {
+    public:
+
+        explicit ScopedThreadInstance(GameRandomEngine & instance)
+            : mPreviousInstanceOverride(ThreadInstanceOverride)
+        {
+            ThreadInstanceOverride = &instance;
+        }
+
+        ~ScopedThreadInstance()
+        {
+            ThreadInstanceOverride = mPreviousInstanceOverride;
+        }
+
+        ScopedThreadInstance(ScopedThreadInstance const &) = delete;
+        ScopedThreadInstance & operator=(ScopedThreadInstance const &) = delete;
+
+    private:
+
+        GameRandomEngine * const mPreviousInstanceOverride;
+    };
+
     /*
      * Returns a value between 0 and count - 1, included.
      */
@@ -158,14 +212,29 @@ public:
 
 private:
 
-    GameRandomEngine()
+    static GameRandomEngine MakeThreadInstance(unsigned int threadOrdinal)
+    {
+        if (threadOrdinal == 0)
+        {
+            std::seed_seq seed_seq({ 1, 242, 19730528 });
+            return GameRandomEngine(seed_seq);
+        }
+        else
+        {
+            std::seed_seq seed_seq({ 1u, 242u, 19730528u, threadOrdinal });
+            return GameRandomEngine(seed_seq);
+        }
+    }
+
+    explicit GameRandomEngine(std::seed_seq & seed_seq)
+        : mRandomEngine(seed_seq)
+        , mRandomUniformDistribution(0.0f, 1.0f)
+        , mNormalDistribution(0.0f, 1.0f)
     {
-        std::seed_seq seed_seq({ 1, 242, 19730528 });
-        mRandomEngine = std::ranlux48_base(seed_seq);
-        mRandomUniformDistribution = std::uniform_real_distribution<float>(0.0f, 1.0f);
-        mNormalDistribution = std::normal_distribution<float>(0.0f, 1.0f);
     }
 
+    static inline thread_local GameRandomEngine * ThreadInstanceOverride = nullptr;
+
     std::ranlux48_base mRandomEngine;
     std::uniform_real_distribution<float> mRandomUniformDistribution;
     std::normal_distribution<float> mNormalDistribution;
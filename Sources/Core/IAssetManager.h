@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -38,13 +39,13 @@ public:
 		std::string RelativePath;
 	};
 
-	// Texture databases
+	// Texture databases; frames may be loaded concurrently from multiple threads
 	virtual picojson::value LoadTetureDatabaseSpecification(std::string const & databaseName) const = 0;
 	virtual ImageSize GetTextureDatabaseFrameSize(std::string const & databaseName, std::string const & frameRelativePath) const = 0;
 	virtual RgbaImageData LoadTextureDatabaseFrameRGBA(std::string const & databaseName, std::string const & frameRelativePath) const = 0;
 	virtual std::vector<AssetDescriptor> EnumerateTextureDatabaseFrames(std::string const & databaseName) const = 0;
 
-	// Material textures
+	// Material textures; may be loaded concurrently from multiple threads
 	virtual std::string GetMaterialTextureRelativePath(std::string const & materialTextureName) const = 0;
 	virtual RgbImageData LoadMaterialTexture(std::string const & frameRelativePath) const = 0;
 
@@ -52,6 +53,12 @@ public:
 	virtual picojson::value LoadTetureAtlasSpecification(std::string const & textureDatabaseName) const = 0;
 	virtual RgbaImageData LoadTextureAtlasImageRGBA(std::string const & textureDatabaseName) const = 0;
 
+	// Texture atlas cache, for atlases built at runtime; the fingerprint changes whenever any file of the database changes
+	virtual std::string GetTextureDatabaseFingerprint(std::string const & databaseName) const = 0;
+	virtual std::optional<picojson::value> LoadCachedTextureAtlasSpecification(std::string const & textureDatabaseName) const = 0;
+	virtual RgbaImageData LoadCachedTextureAtlasImageRGBA(std::string const & textureDatabaseName) const = 0;
+	virtual void SaveCachedTextureAtlas(std::string const & textureDatabaseName, picojson::value const & specification, RgbaImageData const & image) const = 0;
+
 	// Shaders
 	virtual std::vector<AssetDescriptor> EnumerateShaders(std::string const & shaderSetName) const = 0;
 	virtual std::string LoadShader(std::string const & shaderSetName, std::string const & shaderRelativePath) const = 0;
@@ -0,0 +1,79 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2025-07-20
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameException.h"
+#include "ThreadPool.h"
+
+#include <exception>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * Loads batches of images - typically, reading and decoding PNG files - fanning the
+ * loads out across a thread pool.
+ *
+ * The loader is invoked with the index of each image in the batch, concurrently from
+ * the threads of the pool; it must hence be safe to invoke it from multiple threads.
+ *
+ * Images are returned in the order of their indices; if any of the loads fails, the
+ * whole batch fails with the error of the first failed image.
+ */
+class ImageBatchLoader final
+{
+public:
+
+    template<typename TImage, typename TLoader>
+    static std::vector<TImage> Load(
+        size_t count,
+        TLoader const & loader,
+        ThreadPool & threadPool)
+    {
+        std::vector<std::optional<TImage>> images(count);
+        std::vector<std::string> errors(count);
+
+        threadPool.ParallelFor(
+            0,
+            count,
+            1,
+            [&images, &errors, &loader](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    // The pool does not propagate exceptions, hence we collect them here
+                    try
+                    {
+                        images[i].emplace(loader(i));
+                    }
+                    catch (std::exception const & ex)
+                    {
+                        errors[i] = ex.what();
+                    }
+                    catch (...)
+                    {
+                        errors[i] = "Unknown error loading image";
+                    }
+                }
+            });
+
+        std::vector<TImage> result;
+        result.reserve(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!images[i].has_value())
+            {
+                throw GameException(errors[i]);
+            }
+
+            result.emplace_back(std::move(*images[i]));
+        }
+
+        return result;
+    }
+};
@@ -0,0 +1,183 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2025-07-06
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+ * A copyable wrapper of a callable - like std::function - which stores the callable
+ * in a fixed-size buffer of its own and hence never allocates.
+ *
+ * Callables that do not fit in the buffer are rejected at compile time.
+ */
+template<typename TSignature, size_t Capacity>
+class InplaceFunction;
+
+template<typename TReturn, typename... TArgs, size_t Capacity>
+class InplaceFunction<TReturn(TArgs...), Capacity> final
+{
+public:
+
+    InplaceFunction() noexcept
+        : mInvoker(nullptr)
+        , mManager(nullptr)
+    {}
+
+    InplaceFunction(std::nullptr_t) noexcept
+        : InplaceFunction()
+    {}
+
+    template<
+        typename TCallable,
+        typename = std::enable_if_t<!std::is_same_v<std::decay_t<TCallable>, InplaceFunction>>>
+    InplaceFunction(TCallable && callable)
+    {
+        using TStored = std::decay_t<TCallable>;
+
+        static_assert(sizeof(TStored) <= Capacity, "Callable does not fit in the InplaceFunction's buffer");
+        static_assert(alignof(TStored) <= alignof(std::max_align_t), "Callable is over-aligned");
+        static_assert(std::is_copy_constructible_v<TStored>, "Callable is not copyable");
+
+        new (&mStorage) TStored(std::forward<TCallable>(callable));
+        mInvoker = &Invoke<TStored>;
+        mManager = &Manage<TStored>;
+    }
+
+    InplaceFunction(InplaceFunction const & other)
+        : mInvoker(other.mInvoker)
+        , mManager(other.mManager)
+    {
+        if (mManager != nullptr)
+        {
+            mManager(Operation::CopyConstruct, &mStorage, &other.mStorage);
+        }
+    }
+
+    InplaceFunction(InplaceFunction && other) noexcept
+        : mInvoker(other.mInvoker)
+        , mManager(other.mManager)
+    {
+        if (mManager != nullptr)
+        {
+            mManager(Operation::MoveConstruct, &mStorage, &other.mStorage);
+        }
+    }
+
+    ~InplaceFunction()
+    {
+        Reset();
+    }
+
+    InplaceFunction & operator=(InplaceFunction const & other)
+    {
+        if (this != &other)
+        {
+            Reset();
+
+            if (other.mManager != nullptr)
+            {
+                other.mManager(Operation::CopyConstruct, &mStorage, &other.mStorage);
+                mInvoker = other.mInvoker;
+                mManager = other.mManager;
+            }
+        }
+
+        return *this;
+    }
+
+    InplaceFunction & operator=(InplaceFunction && other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+
+            if (other.mManager != nullptr)
+            {
+                other.mManager(Operation::MoveConstruct, &mStorage, &other.mStorage);
+                mInvoker = other.mInvoker;
+                mManager = other.mManager;
+            }
+        }
+
+        return *this;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return mInvoker != nullptr;
+    }
+
+    TReturn operator()(TArgs... args) const
+    {
+        assert(mInvoker != nullptr);
+        return mInvoker(&mStorage, std::forward<TArgs>(args)...);
+    }
+
+private:
+
+    enum class Operation
+    {
+        CopyConstruct,
+        MoveConstruct,
+        Destroy
+    };
+
+    using Invoker = TReturn(*)(void *, TArgs &&...);
+    using Manager = void(*)(Operation, void *, void const *);
+
+    template<typename TStored>
+    static TReturn Invoke(void * storage, TArgs &&... args)
+    {
+        return (*static_cast<TStored *>(storage))(std::forward<TArgs>(args)...);
+    }
+
+    template<typename TStored>
+    static void Manage(Operation operation, void * storage, void const * otherStorage)
+    {
+        switch (operation)
+        {
+            case Operation::CopyConstruct:
+            {
+                new (storage) TStored(*static_cast<TStored const *>(otherStorage));
+                break;
+            }
+
+            case Operation::MoveConstruct:
+            {
+                new (storage) TStored(std::move(*static_cast<TStored *>(const_cast<void *>(otherStorage))));
+                break;
+            }
+
+            case Operation::Destroy:
+            {
+                static_cast<TStored *>(storage)->~TStored();
+                break;
+            }
+        }
+    }
+
+    void Reset() noexcept
+    {
+        if (mManager != nullptr)
+        {
+            mManager(Operation::Destroy, &mStorage, nullptr);
+            mInvoker = nullptr;
+            mManager = nullptr;
+        }
+    }
+
+private:
+
+    // Mutable as, like std::function, we invoke non-const callables from a const call operator
+    alignas(std::max_align_t) mutable unsigned char mStorage[Capacity];
+
+    Invoker mInvoker;
+    Manager mManager;
+};
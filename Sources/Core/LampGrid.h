@@ -0,0 +1,282 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2025-07-09
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameTypes.h"
+#include "SysSpecifics.h"
+#include "Vectors.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/*
+ * A uniform grid of square cells over the area lit by a set of lamps, which bins each
+ * lamp in all the cells that its light reaches; light diffusion then only needs to
+ * evaluate, for each point, the lamps binned in the point's cell.
+ *
+ * Only lamps that emit light - i.e. with a positive distance coefficient - are binned.
+ *
+ * Each cell stores a copy of its lamps' data - in structure-of-arrays layout and padded
+ * with dark lamps to the vectorization float count - so that cells may be processed
+ * with the same vectorized loops as plain lamp buffers.
+ */
+class LampGrid final
+{
+public:
+
+    explicit LampGrid(std::uint32_t maxCellsPerDimension)
+        : mMaxCellsPerDimension(maxCellsPerDimension)
+        , mLitLampCount(0)
+        , mOrigin(vec2f::zero())
+        , mCellSize(1.0f)
+        , mCellsWidth(0)
+        , mCellsHeight(0)
+        , mCellStarts(1, 0)
+        , mLampPositionsX()
+        , mLampPositionsY()
+        , mLampPlaneIds()
+        , mLampDistanceCoeffs()
+        , mLampSpreadMaxDistances()
+        , mLitLampsBuffer()
+        , mCellCursorsBuffer()
+    {
+        assert(maxCellsPerDimension > 0);
+    }
+
+    /*
+     * Number of lamps that emit light, as of the last rebuild.
+     */
+    ElementCount GetLitLampCount() const
+    {
+        return mLitLampCount;
+    }
+
+    void Rebuild(
+        vec2f const * lampPositions,
+        PlaneId const * lampPlaneIds,
+        float const * lampDistanceCoeffs,
+        float const * lampSpreadMaxDistances,
+        ElementCount lampCount)
+    {
+        //
+        // 1. Find lit lamps and calculate the extent of their light
+        //
+
+        vec2f minPos(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        vec2f maxPos(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+        float maxSpread = 0.0f;
+
+        mLitLampsBuffer.clear();
+
+        for (ElementIndex l = 0; l < lampCount; ++l)
+        {
+            if (lampDistanceCoeffs[l] > 0.0f && lampSpreadMaxDistances[l] > 0.0f)
+            {
+                float const spread = lampSpreadMaxDistances[l];
+
+                minPos.x = std::min(minPos.x, lampPositions[l].x - spread);
+                minPos.y = std::min(minPos.y, lampPositions[l].y - spread);
+                maxPos.x = std::max(maxPos.x, lampPositions[l].x + spread);
+                maxPos.y = std::max(maxPos.y, lampPositions[l].y + spread);
+                maxSpread = std::max(maxSpread, spread);
+
+                mLitLampsBuffer.push_back(l);
+            }
+        }
+
+        mLitLampCount = static_cast<ElementCount>(mLitLampsBuffer.size());
+
+        if (mLitLampsBuffer.empty())
+        {
+            mCellsWidth = 0;
+            mCellsHeight = 0;
+            mCellStarts.assign(1, 0);
+
+            return;
+        }
+
+        // Cells of half the largest spread are a good compromise between the number of
+        // cells each lamp is binned in and the number of far lamps visited by each point
+        mOrigin = minPos;
+        mCellSize = std::max(
+            maxSpread / 2.0f,
+            std::max(maxPos.x - minPos.x, maxPos.y - minPos.y) / static_cast<float>(mMaxCellsPerDimension));
+        mCellsWidth = std::min(static_cast<std::uint32_t>((maxPos.x - minPos.x) / mCellSize) + 1, mMaxCellsPerDimension);
+        mCellsHeight = std::min(static_cast<std::uint32_t>((maxPos.y - minPos.y) / mCellSize) + 1, mMaxCellsPerDimension);
+
+        //
+        // 2. Count lamps per cell, padding each cell to the vectorization float count
+        //
+
+        mCellStarts.assign(static_cast<size_t>(mCellsWidth) * mCellsHeight + 1, 0);
+
+        for (ElementIndex const l : mLitLampsBuffer)
+        {
+            VisitLitCells(
+                lampPositions[l],
+                lampSpreadMaxDistances[l],
+                [this](size_t c)
+                {
+                    ++(mCellStarts[c + 1]);
+                });
+        }
+
+        for (size_t c = 1; c < mCellStarts.size(); ++c)
+        {
+            mCellStarts[c] = mCellStarts[c - 1] + make_aligned_float_element_count(mCellStarts[c]);
+        }
+
+        //
+        // 3. Bin lamps, with padding lamps being dark
+        //
+
+        size_t const binnedLampCount = mCellStarts.back();
+
+        mLampPositionsX.assign(binnedLampCount, 0.0f);
+        mLampPositionsY.assign(binnedLampCount, 0.0f);
+        mLampPlaneIds.assign(binnedLampCount, 0);
+        mLampDistanceCoeffs.assign(binnedLampCount, 0.0f);
+        mLampSpreadMaxDistances.assign(binnedLampCount, 0.0f);
+
+        mCellCursorsBuffer.assign(mCellStarts.cbegin(), mCellStarts.cend() - 1);
+        for (ElementIndex const l : mLitLampsBuffer)
+        {
+            VisitLitCells(
+                lampPositions[l],
+                lampSpreadMaxDistances[l],
+                [&](size_t c)
+                {
+                    ElementIndex const i = mCellCursorsBuffer[c]++;
+
+                    mLampPositionsX[i] = lampPositions[l].x;
+                    mLampPositionsY[i] = lampPositions[l].y;
+                    mLampPlaneIds[i] = lampPlaneIds[l];
+                    mLampDistanceCoeffs[i] = lampDistanceCoeffs[l];
+                    mLampSpreadMaxDistances[i] = lampSpreadMaxDistances[l];
+                });
+        }
+    }
+
+    /*
+     * Returns the range of binned lamps that may light a point at the specified position;
+     * the range's size is a multiple of the vectorization float count.
+     */
+    inline std::pair<ElementIndex, ElementIndex> GetCellLamps(vec2f const & position) const
+    {
+        float const cellX = std::floor((position.x - mOrigin.x) / mCellSize);
+        float const cellY = std::floor((position.y - mOrigin.y) / mCellSize);
+
+        if (cellX < 0.0f || cellX >= static_cast<float>(mCellsWidth)
+            || cellY < 0.0f || cellY >= static_cast<float>(mCellsHeight))
+        {
+            // Not lit by any lamp
+            return { 0, 0 };
+        }
+
+        size_t const c = static_cast<size_t>(cellY) * mCellsWidth + static_cast<size_t>(cellX);
+        return { mCellStarts[c], mCellStarts[c + 1] };
+    }
+
+    float const * GetLampPositionsX() const
+    {
+        return mLampPositionsX.data();
+    }
+
+    float const * GetLampPositionsY() const
+    {
+        return mLampPositionsY.data();
+    }
+
+    PlaneId const * GetLampPlaneIds() const
+    {
+        return mLampPlaneIds.data();
+    }
+
+    float const * GetLampDistanceCoeffs() const
+    {
+        return mLampDistanceCoeffs.data();
+    }
+
+    float const * GetLampSpreadMaxDistances() const
+    {
+        return mLampSpreadMaxDistances.data();
+    }
+
+private:
+
+    /*
+     * Visits the cells that intersect the circle lit by a lamp.
+     */
+    template<typename TVisitor>
+    inline void VisitLitCells(
+        vec2f const & lampPosition,
+        float lampSpreadMaxDistance,
+        TVisitor && visitor) const
+    {
+        // Inflate radius a tiny bit, to be robust against rounding in the calculation of point cells
+        float const radius = lampSpreadMaxDistance + mCellSize * 0.001f;
+        float const squareRadius = radius * radius;
+
+        int const minCellX = ClampCellCoordinate((lampPosition.x - radius - mOrigin.x) / mCellSize, mCellsWidth);
+        int const maxCellX = ClampCellCoordinate((lampPosition.x + radius - mOrigin.x) / mCellSize, mCellsWidth);
+        int const minCellY = ClampCellCoordinate((lampPosition.y - radius - mOrigin.y) / mCellSize, mCellsHeight);
+        int const maxCellY = ClampCellCoordinate((lampPosition.y + radius - mOrigin.y) / mCellSize, mCellsHeight);
+
+        for (int y = minCellY; y <= maxCellY; ++y)
+        {
+            float const cellBottom = mOrigin.y + static_cast<float>(y) * mCellSize;
+            float const dy = lampPosition.y - std::clamp(lampPosition.y, cellBottom, cellBottom + mCellSize);
+
+            for (int x = minCellX; x <= maxCellX; ++x)
+            {
+                float const cellLeft = mOrigin.x + static_cast<float>(x) * mCellSize;
+                float const dx = lampPosition.x - std::clamp(lampPosition.x, cellLeft, cellLeft + mCellSize);
+
+                if (dx * dx + dy * dy <= squareRadius)
+                {
+                    visitor(static_cast<size_t>(y) * mCellsWidth + static_cast<size_t>(x));
+                }
+            }
+        }
+    }
+
+    static inline int ClampCellCoordinate(
+        float cellCoordinate,
+        std::uint32_t cellCount)
+    {
+        return static_cast<int>(std::clamp(std::floor(cellCoordinate), 0.0f, static_cast<float>(cellCount - 1)));
+    }
+
+private:
+
+    std::uint32_t const mMaxCellsPerDimension;
+
+    ElementCount mLitLampCount;
+
+    vec2f mOrigin; // Bottom-left
+    float mCellSize;
+    std::uint32_t mCellsWidth;
+    std::uint32_t mCellsHeight;
+
+    // Index of the first binned lamp of each cell, plus one sentinel at the end
+    std::vector<ElementIndex> mCellStarts;
+
+    // Binned lamps
+    std::vector<float> mLampPositionsX;
+    std::vector<float> mLampPositionsY;
+    std::vector<PlaneId> mLampPlaneIds;
+    std::vector<float> mLampDistanceCoeffs;
+    std::vector<float> mLampSpreadMaxDistances;
+
+    // Scratch buffers, reused across rebuilds
+    std::vector<ElementIndex> mLitLampsBuffer;
+    std::vector<ElementIndex> mCellCursorsBuffer;
+};
@@ -80,10 +80,11 @@ struct PerfStats
 
         inline void Update(GameChronometer::duration duration)
         {
+            // Measurements may be updated concurrently (e.g. by ships updating in parallel)
             auto ratio = mRatio.load();
-            ratio.Duration += duration;
-            ratio.Denominator += 1;
-            mRatio.store(ratio);
+            while (!mRatio.compare_exchange_weak(ratio, _Ratio(ratio.Duration + duration, ratio.Denominator + 1)))
+            {
+            }
         }
 
         template<typename TDuration>
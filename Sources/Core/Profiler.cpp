@@ -0,0 +1,138 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2025-06-15
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "Profiler.h"
+
+#include "Log.h"
+#include "Utils.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace /* anonymous */ {
+
+    // Name given to this thread, kept until the thread registers its buffer
+    thread_local std::string ThisThreadName;
+
+}
+
+Profiler::Profiler()
+    : mIsRunning(false)
+    , mStartTimestamp(GameChronometer::Now())
+    , mThreadBuffersLock()
+    , mThreadBuffers()
+{
+}
+
+void Profiler::Start()
+{
+    std::scoped_lock const lock(mThreadBuffersLock);
+
+    // Forget about everything recorded so far
+    for (auto & threadBuffer : mThreadBuffers)
+    {
+        threadBuffer->StartWriteCount = threadBuffer->WriteCount.load(std::memory_order_acquire);
+    }
+
+    mStartTimestamp = GameChronometer::Now();
+
+    mIsRunning.store(true);
+
+    LogMessage("Profiler: started");
+}
+
+void Profiler::Stop()
+{
+    mIsRunning.store(false);
+
+    LogMessage("Profiler: stopped");
+}
+
+void Profiler::SetThisThreadName(std::string const & threadName)
+{
+    // We don't register the thread now, as it might never record zones
+    ThisThreadName = threadName;
+}
+
+std::string Profiler::MakeChromeTrace() const
+{
+    std::scoped_lock const lock(mThreadBuffersLock);
+
+    picojson::array traceEvents;
+
+    for (auto const & threadBuffer : mThreadBuffers)
+    {
+        auto const tid = picojson::value(static_cast<int64_t>(threadBuffer->ThreadIndex));
+
+        // Thread name
+        {
+            picojson::object args;
+            args.emplace("name", picojson::value(threadBuffer->ThreadName.empty() ? ("Thread " + std::to_string(threadBuffer->ThreadIndex)) : threadBuffer->ThreadName));
+
+            picojson::object traceEvent;
+            traceEvent.emplace("name", picojson::value("thread_name"));
+            traceEvent.emplace("ph", picojson::value("M"));
+            traceEvent.emplace("pid", picojson::value(int64_t(0)));
+            traceEvent.emplace("tid", tid);
+            traceEvent.emplace("args", picojson::value(args));
+
+            traceEvents.emplace_back(traceEvent);
+        }
+
+        // Zones - only the most recent ones, if the ring has wrapped around
+
+        size_t const writeCount = threadBuffer->WriteCount.load(std::memory_order_acquire);
+        size_t const startCount = std::max(
+            threadBuffer->StartWriteCount,
+            writeCount > ThreadBufferCapacity ? writeCount - ThreadBufferCapacity : size_t(0));
+
+        for (size_t r = startCount; r < writeCount; ++r)
+        {
+            ZoneRecord const & zoneRecord = threadBuffer->Records[r % ThreadBufferCapacity];
+
+            double const ts = std::chrono::duration<double, std::micro>(zoneRecord.StartTimestamp - mStartTimestamp).count();
+            double const dur = std::chrono::duration<double, std::micro>(zoneRecord.EndTimestamp - zoneRecord.StartTimestamp).count();
+
+            picojson::object traceEvent;
+            traceEvent.emplace("name", picojson::value(zoneRecord.Name));
+            traceEvent.emplace("ph", picojson::value("X"));
+            traceEvent.emplace("ts", picojson::value(ts));
+            traceEvent.emplace("dur", picojson::value(dur));
+            traceEvent.emplace("pid", picojson::value(int64_t(0)));
+            traceEvent.emplace("tid", tid);
+
+            traceEvents.emplace_back(traceEvent);
+        }
+    }
+
+    picojson::object root;
+    root.emplace("traceEvents", picojson::value(traceEvents));
+    root.emplace("displayTimeUnit", picojson::value("ms"));
+
+    return Utils::MakeStringFromJSON(picojson::value(root));
+}
+
+Profiler::ThreadBuffer & Profiler::GetThisThreadBuffer()
+{
+    thread_local ThreadBuffer * thisThreadBuffer = nullptr;
+
+    if (thisThreadBuffer == nullptr)
+    {
+        thisThreadBuffer = &RegisterThisThread();
+    }
+
+    return *thisThreadBuffer;
+}
+
+Profiler::ThreadBuffer & Profiler::RegisterThisThread()
+{
+    std::scoped_lock const lock(mThreadBuffersLock);
+
+    // Buffers are never freed, as thread-local pointers may outlive
+    // re-created thread pools
+    mThreadBuffers.emplace_back(new ThreadBuffer(mThreadBuffers.size(), ThisThreadName));
+
+    return *mThreadBuffers.back();
+}
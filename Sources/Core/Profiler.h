@@ -0,0 +1,164 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2025-06-15
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameChronometer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+ * A scoped-zone profiler that may be started and stopped at runtime.
+ *
+ * Each thread records the zones it completes into its own ring buffer, without taking
+ * any locks; zones nest naturally as they are scoped. The recorded zones may be exported
+ * as a Chrome trace-event JSON file (chrome://tracing, Perfetto).
+ *
+ * When not running, a zone costs one relaxed atomic load.
+ *
+ * Singleton.
+ */
+class Profiler final
+{
+public:
+
+    /*
+     * Records the zone spanning the lifetime of this object, if the profiler
+     * is running at the moment of construction.
+     */
+    class Zone final
+    {
+    public:
+
+        explicit Zone(char const * name)
+            : mName(Profiler::GetInstance().IsRunning() ? name : nullptr)
+            , mStartTimestamp(mName != nullptr ? GameChronometer::Now() : GameChronometer::time_point())
+        {}
+
+        ~Zone()
+        {
+            if (mName != nullptr)
+            {
+                Profiler::GetInstance().RecordZone(mName, mStartTimestamp, GameChronometer::Now());
+            }
+        }
+
+        Zone(Zone const &) = delete;
+        Zone & operator=(Zone const &) = delete;
+
+    private:
+
+        char const * const mName; // Only set if we're recording
+        GameChronometer::time_point const mStartTimestamp;
+    };
+
+public:
+
+    static inline Profiler & GetInstance()
+    {
+        static Profiler * instance = new Profiler();
+
+        return *instance;
+    }
+
+    inline bool IsRunning() const
+    {
+        return mIsRunning.load(std::memory_order_relaxed);
+    }
+
+    /*
+     * Discards all zones recorded so far and starts recording.
+     */
+    void Start();
+
+    void Stop();
+
+    /*
+     * Gives a name to the calling thread, which will show up in the trace;
+     * must be invoked before the thread records its first zone.
+     */
+    void SetThisThreadName(std::string const & threadName);
+
+    /*
+     * Not meant to be invoked while the profiler is running.
+     */
+    std::string MakeChromeTrace() const;
+
+private:
+
+    // Per-thread capacity; when exceeded, the oldest zones are overwritten
+    static size_t constexpr ThreadBufferCapacity = 1 << 16;
+
+    struct ZoneRecord
+    {
+        char const * Name;
+        GameChronometer::time_point StartTimestamp;
+        GameChronometer::time_point EndTimestamp;
+    };
+
+    struct ThreadBuffer
+    {
+        size_t const ThreadIndex;
+        std::string const ThreadName;
+
+        std::unique_ptr<ZoneRecord[]> Records;
+
+        // Total number of records ever written; only written by owning thread
+        std::atomic<size_t> WriteCount;
+
+        // Value of WriteCount when the profiler was last started; written under the buffers' lock
+        size_t StartWriteCount;
+
+        ThreadBuffer(
+            size_t threadIndex,
+            std::string const & threadName)
+            : ThreadIndex(threadIndex)
+            , ThreadName(threadName)
+            , Records(new ZoneRecord[ThreadBufferCapacity])
+            , WriteCount(0)
+            , StartWriteCount(0)
+        {}
+    };
+
+    Profiler();
+
+    inline void RecordZone(
+        char const * name,
+        GameChronometer::time_point startTimestamp,
+        GameChronometer::time_point endTimestamp)
+    {
+        ThreadBuffer & threadBuffer = GetThisThreadBuffer();
+
+        size_t const writeCount = threadBuffer.WriteCount.load(std::memory_order_relaxed);
+        threadBuffer.Records[writeCount % ThreadBufferCapacity] = ZoneRecord{ name, startTimestamp, endTimestamp };
+        threadBuffer.WriteCount.store(writeCount + 1, std::memory_order_release);
+    }
+
+    ThreadBuffer & GetThisThreadBuffer();
+
+    ThreadBuffer & RegisterThisThread();
+
+private:
+
+    std::atomic<bool> mIsRunning;
+    GameChronometer::time_point mStartTimestamp;
+
+    // Only taken when a thread registers itself, and when exporting
+    mutable std::mutex mThreadBuffersLock;
+    std::vector<std::unique_ptr<ThreadBuffer>> mThreadBuffers;
+};
+
+#define FS_PROFILE_ZONE_CONCAT_INNER(a, b) a##b
+#define FS_PROFILE_ZONE_CONCAT(a, b) FS_PROFILE_ZONE_CONCAT_INNER(a, b)
+
+/*
+ * Profiles the enclosing scope; the name must be a string literal.
+ */
+#define FS_PROFILE_ZONE(name) Profiler::Zone const FS_PROFILE_ZONE_CONCAT(_profilerZone, __LINE__)(name)
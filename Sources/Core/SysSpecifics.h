@@ -180,10 +180,63 @@ inline constexpr T ceil_square_power_of_two(T value)
 #include <pmmintrin.h>
 */
 #include <pmmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 #elif (FS_IS_ARCHITECTURE_ARM_32() || FS_IS_ARCHITECTURE_ARM_64()) && FS_IS_ARM_NEON()
 #include <arm_neon.h>
 #endif
 
+#if FS_IS_ARCHITECTURE_X86_64() || FS_IS_ARCHITECTURE_X86_32()
+
+// Marks a function as being compiled for AVX2 and FMA, regardless of the
+// instruction set targeted by the rest of the binary; such functions may
+// only be invoked after having checked is_avx2_fma_supported()
+#ifdef _MSC_VER
+#define FS_AVX2_FMA_TARGET
+#else
+#define FS_AVX2_FMA_TARGET __attribute__((target("avx2,fma")))
+#endif
+
+/*
+ * Checks - once - whether the CPU we're running on, and the OS, support AVX2 and FMA.
+ */
+inline bool is_avx2_fma_supported() noexcept
+{
+    static bool const isSupported = []() -> bool
+    {
+#ifdef _MSC_VER
+        int cpuInfo[4];
+
+        __cpuid(cpuInfo, 0);
+        if (cpuInfo[0] < 7)
+            return false;
+
+        __cpuid(cpuInfo, 1);
+        bool const hasFma = (cpuInfo[2] & (1 << 12)) != 0;
+        bool const hasOsXSave = (cpuInfo[2] & (1 << 27)) != 0;
+        bool const hasAvx = (cpuInfo[2] & (1 << 28)) != 0;
+        if (!hasFma || !hasOsXSave || !hasAvx)
+            return false;
+
+        // Make sure the OS saves the YMM registers
+        if ((_xgetbv(0) & 0x6) != 0x6)
+            return false;
+
+        __cpuidex(cpuInfo, 7, 0);
+        return (cpuInfo[1] & (1 << 5)) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+    }();
+
+    return isSupported;
+}
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////
 // Alignment
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #include "TextureAtlas.h"
 
+#include "ImageBatchLoader.h"
 #include "ImageFileMap.h"
 #include "ImageTools.h"
 #include "Log.h"
@@ -13,6 +14,8 @@
 
 #include <cmath>
 #include <cstring>
+#include <optional>
+#include <string>
 
 template <typename TTextureDatabase>
 TextureAtlasMetadata<TTextureDatabase>::TextureAtlasMetadata(
@@ -224,6 +227,146 @@ TextureAtlas<TTextureDatabase> TextureAtlas<TTextureDatabase>::Deserialize(IAsse
 // Builder
 ////////////////////////////////////////////////////////////////////////////////
 
+template<typename TTextureDatabase>
+TextureAtlas<TTextureDatabase> TextureAtlasBuilder<TTextureDatabase>::BuildAtlas(
+    TextureDatabase<TTextureDatabase> const & database,
+    TextureAtlasOptions options,
+    float resizeFactor,
+    IAssetManager const & assetManager,
+    ThreadPool & threadPool,
+    SimpleProgressCallback const & progressCallback)
+{
+    //
+    // Load all frames, concurrently
+    //
+
+    std::vector<TextureFrameId<TTextureGroups>> frameIds;
+    std::vector<size_t> groupFirstFrameIndices; // Indexed by group
+    for (auto const & group : database.GetGroups())
+    {
+        assert(static_cast<size_t>(group.Group) == groupFirstFrameIndices.size());
+        groupFirstFrameIndices.push_back(frameIds.size());
+
+        for (TextureFrameIndex f = 0; f < group.GetFrameCount(); ++f)
+        {
+            frameIds.emplace_back(group.Group, f);
+        }
+    }
+
+    auto const frames = ImageBatchLoader::Load<TextureFrame<TTextureDatabase>>(
+        frameIds.size(),
+        [&](size_t f) -> TextureFrame<TTextureDatabase>
+        {
+            auto const & frameId = frameIds[f];
+            if (resizeFactor != 1.0f)
+                return database.GetGroup(frameId.Group).LoadFrame(frameId.FrameIndex, assetManager).Resize(resizeFactor);
+            else
+                return database.GetGroup(frameId.Group).LoadFrame(frameId.FrameIndex, assetManager);
+        },
+        threadPool);
+
+    auto frameLoader = [&](TextureFrameId<TTextureGroups> const & frameId) -> TextureFrame<TTextureDatabase>
+        {
+            return frames[groupFirstFrameIndices[static_cast<size_t>(frameId.Group)] + frameId.FrameIndex].Clone();
+        };
+
+    // Build TextureInfo's
+    std::vector<TextureInfo> textureInfos;
+    for (auto const & group : database.GetGroups())
+    {
+        AddTextureInfos(group, options, resizeFactor, textureInfos);
+    }
+
+    // Build specification
+    auto const specification = BuildAtlasSpecification(
+        textureInfos,
+        options,
+        frameLoader);
+
+    // Build atlas
+    return InternalBuildAtlas(
+        specification,
+        options,
+        frameLoader,
+        progressCallback);
+}
+
+template<typename TTextureDatabase>
+TextureAtlas<TTextureDatabase> TextureAtlasBuilder<TTextureDatabase>::BuildCachedAtlas(
+    TextureAtlasOptions options,
+    float resizeFactor,
+    IAssetManager const & assetManager,
+    ThreadPool & threadPool,
+    SimpleProgressCallback const & progressCallback)
+{
+    // Everything the atlas depends on
+    std::string const cacheKey =
+        assetManager.GetTextureDatabaseFingerprint(TTextureDatabase::DatabaseName)
+        + "|" + std::to_string(static_cast<int>(options))
+        + "|" + std::to_string(resizeFactor)
+        + "|" + std::to_string(CachedAtlasVersion);
+
+    //
+    // Try cache
+    //
+
+    try
+    {
+        std::optional<picojson::value> const cachedSpecificationJsonValue = assetManager.LoadCachedTextureAtlasSpecification(TTextureDatabase::DatabaseName);
+        if (cachedSpecificationJsonValue.has_value()
+            && cachedSpecificationJsonValue->is<picojson::object>())
+        {
+            picojson::object const & cachedSpecificationJson = cachedSpecificationJsonValue->get<picojson::object>();
+
+            auto const cacheKeyIt = cachedSpecificationJson.find("cache_key");
+            if (cacheKeyIt != cachedSpecificationJson.cend()
+                && cacheKeyIt->second.is<std::string>()
+                && cacheKeyIt->second.get<std::string>() == cacheKey)
+            {
+                LogMessage("TextureAtlasBuilder: using cached atlas for \"", TTextureDatabase::DatabaseName, "\"");
+
+                return TextureAtlas<TTextureDatabase>(
+                    TextureAtlasMetadata<TTextureDatabase>::Deserialize(cachedSpecificationJson),
+                    assetManager.LoadCachedTextureAtlasImageRGBA(TTextureDatabase::DatabaseName));
+            }
+        }
+    }
+    catch (std::exception const & ex)
+    {
+        LogMessage("WARNING: cannot load cached atlas for \"", TTextureDatabase::DatabaseName, "\": ", ex.what());
+    }
+
+    //
+    // Build atlas
+    //
+
+    auto textureAtlas = BuildAtlas(
+        TextureDatabase<TTextureDatabase>::Load(assetManager),
+        options,
+        resizeFactor,
+        assetManager,
+        threadPool,
+        progressCallback);
+
+    //
+    // Cache it
+    //
+
+    try
+    {
+        auto [specificationJson, atlasImage] = textureAtlas.Serialize();
+        specificationJson.template get<picojson::object>()["cache_key"] = picojson::value(cacheKey);
+
+        assetManager.SaveCachedTextureAtlas(TTextureDatabase::DatabaseName, specificationJson, atlasImage);
+    }
+    catch (std::exception const & ex)
+    {
+        LogMessage("WARNING: cannot cache atlas for \"", TTextureDatabase::DatabaseName, "\": ", ex.what());
+    }
+
+    return textureAtlas;
+}
+
 template<typename TTextureDatabase>
 typename TextureAtlasBuilder<TTextureDatabase>::AtlasSpecification TextureAtlasBuilder<TTextureDatabase>::BuildAtlasSpecification(
     std::vector<TextureInfo> const & inputTextureInfos,
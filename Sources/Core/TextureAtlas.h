@@ -11,6 +11,7 @@
 #include "ImageData.h"
 #include "ProgressCallback.h"
 #include "TextureDatabase.h"
+#include "ThreadPool.h"
 #include "Vectors.h"
 
 #include <picojson.h>
@@ -19,6 +20,7 @@
 #include <cassert>
 #include <memory>
 #include <numeric>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -254,6 +256,18 @@ public:
             progressCallback);
     }
 
+    /*
+     * Like the above, but loads - and resizes - the database's frames concurrently
+     * on the thread pool, before packing them.
+     */
+    static TextureAtlas<TTextureDatabase> BuildAtlas(
+        TextureDatabase<TTextureDatabase> const & database,
+        TextureAtlasOptions options,
+        float resizeFactor,
+        IAssetManager const & assetManager,
+        ThreadPool & threadPool,
+        SimpleProgressCallback const & progressCallback);
+
     /*
      * Builds an atlas with the specified textures.
      */
@@ -340,8 +354,25 @@ public:
             progressCallback);
     }
 
+    /*
+     * Like BuildAtlas() with the entire content of the database, but first looks in the asset
+     * manager's atlas cache for an atlas built with the same options out of the same database
+     * files; atlases that are built get cached.
+     *
+     * Failures of the cache are not fatal - we just build the atlas.
+     */
+    static TextureAtlas<TTextureDatabase> BuildCachedAtlas(
+        TextureAtlasOptions options,
+        float resizeFactor,
+        IAssetManager const & assetManager,
+        ThreadPool & threadPool,
+        SimpleProgressCallback const & progressCallback);
+
 private:
 
+    // Bump whenever the atlas building algorithm changes, to invalidate cached atlases
+    static int constexpr CachedAtlasVersion = 1;
+
     struct TextureInfo
     {
         TextureFrameId<TTextureGroups> FrameId;
@@ -7,6 +7,7 @@
 
 #include "FloatingPoint.h"
 #include "Log.h"
+#include "Profiler.h"
 #include "SysSpecifics.h"
 
 #include <cassert>
@@ -59,6 +60,12 @@ void ThreadManager::InitializeThisThread(
     EnableFloatingPointExceptions();
 #endif
 
+    //
+    // Initialize profiling
+    //
+
+    Profiler::GetInstance().SetThisThreadName(threadName);
+
     mPlatformSpecificThreadInitializationFunctor(threadTaskKind, threadName, threadTaskIndex);
 }
 
@@ -10,23 +10,39 @@
 
 #include <algorithm>
 
+namespace /* anonymous */ {
+
+    // The pool the current thread belongs to, if any, and the index of its queue
+    thread_local ThreadPool const * ThisThreadPool = nullptr;
+    thread_local size_t ThisThreadQueueIndex = 0;
+
+    // Number of rounds a worker keeps looking for jobs before going to sleep
+    size_t constexpr WorkerSpinRounds = 64;
+}
+
 ThreadPool::ThreadPool(
     ThreadManager::ThreadTaskKind threadTaskKind,
     size_t parallelism,
     ThreadManager & threadManager)
     : mThreadTaskKind(threadTaskKind)
+    , mJobQueues()
     , mLock()
     , mThreads()
     , mWorkerThreadSignal()
-    , mTasksToRun(nullptr)
-    , mTasksToComplete(0)
-    , mCompletedTasks(0)
+    , mQueuedJobCount(0)
+    , mSleepingThreadCount(0)
     , mIsStop(false)
 {
     LogMessage("ThreadPool: creating thread pool with parallelism=", parallelism);
 
     assert(parallelism > 0);
 
+    // One queue per thread, main thread included
+    for (size_t i = 0; i < parallelism; ++i)
+    {
+        mJobQueues.emplace_back(std::make_unique<JobQueue>());
+    }
+
     // Start N-1 threads (main thread is one of them)
     for (size_t i = 0; i < parallelism - 1; ++i)
     {
@@ -60,7 +76,6 @@ ThreadPool::~ThreadPool()
 void ThreadPool::Run(std::vector<Task> const & tasks)
 {
     assert(!tasks.empty());
-    assert(mTasksToComplete <= 0);
 
     // Shortcut to avoid paying synchronization penalties
     // in trivial cases
@@ -74,51 +89,145 @@ void ThreadPool::Run(std::vector<Task> const & tasks)
         return;
     }
 
-    // Queue all the tasks
+    size_t const queueIndex = GetThisThreadQueueIndex();
+
+    Batch batch(tasks.size());
+
+    // Queue all tasks but the last one, which is for this thread
     {
-        std::unique_lock const lock{ mLock };
+        JobQueue & queue = *mJobQueues[queueIndex];
 
-        mTasksToRun = &tasks;
-        mTasksToComplete.store(static_cast<int>(tasks.size()) - 1); // Take already the main thread one into account
-        mCompletedTasks.store(1); // Take already the main thread one into account
+        std::unique_lock const lock{ queue.Lock };
+
+        for (size_t t = 0; t < tasks.size() - 1; ++t)
+        {
+            queue.PushBack(Job{ JobKind::SingleTask, &batch, &(tasks[t]), 0, 0 });
+        }
     }
 
-    // Signal threads that tasks are available
-    mWorkerThreadSignal.notify_all();
+    WakeUpWorkers(tasks.size() - 1);
 
-    // Run the Nth task on the main thread
+    // Run the Nth task on this thread
     RunTask(tasks.back());
+    batch.PendingJobCount.fetch_sub(1, std::memory_order_acq_rel);
+
+    // Help with the remaining tasks, until all are completed
+    WaitForBatch(batch, queueIndex);
+}
+
+void ThreadPool::ParallelFor(
+    size_t begin,
+    size_t end,
+    size_t minChunkSize,
+    RangeTask const & rangeTask)
+{
+    assert(begin <= end);
+
+    minChunkSize = std::max(minChunkSize, size_t(1));
+
+    if (mThreads.empty() || end - begin <= minChunkSize)
+    {
+        if (begin < end)
+        {
+            RunRangeTask(rangeTask, begin, end);
+        }
+
+        return;
+    }
+
+    size_t const queueIndex = GetThisThreadQueueIndex();
+
+    Batch batch(1);
+    batch.TheRangeTask = &rangeTask;
+    batch.MinChunkSize = minChunkSize;
+
+    // Start splitting on this thread
+    RunJob(Job{ JobKind::Range, &batch, nullptr, begin, end }, queueIndex);
+
+    WaitForBatch(batch, queueIndex);
+}
+
+void ThreadPool::Run(TaskGraph & taskGraph)
+{
+    size_t const taskCount = taskGraph.mTaskCount;
+    if (taskCount == 0)
+    {
+        return;
+    }
+
+    if (mThreads.empty())
+    {
+        // Tasks are stored in a topological order already
+        for (size_t t = 0; t < taskCount; ++t)
+        {
+            RunTask(taskGraph.mNodes[t].TheTask);
+        }
+
+        return;
+    }
+
+    //
+    // Initialize dependency counts
+    //
+
+    if (taskGraph.mRemainingDependencyCountsCapacity < taskCount)
+    {
+        taskGraph.mRemainingDependencyCounts.reset(new std::atomic<size_t>[taskCount]);
+        taskGraph.mRemainingDependencyCountsCapacity = taskCount;
+    }
+
+    for (size_t t = 0; t < taskCount; ++t)
+    {
+        taskGraph.mRemainingDependencyCounts[t].store(taskGraph.mNodes[t].DependencyCount, std::memory_order_relaxed);
+    }
+
+    //
+    // Queue tasks without dependencies
+    //
 
-    // Run the remaining tasks on main thread, if needed
-    RunRemainingTasksLoop();
+    size_t const queueIndex = GetThisThreadQueueIndex();
 
-    // Only returns when there are no more tasks
-    assert(mTasksToComplete.load() <= 0);
+    Batch batch(taskCount);
+    batch.TheTaskGraph = &taskGraph;
+
+    size_t rootCount = 0;
 
-    // Wait until all tasks are completed
     {
-        // ...in a spinlock
-        while (true)
+        JobQueue & queue = *mJobQueues[queueIndex];
+
+        std::unique_lock const lock{ queue.Lock };
+
+        // Reverse, so that this thread starts from the first one
+        for (size_t t = taskCount; t-- > 0; )
         {
-            assert(mCompletedTasks.load() >= 0 && mCompletedTasks.load() <= tasks.size());
-            if (mCompletedTasks.load() == tasks.size())
+            if (taskGraph.mNodes[t].DependencyCount == 0)
             {
-                break;
+                queue.PushBack(Job{ JobKind::GraphNode, &batch, nullptr, t, 0 });
+                ++rootCount;
             }
         }
     }
+
+    assert(rootCount > 0);
+
+    WakeUpWorkers(rootCount);
+
+    WaitForBatch(batch, queueIndex);
 }
 
 void ThreadPool::ThreadLoop(
     std::string threadName,
-    size_t threadTaskIndex,
+    size_t threadQueueIndex,
     ThreadManager & threadManager)
 {
     //
     // Initialize thread
     //
 
-    threadManager.InitializeThisThread(mThreadTaskKind, threadName, threadTaskIndex);
+    threadManager.InitializeThisThread(mThreadTaskKind, threadName, threadQueueIndex);
+
+    ThisThreadPool = this;
+    ThisThreadQueueIndex = threadQueueIndex;
 
     //
     // Run thread loop until thread pool is destroyed
@@ -126,6 +235,31 @@ void ThreadPool::ThreadLoop(
 
     while (true)
     {
+        //
+        // Look for jobs for a while...
+        //
+
+        bool hasRunJob = false;
+        for (size_t r = 0; r < WorkerSpinRounds; ++r)
+        {
+            if (TryRunOneJob(threadQueueIndex))
+            {
+                hasRunJob = true;
+                break;
+            }
+
+            std::this_thread::yield();
+        }
+
+        if (hasRunJob)
+        {
+            continue;
+        }
+
+        //
+        // ...and then go to sleep
+        //
+
         {
             std::unique_lock lock{ mLock };
 
@@ -135,62 +269,187 @@ void ThreadPool::ThreadLoop(
                 break;
             }
 
-            // Wait for signal that tasks have been queued (or that we've been stopped)
+            mSleepingThreadCount.fetch_add(1);
+
+            // Wait for signal that jobs have been queued (or that we've been stopped)
             mWorkerThreadSignal.wait(
                 lock,
                 [this]()
                 {
                     // Condition to leave the wait
-                    // Note: other threads may empty mTasksToComplete - that's fine, this thread won't run
-                    return mIsStop || mTasksToComplete.load() > 0;
+                    // Note: other threads may take the jobs first - that's fine, we'll go back to sleep
+                    return mIsStop || mQueuedJobCount.load() > 0;
                 });
 
+            mSleepingThreadCount.fetch_sub(1);
+
             if (mIsStop)
             {
                 // We're done!
                 break;
             }
         }
+    }
 
-        // Tasks have been queued...
+    LogMessage("Thread exiting");
+}
+
+size_t ThreadPool::GetThisThreadQueueIndex() const
+{
+    // Threads not belonging to this pool use the first queue
+    return (ThisThreadPool == this) ? ThisThreadQueueIndex : 0;
+}
+
+void ThreadPool::PushJob(
+    size_t queueIndex,
+    Job const & job)
+{
+    {
+        JobQueue & queue = *mJobQueues[queueIndex];
 
-        // ...run the remaining tasks
-        RunRemainingTasksLoop();
+        std::unique_lock const lock{ queue.Lock };
+
+        queue.PushBack(job);
     }
 
-    LogMessage("Thread exiting");
+    WakeUpWorkers(1);
 }
 
-void ThreadPool::RunRemainingTasksLoop()
+void ThreadPool::WakeUpWorkers(size_t jobCount)
 {
-    //
-    // Run tasks until queue is empty
-    //
+    mQueuedJobCount.fetch_add(static_cast<std::int64_t>(jobCount));
 
-    while (true)
+    // Note: a thread about to sleep first announces itself and then checks the job count,
+    // while we first update the job count and then check for sleepers; hence either we see
+    // it, or it sees our jobs
+    if (mSleepingThreadCount.load() > 0)
     {
-        //
-        // De-queue a task
-        //
+        // Make sure no thread is between checking the job count and waiting
+        {
+            std::unique_lock const lock{ mLock };
+        }
 
-        int const oldTasksToComplete = mTasksToComplete.fetch_sub(1);
-        if (oldTasksToComplete <= 0)
+        if (jobCount == 1)
         {
-            // No more tasks
-            return;
+            mWorkerThreadSignal.notify_one();
         }
+        else
+        {
+            mWorkerThreadSignal.notify_all();
+        }
+    }
+}
 
-        //
-        // Run the task
-        //
+bool ThreadPool::TryRunOneJob(size_t queueIndex)
+{
+    Job job;
 
-        RunTask((*mTasksToRun)[oldTasksToComplete - 1]);
+    // Our own queue first...
+    bool hasJob = mJobQueues[queueIndex]->TryPopBack(job);
 
-        //
-        // Signal task completion
-        //
+    // ...then steal from the others, starting from our neighbor
+    for (size_t i = 1; !hasJob && i < mJobQueues.size(); ++i)
+    {
+        hasJob = mJobQueues[(queueIndex + i) % mJobQueues.size()]->TryPopFront(job);
+    }
 
-        ++mCompletedTasks;
+    if (!hasJob)
+    {
+        return false;
+    }
+
+    mQueuedJobCount.fetch_sub(1);
+
+    RunJob(job, queueIndex);
+
+    return true;
+}
+
+void ThreadPool::RunJob(
+    Job const & job,
+    size_t queueIndex)
+{
+    Batch & batch = *job.ParentBatch;
+
+    switch (job.Kind)
+    {
+        case JobKind::SingleTask:
+        {
+            RunTask(*job.TheTask);
+
+            break;
+        }
+
+        case JobKind::Range:
+        {
+            //
+            // Keep splitting the range in two halves, leaving the second half
+            // for whoever comes first, until it can't be split further
+            //
+
+            size_t const begin = job.Begin;
+            size_t end = job.End;
+
+            while (true)
+            {
+                size_t const chunkCount = (end - begin + batch.MinChunkSize - 1) / batch.MinChunkSize;
+                if (chunkCount <= 1)
+                {
+                    break;
+                }
+
+                size_t const mid = begin + (chunkCount / 2) * batch.MinChunkSize;
+
+                batch.PendingJobCount.fetch_add(1, std::memory_order_relaxed);
+                PushJob(queueIndex, Job{ JobKind::Range, &batch, nullptr, mid, end });
+
+                end = mid;
+            }
+
+            RunRangeTask(*batch.TheRangeTask, begin, end);
+
+            break;
+        }
+
+        case JobKind::GraphNode:
+        {
+            TaskGraph & taskGraph = *batch.TheTaskGraph;
+            auto const & node = taskGraph.mNodes[job.Begin];
+
+            RunTask(node.TheTask);
+
+            // Release successors
+            for (TaskGraph::TaskId const successor : node.Successors)
+            {
+                if (taskGraph.mRemainingDependencyCounts[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    PushJob(queueIndex, Job{ JobKind::GraphNode, &batch, nullptr, successor, 0 });
+                }
+            }
+
+            break;
+        }
+    }
+
+    // Signal job completion; the batch may go away right after this
+    batch.PendingJobCount.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void ThreadPool::WaitForBatch(
+    Batch const & batch,
+    size_t queueIndex)
+{
+    //
+    // Run jobs - of this batch or of any other - until the batch is completed
+    //
+
+    while (batch.PendingJobCount.load(std::memory_order_acquire) != 0)
+    {
+        if (!TryRunOneJob(queueIndex))
+        {
+            // Remaining jobs are running on other threads
+            std::this_thread::yield();
+        }
     }
 }
 
@@ -208,4 +467,89 @@ void ThreadPool::RunTask(Task const & task)
 
         // Keep going...
     }
-}
\ No newline at end of file
+}
+
+void ThreadPool::RunRangeTask(
+    RangeTask const & rangeTask,
+    size_t begin,
+    size_t end)
+{
+    try
+    {
+        rangeTask(begin, end);
+    }
+    catch (std::exception const & e)
+    {
+        assert(false); // Catch it in debug mode
+
+        LogMessage("Error running range task: " + std::string(e.what()));
+
+        // Keep going...
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+void ThreadPool::JobQueue::PushBack(Job const & job)
+{
+    size_t const count = Count.load(std::memory_order_relaxed);
+
+    if (count == Buffer.size())
+    {
+        // Grow, unwrapping the ring
+        std::vector<Job> newBuffer(Buffer.size() * 2);
+        for (size_t j = 0; j < count; ++j)
+        {
+            newBuffer[j] = Buffer[(Front + j) & (Buffer.size() - 1)];
+        }
+
+        Buffer = std::move(newBuffer);
+        Front = 0;
+    }
+
+    Buffer[(Front + count) & (Buffer.size() - 1)] = job;
+    Count.store(count + 1, std::memory_order_relaxed);
+}
+
+bool ThreadPool::JobQueue::TryPopBack(Job & job)
+{
+    if (Count.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+
+    std::unique_lock const lock{ Lock };
+
+    size_t const count = Count.load(std::memory_order_relaxed);
+    if (count == 0)
+    {
+        return false;
+    }
+
+    job = Buffer[(Front + count - 1) & (Buffer.size() - 1)];
+    Count.store(count - 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+bool ThreadPool::JobQueue::TryPopFront(Job & job)
+{
+    if (Count.load(std::memory_order_relaxed) == 0)
+    {
+        return false;
+    }
+
+    std::unique_lock const lock{ Lock };
+
+    size_t const count = Count.load(std::memory_order_relaxed);
+    if (count == 0)
+    {
+        return false;
+    }
+
+    job = Buffer[Front];
+    Front = (Front + 1) & (Buffer.size() - 1);
+    Count.store(count - 1, std::memory_order_relaxed);
+
+    return true;
+}
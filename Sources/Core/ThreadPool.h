@@ -5,27 +5,169 @@
 ***************************************************************************************/
 #pragma once
 
+#include "InplaceFunction.h"
 #include "ThreadManager.h"
 
 #include <atomic>
 #include <cassert>
 #include <condition_variable>
-#include <functional>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
 #include <mutex>
-#include <deque>
 #include <string>
 #include <thread>
 #include <vector>
 
 /*
- * This class implements a thread pool that executes batches of tasks.
+ * This class implements a work-stealing thread pool.
  *
+ * Each thread - including the thread that starts a batch, which takes part in the work - owns
+ * a deque of jobs: it pushes and pops jobs at the back of its own deque, and when that is empty
+ * it steals jobs from the front of the other threads' deques.
+ *
+ * The pool runs three kinds of batches, each of which returns only once the whole batch has
+ * completed:
+ *  - Vectors of independent tasks;
+ *  - Parallel-for's over index ranges, which are split recursively - and stolen - down to
+ *    a minimum chunk size;
+ *  - Task graphs, whose tasks run as soon as all of their dependencies have completed.
+ *
+ * Tasks may themselves start batches on the same pool: while waiting for a batch to complete
+ * a thread keeps running jobs, hence nested batches don't leave threads idle.
+ *
+ * Batches may be started from outside of the pool by only one thread at a time.
+ *
+ * Tasks store their captures in-place, and task graphs retain their storage across
+ * clears; in steady state, running batches does not allocate.
  */
 class ThreadPool final
 {
 public:
 
-    using Task = std::function<void()>;
+    using Task = InplaceFunction<void(), 64>;
+
+    using RangeTask = InplaceFunction<void(size_t begin, size_t end), 64>;
+
+    /*
+     * A set of tasks together with the dependencies among them. May be run multiple
+     * times, and may be cleared and re-built at each run without allocating, once
+     * it has grown to its steady-state size.
+     */
+    class TaskGraph final
+    {
+    public:
+
+        using TaskId = size_t;
+
+        TaskGraph()
+            : mNodes()
+            , mTaskCount(0)
+            , mRemainingDependencyCounts()
+            , mRemainingDependencyCountsCapacity(0)
+        {}
+
+        TaskGraph(TaskGraph const &) = delete;
+        TaskGraph & operator=(TaskGraph const &) = delete;
+
+        /*
+         * Dependencies may only refer to tasks added earlier, hence graphs are acyclic
+         * by construction.
+         *
+         * Dependencies are copied into the graph's own storage, hence passing them -
+         * e.g. as a braced list - does not allocate.
+         */
+        TaskId AddTask(
+            Task task,
+            std::initializer_list<TaskId> dependencies = {})
+        {
+            return AddTask(std::move(task), dependencies.begin(), dependencies.size());
+        }
+
+        TaskId AddTask(
+            Task task,
+            std::vector<TaskId> const & dependencies)
+        {
+            return AddTask(std::move(task), dependencies.data(), dependencies.size());
+        }
+
+        TaskId AddTask(
+            Task task,
+            TaskId const * dependencies,
+            size_t dependencyCount)
+        {
+            TaskId const taskId = mTaskCount;
+
+            if (taskId < mNodes.size())
+            {
+                // Recycle node, keeping its successors' storage
+                mNodes[taskId].TheTask = std::move(task);
+                mNodes[taskId].Successors.clear();
+                mNodes[taskId].DependencyCount = 0;
+            }
+            else
+            {
+                mNodes.emplace_back(std::move(task));
+            }
+
+            ++mTaskCount;
+
+            for (size_t d = 0; d < dependencyCount; ++d)
+            {
+                TaskId const dependency = dependencies[d];
+                assert(dependency < taskId);
+                mNodes[dependency].Successors.push_back(taskId);
+                ++(mNodes[taskId].DependencyCount);
+            }
+
+            return taskId;
+        }
+
+        size_t GetTaskCount() const
+        {
+            return mTaskCount;
+        }
+
+        bool IsEmpty() const
+        {
+            return mTaskCount == 0;
+        }
+
+        void Clear()
+        {
+            // Release the tasks' captures, but keep the nodes for reuse
+            for (size_t t = 0; t < mTaskCount; ++t)
+            {
+                mNodes[t].TheTask = nullptr;
+            }
+
+            mTaskCount = 0;
+        }
+
+    private:
+
+        friend class ThreadPool;
+
+        struct Node
+        {
+            Task TheTask;
+            std::vector<TaskId> Successors;
+            size_t DependencyCount;
+
+            explicit Node(Task && task)
+                : TheTask(std::move(task))
+                , Successors()
+                , DependencyCount(0)
+            {}
+        };
+
+        std::vector<Node> mNodes; // Only grows; the first mTaskCount are in use
+        size_t mTaskCount;
+
+        // Run-time state, one per node; only grows
+        std::unique_ptr<std::atomic<size_t>[]> mRemainingDependencyCounts;
+        size_t mRemainingDependencyCountsCapacity;
+    };
 
 public:
 
@@ -42,12 +184,12 @@ public:
     }
 
     /*
-     * The first task is guaranteed to run on the main thread.
+     * The last task is guaranteed to run on the calling thread.
      */
     void Run(std::vector<Task> const & tasks);
 
     /*
-     * The first task is guaranteed to run on the main thread.
+     * The last task is guaranteed to run on the calling thread.
      */
     inline void RunAndClear(std::vector<Task> & tasks)
     {
@@ -55,22 +197,121 @@ public:
         tasks.clear();
     }
 
+    /*
+     * Runs the task over [begin, end), split in sub-ranges of at least minChunkSize
+     * elements; all sub-ranges but the last one start at begin plus a multiple of
+     * minChunkSize.
+     */
+    void ParallelFor(
+        size_t begin,
+        size_t end,
+        size_t minChunkSize,
+        RangeTask const & rangeTask);
+
+    /*
+     * Runs all tasks of the graph, each one only after all of its dependencies
+     * have completed.
+     */
+    void Run(TaskGraph & taskGraph);
+
 private:
 
+    enum class JobKind : std::uint8_t
+    {
+        SingleTask,
+        Range,
+        GraphNode
+    };
+
+    struct Batch
+    {
+        std::atomic<size_t> PendingJobCount;
+
+        RangeTask const * TheRangeTask;
+        size_t MinChunkSize;
+
+        TaskGraph * TheTaskGraph;
+
+        explicit Batch(size_t pendingJobCount)
+            : PendingJobCount(pendingJobCount)
+            , TheRangeTask(nullptr)
+            , MinChunkSize(1)
+            , TheTaskGraph(nullptr)
+        {}
+    };
+
+    struct Job
+    {
+        JobKind Kind;
+        Batch * ParentBatch;
+        Task const * TheTask; // SingleTask only
+        size_t Begin; // Range: begin; GraphNode: task ID
+        size_t End; // Range only
+    };
+
+    // A deque implemented as a growable ring buffer, so that
+    // in steady state it doesn't allocate
+    struct alignas(64) JobQueue
+    {
+        std::mutex Lock;
+        std::vector<Job> Buffer; // Capacity is a power of two
+        size_t Front;
+        std::atomic<size_t> Count; // Read without lock as a hint
+
+        JobQueue()
+            : Lock()
+            , Buffer(64)
+            , Front(0)
+            , Count(0)
+        {}
+
+        // Lock must be held
+        void PushBack(Job const & job);
+
+        bool TryPopBack(Job & job);
+
+        bool TryPopFront(Job & job);
+    };
+
     void ThreadLoop(
         std::string threadName,
-        size_t threadTaskIndex,
+        size_t threadQueueIndex,
         ThreadManager & threadManager);
 
-    void RunRemainingTasksLoop();
+    size_t GetThisThreadQueueIndex() const;
+
+    void PushJob(
+        size_t queueIndex,
+        Job const & job);
+
+    void WakeUpWorkers(size_t jobCount);
+
+    bool TryRunOneJob(size_t queueIndex);
+
+    void RunJob(
+        Job const & job,
+        size_t queueIndex);
+
+    void WaitForBatch(
+        Batch const & batch,
+        size_t queueIndex);
 
     void RunTask(Task const & task);
 
+    void RunRangeTask(
+        RangeTask const & rangeTask,
+        size_t begin,
+        size_t end);
+
 private:
 
     ThreadManager::ThreadTaskKind const mThreadTaskKind;
 
-    // Our thread lock
+    // One per thread; the first one belongs to the thread starting
+    // batches from outside of the pool
+    std::vector<std::unique_ptr<JobQueue>> mJobQueues;
+
+    // Our sleep lock
     std::mutex mLock;
 
     // Our threads (N-1, as main thread also plays)
@@ -79,16 +320,12 @@ private:
     // The condition variable to wake up threads
     std::condition_variable mWorkerThreadSignal;
 
-    // The tasks currently awaiting to be picked up;
-    // threads takes all but the last one
-    std::vector<Task> const * mTasksToRun;
-
-    // Also serves as proxy to index of next task to pick.
-    // Begins with N-1, as last task is for main thread, and can go lower than zero if too many threads are eager to work
-    std::atomic<int> mTasksToComplete;
+    // Number of jobs in all queues; may transiently go below zero,
+    // as it's updated after the queues
+    std::atomic<std::int64_t> mQueuedJobCount;
 
-    // Number of tasks that still have to complete. Trails opposite of mTasksToComplete
-    std::atomic<size_t> mCompletedTasks;
+    // Number of threads waiting (or about to wait) on the signal
+    std::atomic<size_t> mSleepingThreadCount;
 
     // Set to true when have to stop
     bool mIsStop;
@@ -0,0 +1,247 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2025-06-22
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameTypes.h"
+#include "Vectors.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/*
+ * A uniform grid of square cells over a set of points, supporting radius queries.
+ *
+ * The grid only stores point indices - bucketed by cell via a counting sort - and
+ * covers the bounding box of the points at the moment it's rebuilt; queries test
+ * the points' current positions, hence the grid remains exact for as long as the
+ * points don't move to other cells.
+ *
+ * Not thread-safe, and queries are not reentrant.
+ */
+class UniformPointGrid final
+{
+public:
+
+    UniformPointGrid(
+        float minCellSize,
+        std::uint32_t maxCellsPerDimension)
+        : mMinCellSize(minCellSize)
+        , mMaxCellsPerDimension(maxCellsPerDimension)
+        , mIsValid(false)
+        , mOrigin(vec2f::zero())
+        , mCellSize(minCellSize)
+        , mCellsWidth(0)
+        , mCellsHeight(0)
+        , mCellStarts()
+        , mCellPoints()
+        , mPointCellsBuffer()
+        , mCellCursorsBuffer()
+        , mQueryResultsBuffer()
+    {
+        assert(minCellSize > 0.0f);
+        assert(maxCellsPerDimension > 0);
+    }
+
+    bool IsValid() const
+    {
+        return mIsValid;
+    }
+
+    void Invalidate()
+    {
+        mIsValid = false;
+    }
+
+    /*
+     * Rebuilds the grid with the points in [0, pointCount) for which the predicate is true.
+     */
+    template<typename TIsIncluded>
+    void Rebuild(
+        vec2f const * positions,
+        ElementCount pointCount,
+        TIsIncluded && isIncluded)
+    {
+        //
+        // 1. Calculate extent
+        //
+
+        vec2f minPos(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        vec2f maxPos(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+
+        mPointCellsBuffer.clear();
+
+        for (ElementIndex p = 0; p < pointCount; ++p)
+        {
+            if (isIncluded(p))
+            {
+                minPos.x = std::min(minPos.x, positions[p].x);
+                minPos.y = std::min(minPos.y, positions[p].y);
+                maxPos.x = std::max(maxPos.x, positions[p].x);
+                maxPos.y = std::max(maxPos.y, positions[p].y);
+
+                mPointCellsBuffer.emplace_back(p, 0);
+            }
+        }
+
+        if (mPointCellsBuffer.empty())
+        {
+            mOrigin = vec2f::zero();
+            mCellSize = mMinCellSize;
+            mCellsWidth = 0;
+            mCellsHeight = 0;
+            mCellStarts.assign(1, 0);
+            mCellPoints.clear();
+
+            mIsValid = true;
+            return;
+        }
+
+        mOrigin = minPos;
+        mCellSize = std::max(
+            mMinCellSize,
+            std::max(maxPos.x - minPos.x, maxPos.y - minPos.y) / static_cast<float>(mMaxCellsPerDimension));
+        mCellsWidth = std::min(static_cast<std::uint32_t>((maxPos.x - minPos.x) / mCellSize) + 1, mMaxCellsPerDimension);
+        mCellsHeight = std::min(static_cast<std::uint32_t>((maxPos.y - minPos.y) / mCellSize) + 1, mMaxCellsPerDimension);
+
+        //
+        // 2. Count points per cell
+        //
+
+        mCellStarts.assign(static_cast<size_t>(mCellsWidth) * mCellsHeight + 1, 0);
+
+        for (auto & pointCell : mPointCellsBuffer)
+        {
+            pointCell.second = GetCellIndex(positions[pointCell.first]);
+            ++(mCellStarts[pointCell.second + 1]);
+        }
+
+        // Prefix sum
+        for (size_t c = 1; c < mCellStarts.size(); ++c)
+        {
+            mCellStarts[c] += mCellStarts[c - 1];
+        }
+
+        //
+        // 3. Bucket points - stable, so each cell lists its points in ascending order
+        //
+
+        mCellPoints.resize(mPointCellsBuffer.size());
+
+        mCellCursorsBuffer.assign(mCellStarts.cbegin(), mCellStarts.cend() - 1);
+        for (auto const & pointCell : mPointCellsBuffer)
+        {
+            mCellPoints[mCellCursorsBuffer[pointCell.second]++] = pointCell.first;
+        }
+
+        mIsValid = true;
+    }
+
+    /*
+     * Visits all points whose current distance from the center is less than the radius,
+     * in ascending index order. The visitor is invoked with the point index and the
+     * point's square distance from the center.
+     */
+    template<typename TVisitor>
+    void VisitPointsInRadius(
+        vec2f const * positions,
+        vec2f const & center,
+        float radius,
+        TVisitor && visitor) const
+    {
+        assert(mIsValid);
+
+        if (mCellPoints.empty())
+        {
+            return;
+        }
+
+        float const squareRadius = radius * radius;
+
+        // Calculate cell range, clamped to the grid
+        int const minCellX = ClampCellCoordinate((center.x - radius - mOrigin.x) / mCellSize, mCellsWidth);
+        int const maxCellX = ClampCellCoordinate((center.x + radius - mOrigin.x) / mCellSize, mCellsWidth);
+        int const minCellY = ClampCellCoordinate((center.y - radius - mOrigin.y) / mCellSize, mCellsHeight);
+        int const maxCellY = ClampCellCoordinate((center.y + radius - mOrigin.y) / mCellSize, mCellsHeight);
+
+        mQueryResultsBuffer.clear();
+
+        for (int y = minCellY; y <= maxCellY; ++y)
+        {
+            for (int x = minCellX; x <= maxCellX; ++x)
+            {
+                size_t const c = static_cast<size_t>(y) * mCellsWidth + static_cast<size_t>(x);
+                for (ElementIndex i = mCellStarts[c]; i < mCellStarts[c + 1]; ++i)
+                {
+                    ElementIndex const p = mCellPoints[i];
+                    float const squareDistance = (positions[p] - center).squareLength();
+                    if (squareDistance < squareRadius)
+                    {
+                        mQueryResultsBuffer.emplace_back(p, squareDistance);
+                    }
+                }
+            }
+        }
+
+        std::sort(
+            mQueryResultsBuffer.begin(),
+            mQueryResultsBuffer.end(),
+            [](auto const & l, auto const & r)
+            {
+                return l.first < r.first;
+            });
+
+        for (auto const & result : mQueryResultsBuffer)
+        {
+            visitor(result.first, result.second);
+        }
+    }
+
+private:
+
+    inline std::uint32_t GetCellIndex(vec2f const & position) const
+    {
+        std::uint32_t const x = static_cast<std::uint32_t>(ClampCellCoordinate((position.x - mOrigin.x) / mCellSize, mCellsWidth));
+        std::uint32_t const y = static_cast<std::uint32_t>(ClampCellCoordinate((position.y - mOrigin.y) / mCellSize, mCellsHeight));
+
+        return y * mCellsWidth + x;
+    }
+
+    static inline int ClampCellCoordinate(
+        float cellCoordinate,
+        std::uint32_t cellCount)
+    {
+        // Note: also takes care of positions that are out of the grid because they've moved since the last rebuild
+        return static_cast<int>(std::clamp(std::floor(cellCoordinate), 0.0f, static_cast<float>(cellCount - 1)));
+    }
+
+private:
+
+    float const mMinCellSize;
+    std::uint32_t const mMaxCellsPerDimension;
+
+    bool mIsValid;
+
+    vec2f mOrigin; // Bottom-left
+    float mCellSize;
+    std::uint32_t mCellsWidth;
+    std::uint32_t mCellsHeight;
+
+    // Index in mCellPoints of the first point of each cell, plus one sentinel at the end
+    std::vector<ElementIndex> mCellStarts;
+
+    // Point indices, bucketed by cell
+    std::vector<ElementIndex> mCellPoints;
+
+    // Scratch buffers, reused across rebuilds and queries
+    std::vector<std::pair<ElementIndex, std::uint32_t>> mPointCellsBuffer;
+    std::vector<ElementIndex> mCellCursorsBuffer;
+    mutable std::vector<std::pair<ElementIndex, float>> mQueryResultsBuffer;
+};
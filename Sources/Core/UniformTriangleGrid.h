@@ -0,0 +1,287 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2025-07-11
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameTypes.h"
+#include "Vectors.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/*
+ * A uniform grid of square cells over a set of triangles, supporting point location.
+ *
+ * The grid buckets each triangle index - via a counting sort - in all the cells overlapped
+ * by the triangle's bounding box at the moment the grid is rebuilt; a position's cell hence
+ * lists a superset of the triangles containing the position, for as long as the triangles'
+ * vertices don't move. Callers test the candidates against the vertices' current positions.
+ *
+ * Not thread-safe.
+ */
+class UniformTriangleGrid final
+{
+public:
+
+    /*
+     * The triangles of a cell, in ascending index order.
+     */
+    class CellTriangles final
+    {
+    public:
+
+        CellTriangles(
+            ElementIndex const * begin,
+            ElementIndex const * end)
+            : mBegin(begin)
+            , mEnd(end)
+        {}
+
+        ElementIndex const * begin() const
+        {
+            return mBegin;
+        }
+
+        ElementIndex const * end() const
+        {
+            return mEnd;
+        }
+
+        bool empty() const
+        {
+            return mBegin == mEnd;
+        }
+
+    private:
+
+        ElementIndex const * const mBegin;
+        ElementIndex const * const mEnd;
+    };
+
+public:
+
+    UniformTriangleGrid(
+        float minCellSize,
+        std::uint32_t maxCellsPerDimension)
+        : mMinCellSize(minCellSize)
+        , mMaxCellsPerDimension(maxCellsPerDimension)
+        , mIsValid(false)
+        , mOrigin(vec2f::zero())
+        , mTopRight(vec2f::zero())
+        , mCellSize(minCellSize)
+        , mCellsWidth(0)
+        , mCellsHeight(0)
+        , mCellStarts(1, 0)
+        , mCellTriangles()
+        , mTriangleBoundsBuffer()
+        , mCellCursorsBuffer()
+    {
+        assert(minCellSize > 0.0f);
+        assert(maxCellsPerDimension > 0);
+    }
+
+    bool IsValid() const
+    {
+        return mIsValid;
+    }
+
+    void Invalidate()
+    {
+        mIsValid = false;
+    }
+
+    /*
+     * Rebuilds the grid with the triangles in [0, triangleCount) for which the predicate is true;
+     * getPointIndices returns the indices of the three vertices of a triangle.
+     */
+    template<typename TGetPointIndices, typename TIsIncluded>
+    void Rebuild(
+        vec2f const * positions,
+        ElementCount triangleCount,
+        TGetPointIndices && getPointIndices,
+        TIsIncluded && isIncluded)
+    {
+        //
+        // 1. Calculate bounding boxes and extent
+        //
+
+        vec2f minPos(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        vec2f maxPos(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+
+        mTriangleBoundsBuffer.clear();
+
+        for (ElementIndex t = 0; t < triangleCount; ++t)
+        {
+            if (isIncluded(t))
+            {
+                auto const & pointIndices = getPointIndices(t);
+                vec2f const & a = positions[pointIndices[0]];
+                vec2f const & b = positions[pointIndices[1]];
+                vec2f const & c = positions[pointIndices[2]];
+
+                TriangleBounds bounds{
+                    t,
+                    vec2f(std::min({ a.x, b.x, c.x }), std::min({ a.y, b.y, c.y })),
+                    vec2f(std::max({ a.x, b.x, c.x }), std::max({ a.y, b.y, c.y })) };
+
+                minPos.x = std::min(minPos.x, bounds.Min.x);
+                minPos.y = std::min(minPos.y, bounds.Min.y);
+                maxPos.x = std::max(maxPos.x, bounds.Max.x);
+                maxPos.y = std::max(maxPos.y, bounds.Max.y);
+
+                mTriangleBoundsBuffer.push_back(bounds);
+            }
+        }
+
+        if (mTriangleBoundsBuffer.empty())
+        {
+            mOrigin = vec2f::zero();
+            mTopRight = vec2f::zero();
+            mCellSize = mMinCellSize;
+            mCellsWidth = 0;
+            mCellsHeight = 0;
+            mCellStarts.assign(1, 0);
+            mCellTriangles.clear();
+
+            mIsValid = true;
+            return;
+        }
+
+        mOrigin = minPos;
+        mTopRight = maxPos;
+        mCellSize = std::max(
+            mMinCellSize,
+            std::max(maxPos.x - minPos.x, maxPos.y - minPos.y) / static_cast<float>(mMaxCellsPerDimension));
+        mCellsWidth = std::min(static_cast<std::uint32_t>((maxPos.x - minPos.x) / mCellSize) + 1, mMaxCellsPerDimension);
+        mCellsHeight = std::min(static_cast<std::uint32_t>((maxPos.y - minPos.y) / mCellSize) + 1, mMaxCellsPerDimension);
+
+        //
+        // 2. Count triangles per cell
+        //
+
+        mCellStarts.assign(static_cast<size_t>(mCellsWidth) * mCellsHeight + 1, 0);
+
+        for (auto const & bounds : mTriangleBoundsBuffer)
+        {
+            VisitCells(
+                bounds,
+                [this](size_t c)
+                {
+                    ++(mCellStarts[c + 1]);
+                });
+        }
+
+        // Prefix sum
+        for (size_t c = 1; c < mCellStarts.size(); ++c)
+        {
+            mCellStarts[c] += mCellStarts[c - 1];
+        }
+
+        //
+        // 3. Bucket triangles - stable, so each cell lists its triangles in ascending order
+        //
+
+        mCellTriangles.resize(mCellStarts.back());
+
+        mCellCursorsBuffer.assign(mCellStarts.cbegin(), mCellStarts.cend() - 1);
+        for (auto const & bounds : mTriangleBoundsBuffer)
+        {
+            VisitCells(
+                bounds,
+                [this, t = bounds.TriangleIndex](size_t c)
+                {
+                    mCellTriangles[mCellCursorsBuffer[c]++] = t;
+                });
+        }
+
+        mIsValid = true;
+    }
+
+    /*
+     * Returns the triangles whose bounding box - at the last rebuild - overlapped
+     * the cell of the specified position.
+     */
+    CellTriangles GetCellTriangles(vec2f const & position) const
+    {
+        assert(mIsValid);
+
+        if (mCellTriangles.empty()
+            || position.x < mOrigin.x || position.x > mTopRight.x
+            || position.y < mOrigin.y || position.y > mTopRight.y)
+        {
+            // Outside of all triangles
+            return CellTriangles(nullptr, nullptr);
+        }
+
+        size_t const c =
+            static_cast<size_t>(ClampCellCoordinate((position.y - mOrigin.y) / mCellSize, mCellsHeight)) * mCellsWidth
+            + static_cast<size_t>(ClampCellCoordinate((position.x - mOrigin.x) / mCellSize, mCellsWidth));
+        return CellTriangles(
+            mCellTriangles.data() + mCellStarts[c],
+            mCellTriangles.data() + mCellStarts[c + 1]);
+    }
+
+private:
+
+    struct TriangleBounds
+    {
+        ElementIndex TriangleIndex;
+        vec2f Min;
+        vec2f Max;
+    };
+
+    template<typename TVisitor>
+    inline void VisitCells(
+        TriangleBounds const & bounds,
+        TVisitor && visitor) const
+    {
+        std::uint32_t const minCellX = ClampCellCoordinate((bounds.Min.x - mOrigin.x) / mCellSize, mCellsWidth);
+        std::uint32_t const maxCellX = ClampCellCoordinate((bounds.Max.x - mOrigin.x) / mCellSize, mCellsWidth);
+        std::uint32_t const minCellY = ClampCellCoordinate((bounds.Min.y - mOrigin.y) / mCellSize, mCellsHeight);
+        std::uint32_t const maxCellY = ClampCellCoordinate((bounds.Max.y - mOrigin.y) / mCellSize, mCellsHeight);
+
+        for (std::uint32_t y = minCellY; y <= maxCellY; ++y)
+        {
+            for (std::uint32_t x = minCellX; x <= maxCellX; ++x)
+            {
+                visitor(static_cast<size_t>(y) * mCellsWidth + static_cast<size_t>(x));
+            }
+        }
+    }
+
+    static inline std::uint32_t ClampCellCoordinate(
+        float cellCoordinate,
+        std::uint32_t cellCount)
+    {
+        return static_cast<std::uint32_t>(std::clamp(std::floor(cellCoordinate), 0.0f, static_cast<float>(cellCount - 1)));
+    }
+
+private:
+
+    float const mMinCellSize;
+    std::uint32_t const mMaxCellsPerDimension;
+
+    bool mIsValid;
+
+    vec2f mOrigin; // Bottom-left
+    vec2f mTopRight;
+    float mCellSize;
+    std::uint32_t mCellsWidth;
+    std::uint32_t mCellsHeight;
+
+    // Index in mCellTriangles of the first triangle of each cell, plus one sentinel at the end
+    std::vector<ElementIndex> mCellStarts;
+
+    // Triangle indices, bucketed by cell
+    std::vector<ElementIndex> mCellTriangles;
+
+    // Scratch buffers, reused across rebuilds
+    std::vector<TriangleBounds> mTriangleBoundsBuffer;
+    std::vector<ElementIndex> mCellCursorsBuffer;
+};
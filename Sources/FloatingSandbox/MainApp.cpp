@@ -248,6 +248,7 @@ bool MainApp::OnInit()
         //
 
         mGameAssetManager = std::make_unique<GameAssetManager>(std::string(argv[0]));
+        mGameAssetManager->SetTextureAtlasCacheFolderPath(StandardSystemPaths::GetInstance().GetUserGameRootFolderPath() / "Cache" / "Atlases");
 
         //
         // Load boot settings
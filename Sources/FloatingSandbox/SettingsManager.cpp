@@ -44,6 +44,10 @@ BaseSettingsManager<GameSettings>::BaseSettingsManagerFactory SettingsManager::M
 
     ADD_GC_SETTING(size_t, SimulationParallelism);
     ADD_GC_SETTING(SpringRelaxationParallelComputationModeType, SpringRelaxationParallelComputationMode);
+    ADD_GC_SETTING(bool, DoParallelWaterFlow);
+    ADD_GC_SETTING(bool, DoConcurrentShipUpdates);
+    ADD_GC_SETTING(bool, DoConcurrentWorldUpdates);
+    ADD_GC_SETTING(bool, DoConcurrentNpcUpdates);
     ADD_GC_SETTING(float, NumMechanicalDynamicsIterationsAdjustment);
     ADD_GC_SETTING(float, SpringStiffnessAdjustment);
     ADD_GC_SETTING(float, SpringDampingAdjustment);
@@ -82,6 +86,7 @@ BaseSettingsManager<GameSettings>::BaseSettingsManagerFactory SettingsManager::M
     ADD_GC_SETTING(float, WindSpeedBase);
     ADD_GC_SETTING(float, WindSpeedMaxFactor);
     ADD_GC_SETTING(float, WaveSmoothnessAdjustment);
+    ADD_GC_SETTING(size_t, OceanSurfaceSamplesCount);
 
     // Storm
     ADD_GC_SETTING(std::chrono::minutes, StormRate);
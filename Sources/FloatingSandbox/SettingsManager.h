@@ -14,6 +14,10 @@ enum class GameSettings : size_t
 {
     SimulationParallelism = 0,
     SpringRelaxationParallelComputationMode,
+    DoParallelWaterFlow,
+    DoConcurrentShipUpdates,
+    DoConcurrentWorldUpdates,
+    DoConcurrentNpcUpdates,
     NumMechanicalDynamicsIterationsAdjustment,
     SpringStiffnessAdjustment,
     SpringDampingAdjustment,
@@ -52,6 +56,7 @@ enum class GameSettings : size_t
     WindSpeedBase,
     WindSpeedMaxFactor,
     WaveSmoothnessAdjustment,
+    OceanSurfaceSamplesCount,
 
     // Storm
     StormRate,
@@ -5,6 +5,12 @@
  ***************************************************************************************/
 #include "DebugDialog.h"
 
+#include <UILib/StandardSystemPaths.h>
+
+#include <Game/GameAssetManager.h>
+
+#include <Core/Profiler.h>
+
 #include <wx/gbsizer.h>
 #include <wx/notebook.h>
 #include <wx/settings.h>
@@ -78,6 +84,19 @@ DebugDialog::DebugDialog(
     }
 
 
+    //
+    // Profiling
+    //
+
+    {
+        wxPanel * profilingPanel = new wxPanel(notebook);
+
+        PopulateProfilingPanel(profilingPanel);
+
+        notebook->AddPage(profilingPanel, _("Profiling"));
+    }
+
+
     //
     // Finalize dialog
     //
@@ -370,5 +389,90 @@ void DebugDialog::PopulateEventRecordingPanel(wxPanel * panel)
 
     // Finalize panel
 
+    panel->SetSizerAndFit(gridSizer);
+}
+
+void DebugDialog::PopulateProfilingPanel(wxPanel * panel)
+{
+    wxGridBagSizer * gridSizer = new wxGridBagSizer(0, 0);
+
+    {
+        mProfilingStartButton = new wxButton(panel, wxID_ANY, _("Start"));
+
+        mProfilingStartButton->Enable(!Profiler::GetInstance().IsRunning());
+
+        mProfilingStartButton->Bind(
+            wxEVT_BUTTON,
+            [this](wxCommandEvent &)
+            {
+                mProfilingStartButton->Enable(false);
+                mProfilingStopButton->Enable(true);
+
+                mProfilingTextCtrl->Clear();
+
+                Profiler::GetInstance().Start();
+            });
+
+        gridSizer->Add(
+            mProfilingStartButton,
+            wxGBPosition(0, 0),
+            wxGBSpan(1, 1),
+            wxEXPAND | wxALL,
+            CellBorder);
+    }
+
+    {
+        mProfilingStopButton = new wxButton(panel, wxID_ANY, _("Stop and Save"));
+
+        mProfilingStopButton->Enable(Profiler::GetInstance().IsRunning());
+
+        mProfilingStopButton->Bind(
+            wxEVT_BUTTON,
+            [this](wxCommandEvent &)
+            {
+                mProfilingStartButton->Enable(true);
+                mProfilingStopButton->Enable(false);
+
+                Profiler::GetInstance().Stop();
+
+                try
+                {
+                    std::filesystem::path const traceFilePath = StandardSystemPaths::GetInstance().GetDiagnosticsFolderPath(true) / "trace.json";
+
+                    GameAssetManager::SaveTextFile(
+                        Profiler::GetInstance().MakeChromeTrace(),
+                        traceFilePath);
+
+                    mProfilingTextCtrl->SetValue(traceFilePath.string());
+                }
+                catch (std::exception const & ex)
+                {
+                    mProfilingTextCtrl->SetValue(ex.what());
+                    mSoundController.PlayErrorSound();
+                }
+            });
+
+        gridSizer->Add(
+            mProfilingStopButton,
+            wxGBPosition(0, 1),
+            wxGBSpan(1, 1),
+            wxEXPAND | wxALL,
+            CellBorder);
+    }
+
+    {
+        mProfilingTextCtrl = new wxTextCtrl(panel, wxID_ANY, wxEmptyString, wxDefaultPosition, wxSize(200, 40),
+            wxTE_MULTILINE | wxTE_READONLY | wxTE_WORDWRAP);
+
+        gridSizer->Add(
+            mProfilingTextCtrl,
+            wxGBPosition(1, 0),
+            wxGBSpan(1, 2),
+            wxEXPAND | wxALL,
+            CellBorder);
+    }
+
+    // Finalize panel
+
     panel->SetSizerAndFit(gridSizer);
 }
\ No newline at end of file
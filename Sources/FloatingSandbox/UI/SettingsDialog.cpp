@@ -8,6 +8,7 @@
 #include <UILib/WxHelpers.h>
 
 #include <Core/ExponentialSliderCore.h>
+#include <Core/FixedSetSliderCore.h>
 #include <Core/FixedTickSliderCore.h>
 #include <Core/IntegralLinearSliderCore.h>
 #include <Core/LinearSliderCore.h>
@@ -5763,6 +5764,32 @@ void SettingsDialog::PopulateSoundAndAdvancedSettingsPanel(wxPanel * panel)
                     CellBorderInner);
             }
 
+            // Ocean Surface Resolution
+            {
+                mOceanSurfaceSamplesCountSlider = new SliderControl<size_t>(
+                    performanceBoxSizer->GetStaticBox(),
+                    SliderControl<size_t>::DirectionType::Vertical,
+                    SliderWidth,
+                    SliderHeight,
+                    _("Ocean Resolution"),
+                    _("The number of samples of the ocean surface across the entire world. Lower values make the simulation of the ocean surface faster, at the expense of the detail of its waves."),
+                    [this](size_t value)
+                    {
+                        this->mLiveSettings.SetValue(GameSettings::OceanSurfaceSamplesCount, value);
+                        this->OnLiveSettingsChanged();
+                    },
+                    FixedSetSliderCore<size_t>::FromPowersOfTwo(
+                        mGameControllerSettingsOptions.GetMinOceanSurfaceSamplesCount(),
+                        mGameControllerSettingsOptions.GetMaxOceanSurfaceSamplesCount()));
+
+                performanceSizer->Add(
+                    mOceanSurfaceSamplesCountSlider,
+                    wxGBPosition(0, 2),
+                    wxGBSpan(1, 1),
+                    wxEXPAND | wxALL,
+                    CellBorderInner);
+            }
+
             WxHelpers::MakeAllColumnsExpandable(performanceSizer);
 
             performanceBoxSizer->Add(
@@ -6290,6 +6317,82 @@ void SettingsDialog::PopulateParallelismExperimentsPanel(wxPanel * panel)
             CellBorderOuter);
     }
 
+    // Parallel water flow
+    {
+        mParallelWaterFlowCheckBox = new wxCheckBox(panel, wxID_ANY, "Parallel Water Flow");
+        mParallelWaterFlowCheckBox->Bind(
+            wxEVT_COMMAND_CHECKBOX_CLICKED,
+            [this](wxCommandEvent & event)
+            {
+                mLiveSettings.SetValue<bool>(GameSettings::DoParallelWaterFlow, event.IsChecked());
+                OnLiveSettingsChanged();
+            });
+
+        gridSizer->Add(
+            mParallelWaterFlowCheckBox,
+            wxGBPosition(0, 1),
+            wxGBSpan(1, 1),
+            wxEXPAND | wxALL,
+            CellBorderOuter);
+    }
+
+    // Concurrent ship updates
+    {
+        mConcurrentShipUpdatesCheckBox = new wxCheckBox(panel, wxID_ANY, "Concurrent Ship Updates");
+        mConcurrentShipUpdatesCheckBox->Bind(
+            wxEVT_COMMAND_CHECKBOX_CLICKED,
+            [this](wxCommandEvent & event)
+            {
+                mLiveSettings.SetValue<bool>(GameSettings::DoConcurrentShipUpdates, event.IsChecked());
+                OnLiveSettingsChanged();
+            });
+
+        gridSizer->Add(
+            mConcurrentShipUpdatesCheckBox,
+            wxGBPosition(0, 2),
+            wxGBSpan(1, 1),
+            wxEXPAND | wxALL,
+            CellBorderOuter);
+    }
+
+    // Concurrent world updates
+    {
+        mConcurrentWorldUpdatesCheckBox = new wxCheckBox(panel, wxID_ANY, "Concurrent World Updates");
+        mConcurrentWorldUpdatesCheckBox->Bind(
+            wxEVT_COMMAND_CHECKBOX_CLICKED,
+            [this](wxCommandEvent & event)
+            {
+                mLiveSettings.SetValue<bool>(GameSettings::DoConcurrentWorldUpdates, event.IsChecked());
+                OnLiveSettingsChanged();
+            });
+
+        gridSizer->Add(
+            mConcurrentWorldUpdatesCheckBox,
+            wxGBPosition(0, 3),
+            wxGBSpan(1, 1),
+            wxEXPAND | wxALL,
+            CellBorderOuter);
+    }
+
+    // Concurrent NPC updates
+    {
+        mConcurrentNpcUpdatesCheckBox = new wxCheckBox(panel, wxID_ANY, "Concurrent NPC Updates");
+        mConcurrentNpcUpdatesCheckBox->Bind(
+            wxEVT_COMMAND_CHECKBOX_CLICKED,
+            [this](wxCommandEvent & event)
+            {
+                mLiveSettings.SetValue<bool>(GameSettings::DoConcurrentNpcUpdates, event.IsChecked());
+                OnLiveSettingsChanged();
+            });
+
+        gridSizer->Add(
+            mConcurrentNpcUpdatesCheckBox,
+            wxGBPosition(0, 4),
+            wxGBSpan(1, 1),
+            wxEXPAND | wxALL,
+            CellBorderOuter);
+    }
+
     // Finalize panel
 
     WxHelpers::MakeAllColumnsExpandable(gridSizer);
@@ -6742,6 +6845,7 @@ void SettingsDialog::SyncControlsWithSettings(Settings<GameSettings> const & set
 
     mNumMechanicalIterationsAdjustmentSlider->SetValue(settings.GetValue<float>(GameSettings::NumMechanicalDynamicsIterationsAdjustment));
     mSimulationParallelismSlider->SetValue(settings.GetValue<size_t>(GameSettings::SimulationParallelism));
+    mOceanSurfaceSamplesCountSlider->SetValue(settings.GetValue<size_t>(GameSettings::OceanSurfaceSamplesCount));
 
 #if PARALLELISM_EXPERIMENTS
     //
@@ -6768,6 +6872,11 @@ void SettingsDialog::SyncControlsWithSettings(Settings<GameSettings> const & set
             break;
         }
     }
+
+    mParallelWaterFlowCheckBox->SetValue(settings.GetValue<bool>(GameSettings::DoParallelWaterFlow));
+    mConcurrentShipUpdatesCheckBox->SetValue(settings.GetValue<bool>(GameSettings::DoConcurrentShipUpdates));
+    mConcurrentWorldUpdatesCheckBox->SetValue(settings.GetValue<bool>(GameSettings::DoConcurrentWorldUpdates));
+    mConcurrentNpcUpdatesCheckBox->SetValue(settings.GetValue<bool>(GameSettings::DoConcurrentNpcUpdates));
 #endif
 }
 
@@ -234,6 +234,7 @@ private:
     wxCheckBox * mGenerateSparklesForCutsCheckBox;
     SliderControl<float> * mNumMechanicalIterationsAdjustmentSlider;
     SliderControl<size_t> * mSimulationParallelismSlider;
+    SliderControl<size_t> * mOceanSurfaceSamplesCountSlider;
 
     // Settings Management
     wxListCtrl * mPersistedSettingsListCtrl;
@@ -249,6 +250,10 @@ private:
 #if PARALLELISM_EXPERIMENTS
     // Parallelism Experiment
     wxRadioBox * mSpringRelaxationParallelComputationModeRadioBox;
+    wxCheckBox * mParallelWaterFlowCheckBox;
+    wxCheckBox * mConcurrentShipUpdatesCheckBox;
+    wxCheckBox * mConcurrentWorldUpdatesCheckBox;
+    wxCheckBox * mConcurrentNpcUpdatesCheckBox;
 #endif
 
     //////////////////////////////////////////////////////
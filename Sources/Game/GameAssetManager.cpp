@@ -14,7 +14,12 @@
 #include <Core/Streams.h>
 #include <Core/Utils.h>
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iomanip>
 #include <regex>
+#include <sstream>
 
  ////////////////////////////////////////////////////////////////////////////////////////////
  // IAssetManager
@@ -112,6 +117,90 @@ RgbaImageData GameAssetManager::LoadTextureAtlasImageRGBA(std::string const & te
     return LoadPngImageRgba(mTextureRoot / "Atlases" / MakeAtlasImageFilename(textureDatabaseName));
 }
 
+std::string GameAssetManager::GetTextureDatabaseFingerprint(std::string const & databaseName) const
+{
+    //
+    // Names, sizes, and timestamps of all the files of the database - sorted, as
+    // the order of directory iteration is unspecified
+    //
+
+    std::filesystem::path const databaseRootPath = mTextureRoot / databaseName;
+
+    std::vector<std::string> fileSignatures;
+    for (auto const & entryIt : std::filesystem::recursive_directory_iterator(databaseRootPath))
+    {
+        if (std::filesystem::is_regular_file(entryIt.path()))
+        {
+            fileSignatures.emplace_back(
+                std::filesystem::relative(entryIt.path(), databaseRootPath).string()
+                + ":" + std::to_string(std::filesystem::file_size(entryIt.path()))
+                + ":" + std::to_string(std::filesystem::last_write_time(entryIt.path()).time_since_epoch().count()));
+        }
+    }
+
+    std::sort(fileSignatures.begin(), fileSignatures.end());
+
+    // FNV-1a
+    std::uint64_t hash = 14695981039346656037ull;
+    for (auto const & fileSignature : fileSignatures)
+    {
+        for (char const c : fileSignature)
+        {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+
+        hash ^= static_cast<std::uint8_t>('\n');
+        hash *= 1099511628211ull;
+    }
+
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash << std::dec << "-" << fileSignatures.size();
+    return ss.str();
+}
+
+std::optional<picojson::value> GameAssetManager::LoadCachedTextureAtlasSpecification(std::string const & textureDatabaseName) const
+{
+    if (!mTextureAtlasCacheFolderPath.has_value())
+    {
+        return std::nullopt;
+    }
+
+    std::filesystem::path const filePath = *mTextureAtlasCacheFolderPath / MakeAtlasSpecificationFilename(textureDatabaseName);
+    if (!Exists(filePath)
+        || !Exists(*mTextureAtlasCacheFolderPath / MakeAtlasImageFilename(textureDatabaseName)))
+    {
+        return std::nullopt;
+    }
+
+    return LoadJson(filePath);
+}
+
+RgbaImageData GameAssetManager::LoadCachedTextureAtlasImageRGBA(std::string const & textureDatabaseName) const
+{
+    assert(mTextureAtlasCacheFolderPath.has_value());
+
+    return LoadPngImageRgba(*mTextureAtlasCacheFolderPath / MakeAtlasImageFilename(textureDatabaseName));
+}
+
+void GameAssetManager::SaveCachedTextureAtlas(
+    std::string const & textureDatabaseName,
+    picojson::value const & specification,
+    RgbaImageData const & image) const
+{
+    if (!mTextureAtlasCacheFolderPath.has_value())
+    {
+        return;
+    }
+
+    std::filesystem::create_directories(*mTextureAtlasCacheFolderPath);
+
+    // Image first, so that an interrupted save leaves behind - at most - a specification
+    // that does not match the database anymore
+    SavePngImage(image, *mTextureAtlasCacheFolderPath / MakeAtlasImageFilename(textureDatabaseName));
+    SaveJson(specification, *mTextureAtlasCacheFolderPath / MakeAtlasSpecificationFilename(textureDatabaseName));
+}
+
 std::vector<IAssetManager::AssetDescriptor> GameAssetManager::EnumerateShaders(std::string const & shaderSetName) const
 {
     std::vector<AssetDescriptor> shaderDescriptors;
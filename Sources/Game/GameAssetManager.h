@@ -11,6 +11,7 @@
 #include <picojson.h>
 
 #include <filesystem>
+#include <optional>
 #include <string>
 
 class GameAssetManager : public IAssetManager
@@ -36,6 +37,11 @@ public:
 	picojson::value LoadTetureAtlasSpecification(std::string const & textureDatabaseName) const override;
 	RgbaImageData LoadTextureAtlasImageRGBA(std::string const & textureDatabaseName) const override;
 
+	std::string GetTextureDatabaseFingerprint(std::string const & databaseName) const override;
+	std::optional<picojson::value> LoadCachedTextureAtlasSpecification(std::string const & textureDatabaseName) const override;
+	RgbaImageData LoadCachedTextureAtlasImageRGBA(std::string const & textureDatabaseName) const override;
+	void SaveCachedTextureAtlas(std::string const & textureDatabaseName, picojson::value const & specification, RgbaImageData const & image) const override;
+
 	std::vector<AssetDescriptor> EnumerateShaders(std::string const & shaderSetName) const override;
 	std::string LoadShader(std::string const & shaderSetName, std::string const & shaderRelativePath) const override;
 
@@ -115,6 +121,13 @@ public:
 
 	std::filesystem::path GetBootSettingsFilePath() const;
 
+	// Texture atlas cache; without a folder, atlases are not cached
+
+	void SetTextureAtlasCacheFolderPath(std::filesystem::path const & folderPath)
+	{
+		mTextureAtlasCacheFolderPath = folderPath;
+	}
+
 	// Helpers
 
 	static bool Exists(std::filesystem::path const & filePath);
@@ -168,4 +181,5 @@ private:
 	std::filesystem::path const mResourcesRoot;
 	std::filesystem::path const mTextureRoot;
 	std::filesystem::path const mShaderRoot;
+	std::optional<std::filesystem::path> mTextureAtlasCacheFolderPath;
 };
@@ -141,7 +141,8 @@ GameController::GameController(
         mRenderContext->GetUnderwaterPlantsSpeciesCount(),
         mNpcDatabase,
         mSimulationEventDispatcher,
-        mSimulationParameters);
+        mSimulationParameters,
+        mThreadManager);
 
     // Register ourselves as event handler for the events we care about
     mSimulationEventDispatcher.RegisterGenericShipEventHandler(this);
@@ -346,7 +347,8 @@ ShipMetadata GameController::AddShip(
         mShipStrengthRandomizer,
         mSimulationEventDispatcher,
         assetManager,
-        mSimulationParameters);
+        mSimulationParameters,
+        mThreadManager);
 
     //
     // No errors, so we may continue
@@ -1997,7 +1999,8 @@ ShipMetadata GameController::InternalResetAndLoadShip(
         mRenderContext->GetUnderwaterPlantsSpeciesCount(),
         mNpcDatabase,
         mSimulationEventDispatcher,
-        mSimulationParameters);
+        mSimulationParameters,
+        mThreadManager);
 
     // Produce ship
     auto const shipId = newWorld->GetNextShipId();
@@ -2011,7 +2014,8 @@ ShipMetadata GameController::InternalResetAndLoadShip(
         mShipStrengthRandomizer,
         mSimulationEventDispatcher,
         assetManager,
-        mSimulationParameters);
+        mSimulationParameters,
+        mThreadManager);
 
     //
     // No errors, so we may continue
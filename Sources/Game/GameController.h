@@ -398,6 +398,18 @@ public:
     SpringRelaxationParallelComputationModeType GetSpringRelaxationParallelComputationMode() const override { return mSimulationParameters.SpringRelaxationParallelComputationMode; }
     void SetSpringRelaxationParallelComputationMode(SpringRelaxationParallelComputationModeType value) override {mSimulationParameters.SpringRelaxationParallelComputationMode = value; }
 
+    bool GetDoParallelWaterFlow() const override { return mSimulationParameters.DoParallelWaterFlow; }
+    void SetDoParallelWaterFlow(bool value) override { mSimulationParameters.DoParallelWaterFlow = value; }
+
+    bool GetDoConcurrentShipUpdates() const override { return mSimulationParameters.DoConcurrentShipUpdates; }
+    void SetDoConcurrentShipUpdates(bool value) override { mSimulationParameters.DoConcurrentShipUpdates = value; }
+
+    bool GetDoConcurrentWorldUpdates() const override { return mSimulationParameters.DoConcurrentWorldUpdates; }
+    void SetDoConcurrentWorldUpdates(bool value) override { mSimulationParameters.DoConcurrentWorldUpdates = value; }
+
+    bool GetDoConcurrentNpcUpdates() const override { return mSimulationParameters.DoConcurrentNpcUpdates; }
+    void SetDoConcurrentNpcUpdates(bool value) override { mSimulationParameters.DoConcurrentNpcUpdates = value; }
+
     float GetNumMechanicalDynamicsIterationsAdjustment() const override { return mSimulationParameters.NumMechanicalDynamicsIterationsAdjustment; }
     void SetNumMechanicalDynamicsIterationsAdjustment(float value) override { mSimulationParameters.NumMechanicalDynamicsIterationsAdjustment = value; }
     float GetMinNumMechanicalDynamicsIterationsAdjustment() const override { return SimulationParameters::MinNumMechanicalDynamicsIterationsAdjustment; }
@@ -571,6 +583,11 @@ public:
     float GetMinWaveSmoothnessAdjustment() const override { return SimulationParameters::MinWaveSmoothnessAdjustment; }
     float GetMaxWaveSmoothnessAdjustment() const override { return SimulationParameters::MaxWaveSmoothnessAdjustment; }
 
+    size_t GetOceanSurfaceSamplesCount() const override { return mSimulationParameters.OceanSurfaceSamplesCount; }
+    void SetOceanSurfaceSamplesCount(size_t value) override { mSimulationParameters.OceanSurfaceSamplesCount = value; }
+    size_t GetMinOceanSurfaceSamplesCount() const override { return SimulationParameters::MinOceanSurfaceSamplesCount; }
+    size_t GetMaxOceanSurfaceSamplesCount() const override { return SimulationParameters::MaxOceanSurfaceSamplesCount; }
+
     // Storm
 
     std::chrono::minutes GetStormRate() const override { return mSimulationParameters.StormRate; }
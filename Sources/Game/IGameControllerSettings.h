@@ -30,6 +30,18 @@ struct IGameControllerSettings
     virtual SpringRelaxationParallelComputationModeType GetSpringRelaxationParallelComputationMode() const = 0;
     virtual void SetSpringRelaxationParallelComputationMode(SpringRelaxationParallelComputationModeType value) = 0;
 
+    virtual bool GetDoParallelWaterFlow() const = 0;
+    virtual void SetDoParallelWaterFlow(bool value) = 0;
+
+    virtual bool GetDoConcurrentShipUpdates() const = 0;
+    virtual void SetDoConcurrentShipUpdates(bool value) = 0;
+
+    virtual bool GetDoConcurrentWorldUpdates() const = 0;
+    virtual void SetDoConcurrentWorldUpdates(bool value) = 0;
+
+    virtual bool GetDoConcurrentNpcUpdates() const = 0;
+    virtual void SetDoConcurrentNpcUpdates(bool value) = 0;
+
     virtual float GetNumMechanicalDynamicsIterationsAdjustment() const = 0;
     virtual void SetNumMechanicalDynamicsIterationsAdjustment(float value) = 0;
 
@@ -145,6 +157,9 @@ struct IGameControllerSettings
     virtual float GetWaveSmoothnessAdjustment() const = 0;
     virtual void SetWaveSmoothnessAdjustment(float value) = 0;
 
+    virtual size_t GetOceanSurfaceSamplesCount() const = 0;
+    virtual void SetOceanSurfaceSamplesCount(size_t value) = 0;
+
     // Storm
 
     virtual std::chrono::minutes GetStormRate() const = 0;
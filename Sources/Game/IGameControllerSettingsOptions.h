@@ -131,6 +131,9 @@ struct IGameControllerSettingsOptions
     virtual float GetMinWaveSmoothnessAdjustment() const = 0;
     virtual float GetMaxWaveSmoothnessAdjustment() const = 0;
 
+    virtual size_t GetMinOceanSurfaceSamplesCount() const = 0;
+    virtual size_t GetMaxOceanSurfaceSamplesCount() const = 0;
+
     // Storm
 
     virtual std::chrono::minutes GetMinStormRate() const = 0;
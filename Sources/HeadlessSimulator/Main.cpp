@@ -0,0 +1,433 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2025-06-14
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+
+#include <Game/GameAssetManager.h>
+#include <Game/ShipDeSerializer.h>
+
+#include <Simulation/FishSpeciesDatabase.h>
+#include <Simulation/MaterialDatabase.h>
+#include <Simulation/NpcDatabase.h>
+#include <Simulation/OceanFloorHeightMap.h>
+#include <Simulation/ShipFactory.h>
+#include <Simulation/ShipLoadOptions.h>
+#include <Simulation/ShipStrengthRandomizer.h>
+#include <Simulation/ShipTexturizer.h>
+#include <Simulation/SimulationEventDispatcher.h>
+#include <Simulation/SimulationParameters.h>
+#include <Simulation/Physics/Physics.h>
+
+#include <Render/GameTextureDatabases.h>
+#include <Render/ViewModel.h>
+
+#include <Core/GameChronometer.h>
+#include <Core/PerfStats.h>
+#include <Core/Profiler.h>
+#include <Core/TextureAtlas.h>
+#include <Core/TextureDatabase.h>
+#include <Core/ThreadManager.h>
+#include <Core/Utils.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#define SEPARATOR "------------------------------------------------------"
+
+/*
+ * Runs the simulation of a ship for a number of steps, without any rendering,
+ * and reports the timings of the individual phases of the world update.
+ *
+ * Meant for comparing the throughput of ships, parallelism levels, and computation
+ * modes in a reproducible way, on machines that have no GPU.
+ */
+
+struct RunOptions
+{
+    std::filesystem::path ShipFilePath;
+    size_t StepCount;
+    size_t WarmupStepCount;
+    size_t SimulationParallelism;
+    SpringRelaxationParallelComputationModeType SpringRelaxationParallelComputationMode;
+    bool DoParallelWaterFlow;
+    bool DoConcurrentShipUpdates;
+    bool DoConcurrentWorldUpdates;
+    size_t ShipCount;
+    std::optional<std::filesystem::path> TraceFilePath;
+};
+
+RunOptions ParseOptions(int argc, char ** argv);
+
+SpringRelaxationParallelComputationModeType StrToSpringRelaxationParallelComputationMode(std::string const & str);
+
+std::string SpringRelaxationParallelComputationModeToStr(SpringRelaxationParallelComputationModeType mode);
+
+void PrintPerfStats(
+    PerfStats const & perfStats,
+    size_t stepCount,
+    GameChronometer::duration totalDuration);
+
+void PrintUsage();
+
+int main(int argc, char ** argv)
+{
+    if (argc < 2)
+    {
+        PrintUsage();
+        return 0;
+    }
+
+    try
+    {
+        RunOptions const options = ParseOptions(argc, argv);
+
+        //
+        // Initialize
+        //
+
+        GameAssetManager const gameAssetManager = GameAssetManager(std::string(argv[0]));
+
+        ThreadManager threadManager(
+            false, // Rendering is not multithreaded, as there is no rendering at all
+            options.SimulationParallelism,
+            [](ThreadManager::ThreadTaskKind, std::string const &, size_t)
+            {
+                // No platform-specific initialization
+            });
+
+        threadManager.InitializeThisThread(ThreadManager::ThreadTaskKind::MainAndSimulation, "FS Main Thread", 0);
+
+        std::cout << SEPARATOR << std::endl;
+
+        std::cout << "Running headless simulation:" << std::endl;
+        std::cout << "  ship                          : " << options.ShipFilePath << std::endl;
+        std::cout << "  steps                         : " << options.StepCount << std::endl;
+        std::cout << "  warm-up steps                 : " << options.WarmupStepCount << std::endl;
+        std::cout << "  simulation parallelism        : " << threadManager.GetSimulationParallelism() << std::endl;
+        std::cout << "  spring relaxation mode        : " << SpringRelaxationParallelComputationModeToStr(options.SpringRelaxationParallelComputationMode) << std::endl;
+        std::cout << "  water flow                    : " << (options.DoParallelWaterFlow ? "Parallel" : "Serial") << std::endl;
+        std::cout << "  ship updates                  : " << (options.DoConcurrentShipUpdates ? "Concurrent" : "Serial") << std::endl;
+        std::cout << "  world updates                 : " << (options.DoConcurrentWorldUpdates ? "Concurrent" : "Serial") << std::endl;
+        std::cout << "  ship copies                   : " << options.ShipCount << std::endl;
+        if (options.TraceFilePath)
+            std::cout << "  trace file                    : " << *options.TraceFilePath << std::endl;
+
+        //
+        // Load databases
+        //
+
+        MaterialDatabase const materialDatabase = MaterialDatabase::Load(gameAssetManager);
+
+        FishSpeciesDatabase const fishSpeciesDatabase = FishSpeciesDatabase::Load(gameAssetManager);
+
+        auto const npcTextureAtlas = TextureAtlas<GameTextureDatabases::NpcTextureDatabase>::Deserialize(gameAssetManager);
+
+        NpcDatabase const npcDatabase = NpcDatabase::Load(
+            gameAssetManager,
+            materialDatabase,
+            npcTextureAtlas);
+
+        // We only need the number of species, which we'd otherwise get from the render context
+        size_t const underwaterPlantsSpeciesCount = TextureDatabase<GameTextureDatabases::GenericLinearTextureDatabase>::Load(gameAssetManager)
+            .GetGroup(GameTextureDatabases::GenericLinearTextureGroups::UnderwaterPlant)
+            .GetFrameCount();
+
+        //
+        // Create world
+        //
+
+        SimulationParameters simulationParameters;
+        simulationParameters.SpringRelaxationParallelComputationMode = options.SpringRelaxationParallelComputationMode;
+        simulationParameters.DoParallelWaterFlow = options.DoParallelWaterFlow;
+        simulationParameters.DoConcurrentShipUpdates = options.DoConcurrentShipUpdates;
+        simulationParameters.DoConcurrentWorldUpdates = options.DoConcurrentWorldUpdates;
+
+        SimulationEventDispatcher simulationEventDispatcher;
+
+        auto world = std::make_unique<Physics::World>(
+            OceanFloorHeightMap::LoadFromImage(gameAssetManager.LoadPngImageRgb(gameAssetManager.GetDefaultOceanFloorHeightMapFilePath())),
+            fishSpeciesDatabase,
+            underwaterPlantsSpeciesCount,
+            npcDatabase,
+            simulationEventDispatcher,
+            simulationParameters,
+            threadManager);
+
+        //
+        // Load ship
+        //
+
+        ShipTexturizer const shipTexturizer(materialDatabase, gameAssetManager);
+        ShipStrengthRandomizer const shipStrengthRandomizer;
+
+        auto const loadStartTime = GameChronometer::Now();
+
+        for (size_t c = 0; c < options.ShipCount; ++c)
+        {
+            auto shipDefinition = ShipDeSerializer::LoadShip(options.ShipFilePath, materialDatabase);
+
+            auto [ship, exteriorTextureImage, interiorViewImage] = ShipFactory::Create(
+                world->GetNextShipId(),
+                *world,
+                std::move(shipDefinition),
+                ShipLoadOptions(),
+                materialDatabase,
+                shipTexturizer,
+                shipStrengthRandomizer,
+                simulationEventDispatcher,
+                gameAssetManager,
+                simulationParameters,
+                threadManager);
+
+            world->AddShip(std::move(ship));
+        }
+
+        world->Announce();
+        simulationEventDispatcher.Flush();
+
+        auto const loadDuration = GameChronometer::Now() - loadStartTime;
+
+        std::cout << "  points                        : " << world->GetAllShipPointCount() << std::endl;
+        std::cout << "  springs                       : " << world->GetAllShipSpringCount() << std::endl;
+        std::cout << "  triangles                     : " << world->GetAllShipTriangleCount() << std::endl;
+        std::cout << "  load time                     : " << std::chrono::duration_cast<std::chrono::milliseconds>(loadDuration).count() << "ms" << std::endl;
+
+        //
+        // Run
+        //
+
+        // The view is only used by fishes, to know where to swim to
+        ViewModel const viewModel(
+            FloatSize(SimulationParameters::MaxWorldWidth, SimulationParameters::MaxWorldHeight),
+            1.0f,
+            vec2f::zero(),
+            DisplayLogicalSize(1920, 1080),
+            1);
+
+        PerfStats perfStats;
+        auto runStartTime = GameChronometer::Now();
+
+        for (size_t s = 0; s < options.WarmupStepCount + options.StepCount; ++s)
+        {
+            if (s == options.WarmupStepCount)
+            {
+                // Start measuring from here
+                perfStats.Reset();
+                runStartTime = GameChronometer::Now();
+
+                if (options.TraceFilePath)
+                {
+                    Profiler::GetInstance().Start();
+                }
+            }
+
+            auto const startTime = GameChronometer::Now();
+
+            world->Update(
+                simulationParameters,
+                viewModel,
+                StressRenderModeType::None,
+                threadManager,
+                perfStats);
+
+            simulationEventDispatcher.Flush();
+
+            auto const endTime = GameChronometer::Now();
+            perfStats.Update<PerfMeasurement::TotalUpdate>(endTime - startTime);
+        }
+
+        auto const runDuration = GameChronometer::Now() - runStartTime;
+
+        if (options.TraceFilePath)
+        {
+            Profiler::GetInstance().Stop();
+
+            GameAssetManager::SaveTextFile(
+                Profiler::GetInstance().MakeChromeTrace(),
+                *options.TraceFilePath);
+        }
+
+        //
+        // Report
+        //
+
+        std::cout << SEPARATOR << std::endl;
+
+        PrintPerfStats(
+            perfStats,
+            options.StepCount,
+            runDuration);
+
+        return 0;
+    }
+    catch (std::exception & ex)
+    {
+        std::cout << "ERROR: " << ex.what() << std::endl;
+        return -1;
+    }
+}
+
+RunOptions ParseOptions(int argc, char ** argv)
+{
+    RunOptions options{
+        std::filesystem::path(argv[1]),
+        1000,
+        100,
+        ThreadManager::GetNumberOfProcessors(),
+        SimulationParameters().SpringRelaxationParallelComputationMode,
+        SimulationParameters().DoParallelWaterFlow,
+        SimulationParameters().DoConcurrentShipUpdates,
+        SimulationParameters().DoConcurrentWorldUpdates,
+        1,
+        std::nullopt
+    };
+
+    for (int i = 2; i < argc; ++i)
+    {
+        std::string option(argv[i]);
+
+        if (i == argc - 1)
+        {
+            throw std::runtime_error("Missing value for option '" + option + "'");
+        }
+
+        std::string const value(argv[i + 1]);
+        ++i;
+
+        if (option == "-n")
+        {
+            options.StepCount = static_cast<size_t>(std::max(1, atoi(value.c_str())));
+        }
+        else if (option == "-w")
+        {
+            options.WarmupStepCount = static_cast<size_t>(std::max(0, atoi(value.c_str())));
+        }
+        else if (option == "-p")
+        {
+            options.SimulationParallelism = std::clamp(
+                static_cast<size_t>(std::max(1, atoi(value.c_str()))),
+                size_t(1),
+                ThreadManager::GetNumberOfProcessors());
+        }
+        else if (option == "-m")
+        {
+            options.SpringRelaxationParallelComputationMode = StrToSpringRelaxationParallelComputationMode(value);
+        }
+        else if (option == "-f")
+        {
+            if (Utils::CaseInsensitiveEquals(value, "Serial"))
+                options.DoParallelWaterFlow = false;
+            else if (Utils::CaseInsensitiveEquals(value, "Parallel"))
+                options.DoParallelWaterFlow = true;
+            else
+                throw std::runtime_error("Unrecognized water flow mode '" + value + "'");
+        }
+        else if (option == "-s")
+        {
+            if (Utils::CaseInsensitiveEquals(value, "Serial"))
+                options.DoConcurrentShipUpdates = false;
+            else if (Utils::CaseInsensitiveEquals(value, "Concurrent"))
+                options.DoConcurrentShipUpdates = true;
+            else
+                throw std::runtime_error("Unrecognized ship update mode '" + value + "'");
+        }
+        else if (option == "-u")
+        {
+            if (Utils::CaseInsensitiveEquals(value, "Serial"))
+                options.DoConcurrentWorldUpdates = false;
+            else if (Utils::CaseInsensitiveEquals(value, "Concurrent"))
+                options.DoConcurrentWorldUpdates = true;
+            else
+                throw std::runtime_error("Unrecognized world update mode '" + value + "'");
+        }
+        else if (option == "-c")
+        {
+            options.ShipCount = static_cast<size_t>(std::max(1, atoi(value.c_str())));
+        }
+        else if (option == "-t")
+        {
+            options.TraceFilePath = std::filesystem::path(value);
+        }
+        else
+        {
+            throw std::runtime_error("Unrecognized option '" + option + "'");
+        }
+    }
+
+    if (!std::filesystem::exists(options.ShipFilePath))
+    {
+        throw std::runtime_error("Ship file '" + options.ShipFilePath.string() + "' does not exist");
+    }
+
+    return options;
+}
+
+SpringRelaxationParallelComputationModeType StrToSpringRelaxationParallelComputationMode(std::string const & str)
+{
+    if (Utils::CaseInsensitiveEquals(str, "StepByStep"))
+        return SpringRelaxationParallelComputationModeType::StepByStep;
+    else if (Utils::CaseInsensitiveEquals(str, "FullSpeed"))
+        return SpringRelaxationParallelComputationModeType::FullSpeed;
+    else if (Utils::CaseInsensitiveEquals(str, "Hybrid"))
+        return SpringRelaxationParallelComputationModeType::Hybrid;
+    else
+        throw std::runtime_error("Unrecognized spring relaxation parallel computation mode '" + str + "'");
+}
+
+std::string SpringRelaxationParallelComputationModeToStr(SpringRelaxationParallelComputationModeType mode)
+{
+    switch (mode)
+    {
+        case SpringRelaxationParallelComputationModeType::StepByStep:
+            return "StepByStep";
+        case SpringRelaxationParallelComputationModeType::FullSpeed:
+            return "FullSpeed";
+        case SpringRelaxationParallelComputationModeType::Hybrid:
+            return "Hybrid";
+    }
+
+    assert(false);
+    return "";
+}
+
+void PrintPerfStats(
+    PerfStats const & perfStats,
+    size_t stepCount,
+    GameChronometer::duration totalDuration)
+{
+    auto const printMeasurement = [](std::string const & name, PerfStats::Ratio const & ratio)
+    {
+        std::cout << "  " << std::left << std::setw(30) << name << ": "
+            << std::fixed << std::setprecision(3) << ratio.ToRatio<std::chrono::milliseconds>() << "ms" << std::endl;
+    };
+
+    std::cout << "Results (average per step, over " << stepCount << " steps):" << std::endl;
+
+    printMeasurement("total update", perfStats.GetMeasurement<PerfMeasurement::TotalUpdate>());
+    printMeasurement("ocean surface update", perfStats.GetMeasurement<PerfMeasurement::TotalOceanSurfaceUpdate>());
+    printMeasurement("ships update", perfStats.GetMeasurement<PerfMeasurement::TotalShipsUpdate>());
+    printMeasurement("  springs update (per ship)", perfStats.GetMeasurement<PerfMeasurement::TotalShipsSpringsUpdate>());
+    printMeasurement("NPC update", perfStats.GetMeasurement<PerfMeasurement::TotalNpcUpdate>());
+    printMeasurement("fish update", perfStats.GetMeasurement<PerfMeasurement::TotalFishUpdate>());
+
+    float const totalSeconds = std::chrono::duration_cast<std::chrono::duration<float>>(totalDuration).count();
+
+    std::cout << "  " << std::left << std::setw(30) << "throughput" << ": "
+        << std::fixed << std::setprecision(1) << (totalSeconds > 0.0f ? static_cast<float>(stepCount) / totalSeconds : 0.0f) << " steps/s" << std::endl;
+}
+
+void PrintUsage()
+{
+    std::cout << std::endl;
+    std::cout << "Usage:" << std::endl;
+    std::cout << " HeadlessSimulator <ship_file> [-n <steps>] [-w <warmup_steps>] [-p <parallelism>] [-m StepByStep|FullSpeed|Hybrid] [-f Serial|Parallel] [-s Serial|Concurrent] [-u Serial|Concurrent] [-c <ship_copies>] [-t <trace_json_file>]" << std::endl;
+}
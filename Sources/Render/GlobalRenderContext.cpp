@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #include "GlobalRenderContext.h"
 
+#include <Core/GameChronometer.h>
 #include <Core/Noise.h>
 #include <Core/TextureDatabase.h>
 
@@ -67,24 +68,24 @@ void GlobalRenderContext::InitializeNoiseTextures()
     RegeneratePerlin_8_1024_073_Noise(); // Will upload at firstRenderPrepare
 }
 
-void GlobalRenderContext::InitializeGenericTextures()
+void GlobalRenderContext::InitializeGenericTextures(ThreadPool & threadPool)
 {
     //
     // Create generic linear texture atlas
     //
 
-    // Load texture database
-    auto genericLinearTextureDatabase = TextureDatabase<GameTextureDatabases::GenericLinearTextureDatabase>::Load(mAssetManager);
+    auto const genericLinearStartTime = GameChronometer::Now();
 
-    // Create atlas
-    auto genericLinearTextureAtlas = TextureAtlasBuilder<GameTextureDatabases::GenericLinearTextureDatabase>::BuildAtlas(
-        genericLinearTextureDatabase,
+    // Create atlas - or get it from the cache
+    auto genericLinearTextureAtlas = TextureAtlasBuilder<GameTextureDatabases::GenericLinearTextureDatabase>::BuildCachedAtlas(
         TextureAtlasOptions::None,
         1.0f,
         mAssetManager,
+        threadPool,
         SimpleProgressCallback::Dummy());
 
-    LogMessage("Generic linear texture atlas size: ", genericLinearTextureAtlas.Image.Size.ToString());
+    LogMessage("Generic linear texture atlas size: ", genericLinearTextureAtlas.Image.Size.ToString(),
+        " (", std::chrono::duration_cast<std::chrono::milliseconds>(GameChronometer::Now() - genericLinearStartTime).count(), "ms)");
 
     // Activate texture
     mShaderManager.ActivateTexture<GameShaderSets::ProgramParameterKind::GenericLinearTexturesAtlasTexture>();
@@ -151,18 +152,18 @@ void GlobalRenderContext::InitializeGenericTextures()
     // Create generic mipmapped texture atlas
     //
 
-    // Load texture database
-    auto genericMipMappedTextureDatabase = TextureDatabase<GameTextureDatabases::GenericMipMappedTextureDatabase>::Load(mAssetManager);
+    auto const genericMipMappedStartTime = GameChronometer::Now();
 
-    // Create atlas
-    auto genericMipMappedTextureAtlas = TextureAtlasBuilder<GameTextureDatabases::GenericMipMappedTextureDatabase>::BuildAtlas(
-        genericMipMappedTextureDatabase,
+    // Create atlas - or get it from the cache
+    auto genericMipMappedTextureAtlas = TextureAtlasBuilder<GameTextureDatabases::GenericMipMappedTextureDatabase>::BuildCachedAtlas(
         TextureAtlasOptions::MipMappable,
         1.0f,
         mAssetManager,
+        threadPool,
         SimpleProgressCallback::Dummy());
 
-    LogMessage("Generic mipmapped texture atlas size: ", genericMipMappedTextureAtlas.Image.Size.ToString());
+    LogMessage("Generic mipmapped texture atlas size: ", genericMipMappedTextureAtlas.Image.Size.ToString(),
+        " (", std::chrono::duration_cast<std::chrono::milliseconds>(GameChronometer::Now() - genericMipMappedStartTime).count(), "ms)");
 
     // Activate texture
     mShaderManager.ActivateTexture<GameShaderSets::ProgramParameterKind::GenericMipMappedTexturesAtlasTexture>();
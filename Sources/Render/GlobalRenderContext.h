@@ -18,6 +18,7 @@
 #include <Core/GameTypes.h>
 #include <Core/IAssetManager.h>
 #include <Core/TextureAtlas.h>
+#include <Core/ThreadPool.h>
 
 #include <cassert>
 #include <memory>
@@ -34,7 +35,7 @@ public:
 
     void InitializeNoiseTextures();
 
-    void InitializeGenericTextures();
+    void InitializeGenericTextures(ThreadPool & threadPool);
 
     void InitializeExplosionTextures();
 
@@ -8,6 +8,7 @@
 #include <Core/GameChronometer.h>
 #include <Core/GameException.h>
 #include <Core/Log.h>
+#include <Core/Profiler.h>
 #include <Core/SysSpecifics.h>
 #include <Core/ThreadManager.h>
 
@@ -151,7 +152,7 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
-            mGlobalRenderContext->InitializeGenericTextures();
+            mGlobalRenderContext->InitializeGenericTextures(threadManager.GetSimulationThreadPool());
         });
 
     progressCallback(0.2f, ProgressMessageType::LoadingExplosionTextureAtlas);
@@ -190,7 +191,7 @@ RenderContext::RenderContext(
     mRenderThread.RunSynchronously(
         [&]()
         {
-            mWorldRenderContext->InitializeFishTextures();
+            mWorldRenderContext->InitializeFishTextures(threadManager.GetSimulationThreadPool());
         });
 
     progressCallback(0.7f, ProgressMessageType::LoadingWorldTextures);
@@ -437,6 +438,8 @@ void RenderContext::RenderStart()
 
 void RenderContext::UploadStart()
 {
+    FS_PROFILE_ZONE("RenderContext::UploadStart");
+
     // Wait for an eventual pending RenderDraw, so that we know
     // GPU buffers are free to be used
     if (!!mLastRenderDrawCompletionIndicator)
@@ -456,6 +459,8 @@ void RenderContext::UploadStart()
 
 void RenderContext::UploadEnd()
 {
+    FS_PROFILE_ZONE("RenderContext::UploadEnd");
+
     mWorldRenderContext->UploadEnd();
 
     mNotificationRenderContext->UploadEnd();
@@ -477,6 +482,8 @@ void RenderContext::Draw(float currentSimulationTime)
     mLastRenderDrawCompletionIndicator = mRenderThread.QueueTask(
         [this, renderParameters = mRenderParameters.TakeSnapshotAndClear(), lampToolToSet = mLampToolToSet, currentSimulationTime = currentSimulationTime]() mutable
         {
+            FS_PROFILE_ZONE("RenderContext::Draw");
+
             auto const startTime = GameChronometer::Now();
 
             RenderStatistics renderStats;
@@ -505,6 +512,8 @@ void RenderContext::Draw(float currentSimulationTime)
             //
 
             {
+                FS_PROFILE_ZONE("RenderContext::RenderPrepare");
+
                 if (lampToolToSet)
                 {
                     mShaderManager->SetProgramParameterInAllShaders<GameShaderSets::ProgramParameterKind::LampToolAttributes>(*lampToolToSet);
@@ -554,6 +563,8 @@ void RenderContext::Draw(float currentSimulationTime)
             //
 
             {
+                FS_PROFILE_ZONE("RenderContext::RenderDraw");
+
                 mWorldRenderContext->RenderDrawSky(renderParameters); // Acts as canvas clear
 
                 mWorldRenderContext->RenderDrawStars(renderParameters);
@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #include "WorldRenderContext.h"
 
+#include <Core/GameChronometer.h>
 #include <Core/GameWallClock.h>
 #include <Core/ImageTools.h>
 #include <Core/Log.h>
@@ -710,8 +711,10 @@ void WorldRenderContext::InitializeWorldTextures()
     }
 }
 
-void WorldRenderContext::InitializeFishTextures()
+void WorldRenderContext::InitializeFishTextures(ThreadPool & threadPool)
 {
+    auto const startTime = GameChronometer::Now();
+
     // Load texture database
     auto fishTextureDatabase = TextureDatabase<GameTextureDatabases::FishTextureDatabase>::Load(mAssetManager);
 
@@ -721,9 +724,11 @@ void WorldRenderContext::InitializeFishTextures()
         TextureAtlasOptions::MipMappable,
         1.0f,
         mAssetManager,
+        threadPool,
         SimpleProgressCallback::Dummy());
 
-    LogMessage("Fish texture atlas size: ", fishTextureAtlas.Image.Size);
+    LogMessage("Fish texture atlas size: ", fishTextureAtlas.Image.Size,
+        " (", std::chrono::duration_cast<std::chrono::milliseconds>(GameChronometer::Now() - startTime).count(), "ms)");
 
     mShaderManager.ActivateTexture<GameShaderSets::ProgramParameterKind::FishesAtlasTexture>();
 
@@ -23,6 +23,7 @@
 #include <Core/ImageData.h>
 #include <Core/RunningAverage.h>
 #include <Core/TextureAtlas.h>
+#include <Core/ThreadPool.h>
 #include <Core/Vectors.h>
 
 #include <array>
@@ -47,7 +48,7 @@ public:
 
     void InitializeWorldTextures();
 
-    void InitializeFishTextures();
+    void InitializeFishTextures(ThreadPool & threadPool);
 
     void OnReset(RenderParameters const & renderParameters);
 
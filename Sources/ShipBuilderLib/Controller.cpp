@@ -342,13 +342,13 @@ void Controller::SetStructuralLayer(
 }
 
 void Controller::RestoreStructuralLayerRegionBackupForUndo(
-    StructuralLayerData && layerRegionBackup,
+    LayerRegionDelta<LayerType::Structural> && layerRegionBackup,
     ShipSpaceCoordinates const & origin)
 {
     auto const scopedToolResumeState = SuspendTool();
 
     mModelController->RestoreStructuralLayerRegionBackup(
-        std::move(layerRegionBackup),
+        mModelController->MakeLayerRegionBackup(std::move(layerRegionBackup), origin),
         origin);
 
     // No need to update dirtyness, this is for undo
@@ -410,13 +410,13 @@ void Controller::RemoveElectricalLayer()
 }
 
 void Controller::RestoreElectricalLayerRegionBackupForUndo(
-    ElectricalLayerData && layerRegionBackup,
+    LayerRegionDelta<LayerType::Electrical> && layerRegionBackup,
     ShipSpaceCoordinates const & origin)
 {
     auto const scopedToolResumeState = SuspendTool();
 
     mModelController->RestoreElectricalLayerRegionBackup(
-        std::move(layerRegionBackup),
+        mModelController->MakeLayerRegionBackup(std::move(layerRegionBackup), origin),
         origin);
 
     // No need to update dirtyness, this is for undo
@@ -475,8 +475,10 @@ void Controller::TrimElectricalParticlesWithoutSubstratum()
         {
             // Create undo action
 
-            ElectricalLayerData clippedRegionBackup = originalLayerClone.MakeRegionBackup(*affectedRect);
-            auto const clipByteSize = clippedRegionBackup.Buffer.GetByteSize();
+            auto clippedRegionBackup = mModelController->MakeLayerRegionDelta<LayerType::Electrical>(
+                originalLayerClone.MakeRegionBackup(*affectedRect),
+                affectedRect->origin);
+            auto const clipByteSize = clippedRegionBackup.GetByteSize();
 
             mUndoStack.Push(
                 _("Trim Electrical"),
@@ -578,13 +580,13 @@ void Controller::RemoveExteriorTextureLayer()
 }
 
 void Controller::RestoreExteriorTextureLayerRegionBackupForUndo(
-    TextureLayerData && layerRegionBackup,
+    LayerRegionDelta<LayerType::ExteriorTexture> && layerRegionBackup,
     ImageCoordinates const & origin)
 {
     auto const scopedToolResumeState = SuspendTool();
 
     mModelController->RestoreExteriorTextureLayerRegionBackup(
-        std::move(layerRegionBackup),
+        mModelController->MakeLayerRegionBackup(std::move(layerRegionBackup), origin),
         origin);
 
     // No need to update dirtyness, this is for undo
@@ -636,13 +638,13 @@ void Controller::RemoveInteriorTextureLayer()
 }
 
 void Controller::RestoreInteriorTextureLayerRegionBackupForUndo(
-    TextureLayerData && layerRegionBackup,
+    LayerRegionDelta<LayerType::InteriorTexture> && layerRegionBackup,
     ImageCoordinates const & origin)
 {
     auto const scopedToolResumeState = SuspendTool();
 
     mModelController->RestoreInteriorTextureLayerRegionBackup(
-        std::move(layerRegionBackup),
+        mModelController->MakeLayerRegionBackup(std::move(layerRegionBackup), origin),
         origin);
 
     // No need to update dirtyness, this is for undo
@@ -1374,7 +1376,19 @@ void Controller::UndoUntil(size_t index)
 
 void Controller::Render()
 {
+    if (mModelController->HasPendingGameVisualizationUpdates())
+    {
+        // Continue the game visualization update left pending by the last edits
+        mModelController->UpdateVisualizations(*mView, mGameAssetManager);
+    }
+
     mView->Render();
+
+    if (mModelController->HasPendingGameVisualizationUpdates())
+    {
+        // Keep rendering frames until the update is complete
+        mUserInterface.RefreshView();
+    }
 }
 
 void Controller::AddZoom(int deltaZoom)
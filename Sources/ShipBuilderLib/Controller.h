@@ -7,6 +7,7 @@
 
 #include "GenericUndoPayload.h"
 #include "IUserInterface.h"
+#include "LayerRegionDelta.h"
 #include "ModelController.h"
 #include "ModelValidationSession.h"
 #include "OpenGLManager.h"
@@ -135,7 +136,7 @@ public:
         wxString actionTitle,
         StructuralLayerData && structuralLayer);
     void RestoreStructuralLayerRegionBackupForUndo(
-        StructuralLayerData && layerRegionBackup,
+        LayerRegionDelta<LayerType::Structural> && layerRegionBackup,
         ShipSpaceCoordinates const & origin);
     void RestoreStructuralLayerForUndo(std::unique_ptr<StructuralLayerData> structuralLayer);
 
@@ -147,7 +148,7 @@ public:
         ElectricalLayerData && electricalLayer);
     void RemoveElectricalLayer();
     void RestoreElectricalLayerRegionBackupForUndo(
-        ElectricalLayerData && layerRegionBackup,
+        LayerRegionDelta<LayerType::Electrical> && layerRegionBackup,
         ShipSpaceCoordinates const & origin);
     void RestoreElectricalLayerForUndo(std::unique_ptr<ElectricalLayerData> electricalLayer);
     void TrimElectricalParticlesWithoutSubstratum();
@@ -172,7 +173,7 @@ public:
         std::optional<std::string> textureArtCredits);
     void RemoveExteriorTextureLayer();
     void RestoreExteriorTextureLayerRegionBackupForUndo(
-        TextureLayerData && layerRegionBackup,
+        LayerRegionDelta<LayerType::ExteriorTexture> && layerRegionBackup,
         ImageCoordinates const & origin);
     void RestoreExteriorTextureLayerForUndo(
         std::unique_ptr<TextureLayerData> exteriorTextureLayer,
@@ -185,7 +186,7 @@ public:
         TextureLayerData && interiorTextureLayer);
     void RemoveInteriorTextureLayer();
     void RestoreInteriorTextureLayerRegionBackupForUndo(
-        TextureLayerData && layerRegionBackup,
+        LayerRegionDelta<LayerType::InteriorTexture> && layerRegionBackup,
         ImageCoordinates const & origin);
     void RestoreInteriorTextureLayerForUndo(std::unique_ptr<TextureLayerData> interiorTextureLayer);
 
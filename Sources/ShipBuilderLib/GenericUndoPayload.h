@@ -5,6 +5,8 @@
 ***************************************************************************************/
 #pragma once
 
+#include "LayerRegionDelta.h"
+
 #include <Simulation/Layers.h>
 
 #include <Core/GameTypes.h>
@@ -18,6 +20,9 @@ namespace ShipBuilder {
  * Generic undo payload for a region of the ship. Rules:
  * - Does *not* change the presence of layers
  * - Does *not* change the size of layers
+ *
+ * Region backups are stored as deltas against the layers as they are right after the
+ * edit, except for ropes, whose backup is whole.
  */
 class GenericUndoPayload final
 {
@@ -25,11 +30,11 @@ public:
 
 	ShipSpaceCoordinates Origin;
 
-	std::optional<StructuralLayerData> StructuralLayerRegionBackup;
-	std::optional<ElectricalLayerData> ElectricalLayerRegionBackup;
+	std::optional<LayerRegionDelta<LayerType::Structural>> StructuralLayerRegionBackup;
+	std::optional<LayerRegionDelta<LayerType::Electrical>> ElectricalLayerRegionBackup;
 	std::optional<RopesLayerData> RopesLayerRegionBackup;
-	std::optional<TextureLayerData> ExteriorTextureLayerRegionBackup;
-	std::optional<TextureLayerData> InteriorTextureLayerRegionBackup;
+	std::optional<LayerRegionDelta<LayerType::ExteriorTexture>> ExteriorTextureLayerRegionBackup;
+	std::optional<LayerRegionDelta<LayerType::InteriorTexture>> InteriorTextureLayerRegionBackup;
 
 	// Futurework: if needed, one day may add other elements, e.g. metadata
 
@@ -39,11 +44,11 @@ public:
 
 	GenericUndoPayload(
 		ShipSpaceCoordinates const & origin,
-		std::optional<StructuralLayerData> && structuralLayerRegionBackup,
-		std::optional<ElectricalLayerData > && electricalLayerRegionBackup,
+		std::optional<LayerRegionDelta<LayerType::Structural>> && structuralLayerRegionBackup,
+		std::optional<LayerRegionDelta<LayerType::Electrical>> && electricalLayerRegionBackup,
 		std::optional<RopesLayerData> && ropesLayerRegionBackup,
-		std::optional<TextureLayerData> && exteriorTextureLayerRegionBackup,
-		std::optional<TextureLayerData> && interiorTextureLayerRegionBackup)
+		std::optional<LayerRegionDelta<LayerType::ExteriorTexture>> && exteriorTextureLayerRegionBackup,
+		std::optional<LayerRegionDelta<LayerType::InteriorTexture>> && interiorTextureLayerRegionBackup)
 		: Origin(origin)
 		, StructuralLayerRegionBackup(std::move(structuralLayerRegionBackup))
 		, ElectricalLayerRegionBackup(std::move(electricalLayerRegionBackup))
@@ -55,11 +60,11 @@ public:
 	size_t GetTotalCost() const
 	{
 		return
-			(StructuralLayerRegionBackup ? StructuralLayerRegionBackup->Buffer.GetByteSize() : 0)
-			+ (ElectricalLayerRegionBackup ? ElectricalLayerRegionBackup->Buffer.GetByteSize() : 0)
+			(StructuralLayerRegionBackup ? StructuralLayerRegionBackup->GetByteSize() : 0)
+			+ (ElectricalLayerRegionBackup ? ElectricalLayerRegionBackup->GetByteSize() : 0)
 			+ (RopesLayerRegionBackup ? RopesLayerRegionBackup->Buffer.GetByteSize() : 0)
-			+ (ExteriorTextureLayerRegionBackup ? ExteriorTextureLayerRegionBackup->Buffer.GetByteSize() : 0)
-			+ (InteriorTextureLayerRegionBackup ? InteriorTextureLayerRegionBackup->Buffer.GetByteSize() : 0);
+			+ (ExteriorTextureLayerRegionBackup ? ExteriorTextureLayerRegionBackup->GetByteSize() : 0)
+			+ (InteriorTextureLayerRegionBackup ? InteriorTextureLayerRegionBackup->GetByteSize() : 0);
 	}
 
 	std::vector<LayerType> GetAffectedLayers() const
@@ -0,0 +1,67 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2025-07-24
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <Simulation/Layers.h>
+
+#include <Core/Buffer2DRegionDelta.h>
+#include <Core/GameTypes.h>
+
+namespace ShipBuilder {
+
+/*
+ * The backup of a region of a layer, for undo, stored as a delta against the layer
+ * as it is right after the edit being undone - so that only the elements touched
+ * by the edit are kept.
+ *
+ * Undo actions are applied in reverse order, hence when an action is undone the layer
+ * is back to how it was right after the action's edit, and the backup may be rebuilt
+ * from it.
+ */
+template<LayerType TLayer>
+class LayerRegionDelta final
+{
+public:
+
+    static_assert(TLayer != LayerType::Ropes, "Rope buffers are not region-based");
+
+    using layer_data_type = typename LayerTypeTraits<TLayer>::layer_data_type;
+    using buffer_type = typename LayerTypeTraits<TLayer>::buffer_type;
+    using coordinates_type = typename buffer_type::coordinates_type;
+
+public:
+
+    LayerRegionDelta(
+        layer_data_type && regionBackup,
+        layer_data_type const & layer, // As it is after the edit
+        coordinates_type const & origin)
+        : mBufferDelta(Buffer2DRegionDelta<buffer_type>::Make(regionBackup.Buffer, layer.Buffer, origin))
+        , mRegionBackupRemainder(std::move(regionBackup))
+    {
+        // Drop the buffer, keeping whatever else the backup carries (e.g. the electrical panel)
+        mRegionBackupRemainder.Buffer = buffer_type(0, 0);
+    }
+
+    layer_data_type MakeRegionBackup(
+        layer_data_type const & layer, // As it was after the edit
+        coordinates_type const & origin) &&
+    {
+        mRegionBackupRemainder.Buffer = mBufferDelta.MakeRegionBuffer(layer.Buffer, origin);
+        return std::move(mRegionBackupRemainder);
+    }
+
+    size_t GetByteSize() const
+    {
+        return mBufferDelta.GetByteSize();
+    }
+
+private:
+
+    Buffer2DRegionDelta<buffer_type> mBufferDelta;
+    layer_data_type mRegionBackupRemainder;
+};
+
+}
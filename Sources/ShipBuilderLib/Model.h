@@ -209,6 +209,33 @@ public:
         }
     }
 
+    template<LayerType TLayer>
+    typename LayerTypeTraits<TLayer>::layer_data_type const & GetExistingLayer() const
+    {
+        if constexpr (TLayer == LayerType::Structural)
+        {
+            return GetStructuralLayer();
+        }
+        else if constexpr (TLayer == LayerType::Electrical)
+        {
+            return GetElectricalLayer();
+        }
+        else if constexpr (TLayer == LayerType::Ropes)
+        {
+            return GetRopesLayer();
+        }
+        else if constexpr (TLayer == LayerType::ExteriorTexture)
+        {
+            return GetExteriorTextureLayer();
+        }
+        else
+        {
+            static_assert(TLayer == LayerType::InteriorTexture);
+
+            return GetInteriorTextureLayer();
+        }
+    }
+
     StructuralLayerData const & GetStructuralLayer() const
     {
         assert(mLayers.StructuralLayer);
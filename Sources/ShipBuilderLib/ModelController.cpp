@@ -5,6 +5,8 @@
 ***************************************************************************************/
 #include "ModelController.h"
 
+#include <Core/GameChronometer.h>
+
 #include <cassert>
 #include <queue>
 
@@ -50,6 +52,9 @@ ModelController::ModelController(
     , mGameVisualizationAutoTexturizationTexture()
     , mGameVisualizationTexture()
     , mGameVisualizationTextureMagnificationFactor(0)
+    , mDirtyGameVisualizationTiles()
+    , mGameVisualizationTileColumnCount(0)
+    , mDirtyGameVisualizationTileCount(0)
     , mStructuralLayerVisualizationMode(StructuralLayerVisualizationModeType::None)
     , mStructuralLayerVisualizationTexture()
     , mElectricalLayerVisualizationMode(ElectricalLayerVisualizationModeType::None)
@@ -510,17 +515,43 @@ GenericUndoPayload ModelController::EraseRegion(
     ShipSpaceRect const & region,
     std::optional<LayerType> const & layerSelection)
 {
+    // The region is entirely within the ship
+    assert(region.IsContainedInRect(GetWholeShipRect()));
+
     //
     // Prepare undo
     //
 
-    GenericUndoPayload undoPayload = MakeGenericUndoPayload(
-        region,
-        CheckLayerSelectionApplicability(layerSelection, LayerType::Structural),
-        CheckLayerSelectionApplicability(layerSelection, LayerType::Electrical),
-        CheckLayerSelectionApplicability(layerSelection, LayerType::Ropes),
-        CheckLayerSelectionApplicability(layerSelection, LayerType::ExteriorTexture),
-        CheckLayerSelectionApplicability(layerSelection, LayerType::InteriorTexture));
+    std::optional<StructuralLayerData> structuralLayerRegionBackup;
+    std::optional<ElectricalLayerData> electricalLayerRegionBackup;
+    std::optional<RopesLayerData> ropesLayerRegionBackup;
+    std::optional<TextureLayerData> exteriorTextureLayerRegionBackup;
+    std::optional<TextureLayerData> interiorTextureLayerRegionBackup;
+
+    if (CheckLayerSelectionApplicability(layerSelection, LayerType::Structural))
+    {
+        structuralLayerRegionBackup = mModel.GetStructuralLayer().MakeRegionBackup(region);
+    }
+
+    if (CheckLayerSelectionApplicability(layerSelection, LayerType::Electrical))
+    {
+        electricalLayerRegionBackup = mModel.GetElectricalLayer().MakeRegionBackup(region);
+    }
+
+    if (CheckLayerSelectionApplicability(layerSelection, LayerType::Ropes))
+    {
+        ropesLayerRegionBackup = mModel.GetRopesLayer().MakeRegionBackup(region);
+    }
+
+    if (CheckLayerSelectionApplicability(layerSelection, LayerType::ExteriorTexture))
+    {
+        exteriorTextureLayerRegionBackup = mModel.GetExteriorTextureLayer().MakeRegionBackup(ShipSpaceToExteriorTextureSpace(region));
+    }
+
+    if (CheckLayerSelectionApplicability(layerSelection, LayerType::InteriorTexture))
+    {
+        interiorTextureLayerRegionBackup = mModel.GetInteriorTextureLayer().MakeRegionBackup(ShipSpaceToInteriorTextureSpace(region));
+    }
 
     //
     // Erase
@@ -551,7 +582,13 @@ GenericUndoPayload ModelController::EraseRegion(
         EraseInteriorTextureRegion(ShipSpaceToInteriorTextureSpace(region));
     }
 
-    return undoPayload;
+    return MakeGenericUndoPayload(
+        region.origin,
+        std::move(structuralLayerRegionBackup),
+        std::move(electricalLayerRegionBackup),
+        std::move(ropesLayerRegionBackup),
+        std::move(exteriorTextureLayerRegionBackup),
+        std::move(interiorTextureLayerRegionBackup));
 }
 
 GenericUndoPayload ModelController::Paste(
@@ -791,7 +828,7 @@ GenericUndoPayload ModelController::Paste(
         }
     }
 
-    return GenericUndoPayload(
+    return MakeGenericUndoPayload(
         actualPasteOriginShip,
         std::move(structuralLayerRegionBackup),
         std::move(electricalLayerRegionBackup),
@@ -811,7 +848,7 @@ void ModelController::Restore(GenericUndoPayload && undoPayload)
             case LayerType::Structural:
             {
                 RestoreStructuralLayerRegionBackup(
-                    std::move(*undoPayload.StructuralLayerRegionBackup),
+                    MakeLayerRegionBackup(std::move(*undoPayload.StructuralLayerRegionBackup), undoPayload.Origin),
                     undoPayload.Origin);
 
                 break;
@@ -820,7 +857,7 @@ void ModelController::Restore(GenericUndoPayload && undoPayload)
             case LayerType::Electrical:
             {
                 RestoreElectricalLayerRegionBackup(
-                    std::move(*undoPayload.ElectricalLayerRegionBackup),
+                    MakeLayerRegionBackup(std::move(*undoPayload.ElectricalLayerRegionBackup), undoPayload.Origin),
                     undoPayload.Origin);
 
                 break;
@@ -837,18 +874,22 @@ void ModelController::Restore(GenericUndoPayload && undoPayload)
 
             case LayerType::ExteriorTexture:
             {
+                ImageCoordinates const textureOrigin = ShipSpaceToExteriorTextureSpace(undoPayload.Origin);
+
                 RestoreExteriorTextureLayerRegionBackup(
-                    std::move(*undoPayload.ExteriorTextureLayerRegionBackup),
-                    ShipSpaceToExteriorTextureSpace(undoPayload.Origin));
+                    MakeLayerRegionBackup(std::move(*undoPayload.ExteriorTextureLayerRegionBackup), textureOrigin),
+                    textureOrigin);
 
                 break;
             }
 
             case LayerType::InteriorTexture:
             {
+                ImageCoordinates const textureOrigin = ShipSpaceToInteriorTextureSpace(undoPayload.Origin);
+
                 RestoreInteriorTextureLayerRegionBackup(
-                    std::move(*undoPayload.InteriorTextureLayerRegionBackup),
-                    ShipSpaceToInteriorTextureSpace(undoPayload.Origin));
+                    MakeLayerRegionBackup(std::move(*undoPayload.InteriorTextureLayerRegionBackup), textureOrigin),
+                    textureOrigin);
 
                 break;
             }
@@ -1279,7 +1320,7 @@ GenericUndoPayload ModelController::StructuralRectangle(
     RegisterDirtyVisualization<VisualizationType::Game>(rect);
     RegisterDirtyVisualization<VisualizationType::StructuralLayer>(rect);
 
-    return GenericUndoPayload(
+    return MakeGenericUndoPayload(
         rect.origin,
         std::move(structuralLayerRegionBackup),
         std::nullopt,
@@ -1336,7 +1377,7 @@ GenericUndoPayload ModelController::StructureTrace(
 
     // Note: DoStructuralRegionBufferPaste also updates viz
 
-    return GenericUndoPayload(
+    return MakeGenericUndoPayload(
         shipRect.origin,
         std::move(structuralLayerRegionBackup),
         std::nullopt,
@@ -2645,6 +2686,12 @@ void ModelController::UpdateVisualizations(
 
     if (mGameVisualizationMode != GameVisualizationModeType::None)
     {
+        bool isWholeTextureToBeUploaded = !view.HasGameVisualization();
+
+        // Only updates of edited regions are spread across frames; a whole refresh - e.g. of a
+        // new texture - is rendered at once, or else it would look incomplete for a few frames
+        bool isWholeVisualizationToBeUpdated = false;
+
         if (!mGameVisualizationTexture)
         {
             // Initialize game visualization texture
@@ -2655,7 +2702,13 @@ void ModelController::UpdateVisualizations(
                 mModel.GetShipSize().width * mGameVisualizationTextureMagnificationFactor,
                 mModel.GetShipSize().height * mGameVisualizationTextureMagnificationFactor);
 
-            mGameVisualizationTexture = std::make_unique<RgbaImageData>(textureSize);
+            mGameVisualizationTexture = std::make_unique<RgbaImageData>(textureSize, rgbaColor::zero());
+
+            ResetGameVisualizationTiles();
+
+            // All of it, as the whole ship is dirty
+            isWholeTextureToBeUploaded = true;
+            isWholeVisualizationToBeUpdated = true;
         }
 
         if (mGameVisualizationMode == GameVisualizationModeType::AutoTexturizationMode && !mGameVisualizationAutoTexturizationTexture)
@@ -2666,11 +2719,37 @@ void ModelController::UpdateVisualizations(
 
         if (mDirtyGameVisualizationRegion.has_value())
         {
+            if (GetWholeShipRect().IsContainedInRect(*mDirtyGameVisualizationRegion))
+            {
+                isWholeVisualizationToBeUpdated = true;
+            }
+
+            RegisterDirtyGameVisualizationTiles(*mDirtyGameVisualizationRegion);
+        }
+
+        //
+        // Update dirty tiles, leaving to the next updates those we don't have time for - unless
+        // we're refreshing the whole visualization; a tile that gets dirty again before being
+        // updated is only updated once
+        //
+
+        auto const startTime = GameChronometer::Now();
+
+        for (size_t t = 0; t < mDirtyGameVisualizationTiles.size() && mDirtyGameVisualizationTileCount > 0; ++t)
+        {
+            if (!mDirtyGameVisualizationTiles[t].has_value())
+            {
+                continue;
+            }
+
             // Update visualization
-            ImageRect const dirtyTextureRegion = UpdateGameVisualization(*mDirtyGameVisualizationRegion, gameAssetManager);
+            ImageRect const dirtyTextureRegion = UpdateGameVisualization(*mDirtyGameVisualizationTiles[t], gameAssetManager);
+
+            mDirtyGameVisualizationTiles[t].reset();
+            --mDirtyGameVisualizationTileCount;
 
             // Upload visualization
-            if (dirtyTextureRegion != ImageRect(mGameVisualizationTexture->Size))
+            if (!isWholeTextureToBeUploaded)
             {
                 //
                 // For better performance, we only upload the dirty sub-texture
@@ -2686,17 +2765,27 @@ void ModelController::UpdateVisualizations(
                     subTexture,
                     dirtyTextureRegion.origin);
             }
-            else
+
+            if (!isWholeVisualizationToBeUpdated
+                && GameChronometer::Now() - startTime >= GameVisualizationUpdateTimeBudget)
             {
-                // Upload whole texture
-                view.UploadGameVisualization(*mGameVisualizationTexture);
+                break;
             }
         }
+
+        if (isWholeTextureToBeUploaded)
+        {
+            // Upload whole texture
+            view.UploadGameVisualization(*mGameVisualizationTexture);
+        }
     }
     else
     {
         assert(!mGameVisualizationTexture);
 
+        mDirtyGameVisualizationTiles.clear();
+        mDirtyGameVisualizationTileCount = 0;
+
         if (view.HasGameVisualization())
         {
             view.RemoveGameVisualization();
@@ -3654,70 +3743,48 @@ std::optional<ImageRect> ModelController::DoTextureMagicWandEraseBackground(
 }
 
 GenericUndoPayload ModelController::MakeGenericUndoPayload(
-    std::optional<ShipSpaceRect> const & region,
-    bool doStructuralLayer,
-    bool doElectricalLayer,
-    bool doRopesLayer,
-    bool doExteriorTextureLayer,
-    bool doInteriorTextureLayer) const
+    ShipSpaceCoordinates const & origin,
+    std::optional<StructuralLayerData> && structuralLayerRegionBackup,
+    std::optional<ElectricalLayerData> && electricalLayerRegionBackup,
+    std::optional<RopesLayerData> && ropesLayerRegionBackup,
+    std::optional<TextureLayerData> && exteriorTextureLayerRegionBackup,
+    std::optional<TextureLayerData> && interiorTextureLayerRegionBackup) const
 {
-    ShipSpaceRect actualRegion = region.value_or(GetWholeShipRect());
-
-    // The requested region is entirely within the ship
-    assert(actualRegion.IsContainedInRect(GetWholeShipRect()));
-
-    std::optional<StructuralLayerData> structuralLayerRegionBackup;
-    std::optional<ElectricalLayerData> electricalLayerRegionBackup;
-    std::optional<RopesLayerData> ropesLayerRegionBackup;
-    std::optional<TextureLayerData> exteriorTextureLayerRegionBackup;
-    std::optional<TextureLayerData> interiorTextureLayerRegionBackup;
+    //
+    // Store region backups as deltas against the layers as they are now, i.e. after the edit
+    //
 
-    if (doStructuralLayer)
+    std::optional<LayerRegionDelta<LayerType::Structural>> structuralLayerRegionDelta;
+    if (structuralLayerRegionBackup.has_value())
     {
-        structuralLayerRegionBackup = mModel.GetStructuralLayer().MakeRegionBackup(actualRegion);
+        structuralLayerRegionDelta.emplace(MakeLayerRegionDelta<LayerType::Structural>(std::move(*structuralLayerRegionBackup), origin));
     }
 
-    if (doElectricalLayer)
+    std::optional<LayerRegionDelta<LayerType::Electrical>> electricalLayerRegionDelta;
+    if (electricalLayerRegionBackup.has_value())
     {
-        electricalLayerRegionBackup = mModel.GetElectricalLayer().MakeRegionBackup(actualRegion);
+        electricalLayerRegionDelta.emplace(MakeLayerRegionDelta<LayerType::Electrical>(std::move(*electricalLayerRegionBackup), origin));
     }
 
-    if (doRopesLayer)
+    std::optional<LayerRegionDelta<LayerType::ExteriorTexture>> exteriorTextureLayerRegionDelta;
+    if (exteriorTextureLayerRegionBackup.has_value())
     {
-        ropesLayerRegionBackup = mModel.GetRopesLayer().MakeRegionBackup(actualRegion);
+        exteriorTextureLayerRegionDelta.emplace(MakeLayerRegionDelta<LayerType::ExteriorTexture>(std::move(*exteriorTextureLayerRegionBackup), ShipSpaceToExteriorTextureSpace(origin)));
     }
 
-    if (doExteriorTextureLayer)
+    std::optional<LayerRegionDelta<LayerType::InteriorTexture>> interiorTextureLayerRegionDelta;
+    if (interiorTextureLayerRegionBackup.has_value())
     {
-        // The requested region - if any - is entirely within the ship
-        assert(!region.has_value() || ShipSpaceToExteriorTextureSpace(*region).IsContainedInRect(GetWholeExteriorTextureRect()));
-
-        ImageRect actualTextureRegion = region.has_value()
-            ? ShipSpaceToExteriorTextureSpace(*region)
-            : GetWholeExteriorTextureRect();
-
-        exteriorTextureLayerRegionBackup = mModel.GetExteriorTextureLayer().MakeRegionBackup(actualTextureRegion);
-    }
-
-    if (doInteriorTextureLayer)
-    {
-        // The requested region - if any - is entirely within the ship
-        assert(!region.has_value() || ShipSpaceToInteriorTextureSpace(*region).IsContainedInRect(GetWholeInteriorTextureRect()));
-
-        ImageRect actualTextureRegion = region.has_value()
-            ? ShipSpaceToInteriorTextureSpace(*region)
-            : GetWholeInteriorTextureRect();
-
-        interiorTextureLayerRegionBackup = mModel.GetInteriorTextureLayer().MakeRegionBackup(actualTextureRegion);
+        interiorTextureLayerRegionDelta.emplace(MakeLayerRegionDelta<LayerType::InteriorTexture>(std::move(*interiorTextureLayerRegionBackup), ShipSpaceToInteriorTextureSpace(origin)));
     }
 
     return GenericUndoPayload(
-        actualRegion.origin,
-        std::move(structuralLayerRegionBackup),
-        std::move(electricalLayerRegionBackup),
-        std::move(ropesLayerRegionBackup),
-        std::move(exteriorTextureLayerRegionBackup),
-        std::move(interiorTextureLayerRegionBackup));
+        origin,
+        std::move(structuralLayerRegionDelta),
+        std::move(electricalLayerRegionDelta),
+        std::move(ropesLayerRegionBackup), // Ropes are whole
+        std::move(exteriorTextureLayerRegionDelta),
+        std::move(interiorTextureLayerRegionDelta));
 }
 
 GenericEphemeralVisualizationRestorePayload ModelController::MakeGenericEphemeralVisualizationRestorePayload(
@@ -4032,6 +4099,60 @@ void ModelController::RegisterDirtyVisualization(TRect const & region)
     }
 }
 
+void ModelController::ResetGameVisualizationTiles()
+{
+    mGameVisualizationTileColumnCount = (mModel.GetShipSize().width + GameVisualizationTileSize - 1) / GameVisualizationTileSize;
+    int const tileRowCount = (mModel.GetShipSize().height + GameVisualizationTileSize - 1) / GameVisualizationTileSize;
+
+    mDirtyGameVisualizationTiles.assign(
+        static_cast<size_t>(mGameVisualizationTileColumnCount) * static_cast<size_t>(tileRowCount),
+        std::nullopt);
+    mDirtyGameVisualizationTileCount = 0;
+}
+
+void ModelController::RegisterDirtyGameVisualizationTiles(ShipSpaceRect const & dirtyRegion)
+{
+    auto const clippedRegion = dirtyRegion.MakeIntersectionWith(GetWholeShipRect());
+    if (!clippedRegion.has_value() || clippedRegion->IsEmpty())
+    {
+        return;
+    }
+
+    ShipSpaceRect const & region = *clippedRegion;
+
+    int const tileXStart = region.origin.x / GameVisualizationTileSize;
+    int const tileXEnd = (region.origin.x + region.size.width - 1) / GameVisualizationTileSize + 1;
+    int const tileYStart = region.origin.y / GameVisualizationTileSize;
+    int const tileYEnd = (region.origin.y + region.size.height - 1) / GameVisualizationTileSize + 1;
+
+    for (int tileY = tileYStart; tileY < tileYEnd; ++tileY)
+    {
+        for (int tileX = tileXStart; tileX < tileXEnd; ++tileX)
+        {
+            ShipSpaceRect const tileRect(
+                ShipSpaceCoordinates(tileX * GameVisualizationTileSize, tileY * GameVisualizationTileSize),
+                ShipSpaceSize(GameVisualizationTileSize, GameVisualizationTileSize));
+
+            auto const tileDirtyRegion = region.MakeIntersectionWith(tileRect);
+            assert(tileDirtyRegion.has_value());
+
+            size_t const tileIndex = static_cast<size_t>(tileY) * static_cast<size_t>(mGameVisualizationTileColumnCount) + static_cast<size_t>(tileX);
+            assert(tileIndex < mDirtyGameVisualizationTiles.size());
+
+            auto & tile = mDirtyGameVisualizationTiles[tileIndex];
+            if (!tile.has_value())
+            {
+                tile = *tileDirtyRegion;
+                ++mDirtyGameVisualizationTileCount;
+            }
+            else
+            {
+                tile->UnionWith(*tileDirtyRegion);
+            }
+        }
+    }
+}
+
 ImageRect ModelController::UpdateGameVisualization(
     ShipSpaceRect const & region,
     GameAssetManager const & gameAssetManager)
@@ -9,6 +9,7 @@
 #include "GenericUndoPayload.h"
 #include "IModelObservable.h"
 #include "InstancedElectricalElementSet.h"
+#include "LayerRegionDelta.h"
 #include "Model.h"
 #include "ModelValidationSession.h"
 #include "ShipBuilderTypes.h"
@@ -26,6 +27,7 @@
 #include <Core/ImageData.h>
 
 #include <array>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -183,41 +185,42 @@ public:
     template<LayerType TLayer>
     typename LayerTypeTraits<TLayer>::layer_data_type CloneExistingLayer() const
     {
-        switch (TLayer)
-        {
-            case LayerType::Electrical:
-            {
-                assert(!mIsElectricalLayerInEphemeralVisualization);
-                break;
-            }
-
-            case LayerType::Ropes:
-            {
-                assert(!mIsRopesLayerInEphemeralVisualization);
-                break;
-            }
+        AssertIsNotInEphemeralVisualization<TLayer>();
 
-            case LayerType::Structural:
-            {
-                assert(!mIsStructuralLayerInEphemeralVisualization);
-                break;
-            }
+        return mModel.CloneExistingLayer<TLayer>();
+    }
 
-            case LayerType::ExteriorTexture:
-            {
-                assert(!mIsExteriorTextureLayerInEphemeralVisualization);
-                break;
-            }
+    /*
+     * Makes an undo backup of a region of a layer, as a delta against the layer as it is
+     * now, i.e. right after the edit being undone.
+     */
+    template<LayerType TLayer>
+    LayerRegionDelta<TLayer> MakeLayerRegionDelta(
+        typename LayerTypeTraits<TLayer>::layer_data_type && regionBackup,
+        typename LayerRegionDelta<TLayer>::coordinates_type const & origin) const
+    {
+        AssertIsNotInEphemeralVisualization<TLayer>();
 
-            case LayerType::InteriorTexture:
-            {
-                assert(!mIsInteriorTextureLayerInEphemeralVisualization);
-                break;
-            }
+        return LayerRegionDelta<TLayer>(
+            std::move(regionBackup),
+            mModel.GetExistingLayer<TLayer>(),
+            origin);
+    }
 
-        }
+    /*
+     * Rebuilds an undo backup of a region of a layer from its delta; the layer is expected to
+     * be as it was right after the edit being undone.
+     */
+    template<LayerType TLayer>
+    typename LayerTypeTraits<TLayer>::layer_data_type MakeLayerRegionBackup(
+        LayerRegionDelta<TLayer> && layerRegionDelta,
+        typename LayerRegionDelta<TLayer>::coordinates_type const & origin) const
+    {
+        AssertIsNotInEphemeralVisualization<TLayer>();
 
-        return mModel.CloneExistingLayer<TLayer>();
+        return std::move(layerRegionDelta).MakeRegionBackup(
+            mModel.GetExistingLayer<TLayer>(),
+            origin);
     }
 
     ShipLayers Copy(
@@ -539,6 +542,15 @@ public:
         View & view,
         GameAssetManager const & gameAssetManager);
 
+    /*
+     * Whether UpdateVisualizations() has left parts of the game visualization
+     * to be updated at its next invocations.
+     */
+    bool HasPendingGameVisualizationUpdates() const
+    {
+        return mDirtyGameVisualizationTileCount > 0;
+    }
+
     //
     // Coords
     //
@@ -561,6 +573,44 @@ private:
         Model && model,
         ShipTexturizer const & shipTexturizer);
 
+    template<LayerType TLayer>
+    void AssertIsNotInEphemeralVisualization() const
+    {
+        switch (TLayer)
+        {
+            case LayerType::Electrical:
+            {
+                assert(!mIsElectricalLayerInEphemeralVisualization);
+                break;
+            }
+
+            case LayerType::Ropes:
+            {
+                assert(!mIsRopesLayerInEphemeralVisualization);
+                break;
+            }
+
+            case LayerType::Structural:
+            {
+                assert(!mIsStructuralLayerInEphemeralVisualization);
+                break;
+            }
+
+            case LayerType::ExteriorTexture:
+            {
+                assert(!mIsExteriorTextureLayerInEphemeralVisualization);
+                break;
+            }
+
+            case LayerType::InteriorTexture:
+            {
+                assert(!mIsInteriorTextureLayerInEphemeralVisualization);
+                break;
+            }
+
+        }
+    }
+
     inline ShipSpaceRect GetWholeShipRect() const
     {
         return ShipSpaceRect(mModel.GetShipSize());
@@ -635,12 +685,12 @@ private:
         TextureLayerData & layer);
 
     GenericUndoPayload MakeGenericUndoPayload(
-        std::optional<ShipSpaceRect> const & region,
-        bool doStructuralLayer,
-        bool doElectricalLayer,
-        bool doRopesLayer,
-        bool doExteriorTextureLayer,
-        bool doInteriorTextureLayer) const;
+        ShipSpaceCoordinates const & origin,
+        std::optional<StructuralLayerData> && structuralLayerRegionBackup,
+        std::optional<ElectricalLayerData> && electricalLayerRegionBackup,
+        std::optional<RopesLayerData> && ropesLayerRegionBackup,
+        std::optional<TextureLayerData> && exteriorTextureLayerRegionBackup,
+        std::optional<TextureLayerData> && interiorTextureLayerRegionBackup) const;
 
     GenericEphemeralVisualizationRestorePayload MakeGenericEphemeralVisualizationRestorePayload(
         ShipSpaceRect const & region,
@@ -695,6 +745,10 @@ private:
     template<VisualizationType TVisualization, typename TRect>
     void RegisterDirtyVisualization(TRect const & region);
 
+    void ResetGameVisualizationTiles();
+
+    void RegisterDirtyGameVisualizationTiles(ShipSpaceRect const & dirtyRegion);
+
     ImageRect UpdateGameVisualization(
         ShipSpaceRect const & region,
         GameAssetManager const & gameAssetManager);
@@ -739,6 +793,14 @@ private:
     std::unique_ptr<RgbaImageData> mGameVisualizationTexture;
     int mGameVisualizationTextureMagnificationFactor;
 
+    // The game visualization is updated by tiles, each with its own dirty region,
+    // so that the update of a large region may be spread across multiple frames
+    static int constexpr GameVisualizationTileSize = 32; // Ship space
+    static constexpr std::chrono::milliseconds GameVisualizationUpdateTimeBudget = std::chrono::milliseconds(15);
+    std::vector<std::optional<ShipSpaceRect>> mDirtyGameVisualizationTiles;
+    int mGameVisualizationTileColumnCount;
+    size_t mDirtyGameVisualizationTileCount;
+
     StructuralLayerVisualizationModeType mStructuralLayerVisualizationMode;
     std::unique_ptr<RgbaImageData> mStructuralLayerVisualizationTexture;
 
@@ -101,8 +101,10 @@ void FloodTool<TLayer>::DoEdit(
     {
         // Create undo action
 
-        auto clippedLayerBackup = layerClone.MakeRegionBackup(*affectedRegion);
-        auto const cloneByteSize = layerClone.Buffer.GetByteSize();
+        auto clippedLayerBackup = mController.GetModelController().template MakeLayerRegionDelta<TLayer>(
+            layerClone.MakeRegionBackup(*affectedRegion),
+            affectedRegion->origin);
+        auto const cloneByteSize = clippedLayerBackup.GetByteSize();
 
         mController.StoreUndoAction(
             TLayer == LayerType::Structural ? _("Flood Structural") : _("Flood Electrical"),
@@ -291,8 +291,10 @@ void LineTool<TLayer>::EndEngagement(ShipSpaceCoordinates const & mouseCoordinat
         // Create undo action
         //
 
-        auto clippedLayerBackup = mOriginalLayerClone.MakeRegionBackup(*resultantEffectiveRect);
-        auto const clipByteSize = clippedLayerBackup.Buffer.GetByteSize();
+        auto clippedLayerBackup = mController.GetModelController().template MakeLayerRegionDelta<TLayer>(
+            mOriginalLayerClone.MakeRegionBackup(*resultantEffectiveRect),
+            resultantEffectiveRect->origin);
+        auto const clipByteSize = clippedLayerBackup.GetByteSize();
 
         mController.StoreUndoAction(
             TLayer == LayerType::Structural ? _("Line Structural") : _("Line Electrical"),
@@ -439,8 +439,10 @@ void PencilTool<TLayer, IsEraser>::EndEngagement()
         // Create undo action
         //
 
-        auto clippedLayerBackup = mOriginalLayerClone.MakeRegionBackup(*mEngagementData->EditRegion);
-        auto const clipByteSize = clippedLayerBackup.Buffer.GetByteSize();
+        auto clippedLayerBackup = mController.GetModelController().template MakeLayerRegionDelta<TLayer>(
+            mOriginalLayerClone.MakeRegionBackup(*mEngagementData->EditRegion),
+            mEngagementData->EditRegion->origin);
+        auto const clipByteSize = clippedLayerBackup.GetByteSize();
 
         mController.StoreUndoAction(
             IsEraser
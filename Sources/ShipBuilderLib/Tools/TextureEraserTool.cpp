@@ -314,8 +314,10 @@ void TextureEraserTool<TLayerType>::EndEngagement()
         // Create undo action
         //
 
-        auto clippedLayerBackup = mOriginalLayerClone.MakeRegionBackup(*mEngagementData->EditRegion);
-        auto const clipByteSize = clippedLayerBackup.Buffer.GetByteSize();
+        auto clippedLayerBackup = mController.GetModelController().MakeLayerRegionDelta<TLayerType>(
+            mOriginalLayerClone.MakeRegionBackup(*mEngagementData->EditRegion),
+            mEngagementData->EditRegion->origin);
+        auto const clipByteSize = clippedLayerBackup.GetByteSize();
 
         if constexpr (TLayerType == LayerType::ExteriorTexture)
         {
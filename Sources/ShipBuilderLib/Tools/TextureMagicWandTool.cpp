@@ -77,8 +77,10 @@ void TextureMagicWandTool<TLayerType>::OnLeftMouseDown()
         {
             // Create undo action
 
-            auto clippedLayerBackup = layerClone.MakeRegionBackup(*affectedRegion);
-            auto const cloneByteSize = clippedLayerBackup.Buffer.GetByteSize();
+            auto clippedLayerBackup = mController.GetModelController().MakeLayerRegionDelta<TLayerType>(
+                layerClone.MakeRegionBackup(*affectedRegion),
+                affectedRegion->origin);
+            auto const cloneByteSize = clippedLayerBackup.GetByteSize();
 
             mController.StoreUndoAction(
                 _("Background Erase"),
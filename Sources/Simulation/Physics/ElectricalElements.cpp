@@ -1508,8 +1508,6 @@ void ElectricalElements::UpdateSourcesAndPropagation(
     // by means of visit sequence number
     //
 
-    std::queue<ElementIndex> electricalElementsToVisit;
-
     for (auto const sourceElementIndex : mSources)
     {
         // Do not visit deleted sources
@@ -1635,14 +1633,13 @@ void ElectricalElements::UpdateSourcesAndPropagation(
                 mCurrentConnectivityVisitSequenceNumberBuffer[sourceElementIndex] = newConnectivityVisitSequenceNumber;
 
                 // Add source to queue
-                assert(electricalElementsToVisit.empty());
-                electricalElementsToVisit.push(sourceElementIndex);
+                mElectricalElementsToVisit.clear();
+                mElectricalElementsToVisit.push_back(sourceElementIndex);
 
                 // Visit all electrical elements electrically reachable from this source
-                while (!electricalElementsToVisit.empty())
+                for (size_t v = 0; v < mElectricalElementsToVisit.size(); ++v)
                 {
-                    auto const e = electricalElementsToVisit.front();
-                    electricalElementsToVisit.pop();
+                    auto const e = mElectricalElementsToVisit[v];
 
                     // Already marked as visited
                     assert(newConnectivityVisitSequenceNumber == mCurrentConnectivityVisitSequenceNumberBuffer[e]);
@@ -1658,7 +1655,7 @@ void ElectricalElements::UpdateSourcesAndPropagation(
                             mCurrentConnectivityVisitSequenceNumberBuffer[cce] = newConnectivityVisitSequenceNumber;
 
                             // Add to queue
-                            electricalElementsToVisit.push(cce);
+                            mElectricalElementsToVisit.push_back(cce);
                         }
                     }
                 }
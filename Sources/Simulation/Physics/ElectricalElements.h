@@ -511,6 +511,7 @@ public:
         , mEngineControllers()
         , mEngines()
         , mJetEnginesSortedByPlaneId()
+        , mElectricalElementsToVisit()
         , mCurrentLightSpreadAdjustment(simulationParameters.LightSpreadAdjustment)
         , mCurrentLuminiscenceAdjustment(simulationParameters.LuminiscenceAdjustment)
         , mHasConnectivityStructureChangedInCurrentStep(true)
@@ -979,6 +980,10 @@ private:
     // never changes size, only order
     std::vector<ElementIndex> mJetEnginesSortedByPlaneId;
 
+    // Queue of the visit from sources at each step - consumed by advancing through it,
+    // in the same order as a FIFO - kept here so that it only grows once
+    std::vector<ElementIndex> mElectricalElementsToVisit;
+
     // The game parameter values that we are current with; changes
     // in the values of these parameters will trigger a re-calculation
     // of pre-calculated coefficients
@@ -32,7 +32,12 @@ Fishes::Fishes(
     , mSimulationEventHandler(simulationEventDispatcher)
     , mFishShoals()
     , mFishes()
+    , mFishCurrentPositions()
+    , mFishTargetVelocities()
+    , mFishLastSteeringSimulationTimes()
+    , mShoalGrid(1.0f, 64)
     , mInteractions()
+    , mOceanSurfaceDisplacements()
     , mCurrentFishSizeMultiplier(0.0f)
     , mCurrentFishSpeedAdjustment(0.0f)
     , mCurrentDoFishShoaling(false)
@@ -41,7 +46,7 @@ Fishes::Fishes(
 
 void Fishes::Update(
     float currentSimulationTime,
-    OceanSurface & oceanSurface,
+    OceanSurface const & oceanSurface,
     OceanFloor const & oceanFloor,
     SimulationParameters const & simulationParameters,
     VisibleWorld const & visibleWorld,
@@ -64,10 +69,12 @@ void Fishes::Update(
             ? simulationParameters.FishSizeMultiplier / mCurrentFishSizeMultiplier
             : 1.0f;
 
-        for (auto & fish : mFishes)
+        for (size_t f = 0; f < mFishes.size(); ++f)
         {
+            Fish & fish = mFishes[f];
+
             fish.CurrentVelocity *= speedFactor * sizeFactor;
-            fish.TargetVelocity *= speedFactor * sizeFactor;
+            mFishTargetVelocities[f] *= speedFactor * sizeFactor;
             fish.ShoalingVelocity *= speedFactor * sizeFactor;
             // No need to change render direction, velocity hasn't changed direction
 
@@ -142,12 +149,24 @@ void Fishes::Update(
     }
 }
 
+void Fishes::ApplyOceanSurfaceDisplacements(OceanSurface & oceanSurface)
+{
+    for (auto const & [x, magnitude] : mOceanSurfaceDisplacements)
+    {
+        oceanSurface.DisplaceAt(x, magnitude);
+    }
+
+    mOceanSurfaceDisplacements.clear();
+}
+
 void Fishes::Upload(RenderContext & renderContext) const
 {
     renderContext.UploadFishesStart(mFishes.size());
 
-    for (auto const & fish : mFishes)
+    for (size_t f = 0; f < mFishes.size(); ++f)
     {
+        Fish const & fish = mFishes[f];
+
         float angleCw = fish.CurrentRenderVector.angleCw();
         float horizontalScale = fish.CurrentRenderVector.length();
 
@@ -166,7 +185,7 @@ void Fishes::Upload(RenderContext & renderContext) const
 
         renderContext.UploadFish(
             fish.RenderTextureFrameId,
-            fish.CurrentPosition,
+            mFishCurrentPositions[f],
             species.WorldSize * mCurrentFishSizeMultiplier,
             angleCw,
             horizontalScale,
@@ -216,7 +235,7 @@ void Fishes::TriggerWidespreadPanic(std::chrono::milliseconds delay)
 
 void Fishes::UpdateNumberOfFishes(
     float /*currentSimulationTime*/,
-    OceanSurface & /*oceanSurface*/,
+    OceanSurface const & /*oceanSurface*/,
     OceanFloor const & oceanFloor,
     Geometry::ShipAABBSet const & aabbSet,
     SimulationParameters const & simulationParameters,
@@ -242,6 +261,9 @@ void Fishes::UpdateNumberOfFishes(
         mFishes.erase(
             mFishes.begin() + simulationParameters.NumberOfFishes,
             mFishes.end());
+        mFishCurrentPositions.resize(simulationParameters.NumberOfFishes);
+        mFishTargetVelocities.resize(simulationParameters.NumberOfFishes);
+        mFishLastSteeringSimulationTimes.resize(simulationParameters.NumberOfFishes);
 
         // Trim empty shoals
         while (!mFishShoals.empty())
@@ -374,18 +396,23 @@ void Fishes::UpdateNumberOfFishes(
             TextureFrameIndex const renderTextureFrameIndex = static_cast<TextureFrameIndex>(
                 GameRandomEngine::GetInstance().Choose(species.RenderTextureFrameIndices.size()));
 
+            vec2f const targetVelocity = MakeCruisingVelocity((targetPosition - initialPosition).normalise(), species, personalitySeed, simulationParameters);
+
             mFishes.emplace_back(
                 freeShoalIndex,
                 personalitySeed,
-                initialPosition,
                 targetPosition,
-                MakeCruisingVelocity((targetPosition - initialPosition).normalise(), species, personalitySeed, simulationParameters),
+                targetVelocity,
                 headOffset,
                 GameRandomEngine::GetInstance().GenerateUniformReal(0.0f, 2.0f * Pi<float>), // initial progress phase
                 TextureFrameId<GameTextureDatabases::FishTextureGroups>(
                     GameTextureDatabases::FishTextureGroups::Fish,
                     species.RenderTextureFrameIndices[renderTextureFrameIndex]));
 
+            mFishCurrentPositions.emplace_back(initialPosition);
+            mFishTargetVelocities.emplace_back(targetVelocity);
+            mFishLastSteeringSimulationTimes.emplace_back(0.0f);
+
             // Update shoal
             ++(shoal.CurrentMemberCount);
         }
@@ -455,7 +482,7 @@ void Fishes::UpdateInteractions(SimulationParameters const & simulationParameter
 
 void Fishes::UpdateDynamics(
     float currentSimulationTime,
-    OceanSurface & oceanSurface,
+    OceanSurface const & oceanSurface,
     OceanFloor const & oceanFloor,
     Geometry::ShipAABBSet const & aabbSet,
     SimulationParameters const & simulationParameters,
@@ -469,6 +496,9 @@ void Fishes::UpdateDynamics(
     for (ElementIndex f = 0; f < fishCount; ++f)
     {
         Fish & fish = mFishes[f];
+        vec2f & fishCurrentPosition = mFishCurrentPositions[f];
+        vec2f & fishTargetVelocity = mFishTargetVelocities[f];
+        float & fishLastSteeringSimulationTime = mFishLastSteeringSimulationTimes[f];
         FishShoal const & fishShoal = mFishShoals[fish.ShoalId];
         FishSpecies const & fishSpecies = fishShoal.Species;
 
@@ -493,8 +523,8 @@ void Fishes::UpdateDynamics(
                 fish.CruiseSteeringState.reset();
 
                 // Reach all targets
-                fish.CurrentVelocity = fish.TargetVelocity;
-                fish.CurrentRenderVector = fish.TargetVelocity.normalise();
+                fish.CurrentVelocity = fishTargetVelocity;
+                fish.CurrentRenderVector = fishTargetVelocity.normalise();
             }
             else
             {
@@ -515,10 +545,10 @@ void Fishes::UpdateDynamics(
                 else
                 {
                     fish.CurrentVelocity =
-                        fish.TargetVelocity * SmoothStep(0.5f, 1.0f, elapsedSteeringDurationFraction);
+                        fishTargetVelocity * SmoothStep(0.5f, 1.0f, elapsedSteeringDurationFraction);
                 }
 
-                vec2f const targetRenderVector = fish.TargetVelocity.normalise();
+                vec2f const targetRenderVector = fishTargetVelocity.normalise();
 
                 // RenderVector Y:
                 // - smooth towards zero during an initial interval
@@ -566,7 +596,7 @@ void Fishes::UpdateDynamics(
             {
                 // Smooth velocity towards target + shoaling
                 fish.CurrentVelocity +=
-                    ((fish.TargetVelocity + fish.ShoalingVelocity) - fish.CurrentVelocity) * fish.CurrentDirectionSmoothingConvergenceRate;
+                    ((fishTargetVelocity + fish.ShoalingVelocity) - fish.CurrentVelocity) * fish.CurrentDirectionSmoothingConvergenceRate;
             }
 
             // Make RenderVector match current velocity
@@ -585,14 +615,14 @@ void Fishes::UpdateDynamics(
         float constexpr OceanSurfaceDisturbanceMagnitude = 8.0f; // Magic number
 
         // Get water surface level at this fish
-        float const oceanY = oceanSurface.GetHeightAt(fish.CurrentPosition.x);
+        float const oceanY = oceanSurface.GetHeightAt(fishCurrentPosition.x);
 
         //
         // Run freefall state machine
         //
 
         if (!fish.IsInFreefall
-            && fish.CurrentPosition.y > oceanY)
+            && fishCurrentPosition.y > oceanY)
         {
             //
             // Enter freefall
@@ -604,10 +634,10 @@ void Fishes::UpdateDynamics(
             fish.CruiseSteeringState.reset();
 
             // Create a little disturbance in the ocean surface
-            oceanSurface.DisplaceAt(fish.CurrentPosition.x, OceanSurfaceDisturbanceMagnitude);
+            mOceanSurfaceDisplacements.emplace_back(fishCurrentPosition.x, OceanSurfaceDisturbanceMagnitude);
         }
         else if (fish.IsInFreefall
-            && fish.CurrentPosition.y <= oceanY - OceanSurfaceLowWatermark)  // Lower level for re-entry, so that jump is more pronounced
+            && fishCurrentPosition.y <= oceanY - OceanSurfaceLowWatermark)  // Lower level for re-entry, so that jump is more pronounced
         {
             //
             // Leave freefall (re-entry!)
@@ -618,7 +648,7 @@ void Fishes::UpdateDynamics(
             // Drag velocity down
             float const currentVelocityMagnitude = fish.CurrentVelocity.length();
             float constexpr MaxVelocityMagnitude = 1.3f; // Magic number
-            fish.TargetVelocity =
+            fishTargetVelocity =
                 fish.CurrentVelocity.normalise(currentVelocityMagnitude)
                 * Clamp(currentVelocityMagnitude, 0.0f, MaxVelocityMagnitude);
 
@@ -633,7 +663,7 @@ void Fishes::UpdateDynamics(
             fish.PanicCharge = 0.03f;
 
             // Create a little disturbance in the ocean surface
-            oceanSurface.DisplaceAt(fish.CurrentPosition.x, OceanSurfaceDisturbanceMagnitude);
+            mOceanSurfaceDisplacements.emplace_back(fishCurrentPosition.x, OceanSurfaceDisturbanceMagnitude);
         }
 
         //
@@ -649,7 +679,7 @@ void Fishes::UpdateDynamics(
             float const speedMultiplier = (fish.PanicCharge * 8.5f + 1.0f);
 
             // Update position: add current velocity
-            fish.CurrentPosition +=
+            fishCurrentPosition +=
                 fish.CurrentVelocity
                 * SimulationParameters::SimulationStepTimeDuration<float>
                 * speedMultiplier;
@@ -660,7 +690,7 @@ void Fishes::UpdateDynamics(
             // Update position: superimpose a small sin component, unless we're steering
             if (!fish.CruiseSteeringState.has_value())
             {
-                fish.CurrentPosition +=
+                fishCurrentPosition +=
                     fish.CurrentRenderVector
                     * (1.0f + std::sinf(2.0f * fish.CurrentTailProgressPhase))
                     * (1.0f + fish.PanicCharge) // Grow incisiveness with panic
@@ -679,17 +709,17 @@ void Fishes::UpdateDynamics(
                 * SimulationParameters::GravityMagnitude
                 * SimulationParameters::SimulationStepTimeDuration<float>;
 
-            fish.TargetVelocity = vec2f(
+            fishTargetVelocity = vec2f(
                 fish.CurrentVelocity.x,
                 newVelocityY);
 
-            fish.CurrentVelocity = fish.TargetVelocity; // Converge immediately
+            fish.CurrentVelocity = fishTargetVelocity; // Converge immediately
 
             // Converge direction at this rate, overriding current convergence rate
             fish.CurrentDirectionSmoothingConvergenceRate = 0.06f;
 
             // Update position: add velocity
-            fish.CurrentPosition +=
+            fishCurrentPosition +=
                 fish.CurrentVelocity
                 * SimulationParameters::SimulationStepTimeDuration<float>
                 * outOfWaterVelocityAmplification;
@@ -710,26 +740,26 @@ void Fishes::UpdateDynamics(
 
         bool hasBouncedAgainstWorldBoundaries = false;
 
-        if (fish.CurrentPosition.x < -SimulationParameters::HalfMaxWorldWidth)
+        if (fishCurrentPosition.x < -SimulationParameters::HalfMaxWorldWidth)
         {
             // Bounce position
-            fish.CurrentPosition.x = -SimulationParameters::HalfMaxWorldWidth + (-SimulationParameters::HalfMaxWorldWidth - fish.CurrentPosition.x);
+            fishCurrentPosition.x = -SimulationParameters::HalfMaxWorldWidth + (-SimulationParameters::HalfMaxWorldWidth - fishCurrentPosition.x);
 
             // Bounce both current and target velocity
             fish.CurrentVelocity.x = std::abs(fish.CurrentVelocity.x);
-            fish.TargetVelocity.x = std::abs(fish.TargetVelocity.x);
+            fishTargetVelocity.x = std::abs(fishTargetVelocity.x);
 
             // Adjust other fish properties
             hasBouncedAgainstWorldBoundaries = true;
         }
-        else if (fish.CurrentPosition.x > SimulationParameters::HalfMaxWorldWidth)
+        else if (fishCurrentPosition.x > SimulationParameters::HalfMaxWorldWidth)
         {
             // Bounce position
-            fish.CurrentPosition.x = SimulationParameters::HalfMaxWorldWidth - (fish.CurrentPosition.x - SimulationParameters::HalfMaxWorldWidth);
+            fishCurrentPosition.x = SimulationParameters::HalfMaxWorldWidth - (fishCurrentPosition.x - SimulationParameters::HalfMaxWorldWidth);
 
             // Bounce both current and target velocity
             fish.CurrentVelocity.x = -std::abs(fish.CurrentVelocity.x);
-            fish.TargetVelocity.x = -std::abs(fish.TargetVelocity.x);
+            fishTargetVelocity.x = -std::abs(fishTargetVelocity.x);
 
             // Adjust other fish properties
             hasBouncedAgainstWorldBoundaries = true;
@@ -739,8 +769,8 @@ void Fishes::UpdateDynamics(
         {
             // Find a new target position away
             fish.TargetPosition = FindNewCruisingTargetPosition(
-                fish.CurrentPosition,
-                fish.TargetVelocity.normalise(),
+                fishCurrentPosition,
+                fishTargetVelocity.normalise(),
                 fishSpecies,
                 visibleWorld);
 
@@ -751,8 +781,8 @@ void Fishes::UpdateDynamics(
             continue;
         }
 
-        assert(fish.CurrentPosition.x >= -SimulationParameters::HalfMaxWorldWidth
-            && fish.CurrentPosition.x <= SimulationParameters::HalfMaxWorldWidth);
+        assert(fishCurrentPosition.x >= -SimulationParameters::HalfMaxWorldWidth
+            && fishCurrentPosition.x <= SimulationParameters::HalfMaxWorldWidth);
 
         // Stop now if we're free-falling
         if (fish.IsInFreefall)
@@ -766,7 +796,7 @@ void Fishes::UpdateDynamics(
         ///////////////////////////////////////////////////////////////////
 
         // Check whether this fish has reached its target
-        if (std::abs(fish.CurrentPosition.x - fish.TargetPosition.x) < 7.0f
+        if (std::abs(fishCurrentPosition.x - fish.TargetPosition.x) < 7.0f
             && fish.PanicCharge == 0.0f) // Not in panic
         {
             //
@@ -775,16 +805,16 @@ void Fishes::UpdateDynamics(
 
             // Choose new target position
             fish.TargetPosition = FindNewCruisingTargetPosition(
-                fish.CurrentPosition,
+                fishCurrentPosition,
                 -fish.CurrentVelocity.normalise(),
                 fishSpecies,
                 visibleWorld);
 
             // Calculate new target velocity
-            fish.TargetVelocity = MakeCruisingVelocity((fish.TargetPosition - fish.CurrentPosition).normalise(), fishSpecies, fish.PersonalitySeed, simulationParameters);
+            fishTargetVelocity = MakeCruisingVelocity((fish.TargetPosition - fishCurrentPosition).normalise(), fishSpecies, fish.PersonalitySeed, simulationParameters);
 
             // Setup steering, depending on whether we're turning or not
-            if (fish.TargetVelocity.x * fish.CurrentVelocity.x < 0.0f
+            if (fishTargetVelocity.x * fish.CurrentVelocity.x < 0.0f
                 && !fish.CruiseSteeringState.has_value()) // Not steering already
             {
                 // Perform a cruise steering
@@ -795,7 +825,7 @@ void Fishes::UpdateDynamics(
                     1.5f); // Slow turn
 
                 // Remember the time at which we did the last steering
-                fish.LastSteeringSimulationTime = currentSimulationTime;
+                fishLastSteeringSimulationTime = currentSimulationTime;
             }
             else
             {    // Converge direction change at this rate
@@ -816,10 +846,10 @@ void Fishes::UpdateDynamics(
             // Continue to current target
 
             // Calculate new target velocity
-            fish.TargetVelocity = MakeCruisingVelocity((fish.TargetPosition - fish.CurrentPosition).normalise(), fishSpecies, fish.PersonalitySeed, simulationParameters);
+            fishTargetVelocity = MakeCruisingVelocity((fish.TargetPosition - fishCurrentPosition).normalise(), fishSpecies, fish.PersonalitySeed, simulationParameters);
 
             // Setup steering, depending on whether we're turning or not
-            if (fish.TargetVelocity.x * fish.CurrentVelocity.x < 0.0f
+            if (fishTargetVelocity.x * fish.CurrentVelocity.x < 0.0f
                 && !fish.CruiseSteeringState.has_value()) // Not steering already
             {
                 // Perform a cruise steering
@@ -830,7 +860,7 @@ void Fishes::UpdateDynamics(
                     1.5f); // Slow turn
 
                 // Remember the time at which we did the last steering
-                fish.LastSteeringSimulationTime = currentSimulationTime;
+                fishLastSteeringSimulationTime = currentSimulationTime;
             }
             else
             {    // Converge direction change at this rate
@@ -846,7 +876,7 @@ void Fishes::UpdateDynamics(
 
         // Calculate position of head
         vec2f const fishHeadPosition =
-            fish.CurrentPosition
+            fishCurrentPosition
             + fish.CurrentRenderVector * fish.HeadOffset;
 
         // Calculate depth of fish head
@@ -855,17 +885,17 @@ void Fishes::UpdateDynamics(
         // Check whether we're too close to the water surface (idealized as being horizontal) - but only if fish is not in too much panic
         if (fishHeadDepth < 2.0f + OceanSurfaceLowWatermark
             && fish.PanicCharge <= 0.3f // Not too much panic
-            && fish.TargetVelocity.y >= 0.0f) // Bounce away only if we're really going into it
+            && fishTargetVelocity.y >= 0.0f) // Bounce away only if we're really going into it
         {
             //
             // OceanSurface Bounce
             //
 
             // Bounce direction, opposite of target
-            vec2f const bounceDirection = vec2f(fish.TargetVelocity.x, -fish.TargetVelocity.y).normalise();
+            vec2f const bounceDirection = vec2f(fishTargetVelocity.x, -fishTargetVelocity.y).normalise();
 
             // Calculate new target velocity - along bounce direction
-            fish.TargetVelocity = MakeCruisingVelocity(bounceDirection, fishSpecies, fish.PersonalitySeed, simulationParameters);
+            fishTargetVelocity = MakeCruisingVelocity(bounceDirection, fishSpecies, fish.PersonalitySeed, simulationParameters);
 
             // Converge direction change at this rate
             fish.CurrentDirectionSmoothingConvergenceRate = std::max(
@@ -888,15 +918,15 @@ void Fishes::UpdateDynamics(
 
             // Calculate the component of the fish's target velocity along the normal,
             // i.e. towards the outside of the floor...
-            float const targetVelocityAlongNormal = fish.TargetVelocity.dot(seaFloorNormal);
+            float const targetVelocityAlongNormal = fishTargetVelocity.dot(seaFloorNormal);
 
             // ...if positive, it will soon be going already outside of the floor, hence we leave it as-is
             if (targetVelocityAlongNormal <= 0.0f)
             {
                 // Set target velocity to reflection of fish's target velocity around normal:
                 // R = V − 2(V⋅N^)N^
-                fish.TargetVelocity =
-                    fish.TargetVelocity
+                fishTargetVelocity =
+                    fishTargetVelocity
                     - seaFloorNormal * 2.0f * targetVelocityAlongNormal;
 
                 // Converge direction change at this rate
@@ -942,9 +972,9 @@ void Fishes::UpdateDynamics(
                     }
 
                     // Rotate target velocity towards normal
-                    float const targetVelocityMagnitude = fish.TargetVelocity.length();
-                    fish.TargetVelocity =
-                        (fish.TargetVelocity.normalise(targetVelocityMagnitude) + outwardNormal * 2.0f).normalise()
+                    float const targetVelocityMagnitude = fishTargetVelocity.length();
+                    fishTargetVelocity =
+                        (fishTargetVelocity.normalise(targetVelocityMagnitude) + outwardNormal * 2.0f).normalise()
                         * targetVelocityMagnitude;
 
                     // Converge direction change at a fast rate
@@ -973,6 +1003,9 @@ void Fishes::UpdateShoaling(
     // Visit all shoals
     for (auto const & fishShoal : mFishShoals)
     {
+        // Fishes have moved since the grid was built
+        mShoalGrid.Invalidate();
+
         // Calculate shoal radius for this shoal in world coordinates
         float const shoalRadius =
             fishShoal.Species.ShoalRadius
@@ -984,6 +1017,7 @@ void Fishes::UpdateShoaling(
         for (ElementIndex f = fishShoal.StartFishIndex; f < endFishIndex; ++f)
         {
             Fish & fish = mFishes[f];
+            vec2f const & fishCurrentPosition = mFishCurrentPositions[f];
 
             if (fishShoal.CurrentMemberCount > 1 // A shoal contains at least one fish
                 && fish.ShoalingTimer <= 0.0f // Wait for this fish's shoaling cycle
@@ -999,7 +1033,7 @@ void Fishes::UpdateShoaling(
                     float const fishShoalSpacing = 0.7f * fishShoalRadius;
 
                     //
-                    // Visit all fishes in same shoal looking for neighbors
+                    // Visit all neighbors in same shoal
                     //
 
                     ElementIndex closestFishIndex = NoneElementIndex; // Closest neighbour among those that are closer to fish than spacing
@@ -1007,70 +1041,67 @@ void Fishes::UpdateShoaling(
                     ElementIndex furthestFishIndex = NoneElementIndex; // Furthest neighbour among those that are further from fish than spacing
                     float furthestFishDistance = std::numeric_limits<float>::lowest();
 
-                    for (ElementIndex n = fishShoal.StartFishIndex; n < endFishIndex; ++n)
-                    {
-                        assert(mFishes[n].ShoalId == fish.ShoalId);
-                        if (n != f) // Not same fish
+                    VisitShoalNeighbors(
+                        fishShoal,
+                        f,
+                        fishShoalRadius,
+                        [&](ElementIndex n, float distance)
                         {
-                            Fish const & neighbor = mFishes[n];
+                            assert(mFishes[n].ShoalId == fish.ShoalId);
 
-                            if (float const distance = (neighbor.CurrentPosition - fish.CurrentPosition).length();
-                                distance < fishShoalRadius) // Neighbor is in the neighborhood (...hence a neighbor)
+                            // No need to look at other neighbors once we've decided to u-turn
+                            if (fish.CruiseSteeringState.has_value())
+                                return;
+
+                            // Update closest and furthest
+                            if (distance < fishShoalSpacing)
                             {
-                                // Update closest and furthest
-                                if (distance < fishShoalSpacing)
+                                // Too close wrt spacing
+                                if (distance < closestFishDistance)
                                 {
-                                    // Too close wrt spacing
-                                    if (distance < closestFishDistance)
-                                    {
-                                        closestFishIndex = n;
-                                        closestFishDistance = distance;
-                                    }
+                                    closestFishIndex = n;
+                                    closestFishDistance = distance;
                                 }
-                                else
+                            }
+                            else
+                            {
+                                // Too far wrt spacing
+                                if (distance > furthestFishDistance)
                                 {
-                                    // Too far wrt spacing
-                                    if (distance > furthestFishDistance)
-                                    {
-                                        furthestFishIndex = n;
-                                        furthestFishDistance = distance;
-                                    }
+                                    furthestFishIndex = n;
+                                    furthestFishDistance = distance;
                                 }
+                            }
 
-                                // Check if should do a u-turn based on this neighbor
-                                float constexpr UTurnSpeed = 2.5f;
-                                if (neighbor.TargetVelocity.x * fish.TargetVelocity.x < 0.0f // Intents are opposite
-                                    && (currentSimulationTime - fish.LastSteeringSimulationTime) > UTurnSpeed + 3.0f // This fish hasn't u-turned recently
-                                    && fish.LastSteeringSimulationTime < neighbor.LastSteeringSimulationTime) // The neighbor has u-turned more recently
-                                {
-                                    vec2f const neighborDirection = neighbor.TargetVelocity.normalise();
-
-                                    // Find a new target position along the neighbor's direction
-                                    fish.TargetPosition = FindNewCruisingTargetPosition(
-                                        fish.CurrentPosition,
-                                        neighborDirection,
-                                        fishShoal.Species,
-                                        visibleWorld);
-
-                                    // Change target velocity to get to target position
-                                    fish.TargetVelocity = MakeCruisingVelocity(neighborDirection, fishShoal.Species, fish.PersonalitySeed, simulationParameters);
-
-                                    // Perform a cruise steering
-                                    fish.CruiseSteeringState.emplace(
-                                        fish.CurrentVelocity,
-                                        fish.CurrentRenderVector,
-                                        currentSimulationTime,
-                                        UTurnSpeed);
-
-                                    // Remember the time at which we did the last steering
-                                    fish.LastSteeringSimulationTime = currentSimulationTime;
-
-                                    // No need to look at other neighbors
-                                    break;
-                                }
+                            // Check if should do a u-turn based on this neighbor
+                            float constexpr UTurnSpeed = 2.5f;
+                            if (mFishTargetVelocities[n].x * mFishTargetVelocities[f].x < 0.0f // Intents are opposite
+                                && (currentSimulationTime - mFishLastSteeringSimulationTimes[f]) > UTurnSpeed + 3.0f // This fish hasn't u-turned recently
+                                && mFishLastSteeringSimulationTimes[f] < mFishLastSteeringSimulationTimes[n]) // The neighbor has u-turned more recently
+                            {
+                                vec2f const neighborDirection = mFishTargetVelocities[n].normalise();
+
+                                // Find a new target position along the neighbor's direction
+                                fish.TargetPosition = FindNewCruisingTargetPosition(
+                                    fishCurrentPosition,
+                                    neighborDirection,
+                                    fishShoal.Species,
+                                    visibleWorld);
+
+                                // Change target velocity to get to target position
+                                mFishTargetVelocities[f] = MakeCruisingVelocity(neighborDirection, fishShoal.Species, fish.PersonalitySeed, simulationParameters);
+
+                                // Perform a cruise steering
+                                fish.CruiseSteeringState.emplace(
+                                    fish.CurrentVelocity,
+                                    fish.CurrentRenderVector,
+                                    currentSimulationTime,
+                                    UTurnSpeed);
+
+                                // Remember the time at which we did the last steering
+                                mFishLastSteeringSimulationTimes[f] = currentSimulationTime;
                             }
-                        }
-                    }
+                        });
 
                     // If we've decided we're gonna u-turn, then stop here
                     if (fish.CruiseSteeringState.has_value())
@@ -1087,24 +1118,24 @@ void Fishes::UpdateShoaling(
                         //
 
                         // Pick lead
-                        Fish const & lead = mFishes[fishShoal.StartFishIndex];
+                        vec2f const & leadCurrentPosition = mFishCurrentPositions[fishShoal.StartFishIndex];
 
-                        vec2f const fishToLeadVector = lead.CurrentPosition - fish.CurrentPosition;
+                        vec2f const fishToLeadVector = leadCurrentPosition - fishCurrentPosition;
                         float const distance = fishToLeadVector.length();
                         vec2f const fishToLeadDirection = fishToLeadVector.normalise(distance);
 
                         // Check whether we need to turn - we do if lead is currently behind us
-                        if (fish.TargetVelocity.x * fishToLeadDirection.x < 0.0f)
+                        if (mFishTargetVelocities[f].x * fishToLeadDirection.x < 0.0f)
                         {
                             // Find a new target position towards the lead
                             fish.TargetPosition = FindNewCruisingTargetPosition(
-                                fish.CurrentPosition,
+                                fishCurrentPosition,
                                 fishToLeadDirection,
                                 fishShoal.Species,
                                 visibleWorld);
 
                             // Change target velocity to get to target position
-                            fish.TargetVelocity = MakeCruisingVelocity(fishToLeadDirection, fishShoal.Species, fish.PersonalitySeed, simulationParameters);
+                            mFishTargetVelocities[f] = MakeCruisingVelocity(fishToLeadDirection, fishShoal.Species, fish.PersonalitySeed, simulationParameters);
 
                             // Perform a cruise steering
                             fish.CruiseSteeringState.emplace(
@@ -1135,11 +1166,11 @@ void Fishes::UpdateShoaling(
                         //
 
                         vec2f collisionCorrectionVelocity = (closestFishIndex != NoneElementIndex)
-                            ? -(mFishes[closestFishIndex].CurrentPosition - fish.CurrentPosition).normalise() * 1.2f // Go away from neighbor
+                            ? -(mFishCurrentPositions[closestFishIndex] - fishCurrentPosition).normalise() * 1.2f // Go away from neighbor
                             : vec2f::zero();
 
                         vec2f cohesionCorrectionVelocity = (furthestFishIndex != NoneElementIndex)
-                            ? (mFishes[furthestFishIndex].CurrentPosition - fish.CurrentPosition).normalise() * 1.8f // Go towards neighbor
+                            ? (mFishCurrentPositions[furthestFishIndex] - fishCurrentPosition).normalise() * 1.8f // Go towards neighbor
                             : vec2f::zero();
 
                         fish.ShoalingVelocity =
@@ -1163,6 +1194,75 @@ void Fishes::UpdateShoaling(
     }
 }
 
+template<typename TVisitor>
+void Fishes::VisitShoalNeighbors(
+    FishShoal const & fishShoal,
+    ElementIndex fishIndex,
+    float radius,
+    TVisitor && visitor)
+{
+    //
+    // Visits - in index order - all the other fishes of the shoal that are
+    // closer than the radius to the fish, invoking the visitor with the
+    // neighbor's index and distance
+    //
+
+    vec2f const & fishPosition = mFishCurrentPositions[fishIndex];
+
+    if (fishShoal.CurrentMemberCount >= MinShoalSizeForGrid)
+    {
+        //
+        // Grid - built with shoal-relative indices, once per shoal per update,
+        // and only if at least one fish of the shoal looks for neighbors
+        //
+
+        vec2f const * const shoalPositions = mFishCurrentPositions.data() + fishShoal.StartFishIndex;
+
+        if (!mShoalGrid.IsValid())
+        {
+            mShoalGrid.Rebuild(
+                shoalPositions,
+                fishShoal.CurrentMemberCount,
+                [](ElementIndex)
+                {
+                    return true;
+                });
+        }
+
+        mShoalGrid.VisitPointsInRadius(
+            shoalPositions,
+            fishPosition,
+            radius,
+            [&](ElementIndex shoalFishIndex, float squareDistance)
+            {
+                ElementIndex const n = fishShoal.StartFishIndex + shoalFishIndex;
+                if (n != fishIndex) // Not same fish
+                {
+                    visitor(n, std::sqrt(squareDistance));
+                }
+            });
+    }
+    else
+    {
+        //
+        // Small shoal - cheaper to scan it all
+        //
+
+        ElementIndex const endFishIndex = fishShoal.StartFishIndex + fishShoal.CurrentMemberCount;
+        for (ElementIndex n = fishShoal.StartFishIndex; n < endFishIndex; ++n)
+        {
+            if (n != fishIndex) // Not same fish
+            {
+                if (float const distance = (mFishCurrentPositions[n] - fishPosition).length();
+                    distance < radius) // Neighbor is in the neighborhood (...hence a neighbor)
+                {
+                    visitor(n, distance);
+                }
+            }
+        }
+    }
+}
+
 void Fishes::EnactDisturbance(
     vec2f const & worldCoordinates,
     float worldRadius,
@@ -1172,15 +1272,17 @@ void Fishes::EnactDisturbance(
         worldRadius
         * (simulationParameters.IsUltraViolentMode ? 5.0f : 1.0f);
 
-    for (auto & fish : mFishes)
+    for (size_t f = 0; f < mFishes.size(); ++f)
     {
+        Fish & fish = mFishes[f];
+
         if (!fish.IsInFreefall)
         {
             FishSpecies const & species = mFishShoals[fish.ShoalId].Species;
 
             // Calculate position of head
             vec2f const fishHeadPosition =
-                fish.CurrentPosition
+                mFishCurrentPositions[f]
                 + fish.CurrentRenderVector.normalise() * fish.HeadOffset;
 
             // Calculate distance from disturbance
@@ -1217,7 +1319,7 @@ void Fishes::EnactDisturbance(
                 }
 
                 // Calculate new target velocity - away from disturbance point, and will be panic velocity
-                fish.TargetVelocity = MakeCruisingVelocity(panicDirection, species, fish.PersonalitySeed, simulationParameters);
+                mFishTargetVelocities[f] = MakeCruisingVelocity(panicDirection, species, fish.PersonalitySeed, simulationParameters);
 
                 // Converge directions really fast
                 fish.CurrentDirectionSmoothingConvergenceRate = std::max(
@@ -1240,8 +1342,10 @@ void Fishes::EnactAttraction(
         worldRadius
         * (simulationParameters.IsUltraViolentMode ? 5.0f : 1.0f);
 
-    for (auto & fish : mFishes)
+    for (size_t f = 0; f < mFishes.size(); ++f)
     {
+        Fish & fish = mFishes[f];
+
         if (!fish.IsInFreefall
             && fish.PanicCharge < 0.65f) // Don't attract fish in much panic
         {
@@ -1249,7 +1353,7 @@ void Fishes::EnactAttraction(
 
             // Calculate position of head
             vec2f const fishHeadPosition =
-                fish.CurrentPosition
+                mFishCurrentPositions[f]
                 + fish.CurrentRenderVector.normalise() * fish.HeadOffset;
 
             // Calculate distance from attraction
@@ -1287,7 +1391,7 @@ void Fishes::EnactAttraction(
                 // Don't change target position, we'll return to it when panic is over
 
                 // Calculate new target velocity - towards food, and will be panic velocity
-                fish.TargetVelocity = MakeCruisingVelocity(panicDirection, species, fish.PersonalitySeed, simulationParameters);
+                mFishTargetVelocities[f] = MakeCruisingVelocity(panicDirection, species, fish.PersonalitySeed, simulationParameters);
 
                 // Converge directions at this rate
                 fish.CurrentDirectionSmoothingConvergenceRate = std::max(
@@ -1306,8 +1410,10 @@ void Fishes::EnactAttraction(
 
 void Fishes::EnactWidespreadPanic(SimulationParameters const & simulationParameters)
 {
-    for (auto & fish : mFishes)
+    for (size_t f = 0; f < mFishes.size(); ++f)
     {
+        Fish & fish = mFishes[f];
+
         if (!fish.IsInFreefall)
         {
             FishSpecies const & species = mFishShoals[fish.ShoalId].Species;
@@ -1327,7 +1433,7 @@ void Fishes::EnactWidespreadPanic(SimulationParameters const & simulationParamet
             // Don't change target position, we'll return to it when panic is over
 
             // Calculate new target velocity in this direction - and will be panic velocity
-            fish.TargetVelocity = MakeCruisingVelocity(panicDirection, species, fish.PersonalitySeed, simulationParameters);
+            mFishTargetVelocities[f] = MakeCruisingVelocity(panicDirection, species, fish.PersonalitySeed, simulationParameters);
 
             // Converge directions at this rate
             fish.CurrentDirectionSmoothingConvergenceRate = std::max(
@@ -15,13 +15,18 @@
 #include <Core/AABBSet.h>
 #include <Core/GameTypes.h>
 #include <Core/GameWallClock.h>
+#include <Core/UniformPointGrid.h>
 #include <Core/Vectors.h>
 
 #include <chrono>
 #include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
+// Tests of the world's internals
+class WorldTests;
+
 namespace Physics
 {
 
@@ -36,12 +41,19 @@ public:
 
     void Update(
         float currentSimulationTime,
-        OceanSurface & oceanSurface,
+        OceanSurface const & oceanSurface,
         OceanFloor const & oceanFloor,
         SimulationParameters const & simulationParameters,
         VisibleWorld const & visibleWorld,
         Geometry::ShipAABBSet const & aabbSet);
 
+    /*
+     * Applies to the ocean surface the disturbances made by fishes during the last
+     * Update(); separate from the update, as fishes might be updating concurrently
+     * with others that displace the ocean surface.
+     */
+    void ApplyOceanSurfaceDisplacements(OceanSurface & oceanSurface);
+
     void Upload(RenderContext & renderContext) const;
 
 public:
@@ -117,11 +129,12 @@ private:
 
         float PersonalitySeed;
 
-        vec2f CurrentPosition;
+        // Note: current position, target velocity, and last steering time live in
+        // the SoA buffers, as they are also read for the neighbors during shoaling
+
         vec2f TargetPosition;
 
         vec2f CurrentVelocity;
-        vec2f TargetVelocity;
 
         vec2f ShoalingVelocity;
 
@@ -145,7 +158,6 @@ private:
 
         // Steering state machine
         std::optional<CruiseSteering> CruiseSteeringState; // When set, fish is turning around during cruise
-        float LastSteeringSimulationTime;
 
         // Freefall state machine
         bool IsInFreefall;
@@ -156,7 +168,6 @@ private:
         Fish(
             FishShoalId shoalId,
             float personalitySeed,
-            vec2f const & initialPosition,
             vec2f const & targetPosition,
             vec2f const & targetVelocity,
             float headOffset,
@@ -164,10 +175,8 @@ private:
             TextureFrameId<GameTextureDatabases::FishTextureGroups> renderTextureFrameId)
             : ShoalId(shoalId)
             , PersonalitySeed(personalitySeed)
-            , CurrentPosition(initialPosition)
             , TargetPosition(targetPosition)
             , CurrentVelocity(targetVelocity)
-            , TargetVelocity(CurrentVelocity)
             , ShoalingVelocity(vec2f::zero())
             , CurrentRenderVector(targetVelocity.normalise())
             , CurrentDirectionSmoothingConvergenceRate(IdealDirectionSmoothingConvergenceRate)
@@ -177,7 +186,6 @@ private:
             , AttractionDecayTimer(0.0f)
             , ShoalingTimer(personalitySeed * ShoalingTimerCycleDuration) // Randomize a bit the shoaling cycles
             , CruiseSteeringState()
-            , LastSteeringSimulationTime(0.0f)
             , IsInFreefall(false)
             , RenderTextureFrameId(renderTextureFrameId)
         {}
@@ -222,7 +230,7 @@ private:
 
     void UpdateNumberOfFishes(
         float currentSimulationTime,
-        OceanSurface & oceanSurface,
+        OceanSurface const & oceanSurface,
         OceanFloor const & oceanFloor,
         Geometry::ShipAABBSet const & aabbSet,
         SimulationParameters const & simulationParameters,
@@ -232,7 +240,7 @@ private:
 
     void UpdateDynamics(
         float currentSimulationTime,
-        OceanSurface & oceanSurface,
+        OceanSurface const & oceanSurface,
         OceanFloor const & oceanFloor,
         Geometry::ShipAABBSet const & aabbSet,
         SimulationParameters const & simulationParameters,
@@ -243,6 +251,13 @@ private:
         SimulationParameters const & simulationParameters,
         VisibleWorld const & visibleWorld);
 
+    template<typename TVisitor>
+    inline void VisitShoalNeighbors(
+        FishShoal const & fishShoal,
+        ElementIndex fishIndex,
+        float radius,
+        TVisitor && visitor);
+
     void EnactDisturbance(
         vec2f const & worldCoordinates,
         float worldRadius,
@@ -290,13 +305,31 @@ private:
     // The...fishes
     std::vector<Fish> mFishes;
 
+    // Hot fish state, in structure-of-arrays layout and parallel to mFishes
+    std::vector<vec2f> mFishCurrentPositions;
+    std::vector<vec2f> mFishTargetVelocities;
+    std::vector<float> mFishLastSteeringSimulationTimes;
+
+    // Neighbor search for shoals with at least MinShoalSizeForGrid members, rebuilt
+    // on demand for one shoal at a time; as only a few fishes of a shoal look for
+    // neighbors at each step, scanning smaller shoals is cheaper than rebuilding
+    static ElementCount constexpr MinShoalSizeForGrid = 1536;
+    UniformPointGrid mShoalGrid;
+
     // Delayed interactions
     std::vector<Interaction> mInteractions;
 
+    // Ocean surface displacements made during the last update, as (x, magnitude)
+    std::vector<std::pair<float, float>> mOceanSurfaceDisplacements;
+
     // Parameters that the calculated values are current with
     float mCurrentFishSizeMultiplier;
     float mCurrentFishSpeedAdjustment;
     bool mCurrentDoFishShoaling;
+
+private:
+
+    friend class ::WorldTests;
 };
 
 }
@@ -5,13 +5,13 @@
 ***************************************************************************************/
 #include "../Physics.h"
 
-#include <Core/GameException.h>
 #include <Core/GameRandomEngine.h>
 #include <Core/Log.h>
 
 namespace Physics {
 
-ElementIndex NpcParticles::Add(
+void NpcParticles::Add(
+    ElementIndex particleIndex,
     float mass,
     float buoyancyVolumeFill,
     float buoyancyFactor,
@@ -21,8 +21,10 @@ ElementIndex NpcParticles::Add(
     vec2f const & position,
     rgbaColor const & color)
 {
-    // Find first free particle
-    ElementIndex const p = FindFreeParticleIndex();
+    assert(particleIndex < mMaxParticleCount);
+    assert(!mIsInUseBuffer[particleIndex]);
+
+    ElementIndex const p = particleIndex;
 
     mIsInUseBuffer[p] = true;
 
@@ -48,8 +50,6 @@ ElementIndex NpcParticles::Add(
     mRenderColorBuffer[p] = color;
 
     ++mParticlesInUseCount;
-
-    return p;
 }
 
 void NpcParticles::Remove(
@@ -59,7 +59,6 @@ void NpcParticles::Remove(
     assert(mParticlesInUseCount > 0);
 
     mIsInUseBuffer[particleIndex] = false;
-    mFreeParticleSearchStartIndex = std::min(mFreeParticleSearchStartIndex, particleIndex);
 
     --mParticlesInUseCount;
 }
@@ -70,36 +69,4 @@ void NpcParticles::Query(ElementIndex particleElementIndex) const
     LogMessage("P=", mPositionBuffer[particleElementIndex].toString(), " V=", mVelocityBuffer[particleElementIndex].toString());
 }
 
-ElementIndex NpcParticles::FindFreeParticleIndex()
-{
-    for (ElementIndex p = mFreeParticleSearchStartIndex; ; /*incremented in loop*/)
-    {
-        if (!mIsInUseBuffer[p])
-        {
-            // Found!
-
-            // Remember to start after this one next time
-            mFreeParticleSearchStartIndex = p + 1;
-            if (mFreeParticleSearchStartIndex >= mElementCount)
-                mFreeParticleSearchStartIndex = 0;
-
-            return p;
-        }
-
-        // Advance
-        ++p;
-        if (p >= mElementCount)
-            p = 0;
-
-        if (p == mFreeParticleSearchStartIndex)
-        {
-            // Went around
-            break;
-        }
-    }
-
-    // If we're here, no luck
-    throw GameException("Cannot find free NPC particle");
-}
-
 }
\ No newline at end of file
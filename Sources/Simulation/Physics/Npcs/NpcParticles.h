@@ -56,7 +56,6 @@ public:
         // Container
         //////////////////////////////////
         , mParticlesInUseCount(0)
-        , mFreeParticleSearchStartIndex(0)
     {
     }
 
@@ -73,7 +72,12 @@ public:
         return mMaxParticleCount - mParticlesInUseCount;
     }
 
-    ElementIndex Add(
+    /*
+     * Occupies the specified - free - particle; the caller owns the particle
+     * index space, e.g. to keep particles of the same NPC contiguous.
+     */
+    void Add(
+        ElementIndex particleIndex,
         float mass,
         float buoyancyVolumeFill,
         float buoyancyFactor,
@@ -351,10 +355,6 @@ public:
         return mRenderColorBuffer.data();
     }
 
-private:
-
-    ElementIndex FindFreeParticleIndex();
-
 private:
 
     ElementCount const mMaxParticleCount;
@@ -403,10 +403,6 @@ private:
 
     // Convenience counter
     ElementCount mParticlesInUseCount;
-
-    // The index at which to start searching for free particles
-    // (just an optimization over restarting from zero each time)
-    ElementIndex mFreeParticleSearchStartIndex;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,224 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2025-07-14
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "../../SimulationParameters.h"
+
+#include <Core/Buffer.h>
+#include <Core/GameTypes.h>
+
+#include <cassert>
+
+namespace Physics {
+
+/*
+ * The springs of all NPCs, in structure-of-arrays layout.
+ *
+ * Each NPC owns a fixed slot of MaxSpringsPerNpc springs, starting at NpcId * MaxSpringsPerNpc;
+ * the springs of an NPC are hence contiguous, and visiting NPCs in id order streams linearly
+ * through the buffers.
+ */
+class NpcSprings final
+{
+public:
+
+    struct EndpointsType
+    {
+        ElementIndex EndpointAIndex; // Index in NpcParticles
+        ElementIndex EndpointBIndex; // Index in NpcParticles
+    };
+
+public:
+
+    explicit NpcSprings(size_t maxNpcs)
+        : mMaxNpcs(maxNpcs)
+        //////////////////////////////////
+        // Buffers
+        //////////////////////////////////
+        , mSpringCountBuffer(maxNpcs, 0)
+        // Physics
+        , mEndpointsBuffer(maxNpcs * SimulationParameters::MaxSpringsPerNpc, EndpointsType({ NoneElementIndex, NoneElementIndex }))
+        , mRestLengthBuffer(maxNpcs * SimulationParameters::MaxSpringsPerNpc, 0.0f)
+        , mStiffnessFactorBuffer(maxNpcs * SimulationParameters::MaxSpringsPerNpc, 0.0f)
+        , mDampingFactorBuffer(maxNpcs * SimulationParameters::MaxSpringsPerNpc, 0.0f)
+        // Constants
+        , mBaseRestLengthBuffer(maxNpcs * SimulationParameters::MaxSpringsPerNpc, 0.0f)
+        , mBaseSpringReductionFractionBuffer(maxNpcs * SimulationParameters::MaxSpringsPerNpc, 0.0f)
+        , mBaseSpringDampingCoefficientBuffer(maxNpcs * SimulationParameters::MaxSpringsPerNpc, 0.0f)
+    {
+    }
+
+    NpcSprings(NpcSprings && other) = default;
+
+    static inline ElementIndex GetSpringIndex(
+        NpcId npcId,
+        size_t springOrdinal) noexcept
+    {
+        assert(springOrdinal < SimulationParameters::MaxSpringsPerNpc);
+        return static_cast<ElementIndex>(npcId * SimulationParameters::MaxSpringsPerNpc + springOrdinal);
+    }
+
+    size_t GetSpringCount(NpcId npcId) const noexcept
+    {
+        assert(npcId < mMaxNpcs);
+        return mSpringCountBuffer[npcId];
+    }
+
+    /*
+     * Adds a spring to the NPC's slot; rest length and force factors are
+     * calculated later.
+     */
+    ElementIndex Add(
+        NpcId npcId,
+        ElementIndex endpointAIndex,
+        ElementIndex endpointBIndex,
+        float baseRestLength,
+        float baseSpringReductionFraction,
+        float baseSpringDampingCoefficient)
+    {
+        assert(npcId < mMaxNpcs);
+        assert(mSpringCountBuffer[npcId] < SimulationParameters::MaxSpringsPerNpc);
+
+        ElementIndex const s = GetSpringIndex(npcId, mSpringCountBuffer[npcId]);
+        ++(mSpringCountBuffer[npcId]);
+
+        mEndpointsBuffer[s] = { endpointAIndex, endpointBIndex };
+        mRestLengthBuffer[s] = 0.0f;
+        mStiffnessFactorBuffer[s] = 0.0f;
+        mDampingFactorBuffer[s] = 0.0f;
+
+        mBaseRestLengthBuffer[s] = baseRestLength;
+        mBaseSpringReductionFractionBuffer[s] = baseSpringReductionFraction;
+        mBaseSpringDampingCoefficientBuffer[s] = baseSpringDampingCoefficient;
+
+        return s;
+    }
+
+    void RemoveAll(NpcId npcId)
+    {
+        assert(npcId < mMaxNpcs);
+        mSpringCountBuffer[npcId] = 0;
+    }
+
+    //
+    // Physics
+    //
+
+    ElementIndex GetEndpointAIndex(ElementIndex springElementIndex) const noexcept
+    {
+        return mEndpointsBuffer[springElementIndex].EndpointAIndex;
+    }
+
+    ElementIndex GetEndpointBIndex(ElementIndex springElementIndex) const noexcept
+    {
+        return mEndpointsBuffer[springElementIndex].EndpointBIndex;
+    }
+
+    EndpointsType const * GetEndpointsBuffer() const noexcept
+    {
+        return mEndpointsBuffer.data();
+    }
+
+    float GetRestLength(ElementIndex springElementIndex) const noexcept
+    {
+        return mRestLengthBuffer[springElementIndex];
+    }
+
+    void SetRestLength(
+        ElementIndex springElementIndex,
+        float value) noexcept
+    {
+        mRestLengthBuffer[springElementIndex] = value;
+    }
+
+    float const * GetRestLengthBuffer() const noexcept
+    {
+        return mRestLengthBuffer.data();
+    }
+
+    float GetStiffnessFactor(ElementIndex springElementIndex) const noexcept
+    {
+        return mStiffnessFactorBuffer[springElementIndex];
+    }
+
+    void SetStiffnessFactor(
+        ElementIndex springElementIndex,
+        float value) noexcept
+    {
+        mStiffnessFactorBuffer[springElementIndex] = value;
+    }
+
+    float const * GetStiffnessFactorBuffer() const noexcept
+    {
+        return mStiffnessFactorBuffer.data();
+    }
+
+    float GetDampingFactor(ElementIndex springElementIndex) const noexcept
+    {
+        return mDampingFactorBuffer[springElementIndex];
+    }
+
+    void SetDampingFactor(
+        ElementIndex springElementIndex,
+        float value) noexcept
+    {
+        mDampingFactorBuffer[springElementIndex] = value;
+    }
+
+    float const * GetDampingFactorBuffer() const noexcept
+    {
+        return mDampingFactorBuffer.data();
+    }
+
+    //
+    // Constants
+    //
+
+    float GetBaseRestLength(ElementIndex springElementIndex) const noexcept
+    {
+        return mBaseRestLengthBuffer[springElementIndex];
+    }
+
+    float GetBaseSpringReductionFraction(ElementIndex springElementIndex) const noexcept
+    {
+        return mBaseSpringReductionFractionBuffer[springElementIndex];
+    }
+
+    float GetBaseSpringDampingCoefficient(ElementIndex springElementIndex) const noexcept
+    {
+        return mBaseSpringDampingCoefficientBuffer[springElementIndex];
+    }
+
+private:
+
+    size_t const mMaxNpcs;
+
+    //////////////////////////////////////////////////////////
+    // Buffers
+    //////////////////////////////////////////////////////////
+
+    // Number of springs in each NPC's slot
+    Buffer<size_t> mSpringCountBuffer;
+
+    //
+    // Physics - hot, read at each simulation step
+    //
+
+    Buffer<EndpointsType> mEndpointsBuffer;
+    Buffer<float> mRestLengthBuffer; // Adjusted
+    Buffer<float> mStiffnessFactorBuffer;
+    Buffer<float> mDampingFactorBuffer;
+
+    //
+    // Constants - cold, only read when recalculating the above
+    //
+
+    Buffer<float> mBaseRestLengthBuffer;
+    Buffer<float> mBaseSpringReductionFractionBuffer;
+    Buffer<float> mBaseSpringDampingCoefficientBuffer;
+};
+
+}
@@ -7,6 +7,7 @@
 
 #include <Core/Colors.h>
 #include <Core/GameGeometry.h>
+#include <Core/Profiler.h>
 #include <Core/StockColors.h>
 
 #ifdef _MSC_VER
@@ -30,11 +31,18 @@ Npcs::Npcs(
     , mStateBuffer()
     , mShips()
     , mParticles(static_cast<ElementCount>(mMaxNpcs * SimulationParameters::MaxParticlesPerNpc))
+    , mSprings(mMaxNpcs)
     // State
     , mCurrentSimulationSequenceNumber()
     , mCurrentlySelectedNpc()
     , mCurrentlySelectedNpcWallClockTimestamp()
     , mGeneralizedPanicLevel(0.0f)
+    // Concurrency
+    , mIsUpdatingNpcPhysicsConcurrently(false)
+    , mConcurrentSideEffectsLock()
+    , mPerShipNpcPhysicsIds()
+    , mNpcPhysicsShipOrder()
+    , mNpcPhysicsTasks()
     // Stats
     , mFreeRegimeHumanNpcCount(0)
     , mConstrainedRegimeHumanNpcCount(0)
@@ -186,7 +194,8 @@ Main principles:
 void Npcs::Update(
     float currentSimulationTime,
     Storm::Parameters const & stormParameters,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     //
     // Check invariants
@@ -250,9 +259,17 @@ void Npcs::Update(
     // Advance the current simulation sequence
     ++mCurrentSimulationSequenceNumber;
 
-    UpdateNpcPhysics(currentSimulationTime, stormParameters, simulationParameters);
+    {
+        FS_PROFILE_ZONE("Npcs::UpdateNpcPhysics");
 
-    UpdateNpcBehavior(currentSimulationTime, simulationParameters);
+        UpdateNpcPhysics(currentSimulationTime, stormParameters, simulationParameters, threadManager);
+    }
+
+    {
+        FS_PROFILE_ZONE("Npcs::UpdateNpcBehavior");
+
+        UpdateNpcBehavior(currentSimulationTime, simulationParameters);
+    }
 
     //
     // Decays
@@ -315,12 +332,13 @@ void Npcs::Upload(RenderContext & renderContext) const
                     }
 
                     // Springs
-                    for (auto const & spring : state.ParticleMesh.Springs)
+                    for (size_t s = 0; s < mSprings.GetSpringCount(npcId); ++s)
                     {
+                        ElementIndex const springIndex = NpcSprings::GetSpringIndex(npcId, s);
                         renderContext.UploadNpcSpring(
                             planeId,
-                            mParticles.GetPosition(spring.EndpointAIndex),
-                            mParticles.GetPosition(spring.EndpointBIndex),
+                            mParticles.GetPosition(mSprings.GetEndpointAIndex(springIndex)),
+                            mParticles.GetPosition(mSprings.GetEndpointBIndex(springIndex)),
                             rgbaColor(0x4a, 0x4a, 0x4a, 0xff));
                     }
                 }
@@ -502,7 +520,7 @@ void Npcs::OnShipAdded(Ship & ship)
     assert(!mShips[s].has_value());
 
     // Initialize NPC Ship
-    mShips[s].emplace(ship);
+    mShips[s].emplace(ship, ship.GetId());
 }
 
 void Npcs::OnShipRemoved(ShipId shipId)
@@ -600,10 +618,16 @@ void Npcs::OnShipRemoved(ShipId shipId)
         }
 
         //
-        // Free particles
+        // Free particles and springs
         //
 
-        InternalFreeNpcParticles(*mStateBuffer[npcId]);
+        InternalFreeNpcParticleMesh(*mStateBuffer[npcId]);
+
+        //
+        // Reset NPC
+        //
+
+        mStateBuffer[npcId].reset();
     }
 
     PublishCount();
@@ -713,6 +737,15 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
     // Create NPC
     //
 
+    // Needed upfront, as it determines the NPC's particle and spring slots
+    auto const newNpcId = GetNewNpcId();
+    if (!newNpcId.has_value())
+    {
+        return { std::nullopt, NpcPlacementFailureReasonType::TooManyNpcs };
+    }
+
+    NpcId const npcId = *newNpcId;
+
     if (!subKind.has_value())
     {
         subKind = ChooseSubKind(NpcKindType::Furniture, std::nullopt);
@@ -776,7 +809,9 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
                 mCurrentNpcFrictionAdjustment,
                 mCurrentKineticFrictionAdjustment);
 
-            auto const primaryParticleIndex = mParticles.Add(
+            auto const primaryParticleIndex = GetNpcParticleIndex(npcId, 0);
+            mParticles.Add(
+                primaryParticleIndex,
                 mass,
                 buoyancyVolumeFill,
                 buoyancyFactor,
@@ -858,7 +893,9 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
                     mCurrentNpcFrictionAdjustment,
                     mCurrentKineticFrictionAdjustment);
 
-                auto const particleIndex = mParticles.Add(
+                auto const particleIndex = GetNpcParticleIndex(npcId, p);
+                mParticles.Add(
+                    particleIndex,
                     mass,
                     buoyancyVolumeFill,
                     buoyancyFactor * GameRandomEngine::GetInstance().GenerateUniformReal(0.99f, 1.01f), // Make sure rotates while floating
@@ -875,7 +912,8 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
 
             // 0 - 1
             {
-                particleMesh.Springs.emplace_back(
+                mSprings.Add(
+                    npcId,
                     particleMesh.Particles[0].ParticleIndex,
                     particleMesh.Particles[1].ParticleIndex,
                     baseWidth,
@@ -885,7 +923,8 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
 
             // 0 | 3
             {
-                particleMesh.Springs.emplace_back(
+                mSprings.Add(
+                    npcId,
                     particleMesh.Particles[0].ParticleIndex,
                     particleMesh.Particles[3].ParticleIndex,
                     baseHeight,
@@ -895,7 +934,8 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
 
             // 0 \ 2
             {
-                particleMesh.Springs.emplace_back(
+                mSprings.Add(
+                    npcId,
                     particleMesh.Particles[0].ParticleIndex,
                     particleMesh.Particles[2].ParticleIndex,
                     baseDiagonal,
@@ -905,7 +945,8 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
 
             // 1 | 2
             {
-                particleMesh.Springs.emplace_back(
+                mSprings.Add(
+                    npcId,
                     particleMesh.Particles[1].ParticleIndex,
                     particleMesh.Particles[2].ParticleIndex,
                     baseHeight,
@@ -915,7 +956,8 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
 
             // 2 - 3
             {
-                particleMesh.Springs.emplace_back(
+                mSprings.Add(
+                    npcId,
                     particleMesh.Particles[2].ParticleIndex,
                     particleMesh.Particles[3].ParticleIndex,
                     baseWidth,
@@ -925,7 +967,8 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
 
             // 1 / 3
             {
-                particleMesh.Springs.emplace_back(
+                mSprings.Add(
+                    npcId,
                     particleMesh.Particles[1].ParticleIndex,
                     particleMesh.Particles[3].ParticleIndex,
                     baseDiagonal,
@@ -941,7 +984,8 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
                 mCurrentSpringReductionFractionAdjustment,
                 mCurrentSpringDampingCoefficientAdjustment,
                 mParticles,
-                particleMesh);
+                npcId,
+                mSprings);
 
             break;
         }
@@ -960,8 +1004,6 @@ NpcPlacementOutcome Npcs::BeginPlaceNewFurnitureNpc(
     // Store NPC
     //
 
-    NpcId const npcId = GetNewNpcId();
-
     // This NPC begins its journey on the topmost ship, just
     // to make sure it's at the nearest Z
     ShipId const shipId = GetTopmostShipId();
@@ -1013,6 +1055,15 @@ NpcPlacementOutcome Npcs::BeginPlaceNewHumanNpc(
     // Create NPC
     //
 
+    // Needed upfront, as it determines the NPC's particle and spring slots
+    auto const newNpcId = GetNewNpcId();
+    if (!newNpcId.has_value())
+    {
+        return { std::nullopt, NpcPlacementFailureReasonType::TooManyNpcs };
+    }
+
+    NpcId const npcId = *newNpcId;
+
     if (!subKind.has_value())
     {
         subKind = ChooseSubKind(NpcKindType::Human, std::nullopt);
@@ -1061,7 +1112,9 @@ NpcPlacementOutcome Npcs::BeginPlaceNewHumanNpc(
         mCurrentNpcFrictionAdjustment,
         mCurrentKineticFrictionAdjustment);
 
-    auto const primaryParticleIndex = mParticles.Add(
+    auto const primaryParticleIndex = GetNpcParticleIndex(npcId, 0);
+    mParticles.Add(
+        primaryParticleIndex,
         feetMass,
         feetParticleAttributes.BuoyancyVolumeFill,
         feetBuoyancyFactor,
@@ -1104,7 +1157,9 @@ NpcPlacementOutcome Npcs::BeginPlaceNewHumanNpc(
         mCurrentNpcFrictionAdjustment,
         mCurrentKineticFrictionAdjustment);
 
-    auto const secondaryParticleIndex = mParticles.Add(
+    auto const secondaryParticleIndex = GetNpcParticleIndex(npcId, 1);
+    mParticles.Add(
+        secondaryParticleIndex,
         headMass,
         headParticleAttributes.BuoyancyVolumeFill,
         headBuoyancyFactor,
@@ -1118,7 +1173,8 @@ NpcPlacementOutcome Npcs::BeginPlaceNewHumanNpc(
 
     // Dipole spring
 
-    particleMesh.Springs.emplace_back(
+    mSprings.Add(
+        npcId,
         primaryParticleIndex,
         secondaryParticleIndex,
         baseHeight,
@@ -1133,7 +1189,8 @@ NpcPlacementOutcome Npcs::BeginPlaceNewHumanNpc(
         mCurrentSpringReductionFractionAdjustment,
         mCurrentSpringDampingCoefficientAdjustment,
         mParticles,
-        particleMesh);
+        npcId,
+        mSprings);
 
     // Human
 
@@ -1179,8 +1236,6 @@ NpcPlacementOutcome Npcs::BeginPlaceNewHumanNpc(
     // Store NPC
     //
 
-    NpcId const npcId = GetNewNpcId();
-
     // This NPC begins its journey on the topmost ship, just
     // to make sure it's at the nearest Z
     ShipId const shipId = GetTopmostShipId();
@@ -1559,10 +1614,10 @@ void Npcs::AbortNewNpc(NpcId id)
     ship.RemoveNpc(id);
 
     //
-    // Free particles
+    // Free particles and springs
     //
 
-    InternalFreeNpcParticles(npc);
+    InternalFreeNpcParticleMesh(npc);
 
     //
     // Reset NPC
@@ -3532,12 +3587,14 @@ void Npcs::InternalHighlightNpc(NpcId id)
     mStateBuffer[id]->IsHighlightedForRendering = true;
 }
 
-void Npcs::InternalFreeNpcParticles(StateType const & npc)
+void Npcs::InternalFreeNpcParticleMesh(StateType const & npc)
 {
     for (auto const & p : npc.ParticleMesh.Particles)
     {
         mParticles.Remove(p.ParticleIndex);
     }
+
+    mSprings.RemoveAll(npc.Id);
 }
 
 void Npcs::PublishCount()
@@ -3550,7 +3607,7 @@ void Npcs::PublishSelection()
     mSimulationEventHandler.OnNpcSelectionChanged(mCurrentlySelectedNpc);
 }
 
-NpcId Npcs::GetNewNpcId()
+std::optional<NpcId> Npcs::GetNewNpcId()
 {
     // See if we can find a hole, so we stay compact
     for (size_t n = 0; n < mStateBuffer.size(); ++n)
@@ -3561,7 +3618,13 @@ NpcId Npcs::GetNewNpcId()
         }
     }
 
-    // No luck, add new entry
+    // No luck, add new entry - as long as it has particle and spring slots,
+    // which are keyed by NPC ID
+    if (mStateBuffer.size() >= mMaxNpcs)
+    {
+        return std::nullopt;
+    }
+
     NpcId const newNpcId = static_cast<NpcId>(mStateBuffer.size());
     mStateBuffer.emplace_back(std::nullopt);
     return newNpcId;
@@ -3685,7 +3748,7 @@ std::optional<GlobalElementId> Npcs::FindTopmostWorkableTriangleContaining(vec2f
 
             std::optional<ElementIndex> bestTriangleIndex;
             PlaneId bestPlaneId = std::numeric_limits<PlaneId>::lowest();
-            for (auto const triangleIndex : homeShip.GetTriangles())
+            for (auto const triangleIndex : homeShip.GetTriangleCandidatesAt(position))
             {
                 if (!homeShip.GetTriangles().IsDeleted(triangleIndex))
                 {
@@ -3727,7 +3790,7 @@ ElementIndex Npcs::FindWorkableTriangleContaining(
     Ship const & homeShip,
     std::optional<ConnectedComponentId> constrainedConnectedComponentId)
 {
-    for (auto const triangleIndex : homeShip.GetTriangles())
+    for (auto const triangleIndex : homeShip.GetTriangleCandidatesAt(position))
     {
         if (!homeShip.GetTriangles().IsDeleted(triangleIndex))
         {
@@ -3844,7 +3907,7 @@ void Npcs::RenderNpc(
         case NpcKindType::Human:
         {
             assert(npc.ParticleMesh.Particles.size() == 2);
-            assert(npc.ParticleMesh.Springs.size() == 1);
+            assert(mSprings.GetSpringCount(npc.Id) == 1);
             auto const & humanNpcState = npc.KindSpecificState.HumanNpcState;
             auto const & animationState = humanNpcState.AnimationState;
 
@@ -3907,7 +3970,7 @@ void Npcs::RenderNpc(
                 + actualBodyVector
                     * (IsTextureMode ? humanNpcState.TextureGeometry.HeadLengthFraction : SimulationParameters::HumanNpcGeometry::HeadLengthFraction);
 
-            float const adjustedIdealHumanHeight = npc.ParticleMesh.Springs[0].RestLength;
+            float const adjustedIdealHumanHeight = mSprings.GetRestLength(NpcSprings::GetSpringIndex(npc.Id, 0));
 
             float const headWidthMultiplier = 1.0f + (humanNpcState.WidthMultipier - 1.0f) * 0.5f; // Head doesn'w widen/narrow like body does
             float const headWidthFraction = IsTextureMode
@@ -4870,7 +4933,7 @@ void Npcs::UpdateHumanNpcAnimation(
     using HumanNpcStateType = StateType::KindSpecificStateType::HumanNpcStateType;
 
     assert(npc.ParticleMesh.Particles.size() == 2);
-    assert(npc.ParticleMesh.Springs.size() == 1);
+    assert(mSprings.GetSpringCount(npc.Id) == 1);
     ElementIndex const primaryParticleIndex = npc.ParticleMesh.Particles[0].ParticleIndex;
     auto const & primaryContrainedState = npc.ParticleMesh.Particles[0].ConstrainedState;
     ElementIndex const secondaryParticleIndex = npc.ParticleMesh.Particles[1].ParticleIndex;
@@ -5174,7 +5237,7 @@ void Npcs::UpdateHumanNpcAnimation(
                 0.41f // std::atanf((SimulationParameters::HumanNpcGeometry::StepLengthFraction / 2.0f) / SimulationParameters::HumanNpcGeometry::LegLengthFraction)
                 * std::sqrt(actualWalkingSpeed * 0.9f);
 
-            adjustedStandardHumanHeight = npc.ParticleMesh.Springs[0].RestLength;
+            adjustedStandardHumanHeight = mSprings.GetRestLength(NpcSprings::GetSpringIndex(npc.Id, 0));
             float const stepLength = SimulationParameters::HumanNpcGeometry::StepLengthFraction * adjustedStandardHumanHeight;
             float const distance =
                 humanNpcState.TotalDistanceTraveledOnEdgeSinceStateTransition
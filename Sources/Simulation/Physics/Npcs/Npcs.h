@@ -22,12 +22,14 @@
 #include <Core/Log.h>
 #include <Core/StrongTypeDef.h>
 #include <Core/SysSpecifics.h>
+#include <Core/ThreadManager.h>
 #include <Core/Vectors.h>
 
 #include <algorithm>
 #include <cassert>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <vector>
 
@@ -174,45 +176,11 @@ private:
 			}
 		};
 
-		struct NpcSpringStateType final
-		{
-			ElementIndex EndpointAIndex; // Index in NpcParticles
-			ElementIndex EndpointBIndex; // Index in NpcParticles
-
-			// Constants
-			float BaseRestLength;
-			float BaseSpringReductionFraction;
-			float BaseSpringDampingCoefficient;
-
-			// Calculated
-			float RestLength; // Adjusted
-			float SpringStiffnessFactor;
-			float SpringDampingFactor;
-
-			NpcSpringStateType() = default; // For array
-
-			NpcSpringStateType(
-				ElementIndex endpointAIndex,
-				ElementIndex endpointBIndex,
-				float baseRestLength,
-				float baseSpringReductionFraction,
-				float baseSpringDampingCoefficient)
-				: EndpointAIndex(endpointAIndex)
-				, EndpointBIndex(endpointBIndex)
-				, BaseRestLength(baseRestLength)
-				, BaseSpringReductionFraction(baseSpringReductionFraction)
-				, BaseSpringDampingCoefficient(baseSpringDampingCoefficient)
-				, RestLength(0.0f) // Calculated later
-				, SpringStiffnessFactor(0.0f) // Calculated later
-				, SpringDampingFactor(0.0f) // Calculated later
-			{}
-		};
-
 		struct ParticleMeshType final
 		{
+			// Particle indices are fixed by the NPC's ID - see GetNpcParticleIndex();
+			// springs live in NpcSprings, at the NPC's slot
 			FixedSizeVector<NpcParticleStateType, SimulationParameters::MaxParticlesPerNpc> Particles;
-
-			FixedSizeVector<NpcSpringStateType, SimulationParameters::MaxSpringsPerNpc> Springs;
 		};
 
 		union KindSpecificStateType
@@ -1054,6 +1022,9 @@ private:
 		NpcStatsByKind ActiveNpcStats;
 		NpcStatsByKind TotalNpcStats; // Included being removed; used e.g. for rendering
 
+		// Our own, so that our NPCs' updates do not depend on the thread they run on
+		GameRandomEngine RandomEngine;
+
 		void AddNpc(NpcId npcId)
 		{
 			assert(std::find(Npcs.cbegin(), Npcs.cend(), npcId) == Npcs.cend());
@@ -1067,7 +1038,9 @@ private:
 			Npcs.erase(it);
 		}
 
-		ShipNpcsType(Ship & homeShip)
+		ShipNpcsType(
+			Ship & homeShip,
+			ShipId homeShipId)
 			: HomeShip(homeShip)
 			, Npcs()
 			, BurningNpcs()
@@ -1076,6 +1049,7 @@ private:
 			//
 			, ActiveNpcStats()
 			, TotalNpcStats()
+			, RandomEngine(GameRandomEngine::MakeObjectInstance(static_cast<unsigned int>(homeShipId)))
 		{}
 	};
 
@@ -1104,7 +1078,8 @@ public:
 	void Update(
 		float currentSimulationTime,
 		Storm::Parameters const & stormParameters,
-		SimulationParameters const & simulationParameters);
+		SimulationParameters const & simulationParameters,
+		ThreadManager & threadManager);
 
 	void UpdateEnd();
 
@@ -1496,13 +1471,23 @@ private:
 
 	void InternalHighlightNpc(NpcId id);
 
-	void InternalFreeNpcParticles(StateType const & npc);
+	void InternalFreeNpcParticleMesh(StateType const & npc);
 
 	void PublishCount();
 
 	void PublishSelection();
 
-	NpcId GetNewNpcId();
+	std::optional<NpcId> GetNewNpcId();
+
+	// Particles of the same NPC are contiguous, so that visiting NPCs
+	// in ID order streams linearly through the particle buffers
+	static inline ElementIndex GetNpcParticleIndex(
+		NpcId npcId,
+		int particleOrdinal)
+	{
+		assert(particleOrdinal >= 0 && static_cast<size_t>(particleOrdinal) < SimulationParameters::MaxParticlesPerNpc);
+		return static_cast<ElementIndex>(npcId * SimulationParameters::MaxParticlesPerNpc + static_cast<size_t>(particleOrdinal));
+	}
 
 	NpcSubKindIdType ChooseSubKind(
 		NpcKindType kind,
@@ -1524,26 +1509,26 @@ private:
 		StateType & npc,
 		ShipId newShip);
 
-	static inline int GetSpringAmongEndpoints(
+	inline ElementIndex GetSpringAmongEndpoints(
 		int particleEndpoint1,
 		int particleEndpoint2,
-		StateType::ParticleMeshType const & particleMesh)
+		StateType const & npc) const
 	{
-		assert(particleMesh.Particles.size() >= 2);
-		ElementIndex p1 = particleMesh.Particles[particleEndpoint1].ParticleIndex;
-		ElementIndex p2 = particleMesh.Particles[particleEndpoint2].ParticleIndex;
-		for (size_t s = 0; s < particleMesh.Springs.size(); ++s)
+		assert(npc.ParticleMesh.Particles.size() >= 2);
+		ElementIndex p1 = npc.ParticleMesh.Particles[particleEndpoint1].ParticleIndex;
+		ElementIndex p2 = npc.ParticleMesh.Particles[particleEndpoint2].ParticleIndex;
+		for (size_t s = 0; s < mSprings.GetSpringCount(npc.Id); ++s)
 		{
-			auto const & spring = particleMesh.Springs[s];
-			if ((spring.EndpointAIndex == p1 && spring.EndpointBIndex == p2)
-				|| (spring.EndpointBIndex == p1 && spring.EndpointAIndex == p2))
+			ElementIndex const springIndex = NpcSprings::GetSpringIndex(npc.Id, s);
+			if ((mSprings.GetEndpointAIndex(springIndex) == p1 && mSprings.GetEndpointBIndex(springIndex) == p2)
+				|| (mSprings.GetEndpointBIndex(springIndex) == p1 && mSprings.GetEndpointAIndex(springIndex) == p2))
 			{
-				return static_cast<int>(s);
+				return springIndex;
 			}
 		}
 
 		assert(false);
-		return -1;
+		return NoneElementIndex;
 	}
 
 	void PublishHumanNpcStats();
@@ -1608,8 +1593,40 @@ private:
 	void UpdateNpcPhysics(
 		float currentSimulationTime,
 		Storm::Parameters const & stormParameters,
+		SimulationParameters const & simulationParameters,
+		ThreadManager & threadManager);
+
+	bool ShouldUpdateNpcPhysicsConcurrently(
+		SimulationParameters const & simulationParameters,
+		ThreadManager const & threadManager) const;
+
+	void UpdateNpcPhysicsConcurrently(
+		float currentSimulationTime,
+		float effectiveAirTemperature,
+		float effectiveWaterTemperature,
+		vec2f const & globalWindForce,
+		SimulationParameters const & simulationParameters,
+		ThreadManager & threadManager);
+
+	void UpdateNpcPhysics(
+		StateType & npc,
+		float currentSimulationTime,
+		float effectiveAirTemperature,
+		float effectiveWaterTemperature,
+		vec2f const & globalWindForce,
 		SimulationParameters const & simulationParameters);
 
+	/*
+	 * Serializes changes to state shared among ships' NPCs - regime stats, deferred removals,
+	 * world - made while NPC physics is updating concurrently; a no-op otherwise.
+	 */
+	inline std::unique_lock<std::mutex> LockForConcurrentSideEffects()
+	{
+		return mIsUpdatingNpcPhysicsConcurrently
+			? std::unique_lock<std::mutex>(mConcurrentSideEffectsLock)
+			: std::unique_lock<std::mutex>();
+	}
+
 	void UpdateNpcBehavior(
 		float currentSimulationTime,
 		SimulationParameters const & simulationParameters);
@@ -1669,7 +1686,8 @@ private:
 		float springReductionFractionAdjustment,
 		float springDampingCoefficientAdjustment,
 		NpcParticles const & particles,
-		StateType::ParticleMeshType & mesh); // In/Out
+		NpcId npcId,
+		NpcSprings & springs); // In/Out
 
 	static float CalculateSpringLength(
 		float baseLength,
@@ -2345,6 +2363,9 @@ private:
 	// All of the NPC particles.
 	NpcParticles mParticles;
 
+	// All of the NPC springs.
+	NpcSprings mSprings;
+
 	//
 	// State
 	//
@@ -2358,6 +2379,18 @@ private:
 
 	float mGeneralizedPanicLevel; // [0.0f ... +1.0f], manually decayed
 
+	//
+	// Concurrency
+	//
+
+	bool mIsUpdatingNpcPhysicsConcurrently;
+	std::mutex mConcurrentSideEffectsLock;
+
+	// Buffers for concurrent NPC physics, reused across steps
+	std::vector<std::vector<NpcId>> mPerShipNpcPhysicsIds;
+	std::vector<ShipId> mNpcPhysicsShipOrder;
+	std::vector<ThreadPool::Task> mNpcPhysicsTasks;
+
 	//
 	// Stats
 	//
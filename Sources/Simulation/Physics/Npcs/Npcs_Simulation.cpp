@@ -7,7 +7,9 @@
 
 #include <Core/Conversions.h>
 #include <Core/GameMath.h>
+#include <Core/Profiler.h>
 
+#include <algorithm>
 #include <array>
 #include <limits>
 
@@ -181,7 +183,10 @@ void Npcs::TransitionParticleToConstrainedState(
     // Regime
     auto const oldRegime = npc.CurrentRegime;
     npc.CurrentRegime = CalculateRegime(npc);
-    OnMayBeNpcRegimeChanged(oldRegime, npc);
+    {
+        auto const lock = LockForConcurrentSideEffects(); // Regime stats are global
+        OnMayBeNpcRegimeChanged(oldRegime, npc);
+    }
 
     // We'll update plane ID for constrained NPCs at end of Update()
 }
@@ -216,7 +221,10 @@ void Npcs::TransitionParticleToFreeState(
     // Regime
     auto const oldRegime = npc.CurrentRegime;
     npc.CurrentRegime = CalculateRegime(npc);
-    OnMayBeNpcRegimeChanged(oldRegime, npc);
+    {
+        auto const lock = LockForConcurrentSideEffects(); // Regime stats are global
+        OnMayBeNpcRegimeChanged(oldRegime, npc);
+    }
 }
 
 std::optional<Npcs::StateType::NpcParticleStateType::ConstrainedStateType> Npcs::CalculateParticleConstrainedState(
@@ -319,7 +327,8 @@ Npcs::StateType::RegimeType Npcs::CalculateRegime(StateType const & npc)
 void Npcs::UpdateNpcPhysics(
     float currentSimulationTime,
     Storm::Parameters const & stormParameters,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     LogNpcDebug("----------------------------------");
     LogNpcDebug("----------------------------------");
@@ -364,442 +373,615 @@ void Npcs::UpdateNpcPhysics(
 
     // Visit all NPCs
 
-    for (auto & npcState : mStateBuffer)
+    if (ShouldUpdateNpcPhysicsConcurrently(simulationParameters, threadManager))
+    {
+        UpdateNpcPhysicsConcurrently(
+            currentSimulationTime,
+            effectiveAirTemperature,
+            effectiveWaterTemperature,
+            globalWindForce,
+            simulationParameters,
+            threadManager);
+    }
+    else
+    {
+        for (auto & npcState : mStateBuffer)
+        {
+            if (npcState.has_value()
+                && npcState->IsActive())
+            {
+                // Draw from the engine we'd use when updating concurrently
+                GameRandomEngine::ScopedThreadInstance const randomEngineScope(mShips[npcState->CurrentShipId]->RandomEngine);
+
+                UpdateNpcPhysics(
+                    *npcState,
+                    currentSimulationTime,
+                    effectiveAirTemperature,
+                    effectiveWaterTemperature,
+                    globalWindForce,
+                    simulationParameters);
+            }
+        }
+    }
+}
+
+bool Npcs::ShouldUpdateNpcPhysicsConcurrently(
+    SimulationParameters const & simulationParameters,
+    ThreadManager const & threadManager) const
+{
+#ifdef IN_BARYLAB
+    // Probing state is shared among all NPCs
+    (void)simulationParameters;
+    (void)threadManager;
+    return false;
+#else
+    if (!simulationParameters.DoConcurrentNpcUpdates
+        || threadManager.GetSimulationParallelism() < 2)
+    {
+        return false;
+    }
+
+    //
+    // NPCs of the same ship share the ship's mesh - imparting forces and masses on it, starting
+    // explosions on it, and looking up its triangles - hence we may only partition by ship;
+    // the NPCs of a single ship are always updated serially, however many they are
+    //
+
+    size_t constexpr MinNpcsForConcurrentUpdate = 32;
+
+    size_t shipsWithNpcsCount = 0;
+    size_t totalNpcCount = 0;
+    for (auto const & ship : mShips)
+    {
+        if (ship.has_value())
+        {
+            size_t const shipNpcCount = ship->ActiveNpcStats.FurnitureNpcCount + ship->ActiveNpcStats.HumanNpcCount;
+            if (shipNpcCount > 0)
+            {
+                ++shipsWithNpcsCount;
+                totalNpcCount += shipNpcCount;
+            }
+        }
+    }
+
+    return shipsWithNpcsCount >= 2 && totalNpcCount >= MinNpcsForConcurrentUpdate;
+#endif
+}
+
+void Npcs::UpdateNpcPhysicsConcurrently(
+    float currentSimulationTime,
+    float effectiveAirTemperature,
+    float effectiveWaterTemperature,
+    vec2f const & globalWindForce,
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
+{
+    //
+    // Each ship's NPCs are a task, visited in ID order and drawing random numbers from
+    // the ship's own engine, as in the serial update; while NPCs are updating:
+    //  - Changes to state shared among ships are serialized (see LockForConcurrentSideEffects()),
+    //    in an arbitrary order;
+    //  - Events are queued, and delivered to sinks by this thread
+    //
+
+    mPerShipNpcPhysicsIds.resize(mShips.size());
+    for (auto & shipNpcIds : mPerShipNpcPhysicsIds)
+    {
+        shipNpcIds.clear();
+    }
+
+    for (auto const & npcState : mStateBuffer)
     {
         if (npcState.has_value()
             && npcState->IsActive())
         {
-            assert(mShips[npcState->CurrentShipId].has_value());
-            auto & homeShip = mShips[npcState->CurrentShipId]->HomeShip;
-
-            // Invariant checks
+            assert(npcState->CurrentShipId < mPerShipNpcPhysicsIds.size());
+            mPerShipNpcPhysicsIds[npcState->CurrentShipId].push_back(npcState->Id);
+        }
+    }
 
-            assert((npcState->CurrentRegime == StateType::RegimeType::BeingPlaced) == npcState->BeingPlacedState.has_value());
-            assert(npcState->ParticleMesh.Particles.size() > 0);
+    // Ships with most NPCs first, so that they're picked up first
+    mNpcPhysicsShipOrder.clear();
+    for (ShipId s = 0; s < mPerShipNpcPhysicsIds.size(); ++s)
+    {
+        if (!mPerShipNpcPhysicsIds[s].empty())
+        {
+            mNpcPhysicsShipOrder.push_back(s);
+        }
+    }
 
-            // Low-frequency updates
+    std::stable_sort(
+        mNpcPhysicsShipOrder.begin(),
+        mNpcPhysicsShipOrder.end(),
+        [this](ShipId l, ShipId r)
+        {
+            return mPerShipNpcPhysicsIds[l].size() > mPerShipNpcPhysicsIds[r].size();
+        });
 
-            unsigned int constexpr LowFrequencyUpdatePeriod = 4;
-            if (mCurrentSimulationSequenceNumber.IsStepOf(npcState->Id % LowFrequencyUpdatePeriod, LowFrequencyUpdatePeriod))
+    assert(mNpcPhysicsTasks.empty());
+    for (ShipId const s : mNpcPhysicsShipOrder)
+    {
+        mNpcPhysicsTasks.emplace_back(
+            [this, s, currentSimulationTime, effectiveAirTemperature, effectiveWaterTemperature, globalWindForce, &simulationParameters]()
             {
-                //
-                // Waterness, Water Velocity, Temperature
-                //
-                // Temperature:
-                //  - Constrained particles exchange with mesh, Free particles with air/water (and evt. interactions)
-                //
+                FS_PROFILE_ZONE("Npcs::UpdateShipNpcPhysics");
 
-                bool isOneNpcParticleInBurningMesh = false; // True if NPC has at least one particle in a burning mesh
-                ElementIndex oneNpcParticleAboveIgnitionTemperature = NoneElementIndex; // If set, that particle is above its ignition temperature
-                ElementIndex oneNpcParticleExplosive = NoneElementIndex; // If set, that particle is explosive
-                bool isOneNpcParticleInWater = false; // True if NPC has at least one particle in water (using magic threshold)
-                ElementIndex oneNpcParticleAboveWaterReactionThreshold = NoneElementIndex; // If set, that (reactive) particle is ready to react
+                GameRandomEngine::ScopedThreadInstance const randomEngineScope(mShips[s]->RandomEngine);
 
-                // Visit all particles
-                for (size_t p = 0; p < npcState->ParticleMesh.Particles.size(); ++p)
+                for (NpcId const npcId : mPerShipNpcPhysicsIds[s])
                 {
-                    auto const & particle = npcState->ParticleMesh.Particles[p];
+                    assert(mStateBuffer[npcId].has_value());
+                    assert(mStateBuffer[npcId]->IsActive());
 
-                    float particleWaterness;
-                    float particleTemperature;
-                    bool isParticleInBurningMesh = false;
+                    UpdateNpcPhysics(
+                        *mStateBuffer[npcId],
+                        currentSimulationTime,
+                        effectiveAirTemperature,
+                        effectiveWaterTemperature,
+                        globalWindForce,
+                        simulationParameters);
+                }
+            });
+    }
 
-                    if (particle.ConstrainedState.has_value())
-                    {
-                        // Constrained particle
+    // Already so when all world subsystems are updating concurrently
+    bool const isNested = mSimulationEventHandler.IsDeferringSinkCalls();
 
-                        //
-                        // Calculate particle's mesh waterness, mesh water velocity, and temperature
-                        // from the mesh
-                        //
+    mIsUpdatingNpcPhysicsConcurrently = true;
+    if (!isNested)
+    {
+        mSimulationEventHandler.StartDeferringSinkCalls();
+    }
 
-                        auto const t = particle.ConstrainedState->CurrentBCoords.TriangleElementIndex;
+    threadManager.GetSimulationThreadPool().RunAndClear(mNpcPhysicsTasks);
 
-                        float totalMeshWaterness = 0.0f;
-                        vec2f totalMeshWaterVelocity = vec2f::zero();
-                        float meshWaterablePointCount = 0.0f;
-                        float totalMeshTemperature = 0.0f;
-                        for (int v = 0; v < 3; ++v)
-                        {
-                            ElementIndex const pointElementIndex = homeShip.GetTriangles().GetPointIndices(t)[v];
+    if (!isNested)
+    {
+        mSimulationEventHandler.StopDeferringSinkCalls();
+    }
+    mIsUpdatingNpcPhysicsConcurrently = false;
+
+    // Restore the order in which NPCs would have been flagged by the serial update
+    std::sort(mDeferredRemovalNpcs.begin(), mDeferredRemovalNpcs.end());
+}
 
-                            // Water
+void Npcs::UpdateNpcPhysics(
+    StateType & npc,
+    float currentSimulationTime,
+    float effectiveAirTemperature,
+    float effectiveWaterTemperature,
+    vec2f const & globalWindForce,
+    SimulationParameters const & simulationParameters)
+{
+    assert(mShips[npc.CurrentShipId].has_value());
+    auto & homeShip = mShips[npc.CurrentShipId]->HomeShip;
 
-                            float const w = std::min(homeShip.GetPoints().GetWater(pointElementIndex), 1.0f);
-                            totalMeshWaterness += w;
+    // Invariant checks
 
-                            totalMeshWaterVelocity += homeShip.GetPoints().GetWaterVelocity(pointElementIndex) * w;
+    assert((npc.CurrentRegime == StateType::RegimeType::BeingPlaced) == npc.BeingPlacedState.has_value());
+    assert(npc.ParticleMesh.Particles.size() > 0);
 
-                            if (!homeShip.GetPoints().GetIsHull(pointElementIndex))
-                                meshWaterablePointCount += 1.0f;
+    // Low-frequency updates
 
-                            // Temperature
+    unsigned int constexpr LowFrequencyUpdatePeriod = 4;
+    if (mCurrentSimulationSequenceNumber.IsStepOf(npc.Id % LowFrequencyUpdatePeriod, LowFrequencyUpdatePeriod))
+    {
+        //
+        // Waterness, Water Velocity, Temperature
+        //
+        // Temperature:
+        //  - Constrained particles exchange with mesh, Free particles with air/water (and evt. interactions)
+        //
 
-                            totalMeshTemperature += homeShip.GetPoints().GetTemperature(pointElementIndex) * particle.ConstrainedState->CurrentBCoords.BCoords[v];
+        bool isOneNpcParticleInBurningMesh = false; // True if NPC has at least one particle in a burning mesh
+        ElementIndex oneNpcParticleAboveIgnitionTemperature = NoneElementIndex; // If set, that particle is above its ignition temperature
+        ElementIndex oneNpcParticleExplosive = NoneElementIndex; // If set, that particle is explosive
+        bool isOneNpcParticleInWater = false; // True if NPC has at least one particle in water (using magic threshold)
+        ElementIndex oneNpcParticleAboveWaterReactionThreshold = NoneElementIndex; // If set, that (reactive) particle is ready to react
 
-                            // Burning mesh
+        // Visit all particles
+        for (size_t p = 0; p < npc.ParticleMesh.Particles.size(); ++p)
+        {
+            auto const & particle = npc.ParticleMesh.Particles[p];
 
-                            if (homeShip.GetPoints().IsBurning(pointElementIndex))
-                            {
-                                isParticleInBurningMesh = true;
-                            }
-                        }
+            float particleWaterness;
+            float particleTemperature;
+            bool isParticleInBurningMesh = false;
 
-                        //
-                        // Store particle's mesh waterness and mesh water velocity
-                        //
+            if (particle.ConstrainedState.has_value())
+            {
+                // Constrained particle
 
-                        float const meshWaterness = totalMeshWaterness / (std::max(meshWaterablePointCount, 1.0f));
-                        mParticles.SetMeshWaterness(particle.ParticleIndex, meshWaterness);
-                        particleWaterness = meshWaterness; // Use this for water determinations
+                //
+                // Calculate particle's mesh waterness, mesh water velocity, and temperature
+                // from the mesh
+                //
 
-                        vec2f const meshWaterVelocity = totalMeshWaterVelocity / (std::max(meshWaterablePointCount, 1.0f));
-                        mParticles.SetMeshWaterVelocity(particle.ParticleIndex, meshWaterVelocity);
+                auto const t = particle.ConstrainedState->CurrentBCoords.TriangleElementIndex;
 
-                        //
-                        // Calculate particle's mesh temperature
-                        //
+                float totalMeshWaterness = 0.0f;
+                vec2f totalMeshWaterVelocity = vec2f::zero();
+                float meshWaterablePointCount = 0.0f;
+                float totalMeshTemperature = 0.0f;
+                for (int v = 0; v < 3; ++v)
+                {
+                    ElementIndex const pointElementIndex = homeShip.GetTriangles().GetPointIndices(t)[v];
 
-                        // Cheap simulation: transfer (actually, copy) mesh temperature to particle,
-                        // simulating a slow transfer
-                        float const oldTemperature = mParticles.GetTemperature(particle.ParticleIndex);
-                        particleTemperature =
-                            oldTemperature
-                            + (totalMeshTemperature - oldTemperature)
-                            * SimulationParameters::NpcConstrainedTemperatureTransferRate * simulationParameters.HeatDissipationAdjustment;
-                    }
-                    else
-                    {
-                        // Free particle
-
-                        //
-                        // Get particle waterness
-                        // Note: is stale (from previous frame), but that's ok
-                        //
-
-                        particleWaterness = mParticles.GetAnyWaterness(particle.ParticleIndex);
-
-                        //
-                        // Calculate temperature
-                        //
-                        // Cheaply: we assume fixed water temperature, and simulate a transfer with speed
-                        // depending on air/water
-                        //
-
-                        float const ambientTemperature = Mix(
-                            effectiveAirTemperature,
-                            effectiveWaterTemperature,
-                            particleWaterness);
-                        float const oldTemperature = mParticles.GetTemperature(particle.ParticleIndex);
-                        particleTemperature =
-                            oldTemperature
-                            + (ambientTemperature - oldTemperature)
-                            * (SimulationParameters::NpcFreeAirTemperatureTransferRate
-                                + (SimulationParameters::NpcFreeWaterTemperatureTransferRate - SimulationParameters::NpcFreeAirTemperatureTransferRate) * particleWaterness
-                              )
-                            * simulationParameters.HeatDissipationAdjustment;
-                    }
+                    // Water
 
-                    //
-                    // Store temperature
-                    //
+                    float const w = std::min(homeShip.GetPoints().GetWater(pointElementIndex), 1.0f);
+                    totalMeshWaterness += w;
 
-                    mParticles.SetTemperature(particle.ParticleIndex, particleTemperature);
+                    totalMeshWaterVelocity += homeShip.GetPoints().GetWaterVelocity(pointElementIndex) * w;
 
-                    //
-                    // Sample particle properties
-                    //
+                    if (!homeShip.GetPoints().GetIsHull(pointElementIndex))
+                        meshWaterablePointCount += 1.0f;
 
-                    if (isParticleInBurningMesh)
-                    {
-                        isOneNpcParticleInBurningMesh = true;
-                    }
+                    // Temperature
 
-                    if (particleTemperature >= mParticles.GetMaterial(particle.ParticleIndex).IgnitionTemperature * simulationParameters.IgnitionTemperatureAdjustment)
-                    {
-                        oneNpcParticleAboveIgnitionTemperature = particle.ParticleIndex;
-                    }
+                    totalMeshTemperature += homeShip.GetPoints().GetTemperature(pointElementIndex) * particle.ConstrainedState->CurrentBCoords.BCoords[v];
 
-                    if (mParticles.GetMaterial(particle.ParticleIndex).CombustionType == StructuralMaterial::MaterialCombustionType::Explosion
-                        || mParticles.GetMaterial(particle.ParticleIndex).CombustionType == StructuralMaterial::MaterialCombustionType::FireExtinguishingExplosion)
-                    {
-                        oneNpcParticleExplosive = particle.ParticleIndex;
-                    }
+                    // Burning mesh
 
-                    float constexpr WaternessThresholdForInWater = 0.3f;
-                    if (particleWaterness >= WaternessThresholdForInWater)
+                    if (homeShip.GetPoints().IsBurning(pointElementIndex))
                     {
-                        isOneNpcParticleInWater = true;
+                        isParticleInBurningMesh = true;
                     }
+                }
 
-                    if (mParticles.GetMaterial(particle.ParticleIndex).WaterReactivity > 0.0f
-                        && particleWaterness > mParticles.GetMaterial(particle.ParticleIndex).WaterReactivity)
-                    {
-                        oneNpcParticleAboveWaterReactionThreshold = particle.ParticleIndex;
-                    }
+                //
+                // Store particle's mesh waterness and mesh water velocity
+                //
+
+                float const meshWaterness = totalMeshWaterness / (std::max(meshWaterablePointCount, 1.0f));
+                mParticles.SetMeshWaterness(particle.ParticleIndex, meshWaterness);
+                particleWaterness = meshWaterness; // Use this for water determinations
 
-                } // for (all particles)
+                vec2f const meshWaterVelocity = totalMeshWaterVelocity / (std::max(meshWaterablePointCount, 1.0f));
+                mParticles.SetMeshWaterVelocity(particle.ParticleIndex, meshWaterVelocity);
 
                 //
-                // Combustion/Water Reaction
+                // Calculate particle's mesh temperature
                 //
-                // Rules:
-                //  - If an NPC is burning and it has an explosive particle, the NPC explodes
-                //    (regardless of water)
-                //  - If a particle's temperature is above its ignition temperature and it's explosive, the NPC explodes
-                //    (regardless of water)
-                //  - If a particle's waterness is above its water reactivity threshold and it's water-reactable, the NPC reacts
-                //  - If a particle is in a burning mesh and NPC not in water, the NPC catches fire immediately
-                //      - Don't explode it yet, we wait for its temperature to reach ignition temperature
-                //  - If a particle's temperature is above its ignition temperature and NPC not in water, the NPC combustion progress
-                //    goes up; else, the NPC combustion progress goes down
-                //  - If the NPC is in water, the NPC combustion progress goes (quickly) down
+
+                // Cheap simulation: transfer (actually, copy) mesh temperature to particle,
+                // simulating a slow transfer
+                float const oldTemperature = mParticles.GetTemperature(particle.ParticleIndex);
+                particleTemperature =
+                    oldTemperature
+                    + (totalMeshTemperature - oldTemperature)
+                    * SimulationParameters::NpcConstrainedTemperatureTransferRate * simulationParameters.HeatDissipationAdjustment;
+            }
+            else
+            {
+                // Free particle
+
                 //
-                // Notes:
-                //  - If one particle is in water, we consider the whole NPC in water for the purposes of combustion
+                // Get particle waterness
+                // Note: is stale (from previous frame), but that's ok
                 //
 
-                if ((npcState->CombustionState.has_value() && oneNpcParticleExplosive != NoneElementIndex)
-                    || (oneNpcParticleAboveIgnitionTemperature != NoneElementIndex && mParticles.GetMaterial(oneNpcParticleAboveIgnitionTemperature).CombustionType == StructuralMaterial::MaterialCombustionType::Explosion))
-                {
-                    ElementIndex const particleIndex = (npcState->CombustionState.has_value() && oneNpcParticleExplosive != NoneElementIndex)
-                        ? oneNpcParticleExplosive : oneNpcParticleAboveIgnitionTemperature;
+                particleWaterness = mParticles.GetAnyWaterness(particle.ParticleIndex);
 
-                    TriggerParticleExplosionWithMaterialProperties(
-                        *npcState,
-                        particleIndex,
-                        1.0f,
-                        3.0f,
-                        currentSimulationTime,
-                        simulationParameters);
-                }
-                else if (oneNpcParticleAboveWaterReactionThreshold != NoneElementIndex)
-                {
-                    float const blastForce = 3000000.0f; // Magic number
+                //
+                // Calculate temperature
+                //
+                // Cheaply: we assume fixed water temperature, and simulate a transfer with speed
+                // depending on air/water
+                //
 
-                    float const blastRadius =
-                        3.0f // Magic number
-                        * (simulationParameters.IsUltraViolentMode ? 4.0f : 1.0f);
+                float const ambientTemperature = Mix(
+                    effectiveAirTemperature,
+                    effectiveWaterTemperature,
+                    particleWaterness);
+                float const oldTemperature = mParticles.GetTemperature(particle.ParticleIndex);
+                particleTemperature =
+                    oldTemperature
+                    + (ambientTemperature - oldTemperature)
+                    * (SimulationParameters::NpcFreeAirTemperatureTransferRate
+                        + (SimulationParameters::NpcFreeWaterTemperatureTransferRate - SimulationParameters::NpcFreeAirTemperatureTransferRate) * particleWaterness
+                      )
+                    * simulationParameters.HeatDissipationAdjustment;
+            }
 
-                    float const blastHeat =
-                        SimulationParameters::WaterReactionHeat
-                        * (simulationParameters.IsUltraViolentMode ? 10.0f : 1.0f);
+            //
+            // Store temperature
+            //
 
-                    TriggerExplosion(
-                        *npcState,
-                        oneNpcParticleAboveWaterReactionThreshold,
-                        blastForce,
-                        blastRadius,
-                        blastHeat,
-                        blastRadius,
-                        5.0f,
-                        ExplosionType::Sodium,
-                        currentSimulationTime,
-                        simulationParameters);
-                }
-                else
-                {
-                    if (!isOneNpcParticleInWater)
-                    {
-                        //
-                        // NPC is not in water
-                        //
+            mParticles.SetTemperature(particle.ParticleIndex, particleTemperature);
 
-                        if (isOneNpcParticleInBurningMesh)
-                        {
-                            // Catch fire immediately
-                            npcState->CombustionProgress = 1.0f;
-                        }
-                        else
-                        {
-                            if (oneNpcParticleAboveIgnitionTemperature != NoneElementIndex)
-                            {
-                                // Increase combustion progress
-                                npcState->CombustionProgress += (1.0f - npcState->CombustionProgress) * 0.2f;
-                            }
-                            else
-                            {
-                                // Decrease combustion progress (slowly)
-                                npcState->CombustionProgress += (-1.0f - npcState->CombustionProgress) * 0.007f;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        //
-                        // NPC is in water
-                        //
+            //
+            // Sample particle properties
+            //
 
-                        // Smother combustion progress quickly
-                        {
-                            npcState->CombustionProgress += (-1.0f - npcState->CombustionProgress) * 0.1f;
-                        }
-                    }
-                }
+            if (isParticleInBurningMesh)
+            {
+                isOneNpcParticleInBurningMesh = true;
+            }
 
-            } // if (low-freq step)
+            if (particleTemperature >= mParticles.GetMaterial(particle.ParticleIndex).IgnitionTemperature * simulationParameters.IgnitionTemperatureAdjustment)
+            {
+                oneNpcParticleAboveIgnitionTemperature = particle.ParticleIndex;
+            }
 
-            if (!npcState->IsActive())
-                continue;
+            if (mParticles.GetMaterial(particle.ParticleIndex).CombustionType == StructuralMaterial::MaterialCombustionType::Explosion
+                || mParticles.GetMaterial(particle.ParticleIndex).CombustionType == StructuralMaterial::MaterialCombustionType::FireExtinguishingExplosion)
+            {
+                oneNpcParticleExplosive = particle.ParticleIndex;
+            }
 
-            // High-frequency updates
+            float constexpr WaternessThresholdForInWater = 0.3f;
+            if (particleWaterness >= WaternessThresholdForInWater)
+            {
+                isOneNpcParticleInWater = true;
+            }
 
+            if (mParticles.GetMaterial(particle.ParticleIndex).WaterReactivity > 0.0f
+                && particleWaterness > mParticles.GetMaterial(particle.ParticleIndex).WaterReactivity)
             {
-                // Combustion state machine: ignite or smother
+                oneNpcParticleAboveWaterReactionThreshold = particle.ParticleIndex;
+            }
 
-                if (npcState->CombustionProgress > 0.0f)
-                {
-                    // See if we've just ignited
-                    if (!npcState->CombustionState.has_value())
-                    {
-                        // Init state (will be evolved right now)
-                        npcState->CombustionState.emplace(
-                            vec2f(0.0f, 1.0f),
-                            0.0f);
-
-                        // Add to burning set
-                        auto & shipNpcs = *mShips[npcState->CurrentShipId];
-                        assert(std::find(shipNpcs.BurningNpcs.cbegin(), shipNpcs.BurningNpcs.cend(), npcState->Id) == shipNpcs.BurningNpcs.cend());
-                        shipNpcs.BurningNpcs.push_back(npcState->Id);
-
-                        // Emit event
-                        mSimulationEventHandler.OnPointCombustionBegin();
-                    }
+        } // for (all particles)
 
-                    // Update flame progress
-                    ElementIndex reprParticleIndex = npcState->Kind == NpcKindType::Human // Approx
-                        ? npcState->ParticleMesh.Particles[1].ParticleIndex
-                        : npcState->ParticleMesh.Particles[0].ParticleIndex;
-                    Formulae::EvolveFlameGeometry(
-                        npcState->CombustionState->FlameVector,
-                        npcState->CombustionState->FlameWindRotationAngle,
-                        mParticles.GetPosition(reprParticleIndex),
-                        // Exhaggerate; using absolute V (instead of more correct rel) to be in sync w/Ship
-                        mParticles.GetVelocity(reprParticleIndex) * 4.0f,
-                        mParentWorld.GetCurrentWindSpeed(),
-                        mParentWorld.GetCurrentRadialWindField());
-                }
-                else
-                {
-                    // See if we've stopped
-                    if (npcState->CombustionState.has_value())
-                    {
-                        // Reset combustion state
-                        npcState->CombustionState.reset();
+        //
+        // Combustion/Water Reaction
+        //
+        // Rules:
+        //  - If an NPC is burning and it has an explosive particle, the NPC explodes
+        //    (regardless of water)
+        //  - If a particle's temperature is above its ignition temperature and it's explosive, the NPC explodes
+        //    (regardless of water)
+        //  - If a particle's waterness is above its water reactivity threshold and it's water-reactable, the NPC reacts
+        //  - If a particle is in a burning mesh and NPC not in water, the NPC catches fire immediately
+        //      - Don't explode it yet, we wait for its temperature to reach ignition temperature
+        //  - If a particle's temperature is above its ignition temperature and NPC not in water, the NPC combustion progress
+        //    goes up; else, the NPC combustion progress goes down
+        //  - If the NPC is in water, the NPC combustion progress goes (quickly) down
+        //
+        // Notes:
+        //  - If one particle is in water, we consider the whole NPC in water for the purposes of combustion
+        //
 
-                        // Remove from burning set
-                        auto & shipNpcs = *mShips[npcState->CurrentShipId];
-                        auto npcIt = std::find(shipNpcs.BurningNpcs.begin(), shipNpcs.BurningNpcs.end(), npcState->Id);
-                        assert(npcIt != shipNpcs.BurningNpcs.end());
-                        shipNpcs.BurningNpcs.erase(npcIt);
+        if ((npc.CombustionState.has_value() && oneNpcParticleExplosive != NoneElementIndex)
+            || (oneNpcParticleAboveIgnitionTemperature != NoneElementIndex && mParticles.GetMaterial(oneNpcParticleAboveIgnitionTemperature).CombustionType == StructuralMaterial::MaterialCombustionType::Explosion))
+        {
+            ElementIndex const particleIndex = (npc.CombustionState.has_value() && oneNpcParticleExplosive != NoneElementIndex)
+                ? oneNpcParticleExplosive : oneNpcParticleAboveIgnitionTemperature;
 
-                        // Emit event
-                        mSimulationEventHandler.OnPointCombustionEnd();
-                    }
-                }
-            }
+            TriggerParticleExplosionWithMaterialProperties(
+                npc,
+                particleIndex,
+                1.0f,
+                3.0f,
+                currentSimulationTime,
+                simulationParameters);
+        }
+        else if (oneNpcParticleAboveWaterReactionThreshold != NoneElementIndex)
+        {
+            float const blastForce = 3000000.0f; // Magic number
 
-            if (!npcState->IsActive())
-                continue;
+            float const blastRadius =
+                3.0f // Magic number
+                * (simulationParameters.IsUltraViolentMode ? 4.0f : 1.0f);
 
-            // Check validity of constrained triangles, and calculate preliminary forces
+            float const blastHeat =
+                SimulationParameters::WaterReactionHeat
+                * (simulationParameters.IsUltraViolentMode ? 10.0f : 1.0f);
 
-            for (size_t p = 0; p < npcState->ParticleMesh.Particles.size(); ++p)
+            TriggerExplosion(
+                npc,
+                oneNpcParticleAboveWaterReactionThreshold,
+                blastForce,
+                blastRadius,
+                blastHeat,
+                blastRadius,
+                5.0f,
+                ExplosionType::Sodium,
+                currentSimulationTime,
+                simulationParameters);
+        }
+        else
+        {
+            if (!isOneNpcParticleInWater)
             {
-                auto const & particleConstrainedState = npcState->ParticleMesh.Particles[p].ConstrainedState;
-                if (particleConstrainedState.has_value())
-                {
-                    // Constrained any particle: check if its triangle is still valid
+                //
+                // NPC is not in water
+                //
 
-                    // If triangle is not workable anymore, become free
-                    if (homeShip.GetTriangles().IsDeleted(particleConstrainedState->CurrentBCoords.TriangleElementIndex)
-                        || IsTriangleFolded(particleConstrainedState->CurrentBCoords.TriangleElementIndex, homeShip))
-                    {
-                        TransitionParticleToFreeState(*npcState, static_cast<int>(p), homeShip);
-                    }
+                if (isOneNpcParticleInBurningMesh)
+                {
+                    // Catch fire immediately
+                    npc.CombustionProgress = 1.0f;
                 }
-                else if (p > 0)
+                else
                 {
-                    // Secondary free: check if should become constrained
-
-                    if (npcState->ParticleMesh.Particles[0].ConstrainedState.has_value())
+                    if (oneNpcParticleAboveIgnitionTemperature != NoneElementIndex)
                     {
-                        auto newConstrainedState = CalculateParticleConstrainedState(
-                            mParticles.GetPosition(npcState->ParticleMesh.Particles[p].ParticleIndex),
-                            homeShip,
-                            std::nullopt,
-                            npcState->CurrentConnectedComponentId); // Constrain search to NPC's connected component
-
-                        if (newConstrainedState.has_value())
-                        {
-                            // Make this secondary constrained
-                            TransitionParticleToConstrainedState(*npcState, static_cast<int>(p), std::move(*newConstrainedState));
-                        }
+                        // Increase combustion progress
+                        npc.CombustionProgress += (1.0f - npc.CombustionProgress) * 0.2f;
+                    }
+                    else
+                    {
+                        // Decrease combustion progress (slowly)
+                        npc.CombustionProgress += (-1.0f - npc.CombustionProgress) * 0.007f;
                     }
                 }
+            }
+            else
+            {
+                //
+                // NPC is in water
+                //
 
-                // Preliminary forces
-
-                CalculateNpcParticlePreliminaryForces(
-                    *npcState,
-                    static_cast<int>(p),
-                    globalWindForce,
-                    simulationParameters);
+                // Smother combustion progress quickly
+                {
+                    npc.CombustionProgress += (-1.0f - npc.CombustionProgress) * 0.1f;
+                }
             }
+        }
 
-            assert(npcState->IsActive());
+    } // if (low-freq step)
 
-            // Spring forces for whole NPC
+    if (!npc.IsActive())
+        return;
 
-            CalculateNpcParticleSpringForces(*npcState);
+    // High-frequency updates
 
-            // Update physical state for all particles and maintain world bounds
+    {
+        // Combustion state machine: ignite or smother
 
-            assert(npcState->IsActive());
+        if (npc.CombustionProgress > 0.0f)
+        {
+            // See if we've just ignited
+            if (!npc.CombustionState.has_value())
+            {
+                // Init state (will be evolved right now)
+                npc.CombustionState.emplace(
+                    vec2f(0.0f, 1.0f),
+                    0.0f);
 
-            for (size_t p = 0; p < npcState->ParticleMesh.Particles.size(); ++p)
+                // Add to burning set
+                auto & shipNpcs = *mShips[npc.CurrentShipId];
+                assert(std::find(shipNpcs.BurningNpcs.cbegin(), shipNpcs.BurningNpcs.cend(), npc.Id) == shipNpcs.BurningNpcs.cend());
+                shipNpcs.BurningNpcs.push_back(npc.Id);
+
+                // Emit event
+                mSimulationEventHandler.OnPointCombustionBegin();
+            }
+
+            // Update flame progress
+            ElementIndex reprParticleIndex = npc.Kind == NpcKindType::Human // Approx
+                ? npc.ParticleMesh.Particles[1].ParticleIndex
+                : npc.ParticleMesh.Particles[0].ParticleIndex;
+            Formulae::EvolveFlameGeometry(
+                npc.CombustionState->FlameVector,
+                npc.CombustionState->FlameWindRotationAngle,
+                mParticles.GetPosition(reprParticleIndex),
+                // Exhaggerate; using absolute V (instead of more correct rel) to be in sync w/Ship
+                mParticles.GetVelocity(reprParticleIndex) * 4.0f,
+                mParentWorld.GetCurrentWindSpeed(),
+                mParentWorld.GetCurrentRadialWindField());
+        }
+        else
+        {
+            // See if we've stopped
+            if (npc.CombustionState.has_value())
             {
-                assert(npcState->IsActive());
+                // Reset combustion state
+                npc.CombustionState.reset();
 
-                UpdateNpcParticlePhysics(
-                    *npcState,
-                    static_cast<int>(p),
-                    homeShip,
-                    currentSimulationTime,
-                    simulationParameters);
+                // Remove from burning set
+                auto & shipNpcs = *mShips[npc.CurrentShipId];
+                auto npcIt = std::find(shipNpcs.BurningNpcs.begin(), shipNpcs.BurningNpcs.end(), npc.Id);
+                assert(npcIt != shipNpcs.BurningNpcs.end());
+                shipNpcs.BurningNpcs.erase(npcIt);
 
-                if (!npcState->IsActive())
-                    break;
+                // Emit event
+                mSimulationEventHandler.OnPointCombustionEnd();
+            }
+        }
+    }
 
-                MaintainInWorldBounds(
-                    *npcState,
-                    static_cast<int>(p),
-                    homeShip,
-                    simulationParameters);
+    if (!npc.IsActive())
+        return;
 
-                if (npcState->CurrentRegime == StateType::RegimeType::Free)
-                {
-                    // Only maintain over land if _all_ particles are free
-                    MaintainOverLand(
-                        *npcState,
-                        static_cast<int>(p),
-                        homeShip,
-                        currentSimulationTime,
-                        simulationParameters);
-                }
+    // Check validity of constrained triangles, and calculate preliminary forces
+
+    for (size_t p = 0; p < npc.ParticleMesh.Particles.size(); ++p)
+    {
+        auto const & particleConstrainedState = npc.ParticleMesh.Particles[p].ConstrainedState;
+        if (particleConstrainedState.has_value())
+        {
+            // Constrained any particle: check if its triangle is still valid
+
+            // If triangle is not workable anymore, become free
+            if (homeShip.GetTriangles().IsDeleted(particleConstrainedState->CurrentBCoords.TriangleElementIndex)
+                || IsTriangleFolded(particleConstrainedState->CurrentBCoords.TriangleElementIndex, homeShip))
+            {
+                TransitionParticleToFreeState(npc, static_cast<int>(p), homeShip);
             }
+        }
+        else if (p > 0)
+        {
+            // Secondary free: check if should become constrained
 
-            // If being moved: now that all particles have been moved, make sure
-            // the NPC triangles are not folded
-            if (npcState->CurrentRegime == StateType::RegimeType::BeingPlaced
-                && !npcState->BeingPlacedState->DoMoveWholeMesh)
+            if (npc.ParticleMesh.Particles[0].ConstrainedState.has_value())
             {
-                MaintainNpcUnfolded(
-                    *npcState,
+                auto newConstrainedState = CalculateParticleConstrainedState(
+                    mParticles.GetPosition(npc.ParticleMesh.Particles[p].ParticleIndex),
                     homeShip,
-                    simulationParameters);
+                    std::nullopt,
+                    npc.CurrentConnectedComponentId); // Constrain search to NPC's connected component
+
+                if (newConstrainedState.has_value())
+                {
+                    // Make this secondary constrained
+                    TransitionParticleToConstrainedState(npc, static_cast<int>(p), std::move(*newConstrainedState));
+                }
             }
         }
+
+        // Preliminary forces
+
+        CalculateNpcParticlePreliminaryForces(
+            npc,
+            static_cast<int>(p),
+            globalWindForce,
+            simulationParameters);
+    }
+
+    assert(npc.IsActive());
+
+    // Spring forces for whole NPC
+
+    CalculateNpcParticleSpringForces(npc);
+
+    // Update physical state for all particles and maintain world bounds
+
+    assert(npc.IsActive());
+
+    for (size_t p = 0; p < npc.ParticleMesh.Particles.size(); ++p)
+    {
+        assert(npc.IsActive());
+
+        UpdateNpcParticlePhysics(
+            npc,
+            static_cast<int>(p),
+            homeShip,
+            currentSimulationTime,
+            simulationParameters);
+
+        if (!npc.IsActive())
+            break;
+
+        MaintainInWorldBounds(
+            npc,
+            static_cast<int>(p),
+            homeShip,
+            simulationParameters);
+
+        if (npc.CurrentRegime == StateType::RegimeType::Free)
+        {
+            // Only maintain over land if _all_ particles are free
+            MaintainOverLand(
+                npc,
+                static_cast<int>(p),
+                homeShip,
+                currentSimulationTime,
+                simulationParameters);
+        }
+    }
+
+    // If being moved: now that all particles have been moved, make sure
+    // the NPC triangles are not folded
+    if (npc.CurrentRegime == StateType::RegimeType::BeingPlaced
+        && !npc.BeingPlacedState->DoMoveWholeMesh)
+    {
+        MaintainNpcUnfolded(
+            npc,
+            homeShip,
+            simulationParameters);
     }
 }
 
@@ -914,10 +1096,10 @@ void Npcs::UpdateNpcsEnd()
             ship.RemoveNpc(npcId);
 
             //
-            // Free particles
+            // Free particles and springs
             //
 
-            InternalFreeNpcParticles(*mStateBuffer[npcId]);
+            InternalFreeNpcParticleMesh(*mStateBuffer[npcId]);
 
             //
             // Reset NPC
@@ -2017,6 +2199,7 @@ void Npcs::CalculateNpcParticlePreliminaryForces(
                     * std::min(1.0f, 2.0f / static_cast<float>(npc.ParticleMesh.Particles.size())) // Other particles in this mesh will generate waves
                     * 0.6f; // Magic number
 
+                auto const lock = LockForConcurrentSideEffects();
                 mParentWorld.DisplaceOceanSurfaceAt(particlePosition.x, waveDisplacement);
             }
         }
@@ -2094,9 +2277,20 @@ void Npcs::CalculateNpcParticlePreliminaryForces(
 
 void Npcs::CalculateNpcParticleSpringForces(StateType const & npc)
 {
-    for (auto const & spring : npc.ParticleMesh.Springs)
+    // The NPC's springs are contiguous, and so are the particles they connect
+    auto const * restrict const endpointsBuffer = mSprings.GetEndpointsBuffer();
+    float const * restrict const restLengthBuffer = mSprings.GetRestLengthBuffer();
+    float const * restrict const stiffnessFactorBuffer = mSprings.GetStiffnessFactorBuffer();
+    float const * restrict const dampingFactorBuffer = mSprings.GetDampingFactorBuffer();
+
+    ElementIndex const springStart = NpcSprings::GetSpringIndex(npc.Id, 0);
+    ElementIndex const springEnd = springStart + static_cast<ElementIndex>(mSprings.GetSpringCount(npc.Id));
+    for (ElementIndex s = springStart; s < springEnd; ++s)
     {
-        vec2f const springDisplacement = mParticles.GetPosition(spring.EndpointAIndex) - mParticles.GetPosition(spring.EndpointBIndex); // Towards A
+        ElementIndex const endpointAIndex = endpointsBuffer[s].EndpointAIndex;
+        ElementIndex const endpointBIndex = endpointsBuffer[s].EndpointBIndex;
+
+        vec2f const springDisplacement = mParticles.GetPosition(endpointAIndex) - mParticles.GetPosition(endpointBIndex); // Towards A
         float const springDisplacementLength = springDisplacement.length();
         vec2f const springDir = springDisplacement.normalise_approx(springDisplacementLength);
 
@@ -2106,8 +2300,8 @@ void Npcs::CalculateNpcParticleSpringForces(StateType const & npc)
 
         // Calculate spring force on this particle
         float const fSpring =
-            (springDisplacementLength - spring.RestLength)
-            * spring.SpringStiffnessFactor;
+            (springDisplacementLength - restLengthBuffer[s])
+            * stiffnessFactorBuffer[s];
 
         //
         // 3b. Damper forces
@@ -2117,10 +2311,10 @@ void Npcs::CalculateNpcParticleSpringForces(StateType const & npc)
         //
 
         // Calculate damp force on this particle
-        vec2f const relVelocity = mParticles.GetVelocity(spring.EndpointAIndex) - mParticles.GetVelocity(spring.EndpointBIndex);
+        vec2f const relVelocity = mParticles.GetVelocity(endpointAIndex) - mParticles.GetVelocity(endpointBIndex);
         float const fDamp =
             relVelocity.dot(springDir)
-            * spring.SpringDampingFactor;
+            * dampingFactorBuffer[s];
 
         //
         // Apply forces
@@ -2128,8 +2322,8 @@ void Npcs::CalculateNpcParticleSpringForces(StateType const & npc)
 
         vec2f const springForce = springDir * (fSpring + fDamp);
 
-        mParticles.SetPreliminaryForces(spring.EndpointAIndex, mParticles.GetPreliminaryForces(spring.EndpointAIndex) - springForce);
-        mParticles.SetPreliminaryForces(spring.EndpointBIndex, mParticles.GetPreliminaryForces(spring.EndpointBIndex) + springForce);
+        mParticles.SetPreliminaryForces(endpointAIndex, mParticles.GetPreliminaryForces(endpointAIndex) - springForce);
+        mParticles.SetPreliminaryForces(endpointBIndex, mParticles.GetPreliminaryForces(endpointBIndex) + springForce);
     }
 }
 
@@ -2181,8 +2375,8 @@ vec2f Npcs::CalculateNpcParticleDefinitiveForces(
         //  - But we approximate the arc with the chord, i.e.the distance between source and destination
         //
 
-        assert(npc.ParticleMesh.Springs.size() == 1);
-        vec2f const idealHeadPosition = feetPosition + vec2f(0.0f, npc.ParticleMesh.Springs[0].RestLength);
+        assert(mSprings.GetSpringCount(npc.Id) == 1);
+        vec2f const idealHeadPosition = feetPosition + vec2f(0.0f, mSprings.GetRestLength(NpcSprings::GetSpringIndex(npc.Id, 0)));
 
         float const stiffnessCoefficient =
             simulationParameters.HumanNpcEquilibriumTorqueStiffnessCoefficient
@@ -2264,7 +2458,8 @@ void Npcs::RecalculateSizeAndMassParameters()
                 mCurrentSpringReductionFractionAdjustment,
                 mCurrentSpringDampingCoefficientAdjustment,
                 mParticles,
-                state->ParticleMesh);
+                state->Id,
+                mSprings);
         }
     }
 }
@@ -2384,44 +2579,47 @@ void Npcs::CalculateSprings(
     float springReductionFractionAdjustment,
     float springDampingCoefficientAdjustment,
     NpcParticles const & particles,
-    StateType::ParticleMeshType & mesh)
+    NpcId npcId,
+    NpcSprings & springs)
 {
     float constexpr dt = SimulationParameters::SimulationStepTimeDuration<float>;
 
-    for (auto & spring : mesh.Springs)
+    for (size_t springOrdinal = 0; springOrdinal < springs.GetSpringCount(npcId); ++springOrdinal)
     {
+        ElementIndex const s = NpcSprings::GetSpringIndex(npcId, springOrdinal);
+
         // Spring rest length
 
-        spring.RestLength = CalculateSpringLength(spring.BaseRestLength, sizeMultiplier);
+        springs.SetRestLength(s, CalculateSpringLength(springs.GetBaseRestLength(s), sizeMultiplier));
 
         // Spring force factors
 
-        float const baseMass1 = particles.GetMaterial(spring.EndpointAIndex).GetMass();
-        float const baseMass2 = particles.GetMaterial(spring.EndpointBIndex).GetMass();
+        float const baseMass1 = particles.GetMaterial(springs.GetEndpointAIndex(s)).GetMass();
+        float const baseMass2 = particles.GetMaterial(springs.GetEndpointBIndex(s)).GetMass();
 
         float const baseMassFactor =
             (baseMass1 * baseMass2)
             / (baseMass1 + baseMass2);
 
-        spring.SpringStiffnessFactor =
-            spring.BaseSpringReductionFraction
+        springs.SetStiffnessFactor(s,
+            springs.GetBaseSpringReductionFraction(s)
             * springReductionFractionAdjustment
             * baseMassFactor
 #ifdef IN_BARYLAB
             * massAdjustment
 #endif
             * (sizeMultiplier * sizeMultiplier) // 2D
-            / (dt * dt);
+            / (dt * dt));
 
-        spring.SpringDampingFactor =
-            spring.BaseSpringDampingCoefficient
+        springs.SetDampingFactor(s,
+            springs.GetBaseSpringDampingCoefficient(s)
             * springDampingCoefficientAdjustment
             * baseMassFactor
 #ifdef IN_BARYLAB
             * massAdjustment
 #endif
             * (sizeMultiplier * sizeMultiplier) // 2D
-            / dt;
+            / dt);
     }
 }
 
@@ -2474,7 +2672,7 @@ void Npcs::UpdateNpcParticle_BeingPlaced(
         // Strive to maintain spring lengths (fight stretching)
         //
 
-        if (npc.ParticleMesh.Springs.size() > 0)
+        if (mSprings.GetSpringCount(npc.Id) > 0)
         {
             assert(npcParticleOrdinal != npc.BeingPlacedState->AnchorParticleOrdinal);
 
@@ -2491,9 +2689,9 @@ void Npcs::UpdateNpcParticle_BeingPlaced(
                 {
                     // Adjust physicsDeltaPos to maintain spring length after we've traveled it
 
-                    int const s = GetSpringAmongEndpoints(npcParticleOrdinal, static_cast<int>(p), npc.ParticleMesh);
+                    ElementIndex const s = GetSpringAmongEndpoints(npcParticleOrdinal, static_cast<int>(p), npc);
 
-                    float const targetSpringLength = npc.ParticleMesh.Springs[s].RestLength;
+                    float const targetSpringLength = mSprings.GetRestLength(s);
                     vec2f const & otherPPosition = mParticles.GetPosition(npc.ParticleMesh.Particles[p].ParticleIndex);
                     vec2f const particleAdjustedPosition =
                         otherPPosition
@@ -4143,6 +4341,7 @@ void Npcs::TriggerExplosion(
     // Start deferred deletion
     //
 
+    auto const lock = LockForConcurrentSideEffects(); // Deferred removals and NPC stats are global
     InternalBeginDeferredDeletion(npc.Id, currentSimulationTime);
 }
 
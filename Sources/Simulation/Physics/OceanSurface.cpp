@@ -27,7 +27,8 @@ static std::chrono::seconds constexpr RogueWaveGracePeriod(5);
 
 OceanSurface::OceanSurface(
     World & parentWorld,
-    SimulationEventDispatcher & simulationEventDispatcher)
+    SimulationEventDispatcher & simulationEventDispatcher,
+    SimulationParameters const & simulationParameters)
     : mParentWorld(parentWorld)
     , mSimulationEventHandler(simulationEventDispatcher)
     ////////
@@ -48,14 +49,18 @@ OceanSurface::OceanSurface(
     , mTsunamiRate(std::chrono::minutes::max())
     , mRogueWaveRate(std::chrono::seconds::max())
     ////////
-    , mSamples(SamplesCount + 1)
-    , mSWEHeightField(SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples)
-    , mSWEVelocityField(SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples + 1)
-    , mInteractiveWaveTargetHeight(SamplesCount)
-    , mInteractiveWaveCurrentHeightGrowthCoefficient(SamplesCount)
-    , mInteractiveWaveTargetHeightGrowthCoefficient(SamplesCount)
-    , mInteractiveWaveHeightGrowthCoefficientGrowthRate(SamplesCount)
-    , mDeltaHeightBuffer(DeltaHeightBufferSize)
+    , mSamplesCount(simulationParameters.OceanSurfaceSamplesCount)
+    , mDx(SimulationParameters::MaxWorldWidth / static_cast<float>(mSamplesCount - 1))
+    , mSamples(mSamplesCount + 1)
+    , mSamplesGenerationParameters()
+    , mSWEHeightField(SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + mSamplesCount + SWEBoundaryConditionsSamples)
+    , mSWEVelocityField(SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + mSamplesCount + SWEBoundaryConditionsSamples + 1)
+    , mSWENextVelocityField(SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + mSamplesCount + SWEBoundaryConditionsSamples + 1)
+    , mInteractiveWaveTargetHeight(mSamplesCount)
+    , mInteractiveWaveCurrentHeightGrowthCoefficient(mSamplesCount)
+    , mInteractiveWaveTargetHeightGrowthCoefficient(mSamplesCount)
+    , mInteractiveWaveHeightGrowthCoefficientGrowthRate(mSamplesCount)
+    , mDeltaHeightBuffer(DeltaHeightBufferPrefixSize + mSamplesCount + (DeltaHeightSmoothing / 2))
     ////////
     , mSWETsunamiWaveStateMachine()
     , mSWERogueWaveWaveStateMachine()
@@ -66,6 +71,7 @@ OceanSurface::OceanSurface(
     mSamples.fill({ 0.0f, 0.0f });
     mSWEHeightField.fill(SWEHeightFieldOffset);
     mSWEVelocityField.fill(0.0f);
+    mSWENextVelocityField.fill(0.0f);
     mInteractiveWaveTargetHeight.fill(SWEHeightFieldOffset);
     mInteractiveWaveCurrentHeightGrowthCoefficient.fill(0.0f);
     mInteractiveWaveTargetHeightGrowthCoefficient.fill(0.0f);
@@ -73,14 +79,15 @@ OceanSurface::OceanSurface(
     mDeltaHeightBuffer.fill(0.0f);
 
     // Initialize constant sample values
-    mSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue = 0.0f; // Extra sample is always == last sample
-    mSamples[SamplesCount].SampleValuePlusOneMinusSampleValue = 0.0f; // Won't really be used
+    mSamples[mSamplesCount - 1].SampleValuePlusOneMinusSampleValue = 0.0f; // Extra sample is always == last sample
+    mSamples[mSamplesCount].SampleValuePlusOneMinusSampleValue = 0.0f; // Won't really be used
 }
 
 void OceanSurface::Update(
     float currentSimulationTime,
     Wind const & wind,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     auto const now = GameWallClock::GetInstance().Now();
 
@@ -88,6 +95,11 @@ void OceanSurface::Update(
     // Check whether parameters have changed
     //
 
+    if (mSamplesCount != simulationParameters.OceanSurfaceSamplesCount)
+    {
+        SetSamplesCount(simulationParameters.OceanSurfaceSamplesCount);
+    }
+
     if (mWindBaseAndStormSpeedMagnitude != wind.GetBaseAndStormSpeedMagnitude()
         || mBasalWaveHeightAdjustment != simulationParameters.BasalWaveHeightAdjustment
         || mBasalWaveLengthAdjustment != simulationParameters.BasalWaveLengthAdjustment
@@ -219,38 +231,59 @@ void OceanSurface::Update(
     }
 
     //
-    // 2. Interactive Waves Update
-    //
-
-    UpdateInteractiveWaves();
-
+    // 3. Update SWE fields and generate samples
     //
-    // 3. SWE Update
+    // The body of the buffers is split among threads, in two passes: the first one
+    // updates the height field, and the second one - which requires the updated heights
+    // of neighboring samples - updates the velocity field and generates samples.
+    // The boundary samples are updated on this thread.
     //
 
-    SmoothDeltaBufferIntoHeightField();
-
     ApplyDampingBoundaryConditions();
 
-    UpdateFields(simulationParameters);
-
-    // Note: field advection does not seem to improve the simulation in any visible way
-    // AdvectFields();
+    UpdateBoundaryHeightField();
 
-    //
-    // 4. Generate Samples
-    //
-
-    GenerateSamples(
+    PrepareSamplesGeneration(
         currentSimulationTime,
         wind,
         simulationParameters);
 
-    //
-    // 5. Reset Interactive Waves
-    //
+    auto & threadPool = threadManager.GetSimulationThreadPool();
+
+    threadPool.ParallelFor(
+        0,
+        mSamplesCount,
+        MinSamplesPerThread,
+        [this](size_t startSampleIndex, size_t endSampleIndex)
+        {
+            UpdateInteractiveWaves(startSampleIndex, endSampleIndex);
+            ResetInteractiveWaves(startSampleIndex, endSampleIndex);
+            SmoothDeltaBufferIntoHeightField(startSampleIndex, endSampleIndex);
+            UpdateHeightField(startSampleIndex, endSampleIndex);
+        });
+
+    threadPool.ParallelFor(
+        0,
+        mSamplesCount,
+        MinSamplesPerThread,
+        [this, &simulationParameters](size_t startSampleIndex, size_t endSampleIndex)
+        {
+            UpdateVelocityField(startSampleIndex, endSampleIndex, simulationParameters);
+            ClearDeltaBuffer(startSampleIndex, endSampleIndex);
+            GenerateSamples(startSampleIndex, endSampleIndex);
+        });
 
-    ResetInteractiveWaves();
+    UpdateBoundaryVelocityField(simulationParameters);
+
+    mSWEVelocityField.swap(mSWENextVelocityField);
+
+    // Note: field advection does not seem to improve the simulation in any visible way
+    // AdvectFields();
+
+    // Populate extra sample - same value as last sample
+    assert(mSamples[mSamplesCount - 1].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
+    mSamples[mSamplesCount].SampleValue = mSamples[mSamplesCount - 1].SampleValue;
+    assert(mSamples[mSamplesCount].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
 }
 
 void OceanSurface::Upload(RenderContext & renderContext) const
@@ -310,7 +343,7 @@ void OceanSurface::ApplyThanosSnap(
 
     mSWEHeightField[sweIndexLeft] -= WaterDepression;
 
-    if (sweIndexLeft < SWEBufferPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples - 1)
+    if (sweIndexLeft < SWEBufferPrefixSize + SWEBoundaryConditionsSamples + mSamplesCount + SWEBoundaryConditionsSamples - 1)
         mSWEHeightField[sweIndexLeft + 1] -= WaterDepression * 0.5f;
 
 
@@ -319,7 +352,7 @@ void OceanSurface::ApplyThanosSnap(
 
     mSWEHeightField[sweIndexRight] -= WaterDepression;
 
-    if (sweIndexRight < SWEBufferPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples - 1)
+    if (sweIndexRight < SWEBufferPrefixSize + SWEBoundaryConditionsSamples + mSamplesCount + SWEBoundaryConditionsSamples - 1)
         mSWEHeightField[sweIndexRight + 1] -= WaterDepression * 0.5f;
 }
 
@@ -389,13 +422,13 @@ void OceanSurface::InternalUpload(RenderContext & renderContext) const
     //
 
     // Find index of leftmost sample, and its corresponding world X
-    auto const leftmostSampleIndex = FastTruncateToArchInt((renderContext.GetVisibleWorld().TopLeft.x + SimulationParameters::HalfMaxWorldWidth) / Dx);
-    float sampleIndexWorldX = -SimulationParameters::HalfMaxWorldWidth + (Dx * leftmostSampleIndex);
+    auto const leftmostSampleIndex = FastTruncateToArchInt((renderContext.GetVisibleWorld().TopLeft.x + SimulationParameters::HalfMaxWorldWidth) / mDx);
+    float sampleIndexWorldX = -SimulationParameters::HalfMaxWorldWidth + (mDx * leftmostSampleIndex);
 
     // Calculate number of samples required to cover screen from leftmost sample
     // up to the visible world right (included)
     float const coverageWorldWidth = renderContext.GetVisibleWorld().BottomRight.x - sampleIndexWorldX;
-    auto const numberOfSamplesToRender = static_cast<size_t>(ceil(coverageWorldWidth / Dx));
+    auto const numberOfSamplesToRender = static_cast<size_t>(ceil(coverageWorldWidth / mDx));
 
     if (numberOfSamplesToRender >= RenderSlices<size_t>)
     {
@@ -437,7 +470,7 @@ void OceanSurface::InternalUpload(RenderContext & renderContext) const
                     && sampleIndexWorldX <= SimulationParameters::HalfMaxWorldWidth + 1.0f); // Allow for compounding inaccuracies
 
                 // Fractional index in the sample array
-                float const sampleIndexF = (sampleIndexWorldX + SimulationParameters::HalfMaxWorldWidth) / Dx;
+                float const sampleIndexF = (sampleIndexWorldX + SimulationParameters::HalfMaxWorldWidth) / mDx;
 
                 // Integral part
                 auto const sampleIndexI = FastTruncateToArchInt(sampleIndexF);
@@ -445,7 +478,7 @@ void OceanSurface::InternalUpload(RenderContext & renderContext) const
                 // Fractional part within sample index and the next sample index
                 float const sampleIndexDx = sampleIndexF - sampleIndexI;
 
-                assert(sampleIndexI >= 0 && sampleIndexI <= static_cast<decltype(sampleIndexI)>(SamplesCount)); // Allow for compounding inaccuracies
+                assert(sampleIndexI >= 0 && sampleIndexI <= static_cast<decltype(sampleIndexI)>(mSamplesCount)); // Allow for compounding inaccuracies
                 assert(sampleIndexDx >= 0.0f && sampleIndexDx < 1.0f);
 
                 //
@@ -541,7 +574,7 @@ void OceanSurface::InternalUpload(RenderContext & renderContext) const
 
         // We do one extra iteration as the number of slices is the number of quads, and the last vertical
         // quad side must be at the end of the width
-        for (size_t s = 0; s <= numberOfSamplesToRender; ++s, sampleIndexWorldX += Dx)
+        for (size_t s = 0; s <= numberOfSamplesToRender; ++s, sampleIndexWorldX += mDx)
         {
             if constexpr (DetailType == OceanRenderDetailType::Basic)
             {
@@ -567,6 +600,59 @@ void OceanSurface::InternalUpload(RenderContext & renderContext) const
         renderContext.UploadOceanDetailedEnd();
 }
 
+void OceanSurface::SetSamplesCount(size_t samplesCount)
+{
+    assert(samplesCount >= 2 * SWEBoundaryConditionsSamples);
+    assert(is_aligned_to_float_element_count(samplesCount));
+
+    size_t const oldSamplesCount = mSamplesCount;
+
+    mSamplesCount = samplesCount;
+    mDx = SimulationParameters::MaxWorldWidth / static_cast<float>(mSamplesCount - 1);
+
+    //
+    // Resample the SWE fields, so that waves survive the change of resolution
+    //
+
+    size_t const sweBufferSize = SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + mSamplesCount + SWEBoundaryConditionsSamples;
+
+    Buffer<float> newSWEHeightField(sweBufferSize, 0, SWEHeightFieldOffset);
+    Buffer<float> newSWEVelocityField(sweBufferSize + 1, 0, 0.0f);
+
+    float const oldSampleIndexStep = static_cast<float>(oldSamplesCount - 1) / static_cast<float>(mSamplesCount - 1);
+    for (size_t i = 0; i < mSamplesCount; ++i)
+    {
+        float const oldSampleIndexF = static_cast<float>(i) * oldSampleIndexStep;
+        size_t const oldSampleIndexI = std::min(static_cast<size_t>(oldSampleIndexF), oldSamplesCount - 2);
+        float const oldSampleIndexDx = oldSampleIndexF - static_cast<float>(oldSampleIndexI);
+
+        newSWEHeightField[SWEBufferPrefixSize + i] = Mix(
+            mSWEHeightField[SWEBufferPrefixSize + oldSampleIndexI],
+            mSWEHeightField[SWEBufferPrefixSize + oldSampleIndexI + 1],
+            oldSampleIndexDx);
+
+        newSWEVelocityField[SWEBufferPrefixSize + i] = Mix(
+            mSWEVelocityField[SWEBufferPrefixSize + oldSampleIndexI],
+            mSWEVelocityField[SWEBufferPrefixSize + oldSampleIndexI + 1],
+            oldSampleIndexDx);
+    }
+
+    mSWEHeightField.swap(newSWEHeightField);
+    mSWEVelocityField.swap(newSWEVelocityField);
+    Buffer<float>(sweBufferSize + 1, 0, 0.0f).swap(mSWENextVelocityField);
+
+    //
+    // Start afresh with all other buffers
+    //
+
+    Buffer<Sample>(mSamplesCount + 1, 0, { 0.0f, 0.0f }).swap(mSamples);
+    Buffer<float>(mSamplesCount, 0, SWEHeightFieldOffset).swap(mInteractiveWaveTargetHeight);
+    Buffer<float>(mSamplesCount, 0, 0.0f).swap(mInteractiveWaveCurrentHeightGrowthCoefficient);
+    Buffer<float>(mSamplesCount, 0, 0.0f).swap(mInteractiveWaveTargetHeightGrowthCoefficient);
+    Buffer<float>(mSamplesCount, 0, 0.0f).swap(mInteractiveWaveHeightGrowthCoefficientGrowthRate);
+    Buffer<float>(DeltaHeightBufferPrefixSize + mSamplesCount + (DeltaHeightSmoothing / 2), 0, 0.0f).swap(mDeltaHeightBuffer);
+}
+
 void OceanSurface::RecalculateWaveCoefficients(
     Wind const & wind,
     SimulationParameters const & simulationParameters)
@@ -725,6 +811,7 @@ void OceanSurface::ImpartInteractiveWave(
     // The general formula is:
     //      calcd_radius = MaxRadius * height_fraction + alpha / (height_fraction + beta)
     // Imposing that this curve has a slope of zero at zero, we get that alpha = H^2 / MaxRadius and beta = H / MaxRadius
+    // The radius is in samples at ReferenceDx, hence we scale it to the current resolution to keep waves as wide.
     float constexpr MaxRadius = 22.0f;
     float constexpr H = 3.0f;
     float constexpr alpha = H * H / MaxRadius;
@@ -732,7 +819,8 @@ void OceanSurface::ImpartInteractiveWave(
     float const heightFraction = std::abs(targetRelativeHeight) / MaxInteractiveWaveAbsRelativeHeight;
     float const actionRadius = std::max(
         MaxRadius * heightFraction + alpha / (heightFraction + beta),
-        worldRadius); // Take into account also the interactive radius
+        worldRadius) // Take into account also the interactive radius
+        * ReferenceDx / mDx;
 
     // Set at center and around
     for (register_int d = 0; d <= static_cast<register_int>(std::floor(actionRadius)); ++d)
@@ -747,7 +835,7 @@ void OceanSurface::ImpartInteractiveWave(
             mInteractiveWaveHeightGrowthCoefficientGrowthRate[centerIndex - d] = growthRate;
         }
 
-        if (centerIndex + d < static_cast<register_int>(SamplesCount) && d != 0)
+        if (centerIndex + d < static_cast<register_int>(mSamplesCount) && d != 0)
         {
             mInteractiveWaveTargetHeight[centerIndex + d] = targetAbsoluteHeight;
             mInteractiveWaveTargetHeightGrowthCoefficient[centerIndex + d] = coeff;
@@ -756,32 +844,48 @@ void OceanSurface::ImpartInteractiveWave(
     }
 }
 
-void OceanSurface::UpdateInteractiveWaves()
+void OceanSurface::UpdateInteractiveWaves(
+    size_t startSampleIndex,
+    size_t endSampleIndex)
 {
     float * const restrict currentHeightGrowthCoefficientBuffer = mInteractiveWaveCurrentHeightGrowthCoefficient.data();
+    float const * const restrict targetHeightGrowthCoefficientBuffer = mInteractiveWaveTargetHeightGrowthCoefficient.data();
+    float const * const restrict heightGrowthCoefficientGrowthRateBuffer = mInteractiveWaveHeightGrowthCoefficientGrowthRate.data();
+    float const * const restrict targetHeightBuffer = mInteractiveWaveTargetHeight.data();
     float * const restrict sweHeightFieldBuffer = mSWEHeightField.data() + SWEBufferPrefixSize;
 
-    for (size_t i = 0; i < SamplesCount; ++i)
+    for (size_t i = startSampleIndex; i < endSampleIndex; ++i)
     {
         // Update growth coefficient
         currentHeightGrowthCoefficientBuffer[i] +=
-            (mInteractiveWaveTargetHeightGrowthCoefficient[i] - currentHeightGrowthCoefficientBuffer[i])
-            * mInteractiveWaveHeightGrowthCoefficientGrowthRate[i];
+            (targetHeightGrowthCoefficientBuffer[i] - currentHeightGrowthCoefficientBuffer[i])
+            * heightGrowthCoefficientGrowthRateBuffer[i];
 
         // Smooth current height to target according to current growth coefficient
         sweHeightFieldBuffer[i] +=
-            (mInteractiveWaveTargetHeight[i] - sweHeightFieldBuffer[i])
+            (targetHeightBuffer[i] - sweHeightFieldBuffer[i])
             * currentHeightGrowthCoefficientBuffer[i];
     }
 }
 
-void OceanSurface::ResetInteractiveWaves()
+void OceanSurface::ResetInteractiveWaves(
+    size_t startSampleIndex,
+    size_t endSampleIndex)
 {
-    mInteractiveWaveTargetHeightGrowthCoefficient.fill<SamplesCount>(0.0f);
-    mInteractiveWaveHeightGrowthCoefficientGrowthRate.fill<SamplesCount>(0.1f); // Magic number: rate with which we stop pinning the SWE height field
+    std::fill(
+        mInteractiveWaveTargetHeightGrowthCoefficient.data() + startSampleIndex,
+        mInteractiveWaveTargetHeightGrowthCoefficient.data() + endSampleIndex,
+        0.0f);
+
+    std::fill(
+        mInteractiveWaveHeightGrowthCoefficientGrowthRate.data() + startSampleIndex,
+        mInteractiveWaveHeightGrowthCoefficientGrowthRate.data() + endSampleIndex,
+        0.1f); // Magic number: rate with which we stop pinning the SWE height field
 }
 
-void OceanSurface::SmoothDeltaBufferIntoHeightField()
+void OceanSurface::SmoothDeltaBufferIntoHeightField(
+    size_t startSampleIndex,
+    size_t endSampleIndex)
 {
     //
     // Incorporate delta-height into height field, after smoothing
@@ -790,12 +894,21 @@ void OceanSurface::SmoothDeltaBufferIntoHeightField()
     // centered on the sample
     //
 
-    Algorithms::SmoothBufferAndAdd<SamplesCount, DeltaHeightSmoothing>(
-        mDeltaHeightBuffer.data() + DeltaHeightBufferPrefixSize,
-        mSWEHeightField.data() + SWEBufferPrefixSize);
+    Algorithms::SmoothBufferAndAdd<DeltaHeightSmoothing>(
+        mDeltaHeightBuffer.data() + DeltaHeightBufferPrefixSize + startSampleIndex,
+        mSWEHeightField.data() + SWEBufferPrefixSize + startSampleIndex,
+        endSampleIndex - startSampleIndex);
+}
 
-    // Clear delta-height buffer
-    mDeltaHeightBuffer.fill<DeltaHeightBufferSize>(0.0f);
+void OceanSurface::ClearDeltaBuffer(
+    size_t startSampleIndex,
+    size_t endSampleIndex)
+{
+    // Note: the zeroes around the body are never written to
+    std::fill(
+        mDeltaHeightBuffer.data() + DeltaHeightBufferPrefixSize + startSampleIndex,
+        mDeltaHeightBuffer.data() + DeltaHeightBufferPrefixSize + endSampleIndex,
+        0.0f);
 }
 
 void OceanSurface::ApplyDampingBoundaryConditions()
@@ -814,54 +927,119 @@ void OceanSurface::ApplyDampingBoundaryConditions()
 
         // Right side
 
-        mSWEHeightField[SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples - 1 - i] =
-            (mSWEHeightField[SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples - 1 - i] - SWEHeightFieldOffset) * damping
+        mSWEHeightField[SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + mSamplesCount + SWEBoundaryConditionsSamples - 1 - i] =
+            (mSWEHeightField[SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + mSamplesCount + SWEBoundaryConditionsSamples - 1 - i] - SWEHeightFieldOffset) * damping
             + SWEHeightFieldOffset;
 
         // For symmetry we actually damp the v-sample that is *after* this h-sample
-        mSWEVelocityField[SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples - 1 - i + 1] *= damping;
+        mSWEVelocityField[SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + mSamplesCount + SWEBoundaryConditionsSamples - 1 - i + 1] *= damping;
     }
 }
 
-void OceanSurface::UpdateFields(SimulationParameters const & simulationParameters)
+//
+// SWE Update
+//
+// "q‐Upwind Numerical Scheme" from "Improving the stability of a simple formulation of the shallow water equations for 2‐D flood modeling",
+//      de Almeida, Bates, Freer, Souvignet (2012), https://agupubs.onlinelibrary.wiley.com/doi/full/10.1029/2011WR011570
+//
+// Height field  : from 0 to SWETotalSamples
+// Velocity field: from 1 to SWETotalSamples (i.e. at boundaries it's inner only)
+//                 H[i] has V[i] at its left and V[i+1] at its right
+//
+// All heights are updated first, from the current velocities; velocities are then
+// updated from the new heights and from the current velocities, into the next
+// velocity field.
+//
+
+void OceanSurface::UpdateHeightField(
+    size_t startSampleIndex,
+    size_t endSampleIndex)
 {
-    //
-    // SWE Update
-    //
-    // "q‐Upwind Numerical Scheme" from "Improving the stability of a simple formulation of the shallow water equations for 2‐D flood modeling",
-    //      de Almeida, Bates, Freer, Souvignet (2012), https://agupubs.onlinelibrary.wiley.com/doi/full/10.1029/2011WR011570
-    //
-    // Height field  : from 0 to SWETotalSamples
-    // Velocity field: from 1 to SWETotalSamples (i.e. at boundaries it's inner only)
-    //                 H[i] has V[i] at its left and V[i+1] at its right
-    //
+    float constexpr Dt = SimulationParameters::SimulationStepTimeDuration<float>;
 
+    Algorithms::UpdateSWEHeightField(
+        mSWEHeightField.data() + SWEBufferPrefixSize + startSampleIndex,
+        mSWEVelocityField.data() + SWEBufferPrefixSize + startSampleIndex,
+        endSampleIndex - startSampleIndex,
+        Dt / mDx);
+}
+
+void OceanSurface::UpdateBoundaryHeightField()
+{
+    float constexpr Dt = SimulationParameters::SimulationStepTimeDuration<float>;
+
+    float * const heightField = mSWEHeightField.data() + SWEBufferAlignmentPrefixSize;
+    float const * const velocityField = mSWEVelocityField.data() + SWEBufferAlignmentPrefixSize;
+
+    // Left
+    Algorithms::UpdateSWEHeightField_Naive(
+        heightField,
+        velocityField,
+        SWEBoundaryConditionsSamples,
+        Dt / mDx);
+
+    // Right
+    Algorithms::UpdateSWEHeightField_Naive(
+        heightField + SWEBoundaryConditionsSamples + mSamplesCount,
+        velocityField + SWEBoundaryConditionsSamples + mSamplesCount,
+        SWEBoundaryConditionsSamples,
+        Dt / mDx);
+}
+
+void OceanSurface::UpdateVelocityField(
+    size_t startSampleIndex,
+    size_t endSampleIndex,
+    SimulationParameters const & simulationParameters)
+{
     float constexpr G = SimulationParameters::GravityMagnitude;
     float constexpr Dt = SimulationParameters::SimulationStepTimeDuration<float>;
     float const previousVWeight1 = 1.0f - simulationParameters.WaveSmoothnessAdjustment;
     float const previousVWeight2 = simulationParameters.WaveSmoothnessAdjustment / 2.0f; // Includes /2 for average
 
-    float * const restrict heightField = mSWEHeightField.data() + SWEBufferAlignmentPrefixSize;
-    float * const restrict velocityField = mSWEVelocityField.data() + SWEBufferAlignmentPrefixSize;
-
-    // Update first height field value
-    heightField[0] *=
-        1.0f + Dt / Dx * (velocityField[0] - velocityField[0 + 1]);
-
-    for (size_t i = 1; i < SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples; ++i)
-    {
-        // Update height field
-        heightField[i] *=
-            1.0f + Dt / Dx * (velocityField[i] - velocityField[i + 1]);
+    Algorithms::UpdateSWEVelocityField(
+        mSWEHeightField.data() + SWEBufferPrefixSize + startSampleIndex,
+        mSWEVelocityField.data() + SWEBufferPrefixSize + startSampleIndex,
+        mSWENextVelocityField.data() + SWEBufferPrefixSize + startSampleIndex,
+        endSampleIndex - startSampleIndex,
+        previousVWeight1,
+        previousVWeight2,
+        G * Dt / mDx);
+}
 
-        // V @ t-1: mix of V[i] and of avg(V[i-1], V[i+1])
-        float const previousV =
-            previousVWeight1 * velocityField[i]
-            + previousVWeight2 * (velocityField[i - 1] + velocityField[i + 1]);
+void OceanSurface::UpdateBoundaryVelocityField(SimulationParameters const & simulationParameters)
+{
+    float constexpr G = SimulationParameters::GravityMagnitude;
+    float constexpr Dt = SimulationParameters::SimulationStepTimeDuration<float>;
+    float const previousVWeight1 = 1.0f - simulationParameters.WaveSmoothnessAdjustment;
+    float const previousVWeight2 = simulationParameters.WaveSmoothnessAdjustment / 2.0f; // Includes /2 for average
 
-        // Update velocity field
-        velocityField[i] = previousV - G * Dt / Dx * (heightField[i] - heightField[i - 1]);
-    }
+    float const * const heightField = mSWEHeightField.data() + SWEBufferAlignmentPrefixSize;
+    float const * const velocityField = mSWEVelocityField.data() + SWEBufferAlignmentPrefixSize;
+    float * const nextVelocityField = mSWENextVelocityField.data() + SWEBufferAlignmentPrefixSize;
+
+    size_t const sweTotalSamples = SWEBoundaryConditionsSamples + mSamplesCount + SWEBoundaryConditionsSamples;
+
+    // Left - the first velocity is not updated
+    nextVelocityField[0] = velocityField[0];
+    Algorithms::UpdateSWEVelocityField_Naive(
+        heightField + 1,
+        velocityField + 1,
+        nextVelocityField + 1,
+        SWEBoundaryConditionsSamples - 1,
+        previousVWeight1,
+        previousVWeight2,
+        G * Dt / mDx);
+
+    // Right - the last velocity is not updated
+    Algorithms::UpdateSWEVelocityField_Naive(
+        heightField + SWEBoundaryConditionsSamples + mSamplesCount,
+        velocityField + SWEBoundaryConditionsSamples + mSamplesCount,
+        nextVelocityField + SWEBoundaryConditionsSamples + mSamplesCount,
+        SWEBoundaryConditionsSamples,
+        previousVWeight1,
+        previousVWeight2,
+        G * Dt / mDx);
+    nextVelocityField[sweTotalSamples] = velocityField[sweTotalSamples];
 }
 
 void OceanSurface::AdvectFields()
@@ -877,10 +1055,10 @@ void OceanSurface::AdvectFields()
 
     // Height field
 
-    Buffer<float> newHeightField(SamplesCount, 0.0f);
+    Buffer<float> newHeightField(mSamplesCount, 0.0f);
 
     // For each index, move into it the height value that comes into it according to the current velocity
-    for (size_t i = 0; i < SamplesCount; ++i)
+    for (size_t i = 0; i < mSamplesCount; ++i)
     {
         // Calculate the (current) velocity of this sample;
         // the height field values are at the center of the cell,
@@ -889,8 +1067,8 @@ void OceanSurface::AdvectFields()
         float const v = (mSWEVelocityField[SWEBufferPrefixSize + i] + mSWEVelocityField[SWEBufferPrefixSize + i + 1]) / 2.0f;
 
         // Calculate the (fractional) index that this height sample had one time step ago
-        float const prevCellIndex = static_cast<float>(i) - v * Dt / Dx;
-        if (prevCellIndex >= 0 && prevCellIndex < SamplesCount - 1)
+        float const prevCellIndex = static_cast<float>(i) - v * Dt / mDx;
+        if (prevCellIndex >= 0 && prevCellIndex < mSamplesCount - 1)
         {
             // Calculate integral and fractional parts of the index
             auto const prevCellIndexI = FastTruncateToArchInt(prevCellIndex);
@@ -907,23 +1085,23 @@ void OceanSurface::AdvectFields()
     std::memcpy(
         &(mSWEHeightField[SWEBufferPrefixSize]),
         &(newHeightField[0]),
-        SamplesCount);
+        mSamplesCount);
 
     // Velocity field
 
-    Buffer<float> newVelocityField(SamplesCount + 1, 0.0f);
+    Buffer<float> newVelocityField(mSamplesCount + 1, 0.0f);
 
     // For each index, move into it the velocity value that comes into it according to the current velocity
     // Note: the last velocity sample is the one after the last height field sample
-    for (size_t i = 0; i <= SamplesCount; ++i)
+    for (size_t i = 0; i <= mSamplesCount; ++i)
     {
         // Calculate the (current) velocity of this sample;
         // velocity values are at the edges of the cell
         float const v = mSWEVelocityField[i];
 
         // Calculate the (fractional) index that this velocity sample had one time step ago
-        float const prevCellIndex = static_cast<float>(i) - v * Dt / Dx;
-        if (prevCellIndex >= 0 && prevCellIndex < SamplesCount)
+        float const prevCellIndex = static_cast<float>(i) - v * Dt / mDx;
+        if (prevCellIndex >= 0 && prevCellIndex < mSamplesCount)
         {
             // Calculate integral and fractional parts of the index
             auto const prevCellIndexI = FastTruncateToArchInt(prevCellIndex);
@@ -940,10 +1118,10 @@ void OceanSurface::AdvectFields()
     std::memcpy(
         &(mSWEVelocityField[SWEBufferPrefixSize]),
         &(newVelocityField[0]),
-        SamplesCount + 1);
+        mSamplesCount + 1);
 }
 
-void OceanSurface::GenerateSamples(
+void OceanSurface::PrepareSamplesGeneration(
     float currentSimulationTime,
     Wind const & wind,
     SimulationParameters const & /*simulationParameters*/)
@@ -979,84 +1157,73 @@ void OceanSurface::GenerateSamples(
     float const smoothedWindNormalizedIncisiveness = mWindIncisivenessRunningAverage.Update(rawWindNormalizedIncisiveness);
     float const windRipplesWaveHeight = WindRippleWaveHeight * smoothedWindNormalizedIncisiveness;
 
-
     //
-    // Generate samples
+    // Calculate generation parameters
     //
 
     float const x = -SimulationParameters::HalfMaxWorldWidth;
 
-    float const basalWave2AmplitudeCoeff =
+    mSamplesGenerationParameters.BasalWave2AmplitudeCoeff =
         (mBasalWaveAmplitude1 != 0.0f)
         ? mBasalWaveAmplitude2 / mBasalWaveAmplitude1
         : 0.0f;
 
-    float const rippleWaveAmplitudeCoeff =
+    mSamplesGenerationParameters.RippleWaveAmplitudeCoeff =
         (mBasalWaveAmplitude1 != 0.0f)
         ? windRipplesWaveHeight / mBasalWaveAmplitude1
         : 0.0f;
 
-    float sinArg1 = (mBasalWaveNumber1 * x - mBasalWaveAngularVelocity1 * currentSimulationTime) / (2 * Pi<float>);
-    float sinArg2 = (mBasalWaveNumber2 * x - mBasalWaveAngularVelocity2 * currentSimulationTime + secondaryBasalComponentPhase) / (2 * Pi<float>);
-    float sinArgRipple = (WindRippleWaveNumber * x - windRipplesAngularVelocity * currentSimulationTime) / (2 * Pi<float>);
+    mSamplesGenerationParameters.SinArg1 = (mBasalWaveNumber1 * x - mBasalWaveAngularVelocity1 * currentSimulationTime) / (2 * Pi<float>);
+    mSamplesGenerationParameters.SinArg2 = (mBasalWaveNumber2 * x - mBasalWaveAngularVelocity2 * currentSimulationTime + secondaryBasalComponentPhase) / (2 * Pi<float>);
+    mSamplesGenerationParameters.SinArgRipple = (WindRippleWaveNumber * x - windRipplesAngularVelocity * currentSimulationTime) / (2 * Pi<float>);
 
-    // sample index = 0
-    float previousSampleValue;
-    {
-        float const sweValue =
-            (mSWEHeightField[SWEBufferPrefixSize + 0] - SWEHeightFieldOffset)
-            * SWEHeightFieldAmplification;
+    mSamplesGenerationParameters.SinArg1Dx = mBasalWaveNumber1 * mDx / (2 * Pi<float>);
+    mSamplesGenerationParameters.SinArg2Dx = mBasalWaveNumber2 * mDx / (2 * Pi<float>);
+    mSamplesGenerationParameters.SinArgRippleDx = WindRippleWaveNumber * mDx / (2 * Pi<float>);
+}
 
-        float const basalValue1 =
-            mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArg1);
+inline float OceanSurface::CalculateSampleValue(size_t sampleIndex) const noexcept
+{
+    auto const & parameters = mSamplesGenerationParameters;
 
-        float const basalValue2 =
-            basalWave2AmplitudeCoeff
-            * mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArg2);
+    float const sweValue =
+        (mSWEHeightField[SWEBufferPrefixSize + sampleIndex] - SWEHeightFieldOffset)
+        * SWEHeightFieldAmplification;
 
-        float const rippleValue =
-            rippleWaveAmplitudeCoeff
-            * mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArgRipple);
+    // Arguments are calculated from the sample index - rather than accumulated - so
+    // that any sample may be calculated independently of the others
+    float const sampleIndexF = static_cast<float>(sampleIndex);
 
-        previousSampleValue =
-            sweValue
-            + basalValue1
-            + basalValue2
-            + rippleValue;
+    float const basalValue1 =
+        mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(parameters.SinArg1 + parameters.SinArg1Dx * sampleIndexF);
 
-        mSamples[0].SampleValue = previousSampleValue;
-    }
+    float const basalValue2 =
+        parameters.BasalWave2AmplitudeCoeff
+        * mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(parameters.SinArg2 + parameters.SinArg2Dx * sampleIndexF);
 
-    float const sinArg1Dx = mBasalWaveNumber1 * Dx / (2 * Pi<float>);
-    float const sinArg2Dx = mBasalWaveNumber2 * Dx / (2 * Pi<float>);
-    float const sinArgRippleDx = WindRippleWaveNumber * Dx / (2 * Pi<float>);
+    float const rippleValue =
+        parameters.RippleWaveAmplitudeCoeff
+        * mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(parameters.SinArgRipple + parameters.SinArgRippleDx * sampleIndexF);
 
-    // sample index = 1...SamplesCount - 1
-    for (size_t i = 1; i < SamplesCount; ++i)
+    return
+        sweValue
+        + basalValue1
+        + basalValue2
+        + rippleValue;
+}
+
+void OceanSurface::GenerateSamples(
+    size_t startSampleIndex,
+    size_t endSampleIndex)
+{
+    assert(startSampleIndex < endSampleIndex);
+
+    float previousSampleValue = CalculateSampleValue(startSampleIndex);
+    mSamples[startSampleIndex].SampleValue = previousSampleValue;
+
+    for (size_t i = startSampleIndex + 1; i < endSampleIndex; ++i)
     {
-        float const sweValue =
-            (mSWEHeightField[SWEBufferPrefixSize + i] - SWEHeightFieldOffset)
-            * SWEHeightFieldAmplification;
-
-        sinArg1 += sinArg1Dx;
-        float const basalValue1 =
-            mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArg1);
-
-        sinArg2 += sinArg2Dx;
-        float const basalValue2 =
-            basalWave2AmplitudeCoeff
-            * mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArg2);
-
-        sinArgRipple += sinArgRippleDx;
-        float const rippleValue =
-            rippleWaveAmplitudeCoeff
-            * mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArgRipple);
-
-        float const sampleValue =
-            sweValue
-            + basalValue1
-            + basalValue2
-            + rippleValue;
+        float const sampleValue = CalculateSampleValue(i);
 
         mSamples[i].SampleValue = sampleValue;
         mSamples[i - 1].SampleValuePlusOneMinusSampleValue = sampleValue - previousSampleValue;
@@ -1064,13 +1231,12 @@ void OceanSurface::GenerateSamples(
         previousSampleValue = sampleValue;
     }
 
-    assert(mSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
-
-    // Populate extra sample - same value as last sample
-    assert(previousSampleValue == mSamples[SamplesCount - 1].SampleValue);
-    mSamples[SamplesCount].SampleValue = previousSampleValue;
-
-    assert(mSamples[SamplesCount].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
+    // The delta of the last sample of the range requires the first sample of the next range,
+    // which we calculate again rather than waiting for it; the very last sample has no delta
+    if (endSampleIndex < mSamplesCount)
+    {
+        mSamples[endSampleIndex - 1].SampleValuePlusOneMinusSampleValue = CalculateSampleValue(endSampleIndex) - previousSampleValue;
+    }
 }
 
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include <Core/RunningAverage.h>
 #include <Core/StrongTypeDef.h>
 #include <Core/SysSpecifics.h>
+#include <Core/ThreadManager.h>
 
 #include <memory>
 #include <optional>
@@ -27,12 +28,14 @@ public:
 
     OceanSurface(
         World & parentWorld,
-        SimulationEventDispatcher & simulationEventDispatcher);
+        SimulationEventDispatcher & simulationEventDispatcher,
+        SimulationParameters const & simulationParameters);
 
     void Update(
         float currentSimulationTime,
         Wind const & wind,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     void Upload(RenderContext & renderContext) const;
 
@@ -44,6 +47,14 @@ public:
         float sampleIndexDx;
     };
 
+    /*
+     * Coordinates proxies are only valid for as long as the samples count doesn't change.
+     */
+    size_t GetSamplesCount() const noexcept
+    {
+        return mSamplesCount;
+    }
+
     /*
      * Assumption: x is in world boundaries.
      */
@@ -56,7 +67,7 @@ public:
         //
 
         // Fractional index in the sample array
-        float const sampleIndexF = (x + SimulationParameters::HalfMaxWorldWidth) / Dx;
+        float const sampleIndexF = (x + SimulationParameters::HalfMaxWorldWidth) / mDx;
 
         // Integral part
         register_int const sampleIndexI = FastTruncateToArchInt(sampleIndexF);
@@ -64,7 +75,7 @@ public:
         // Fractional part within sample index and the next sample index
         float const sampleIndexDx = sampleIndexF - sampleIndexI;
 
-        assert(sampleIndexI >= 0 && sampleIndexI < SamplesCount);
+        assert(sampleIndexI >= 0 && sampleIndexI < static_cast<register_int>(mSamplesCount));
         assert(sampleIndexDx >= 0.0f && sampleIndexDx < 1.0f);
 
         return mSamples[sampleIndexI].SampleValue
@@ -76,7 +87,7 @@ public:
      */
     float GetHeightAt(CoordinatesProxy const & coords) const noexcept
     {
-        assert(coords.sampleIndexI >= 0 && coords.sampleIndexI < SamplesCount);
+        assert(coords.sampleIndexI >= 0 && coords.sampleIndexI < static_cast<register_int>(mSamplesCount));
         assert(coords.sampleIndexDx >= 0.0f && coords.sampleIndexDx < 1.0f);
 
         return mSamples[coords.sampleIndexI].SampleValue
@@ -111,16 +122,16 @@ public:
         //
 
         // Fractional index in the sample array
-        float const sampleIndexF = (x + SimulationParameters::HalfMaxWorldWidth) / Dx;
+        float const sampleIndexF = (x + SimulationParameters::HalfMaxWorldWidth) / mDx;
 
         // Integral part
         register_int const sampleIndexI = FastTruncateToArchInt(sampleIndexF);
 
-        assert(sampleIndexI >= 0 && sampleIndexI < SamplesCount);
+        assert(sampleIndexI >= 0 && sampleIndexI < static_cast<register_int>(mSamplesCount));
 
         return vec2f(
             -mSamples[sampleIndexI].SampleValuePlusOneMinusSampleValue,
-            Dx).normalise();
+            mDx).normalise();
     }
 
     /*
@@ -135,7 +146,7 @@ public:
         //
 
         // Fractional index in the sample array
-        float const sampleIndexF = (x + SimulationParameters::HalfMaxWorldWidth) / Dx;
+        float const sampleIndexF = (x + SimulationParameters::HalfMaxWorldWidth) / mDx;
 
         // Integral part
         register_int const sampleIndexI = FastTruncateToArchInt(sampleIndexF);
@@ -143,7 +154,7 @@ public:
         // Fractional part within sample index and the next sample index
         float const sampleIndexDx = sampleIndexF - sampleIndexI;
 
-        assert(sampleIndexI >= 0 && sampleIndexI < SamplesCount);
+        assert(sampleIndexI >= 0 && sampleIndexI < static_cast<register_int>(mSamplesCount));
         assert(sampleIndexDx >= 0.0f && sampleIndexDx < 1.0f);
 
         return CoordinatesProxy{ sampleIndexI, sampleIndexDx };
@@ -160,12 +171,12 @@ public:
         assert(x >= -SimulationParameters::HalfMaxWorldWidth && x <= SimulationParameters::HalfMaxWorldWidth);
 
         // Fractional index in the sample array - smack in the center
-        float const sampleIndexF = (x + SimulationParameters::HalfMaxWorldWidth + Dx / 2.0f) / Dx;
+        float const sampleIndexF = (x + SimulationParameters::HalfMaxWorldWidth + mDx / 2.0f) / mDx;
 
         // Integral part
         register_int const sampleIndexI = FastTruncateToArchInt(sampleIndexF);
 
-        assert(sampleIndexI >= 0 && sampleIndexI < SamplesCount);
+        assert(sampleIndexI >= 0 && sampleIndexI < static_cast<register_int>(mSamplesCount));
 
         // Store - the one with the largest absolute magnitude wins
         float const yDisplacement = yOffset / SWEHeightFieldAmplification;
@@ -190,16 +201,18 @@ private:
     template<OceanRenderDetailType DetailType>
     void InternalUpload(RenderContext & renderContext) const;
 
-    static inline auto ToSampleIndex(float x) noexcept
+    inline auto ToSampleIndex(float x) const noexcept
     {
         // Calculate sample index, minimizing error
-        float const sampleIndexF = (x + SimulationParameters::HalfMaxWorldWidth) / Dx;
+        float const sampleIndexF = (x + SimulationParameters::HalfMaxWorldWidth) / mDx;
         register_int const sampleIndexI = FastTruncateToArchInt(sampleIndexF + 0.5f);
-        assert(sampleIndexI >= 0 && sampleIndexI < SamplesCount);
+        assert(sampleIndexI >= 0 && sampleIndexI < static_cast<register_int>(mSamplesCount));
 
         return sampleIndexI;
     }
 
+    void SetSamplesCount(size_t samplesCount);
+
     void RecalculateWaveCoefficients(
         Wind const & wind,
         SimulationParameters const & simulationParameters);
@@ -218,23 +231,50 @@ private:
         float growthRate,
         float worldRadius);
 
-    void UpdateInteractiveWaves();
+    void UpdateInteractiveWaves(
+        size_t startSampleIndex,
+        size_t endSampleIndex);
+
+    void ResetInteractiveWaves(
+        size_t startSampleIndex,
+        size_t endSampleIndex);
 
-    void ResetInteractiveWaves();
+    void SmoothDeltaBufferIntoHeightField(
+        size_t startSampleIndex,
+        size_t endSampleIndex);
 
-    void SmoothDeltaBufferIntoHeightField();
+    void ClearDeltaBuffer(
+        size_t startSampleIndex,
+        size_t endSampleIndex);
 
     void ApplyDampingBoundaryConditions();
 
-    void UpdateFields(SimulationParameters const & simulationParameters);
+    void UpdateHeightField(
+        size_t startSampleIndex,
+        size_t endSampleIndex);
+
+    void UpdateBoundaryHeightField();
+
+    void UpdateVelocityField(
+        size_t startSampleIndex,
+        size_t endSampleIndex,
+        SimulationParameters const & simulationParameters);
+
+    void UpdateBoundaryVelocityField(SimulationParameters const & simulationParameters);
 
     void AdvectFields();
 
-    void GenerateSamples(
+    void PrepareSamplesGeneration(
         float currentSimulationTime,
         Wind const & wind,
         SimulationParameters const & simulationParameters);
 
+    inline float CalculateSampleValue(size_t sampleIndex) const noexcept;
+
+    void GenerateSamples(
+        size_t startSampleIndex,
+        size_t endSampleIndex);
+
 private:
 
     World & mParentWorld;
@@ -282,6 +322,11 @@ private:
     // World offset = SWE offset * SWEHeightFieldAmplification
     static float constexpr SWEHeightFieldAmplification = 50.0f;
 
+    // The minimum number of samples updated by each thread; keeps the
+    // chunks of all buffers aligned
+    static size_t constexpr MinSamplesPerThread = 2048;
+    static_assert(is_aligned_to_float_element_count(MinSamplesPerThread));
+
     //
     // Samples buffer
     //
@@ -290,12 +335,16 @@ private:
     //      - Buffer "body" (size == SamplesCount + 1, one extra sample to allow for numeric imprecisions falling over boundary)
     //
 
-    // The number of samples for the entire world width;
+    // The number of samples for the entire world width, as a power of two;
     // a higher value means more resolution at the expense of Update() and cache misses
-    static size_t constexpr SamplesCount = 16384;
+    size_t mSamplesCount;
 
     // The x step of the samples
-    static float constexpr Dx = SimulationParameters::MaxWorldWidth / static_cast<float>(SamplesCount - 1);
+    float mDx;
+
+    // The sample x step which the SWE constants - and the size of interactive
+    // waves, in samples - have been tuned for
+    static float constexpr ReferenceDx = SimulationParameters::MaxWorldWidth / static_cast<float>(SimulationParameters::MaxOceanSurfaceSamplesCount - 1);
 
     // What we store for each sample
     struct Sample
@@ -307,6 +356,21 @@ private:
     // The samples
     Buffer<Sample> mSamples;
 
+    // The per-step constants of samples generation, shared among threads
+    struct SamplesGenerationParameters
+    {
+        float SinArg1;
+        float SinArg2;
+        float SinArgRipple;
+        float SinArg1Dx;
+        float SinArg2Dx;
+        float SinArgRippleDx;
+        float BasalWave2AmplitudeCoeff;
+        float RippleWaveAmplitudeCoeff;
+    };
+
+    SamplesGenerationParameters mSamplesGenerationParameters;
+
     //
     // SWE Buffers
     //
@@ -338,6 +402,10 @@ private:
     //      - H[i] has V[i] at its left and V[i+1] at its right
     Buffer<float> mSWEVelocityField;
 
+    // The velocity field being calculated, swapped with the current
+    // velocity field at the end of each update
+    Buffer<float> mSWENextVelocityField;
+
     //
     // Interactive waves
     //
@@ -382,8 +450,6 @@ private:
     static size_t constexpr DeltaHeightBufferPrefixSize = DeltaHeightBufferAlignmentPrefixSize + (DeltaHeightSmoothing / 2);
     static_assert(is_aligned_to_float_element_count(DeltaHeightBufferPrefixSize));
 
-    static size_t constexpr DeltaHeightBufferSize = DeltaHeightBufferAlignmentPrefixSize + (DeltaHeightSmoothing / 2) + SamplesCount + (DeltaHeightSmoothing / 2);
-
     Buffer<float> mDeltaHeightBuffer;
 
 private:
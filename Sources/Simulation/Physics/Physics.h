@@ -14,6 +14,7 @@ namespace Physics
     class Gadgets;
     class Npcs;
     class NpcParticles;
+    class NpcSprings;
     class OceanFloor;
     class OceanSurface;
     class PinnedPoints;
@@ -43,6 +44,7 @@ namespace Physics
 #include "ElectricalElements.h"
 #include "Frontiers.h"
 #include "Npcs/NpcParticles.h"
+#include "Npcs/NpcSprings.h"
 //
 #include "Clouds.h"
 #include "Fishes.h"
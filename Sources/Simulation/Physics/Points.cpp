@@ -73,6 +73,7 @@ void Points::Add(
     mMaterialWaterDiffusionSpeedBuffer.emplace_back(structuralMaterial.WaterDiffusionSpeed);
 
     mWaterBuffer.emplace_back(water);
+    mWaterBackBuffer.emplace_back(water);
     mWaterVelocityBuffer.emplace_back(vec2f::zero());
     mWaterMomentumBuffer.emplace_back(vec2f::zero());
     mCumulatedIntakenWater.emplace_back(0.0f);
@@ -84,6 +85,7 @@ void Points::Add(
 
     // Heat dynamics
     mTemperatureBuffer.emplace_back(SimulationParameters::Temperature0);
+    mTemperatureBackBuffer.emplace_back(SimulationParameters::Temperature0);
     assert(structuralMaterial.GetHeatCapacity() > 0.0f);
     mMaterialHeatCapacityReciprocalBuffer.emplace_back(1.0f / structuralMaterial.GetHeatCapacity());
     mMaterialThermalExpansionCoefficientBuffer.emplace_back(structuralMaterial.ThermalExpansionCoefficient);
@@ -215,8 +217,7 @@ void Points::CreateEphemeralParticleAirBubble(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::AirBubble;
-    mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
+    ActivateEphemeralParticle(pointIndex, EphemeralType::AirBubble, currentSimulationTime);
     mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = std::numeric_limits<float>::max();
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::AirBubbleState(
         finalScale,
@@ -295,8 +296,7 @@ void Points::CreateEphemeralParticleDebris(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Debris;
-    mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
+    ActivateEphemeralParticle(pointIndex, EphemeralType::Debris, currentSimulationTime);
     mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::DebrisState();
 
@@ -395,8 +395,7 @@ void Points::CreateEphemeralParticleSmoke(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Smoke;
-    mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
+    ActivateEphemeralParticle(pointIndex, EphemeralType::Smoke, currentSimulationTime);
     mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::SmokeState(
         textureGroup,
@@ -474,8 +473,7 @@ void Points::CreateEphemeralParticleSparkle(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Sparkle;
-    mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
+    ActivateEphemeralParticle(pointIndex, EphemeralType::Sparkle, currentSimulationTime);
     mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::SparkleState();
 
@@ -560,8 +558,7 @@ void Points::CreateEphemeralParticleWakeBubble(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::WakeBubble;
-    mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
+    ActivateEphemeralParticle(pointIndex, EphemeralType::WakeBubble, currentSimulationTime);
     mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = 0.4f; // Magic number
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::WakeBubbleState();
 
@@ -1483,209 +1480,212 @@ void Points::UpdateEphemeralParticles(
         (simulationParameters.DoDisplaceWater ? 1.0f : 0.0f)
         * 1.0f;
 
-    // Visit all ephemeral particles
-    for (ElementIndex pointIndex : this->EphemeralPoints())
+    //
+    // Visit the active ephemeral particles of each type; we visit them backwards, so that
+    // the swap-removal of expiring particles only moves particles that we have visited already
+    //
+
+    // Air bubbles
     {
-        auto const ephemeralType = GetEphemeralType(pointIndex);
-        if (EphemeralType::None != ephemeralType)
+        auto const & airBubbles = GetActiveEphemeralParticles(EphemeralType::AirBubble);
+        for (size_t i = airBubbles.size(); i-- > 0; )
         {
-            //
-            // Run this particle's state machine
-            //
+            ElementIndex const pointIndex = airBubbles[i];
 
-            switch (ephemeralType)
+            // Do not advance air bubble if it's pinned
+            if (!IsPinned(pointIndex))
             {
-                case EphemeralType::AirBubble:
+                float const depth = GetCachedDepth(pointIndex);
+                if (depth <= 0.0f)
                 {
-                    // Do not advance air bubble if it's pinned
-                    if (!IsPinned(pointIndex))
-                    {
-                        float const depth = GetCachedDepth(pointIndex);
-                        if (depth <= 0.0f)
-                        {
-                            // Got to the surface, expire
-                            ExpireEphemeralParticle(pointIndex);
-                        }
-                        else
-                        {
-                            //
-                            // Update state
-                            //
-
-                            auto & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
-
-                            // DeltaY
-
-                            state.CurrentDeltaY = depth;
-
-                            // Simulation lifetime
-
-                            auto const simulationLifetime =
-                                currentSimulationTime
-                                - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-
-                            state.SimulationLifetime = simulationLifetime;
-
-                            //
-                            // Update vortex
-                            //
-
-                            float const vortexValue =
-                                state.VortexAmplitude
-                                * PrecalcLoFreqSin.GetNearestPeriodic(
-                                    state.NormalizedVortexAngularVelocity * simulationLifetime);
-
-                            // Apply vortex to bubble
-                            AddStaticForce(
-                                pointIndex,
-                                vec2f(
-                                    vortexValue,
-                                    0.0f));
-
-                            //
-                            // Displace ocean surface, if surfacing
-                            //
-
-                            if (depth < oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset)
-                            {
-                                mParentWorld.DisplaceOceanSurfaceAt(
-                                    GetPosition(pointIndex).x,
-                                    // Magnitude is lower with depth and higher with scale
-                                    (oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset - depth) * state.FinalScale * 3.75f); // Magic number
-
-                                mSimulationEventHandler.OnAirBubbleSurfaced(1);
-                            }
-                        }
-                    }
-
-                    break;
+                    // Got to the surface, expire
+                    ExpireEphemeralParticle(pointIndex);
                 }
-
-                case EphemeralType::Debris:
+                else
                 {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime)
-                    {
-                        ExpireEphemeralParticle(pointIndex);
+                    //
+                    // Update state
+                    //
 
-                        // Remember that ephemeral point elements are now dirty
-                        mAreEphemeralPointElementsDirtyForRendering = true;
-                    }
-                    else
-                    {
-                        // Update alpha based off remaining time
+                    auto & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
 
-                        float alpha = std::max(
-                            1.0f - elapsedSimulationLifetime / maxSimulationLifetime,
-                            0.0f);
+                    // DeltaY
 
-                        mColorBuffer[pointIndex].w = alpha;
-                        mIsEphemeralColorBufferDirty = true;
-                    }
+                    state.CurrentDeltaY = depth;
 
-                    break;
-                }
+                    // Simulation lifetime
 
-                case EphemeralType::Smoke:
-                {
-                    // Calculate progress
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    assert(mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime > 0.0f);
-                    float const lifetimeProgress =
-                        elapsedSimulationLifetime
-                        / mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-
-                    // Check if expired
-                    if (lifetimeProgress >= 1.0f
-                        || IsCachedUnderwater(pointIndex))
-                    {
-                        //
-                        /// Expired
-                        //
+                    auto const simulationLifetime =
+                        currentSimulationTime
+                        - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
 
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
-                    {
-                        //
-                        // Still alive
-                        //
-
-                        // Update progress
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.LifetimeProgress = lifetimeProgress;
-                        if (EphemeralState::SmokeState::GrowthType::Slow == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth)
-                        {
-                            mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
-                                std::min(1.0f, elapsedSimulationLifetime / 5.0f);
-                        }
-                        else
-                        {
-                            assert(EphemeralState::SmokeState::GrowthType::Fast == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth);
-                            mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
-                                1.07f * (1.0f - exp(-3.0f * lifetimeProgress));
-                        }
-
-                        // Inject random walk in direction orthogonal to current velocity
-                        float const randomWalkMagnitude =
-                            0.3f * (static_cast<float>(GameRandomEngine::GetInstance().Choose<int>(2)) - 0.5f);
-                        vec2f const deviationDirection =
-                            GetVelocity(pointIndex).normalise().to_perpendicular();
-                        AddStaticForce(
-                            pointIndex,
-                            deviationDirection * randomWalkMagnitude * randomWalkVelocityImpulseToForceCoefficient);
-                    }
+                    state.SimulationLifetime = simulationLifetime;
 
-                    break;
-                }
+                    //
+                    // Update vortex
+                    //
 
-                case EphemeralType::Sparkle:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime
-                        || IsCachedUnderwater(pointIndex))
-                    {
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
-                    {
-                        // Update progress based off remaining time
-                        assert(maxSimulationLifetime > 0.0f);
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress =
-                            elapsedSimulationLifetime / maxSimulationLifetime;
-                    }
+                    float const vortexValue =
+                        state.VortexAmplitude
+                        * PrecalcLoFreqSin.GetNearestPeriodic(
+                            state.NormalizedVortexAngularVelocity * simulationLifetime);
 
-                    break;
-                }
+                    // Apply vortex to bubble
+                    AddStaticForce(
+                        pointIndex,
+                        vec2f(
+                            vortexValue,
+                            0.0f));
 
-                case EphemeralType::WakeBubble:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime
-                        || !IsCachedUnderwater(pointIndex))
-                    {
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
+                    //
+                    // Displace ocean surface, if surfacing
+                    //
+
+                    if (depth < oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset)
                     {
-                        // Update progress based off remaining time
-                        assert(maxSimulationLifetime > 0.0f);
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble.Progress =
-                            elapsedSimulationLifetime / maxSimulationLifetime;
-                    }
+                        mParentWorld.DisplaceOceanSurfaceAt(
+                            GetPosition(pointIndex).x,
+                            // Magnitude is lower with depth and higher with scale
+                            (oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset - depth) * state.FinalScale * 3.75f); // Magic number
 
-                    break;
+                        mSimulationEventHandler.OnAirBubbleSurfaced(1);
+                    }
                 }
+            }
+        }
+    }
 
-                default:
+    // Debris
+    {
+        auto const & debris = GetActiveEphemeralParticles(EphemeralType::Debris);
+        for (size_t i = debris.size(); i-- > 0; )
+        {
+            ElementIndex const pointIndex = debris[i];
+
+            // Check if expired
+            auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+            auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+            if (elapsedSimulationLifetime >= maxSimulationLifetime)
+            {
+                // Also makes ephemeral point elements dirty
+                ExpireEphemeralParticle(pointIndex);
+            }
+            else
+            {
+                // Update alpha based off remaining time
+
+                float alpha = std::max(
+                    1.0f - elapsedSimulationLifetime / maxSimulationLifetime,
+                    0.0f);
+
+                mColorBuffer[pointIndex].w = alpha;
+                mIsEphemeralColorBufferDirty = true;
+            }
+        }
+    }
+
+    // Smoke
+    {
+        auto const & smoke = GetActiveEphemeralParticles(EphemeralType::Smoke);
+        for (size_t i = smoke.size(); i-- > 0; )
+        {
+            ElementIndex const pointIndex = smoke[i];
+
+            // Calculate progress
+            auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+            assert(mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime > 0.0f);
+            float const lifetimeProgress =
+                elapsedSimulationLifetime
+                / mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+
+            // Check if expired
+            if (lifetimeProgress >= 1.0f
+                || IsCachedUnderwater(pointIndex))
+            {
+                //
+                /// Expired
+                //
+
+                ExpireEphemeralParticle(pointIndex);
+            }
+            else
+            {
+                //
+                // Still alive
+                //
+
+                // Update progress
+                mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.LifetimeProgress = lifetimeProgress;
+                if (EphemeralState::SmokeState::GrowthType::Slow == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth)
                 {
-                    // Do nothing
+                    mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
+                        std::min(1.0f, elapsedSimulationLifetime / 5.0f);
                 }
+                else
+                {
+                    assert(EphemeralState::SmokeState::GrowthType::Fast == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth);
+                    mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
+                        1.07f * (1.0f - exp(-3.0f * lifetimeProgress));
+                }
+
+                // Inject random walk in direction orthogonal to current velocity
+                float const randomWalkMagnitude =
+                    0.3f * (static_cast<float>(GameRandomEngine::GetInstance().Choose<int>(2)) - 0.5f);
+                vec2f const deviationDirection =
+                    GetVelocity(pointIndex).normalise().to_perpendicular();
+                AddStaticForce(
+                    pointIndex,
+                    deviationDirection * randomWalkMagnitude * randomWalkVelocityImpulseToForceCoefficient);
+            }
+        }
+    }
+
+    // Sparkles
+    {
+        auto const & sparkles = GetActiveEphemeralParticles(EphemeralType::Sparkle);
+        for (size_t i = sparkles.size(); i-- > 0; )
+        {
+            ElementIndex const pointIndex = sparkles[i];
+
+            // Check if expired
+            auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+            auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+            if (elapsedSimulationLifetime >= maxSimulationLifetime
+                || IsCachedUnderwater(pointIndex))
+            {
+                ExpireEphemeralParticle(pointIndex);
+            }
+            else
+            {
+                // Update progress based off remaining time
+                assert(maxSimulationLifetime > 0.0f);
+                mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress =
+                    elapsedSimulationLifetime / maxSimulationLifetime;
+            }
+        }
+    }
+
+    // Wake bubbles
+    {
+        auto const & wakeBubbles = GetActiveEphemeralParticles(EphemeralType::WakeBubble);
+        for (size_t i = wakeBubbles.size(); i-- > 0; )
+        {
+            ElementIndex const pointIndex = wakeBubbles[i];
+
+            // Check if expired
+            auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+            auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+            if (elapsedSimulationLifetime >= maxSimulationLifetime
+                || !IsCachedUnderwater(pointIndex))
+            {
+                ExpireEphemeralParticle(pointIndex);
+            }
+            else
+            {
+                // Update progress based off remaining time
+                assert(maxSimulationLifetime > 0.0f);
+                mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble.Progress =
+                    elapsedSimulationLifetime / maxSimulationLifetime;
             }
         }
     }
@@ -2040,9 +2040,9 @@ void Points::UploadVectors(
             lengthAdjustment);
     }
 
-    for (auto const p : this->EphemeralPoints())
+    for (auto const & activeEphemeralParticles : mActiveEphemeralParticles)
     {
-        if (GetEphemeralType(p) != EphemeralType::None)
+        for (auto const p : activeEphemeralParticles)
         {
             shipRenderContext.UploadVector(
                 GetPosition(p),
@@ -2070,99 +2070,80 @@ void Points::UploadEphemeralParticles(
         shipRenderContext.UploadElementEphemeralPointsStart();
     }
 
-    for (ElementIndex pointIndex : this->EphemeralPoints())
+    // Air bubbles
+    for (ElementIndex const pointIndex : GetActiveEphemeralParticles(EphemeralType::AirBubble))
     {
-        switch (GetEphemeralType(pointIndex))
-        {
-            case EphemeralType::AirBubble:
-            {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
-
-                // Calculate scale based on lifetime
-                float const scaleMax = state.FinalScale;
-                float const scaleMin = state.FinalScale / 5.0f;
-                float const scale =
-                    scaleMin + (scaleMax - scaleMin) * SmoothStep(0.0f, 2.0f, state.SimulationLifetime);
-
-                shipRenderContext.UploadAirBubble(
-                    GetPlaneId(pointIndex),
-                    GetPosition(pointIndex),
-                    scale,
-                    std::min(0.6f, state.CurrentDeltaY), // Alpha
-                    state.SimulationLifetime * Pi<float> * 2.0f); // Angle
-
-                break;
-            }
-
-            case EphemeralType::Debris:
-            {
-                // Don't upload point unless there's been a change
-                if (mAreEphemeralPointElementsDirtyForRendering)
-                {
-                    shipRenderContext.UploadElementEphemeralPoint(pointIndex);
-                }
-
-                break;
-            }
-
-            case EphemeralType::Smoke:
-            {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke;
-
-                // Calculate scale
-                float const scale = state.ScaleProgress;
-
-                // Calculate alpha
-                float const lifetimeProgress = state.LifetimeProgress;
-                float const alpha =
-                    SmoothStep(0.0f, 0.05f, lifetimeProgress)
-                    - SmoothStep(0.7f, 1.0f, lifetimeProgress);
-
-                // Upload smoke
-                shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                    GetPlaneId(pointIndex),
-                    state.PersonalitySeed,
-                    state.TextureGroup,
-                    GetPosition(pointIndex),
-                    scale,
-                    alpha);
-
-                break;
-            }
-
-            case EphemeralType::Sparkle:
-            {
-                shipRenderContext.UploadSparkle(
-                    GetPlaneId(pointIndex),
-                    GetPosition(pointIndex),
-                    GetVelocity(pointIndex),
-                    mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress);
-
-                break;
-            }
+        auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
+
+        // Calculate scale based on lifetime
+        float const scaleMax = state.FinalScale;
+        float const scaleMin = state.FinalScale / 5.0f;
+        float const scale =
+            scaleMin + (scaleMax - scaleMin) * SmoothStep(0.0f, 2.0f, state.SimulationLifetime);
+
+        shipRenderContext.UploadAirBubble(
+            GetPlaneId(pointIndex),
+            GetPosition(pointIndex),
+            scale,
+            std::min(0.6f, state.CurrentDeltaY), // Alpha
+            state.SimulationLifetime * Pi<float> * 2.0f); // Angle
+    }
 
-            case EphemeralType::WakeBubble:
-            {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble;
+    // Debris - don't upload points unless there's been a change
+    if (mAreEphemeralPointElementsDirtyForRendering)
+    {
+        for (ElementIndex const pointIndex : GetActiveEphemeralParticles(EphemeralType::Debris))
+        {
+            shipRenderContext.UploadElementEphemeralPoint(pointIndex);
+        }
+    }
 
-                shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                    GetPlaneId(pointIndex),
-                    TextureFrameId(GameTextureDatabases::GenericMipMappedTextureGroups::EngineWake, 0),
-                    GetPosition(pointIndex),
-                    0.10f + 1.22f * state.Progress, // Scale, magic formula
-                    mRandomNormalizedUniformFloatBuffer[pointIndex] * 2.0f * Pi<float>, // Angle
-                    1.0f - state.Progress); // Alpha
+    // Smoke
+    for (ElementIndex const pointIndex : GetActiveEphemeralParticles(EphemeralType::Smoke))
+    {
+        auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke;
+
+        // Calculate scale
+        float const scale = state.ScaleProgress;
+
+        // Calculate alpha
+        float const lifetimeProgress = state.LifetimeProgress;
+        float const alpha =
+            SmoothStep(0.0f, 0.05f, lifetimeProgress)
+            - SmoothStep(0.7f, 1.0f, lifetimeProgress);
+
+        // Upload smoke
+        shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+            GetPlaneId(pointIndex),
+            state.PersonalitySeed,
+            state.TextureGroup,
+            GetPosition(pointIndex),
+            scale,
+            alpha);
+    }
 
-                break;
-            }
+    // Sparkles
+    for (ElementIndex const pointIndex : GetActiveEphemeralParticles(EphemeralType::Sparkle))
+    {
+        shipRenderContext.UploadSparkle(
+            GetPlaneId(pointIndex),
+            GetPosition(pointIndex),
+            GetVelocity(pointIndex),
+            mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress);
+    }
 
-            case EphemeralType::None:
-            default:
-            {
-                // Ignore
-                break;
-            }
-        }
+    // Wake bubbles
+    for (ElementIndex const pointIndex : GetActiveEphemeralParticles(EphemeralType::WakeBubble))
+    {
+        auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble;
+
+        shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+            GetPlaneId(pointIndex),
+            TextureFrameId(GameTextureDatabases::GenericMipMappedTextureGroups::EngineWake, 0),
+            GetPosition(pointIndex),
+            0.10f + 1.22f * state.Progress, // Scale, magic formula
+            mRandomNormalizedUniformFloatBuffer[pointIndex] * 2.0f * Pi<float>, // Angle
+            1.0f - state.Progress); // Alpha
     }
 
     if (mAreEphemeralPointElementsDirtyForRendering)
@@ -2321,48 +2302,18 @@ ElementIndex Points::FindFreeEphemeralParticle(
     bool doForce)
 {
     //
-    // Search for the firt free ephemeral particle; if a free one is not found, reuse the
-    // oldest particle
+    // Take a free ephemeral particle; if there are no free ones, reuse the oldest
+    // particle
     //
 
-    ElementIndex oldestParticle = NoneElementIndex;
-    float oldestParticleLifetime = 0.0f;
-
-    assert(mFreeEphemeralParticleSearchStartIndex >= mAlignedShipPointCount
-        && mFreeEphemeralParticleSearchStartIndex < mAllPointCount);
-
-    for (ElementIndex p = mFreeEphemeralParticleSearchStartIndex; ; /*incremented in loop*/)
+    if (!mFreeEphemeralParticles.empty())
     {
-        if (EphemeralType::None == mEphemeralParticleAttributes1Buffer[p].Type)
-        {
-            // Found!
-
-            // Remember to start after this one next time
-            mFreeEphemeralParticleSearchStartIndex = p + 1;
-            if (mFreeEphemeralParticleSearchStartIndex >= mAllPointCount)
-                mFreeEphemeralParticleSearchStartIndex = mAlignedShipPointCount;
-
-            return p;
-        }
+        ElementIndex const freeParticle = mFreeEphemeralParticles.back();
+        mFreeEphemeralParticles.pop_back();
 
-        // Check whether it's the oldest
-        auto const lifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[p].StartSimulationTime;
-        if (lifetime >= oldestParticleLifetime)
-        {
-            oldestParticle = p;
-            oldestParticleLifetime = lifetime;
-        }
+        assert(EphemeralType::None == mEphemeralParticleAttributes1Buffer[freeParticle].Type);
 
-        // Advance
-        ++p;
-        if (p >= mAllPointCount)
-            p = mAlignedShipPointCount;
-
-        if (p == mFreeEphemeralParticleSearchStartIndex)
-        {
-            // Went around
-            break;
-        }
+        return freeParticle;
     }
 
     //
@@ -2372,17 +2323,30 @@ ElementIndex Points::FindFreeEphemeralParticle(
     if (!doForce)
         return NoneElementIndex;
 
-
     //
     // Steal the oldest
     //
 
+    ElementIndex oldestParticle = NoneElementIndex;
+    float oldestParticleLifetime = 0.0f;
+
+    for (auto const & activeEphemeralParticles : mActiveEphemeralParticles)
+    {
+        for (ElementIndex const p : activeEphemeralParticles)
+        {
+            auto const lifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[p].StartSimulationTime;
+            if (lifetime >= oldestParticleLifetime)
+            {
+                oldestParticle = p;
+                oldestParticleLifetime = lifetime;
+            }
+        }
+    }
+
     assert(NoneElementIndex != oldestParticle);
 
-    // Remember to start after this one next time
-    mFreeEphemeralParticleSearchStartIndex = oldestParticle + 1;
-    if (mFreeEphemeralParticleSearchStartIndex >= mAllPointCount)
-        mFreeEphemeralParticleSearchStartIndex = mAlignedShipPointCount;
+    // Take it away from its type, without freeing it
+    DeactivateEphemeralParticle(oldestParticle);
 
     return oldestParticle;
 }
@@ -27,6 +27,7 @@
 #include <Core/Vectors.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <cstring>
@@ -57,7 +58,9 @@ public:
         Debris,
         Smoke,
         Sparkle,
-        WakeBubble
+        WakeBubble,
+
+        _Last = WakeBubble
     };
 
     /*
@@ -438,10 +441,12 @@ private:
     {
         EphemeralType Type;
         float StartSimulationTime;
+        ElementIndex ActiveListPosition; // Position in the list of active particles of its type
 
         EphemeralParticleAttributes1()
             : Type(EphemeralType::None)
             , StartSimulationTime(0.0f)
+            , ActiveListPosition(NoneElementIndex)
         {}
     };
 
@@ -626,14 +631,18 @@ public:
         , mMaterialWaterRestitutionBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialWaterDiffusionSpeedBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mWaterBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mWaterBackBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mWaterVelocityBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
         , mWaterMomentumBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
+        , mParallelWaterBuffers()
+        , mParallelWaterMomentumBuffers()
         , mCumulatedIntakenWater(mBufferElementCount, shipPointCount, 0.0f)
         , mLeakingCompositeBuffer(mBufferElementCount, shipPointCount, LeakingComposite(false))
         , mFactoryIsStructurallyLeakingBuffer(mBufferElementCount, shipPointCount, false)
         , mTotalFactoryWetPoints(0)
         // Heat dynamics
         , mTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mTemperatureBackBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialHeatCapacityReciprocalBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialThermalExpansionCoefficientBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialIgnitionTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f)
@@ -708,7 +717,8 @@ public:
         , mWaterReactionExplosionCandidates(mRawShipPointCount)
         , mBurningPoints()
         , mStoppedBurningPoints()
-        , mFreeEphemeralParticleSearchStartIndex(mAlignedShipPointCount)
+        , mFreeEphemeralParticles()
+        , mActiveEphemeralParticles()
         , mAreEphemeralPointElementsDirtyForRendering(false)
 #ifdef _DEBUG
         , mDiagnostic_ArePositionsDirty(false)
@@ -719,6 +729,18 @@ public:
         mDynamicForceRawBuffers.emplace_back(reinterpret_cast<float *>(mDynamicForceBuffers[0].data()));
 
         CalculateCombustionDecayParameters(mCurrentCombustionSpeedAdjustment, SimulationParameters::ParticleUpdateLowFrequencyStepTimeDuration<float>);
+
+        // All ephemeral particles are free, and the lowest ones are handed out first
+        mFreeEphemeralParticles.reserve(mEphemeralPointCount);
+        for (ElementIndex p = mAllPointCount; p > mAlignedShipPointCount; --p)
+        {
+            mFreeEphemeralParticles.push_back(p - 1);
+        }
+
+        for (auto & activeEphemeralParticles : mActiveEphemeralParticles)
+        {
+            activeEphemeralParticles.reserve(mEphemeralPointCount);
+        }
     }
 
     Points(Points && other) = default;
@@ -1497,17 +1519,18 @@ public:
         return mWaterBuffer[pointElementIndex] > threshold;
     }
 
-    std::shared_ptr<Buffer<float>> MakeWaterBufferCopy()
+    /*
+     * The buffer receiving the results of a water flow - which reads from the water
+     * buffer - before it's made current with SwapWaterBuffers().
+     */
+    float * GetWaterBackBufferAsFloat()
     {
-        auto waterBufferCopy = mFloatBufferAllocator.Allocate();
-        waterBufferCopy->copy_from(mWaterBuffer);
-
-        return waterBufferCopy;
+        return mWaterBackBuffer.data();
     }
 
-    void UpdateWaterBuffer(std::shared_ptr<Buffer<float>> newWaterBuffer)
+    void SwapWaterBuffers()
     {
-        mWaterBuffer.copy_from(*newWaterBuffer);
+        mWaterBuffer.swap(mWaterBackBuffer);
     }
 
     vec2f const & GetWaterVelocity(ElementIndex pointElementIndex) const
@@ -1536,6 +1559,51 @@ public:
         return mWaterMomentumBuffer.data();
     }
 
+    /*
+     * Returns the buffer of water deltas for the specified thread of a water flow;
+     * deltas must be merged into the water back buffer and zeroed at the end of the flow.
+     */
+    float * GetParallelWaterBuffer(size_t parallelIndex)
+    {
+        assert(parallelIndex < mParallelWaterBuffers.size());
+        return mParallelWaterBuffers[parallelIndex].data();
+    }
+
+    /*
+     * Returns the water momentum buffer for the specified thread of a water flow:
+     * the first thread works directly on the water momentum buffer, while each other
+     * thread works on its own buffer of momentum deltas, which must be merged back and
+     * zeroed at the end of the flow.
+     */
+    vec2f * GetParallelWaterMomentumBuffer(size_t parallelIndex)
+    {
+        if (parallelIndex == 0)
+        {
+            return mWaterMomentumBuffer.data();
+        }
+
+        assert(parallelIndex - 1 < mParallelWaterMomentumBuffers.size());
+        return mParallelWaterMomentumBuffers[parallelIndex - 1].data();
+    }
+
+    void SetWaterFlowParallelism(size_t parallelism)
+    {
+        assert(parallelism >= 1);
+
+        mParallelWaterBuffers.clear();
+        mParallelWaterMomentumBuffers.clear();
+
+        for (size_t b = 0; b < parallelism; ++b)
+        {
+            mParallelWaterBuffers.emplace_back(mBufferElementCount, 0.0f);
+
+            if (b > 0)
+            {
+                mParallelWaterMomentumBuffers.emplace_back(mBufferElementCount, vec2f::zero());
+            }
+        }
+    }
+
     void UpdateWaterMomentaFromVelocities()
     {
         float * const restrict waterBuffer = mWaterBuffer.data();
@@ -1640,17 +1708,18 @@ public:
         mTemperatureBuffer[pointElementIndex] = value;
     }
 
-    std::shared_ptr<Buffer<float>> MakeTemperatureBufferCopy()
+    /*
+     * The buffer receiving the results of heat propagation - which reads from the
+     * temperature buffer - before it's made current with SwapTemperatureBuffers().
+     */
+    float * GetTemperatureBackBufferAsFloat()
     {
-        auto temperatureBufferCopy = mFloatBufferAllocator.Allocate();
-        temperatureBufferCopy->copy_from(mTemperatureBuffer);
-
-        return temperatureBufferCopy;
+        return mTemperatureBackBuffer.data();
     }
 
-    void UpdateTemperatureBuffer(std::shared_ptr<Buffer<float>> newTemperatureBuffer)
+    void SwapTemperatureBuffers()
     {
-        mTemperatureBuffer.copy_from(*newTemperatureBuffer);
+        mTemperatureBuffer.swap(mTemperatureBackBuffer);
     }
 
     float GetMaterialHeatCapacityReciprocal(ElementIndex pointElementIndex) const
@@ -2235,6 +2304,58 @@ private:
         float currentSimulationTime,
         bool doForce);
 
+    inline std::vector<ElementIndex> & GetActiveEphemeralParticles(EphemeralType ephemeralType)
+    {
+        assert(ephemeralType != EphemeralType::None);
+        return mActiveEphemeralParticles[static_cast<size_t>(ephemeralType) - 1];
+    }
+
+    inline std::vector<ElementIndex> const & GetActiveEphemeralParticles(EphemeralType ephemeralType) const
+    {
+        assert(ephemeralType != EphemeralType::None);
+        return mActiveEphemeralParticles[static_cast<size_t>(ephemeralType) - 1];
+    }
+
+    inline void ActivateEphemeralParticle(
+        ElementIndex pointElementIndex,
+        EphemeralType ephemeralType,
+        float currentSimulationTime)
+    {
+        auto & attributes1 = mEphemeralParticleAttributes1Buffer[pointElementIndex];
+        assert(attributes1.Type == EphemeralType::None);
+
+        auto & activeEphemeralParticles = GetActiveEphemeralParticles(ephemeralType);
+
+        attributes1.Type = ephemeralType;
+        attributes1.StartSimulationTime = currentSimulationTime;
+        attributes1.ActiveListPosition = static_cast<ElementIndex>(activeEphemeralParticles.size());
+
+        activeEphemeralParticles.push_back(pointElementIndex);
+    }
+
+    inline void DeactivateEphemeralParticle(ElementIndex pointElementIndex)
+    {
+        auto & attributes1 = mEphemeralParticleAttributes1Buffer[pointElementIndex];
+        auto & activeEphemeralParticles = GetActiveEphemeralParticles(attributes1.Type);
+
+        // Swap-remove from its list
+        assert(attributes1.ActiveListPosition < activeEphemeralParticles.size());
+        assert(activeEphemeralParticles[attributes1.ActiveListPosition] == pointElementIndex);
+        ElementIndex const lastPointElementIndex = activeEphemeralParticles.back();
+        activeEphemeralParticles[attributes1.ActiveListPosition] = lastPointElementIndex;
+        mEphemeralParticleAttributes1Buffer[lastPointElementIndex].ActiveListPosition = attributes1.ActiveListPosition;
+        activeEphemeralParticles.pop_back();
+
+        if (attributes1.Type == EphemeralType::Debris)
+        {
+            // Remember that ephemeral point elements are now dirty
+            mAreEphemeralPointElementsDirtyForRendering = true;
+        }
+
+        attributes1.Type = EphemeralType::None;
+        attributes1.ActiveListPosition = NoneElementIndex;
+    }
+
     inline void ExpireEphemeralParticle(ElementIndex pointElementIndex)
     {
         // Freeze the particle (just to prevent drifting)
@@ -2244,7 +2365,8 @@ private:
         // - Being rendered
         // - Being updated
         // ...and it will allow its slot to be chosen for a new ephemeral particle
-        mEphemeralParticleAttributes1Buffer[pointElementIndex].Type = EphemeralType::None;
+        DeactivateEphemeralParticle(pointElementIndex);
+        mFreeEphemeralParticles.push_back(pointElementIndex);
     }
 
 private:
@@ -2303,12 +2425,22 @@ private:
     // this point. Quantity of water is min(water, 1.0)
     Buffer<float> mWaterBuffer;
 
+    // Receives the results of the water flow, and is then swapped with the water buffer
+    Buffer<float> mWaterBackBuffer;
+
     // Total velocity of the water at this point
     Buffer<vec2f> mWaterVelocityBuffer;
 
     // Total momentum of the water at this point
     Buffer<vec2f> mWaterMomentumBuffer;
 
+    // Water delta accumulation buffers for each water flow thread
+    std::vector<Buffer<float>> mParallelWaterBuffers;
+
+    // Water momentum accumulation buffers for each water flow thread other
+    // than the first one, which works directly on the water momentum buffer
+    std::vector<Buffer<vec2f>> mParallelWaterMomentumBuffers;
+
     // Total amount of water in/out taken which has not yet been
     // utilized for air bubbles
     Buffer<float> mCumulatedIntakenWater;
@@ -2325,6 +2457,7 @@ private:
     //
 
     Buffer<float> mTemperatureBuffer; // Kelvin
+    Buffer<float> mTemperatureBackBuffer; // Receives the results of heat propagation, and is then swapped with the temperature buffer
     Buffer<float> mMaterialHeatCapacityReciprocalBuffer;
     Buffer<float> mMaterialThermalExpansionCoefficientBuffer;
     Buffer<float> mMaterialIgnitionTemperatureBuffer;
@@ -2481,9 +2614,12 @@ private:
     // member only to save allocations at use time
     std::vector<ElementIndex> mStoppedBurningPoints;
 
-    // The index at which to start searching for free ephemeral particles
-    // (just an optimization over restarting from zero each time)
-    ElementIndex mFreeEphemeralParticleSearchStartIndex;
+    // The free ephemeral particle slots, used as a stack
+    std::vector<ElementIndex> mFreeEphemeralParticles;
+
+    // The active ephemeral particles of each type (indexed by type - 1), in no
+    // particular order; particles are swap-removed when they expire
+    std::array<std::vector<ElementIndex>, static_cast<size_t>(EphemeralType::_Last)> mActiveEphemeralParticles;
 
     // Flag remembering whether the set of ephemeral point *elements* is dirty
     // (i.e. whether there are more or less points than previously
@@ -15,6 +15,7 @@
 #include <Core/GameMath.h>
 #include <Core/GameRandomEngine.h>
 #include <Core/Log.h>
+#include <Core/Profiler.h>
 #include <Core/SysSpecifics.h>
 
 #include <algorithm>
@@ -55,6 +56,10 @@ static int constexpr RotPointsStep4 = 35;
 
 static_assert(RotPointsStep4 < SimulationParameters::ParticleUpdateLowFrequencyPeriod);
 
+// Queries per step from which rebuilding the point grid at each step is cheaper
+// than scanning all points at each query (see the PointGridQuery benchmarks)
+static size_t constexpr MinPointGridQueriesPerStep = 6;
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,6 +92,7 @@ Ship::Ship(
     , mMaterialDatabase(materialDatabase)
     , mSimulationEventHandler(simulationEventDispatcher)
     , mEventRecorder(nullptr)
+    , mRandomEngine(GameRandomEngine::MakeObjectInstance(static_cast<unsigned int>(id)))
     , mPoints(std::move(points))
     , mSprings(std::move(springs))
     , mTriangles(std::move(triangles))
@@ -115,14 +121,27 @@ Ship::Ship(
     , mCurrentElectricalVisitSequenceNumber()
     , mConnectedComponentSizes()
     , mIsStructureDirty(true)
+    , mConnectivityDirtyPoints()
+    , mConnectivityPlaneTriangleCountChanges()
+    , mCanUpdateConnectivityIncrementally(false) // First update is a full visit
+    , mConnectivitySearchFronts()
+    , mConnectivitySearchFrontIndices(mPoints.GetRawShipPointCount(), 0)
+    , mConnectivityPlaneIdRemap()
     , mDamagedPointsCount(0)
     , mBrokenSpringsCount(0)
     , mBrokenTrianglesCount(0)
     , mIsSinking(false)
     , mWaterSplashedRunningAverage()
-    , mLastLuminiscenceAdjustmentDiffused(-1.0f)
+    , mWereLampsLitAtLastLightDiffusion(true) // Make sure we run at least once
     , mRepairGracePeriodMultiplier(1.0f)
     , mLastQueriedPointIndex(NoneElementIndex)
+    , mPointGrid(
+        2.0f, // Min cell size
+        1024) // Max cells per dimension
+    , mPointQueryCount(0)
+    , mTriangleGrid(
+        2.0f, // Min cell size
+        1024) // Max cells per dimension
     , mAirBubblesCreatedCount(0)
     , mCurrentSimulationParallelism(0) // We'll detect a difference on first run
     , mCurrentSpringRelaxationParallelComputationMode() // We'll detect a difference on first run
@@ -132,6 +151,21 @@ Ship::Ship(
     , mStaticPressureNetForceMagnitudeCount(0.0f)
     , mStaticPressureIterationsPercentagesSum(0.0f)
     , mStaticPressureIterationsCount(0.0f)
+    // Light diffusion
+    , mLightDiffusionTasks()
+    , mLampGrid(64) // Max cells per dimension
+    , mIsLightDiffusionBinned(false)
+    // Water flow
+    , mWaterFlowStepParameters()
+    , mWaterFlowPartitions()
+    , mWaterFlowMergeTasks()
+    , mCurrentDoParallelWaterFlow() // We'll detect a difference on first run
+    // Heat
+    , mHeatPropagationStepParameters()
+    , mHeatOutflowNormalizationFactorBuffer(mPoints.GetBufferElementCount())
+    // Update
+    , mUpdateTaskGraph()
+    , mUpdateWaterVelocityTaskIds()
     // Render
     , mLastUploadedDebugShipRenderMode()
     , mPlaneTriangleIndicesToRender()
@@ -225,16 +259,15 @@ void Ship::Update(
     ThreadManager & threadManager,
     PerfStats & perfStats)
 {
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const updateStartTimestamp = GameChronometer::Now();
-#endif
+    FS_PROFILE_ZONE("Ship::Update");
+
+    // Draw from our own engine, whichever thread we're running on
+    GameRandomEngine::ScopedThreadInstance const randomEngineScope(mRandomEngine);
 
     /////////////////////////////////////////////////////////////////
     //         This is where most of the magic happens             //
     /////////////////////////////////////////////////////////////////
 
-    std::vector<ThreadPool::Task> parallelTasks;
-
     /////////////////////////////////////////////////////////////////
     // At this moment:
     //  - Particle positions are within world boundaries
@@ -248,6 +281,9 @@ void Ship::Update(
     // Advance the current simulation sequence
     ++mCurrentSimulationSequenceNumber;
 
+    // Points are about to move
+    InvalidateSpatialGrids();
+
 #ifdef _DEBUG
     VerifyInvariants();
 #endif
@@ -295,11 +331,9 @@ void Ship::Update(
     // and ocean floor collision handling
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto startTimestamp1 = GameChronometer::Now();
-#endif
-
     {
+        FS_PROFILE_ZONE("Ship::RunSpringRelaxation");
+
         auto const springsStartTime = GameChronometer::Now();
 
         RunSpringRelaxation(threadManager, simulationParameters);
@@ -307,10 +341,6 @@ void Ship::Update(
         perfStats.Update<PerfMeasurement::TotalShipsSpringsUpdate>(GameChronometer::Now() - springsStartTime);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedSpringRelaxation = GameChronometer::Now() - startTimestamp1;
-#endif
-
     ///////////////////////////////////////////////////////////////////
     // Trim for world bounds
     ///////////////////////////////////////////////////////////////////
@@ -342,22 +372,18 @@ void Ship::Update(
         mPoints.ResetStress();
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
-    // - Inputs: P.Position, S.SpringDeletion, S.RestLength, S.BreakingElongation
-    // - Outputs: S.Destroy(), P.Stress, S.CachedVectorialInfo
-    // - Fires events, updates frontiers
-    mSprings.UpdateForStrainsAndCacheSpringVectors(
-        currentSimulationTime,
-        simulationParameters,
-        mPoints,
-        stressRenderMode);
+    {
+        FS_PROFILE_ZONE("Springs::UpdateForStrainsAndCacheSpringVectors");
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedUpdateForStress = GameChronometer::Now() - startTimestamp1;
-#endif
+        // - Inputs: P.Position, S.SpringDeletion, S.RestLength, S.BreakingElongation
+        // - Outputs: S.Destroy(), P.Stress, S.CachedVectorialInfo
+        // - Fires events, updates frontiers
+        mSprings.UpdateForStrainsAndCacheSpringVectors(
+            currentSimulationTime,
+            simulationParameters,
+            mPoints,
+            stressRenderMode);
+    }
 
     ///////////////////////////////////////////////////////////////////
     // Reset static forces, now that we have integrated them
@@ -379,19 +405,15 @@ void Ship::Update(
     // geometric centers - hence needs to come _after _ UpdateForStrains()
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
-    ApplyWorldForces(
-        effectiveAirDensity,
-        effectiveWaterDensity,
-        simulationParameters,
-        externalAabbSet);
+    {
+        FS_PROFILE_ZONE("Ship::ApplyWorldForces");
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedWorldForces = GameChronometer::Now() - startTimestamp1;
-#endif
+        ApplyWorldForces(
+            effectiveAirDensity,
+            effectiveWaterDensity,
+            simulationParameters,
+            externalAabbSet);
+    }
 
     // Cached depths are valid from now on --------------------------->
 
@@ -399,10 +421,6 @@ void Ship::Update(
     // Rot points
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     // - Inputs: Position, Water, IsLeaking
     // - Output: Decay
 
@@ -435,9 +453,6 @@ void Ship::Update(
             simulationParameters);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedRotPoints = GameChronometer::Now() - startTimestamp1;
-#endif
 
     /////////////////////////////////////////////////////////////////
     // Update gadgets
@@ -463,15 +478,13 @@ void Ship::Update(
     // Update water dynamics - may generate ephemeral particles
     /////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     //
     // Update intake of pressure and water
     //
 
     {
+        FS_PROFILE_ZONE("Ship::UpdatePressureAndWaterInflow");
+
         float waterTakenInStep = 0.f;
 
         // - Inputs: P.Position, P.Water, P.IsLeaking, P.Temperature, P.PlaneId
@@ -489,77 +502,99 @@ void Ship::Update(
         mSimulationEventHandler.OnWaterTaken(waterTakenInStep);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedWaterDynamics = GameChronometer::Now() - startTimestamp1;
-#endif
-
     ///////////////////////////////
     // Parallel run 1 START
     ///////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    GameChronometer::duration elapsedWaterDiffusion;
-    GameChronometer::duration elapsedEqualizeInternalPressure;
-    GameChronometer::duration elapsedStaticPressure;
-    GameChronometer::duration elapsedHeatPropagation;
-#endif
+    //
+    // Water flow, heat propagation and pressure run as a graph:
+    //
+    //  UpdateWaterVelocities(1..N) --> CompleteWaterFlow --> PropagateHeat
+    //  EqualizeInternalPressure --> ApplyStaticPressureForces
+    //
+    // Heat depends on the new water, while pressure is independent of both
+    //
 
-    assert(parallelTasks.empty());
+    assert(mUpdateTaskGraph.IsEmpty());
 
-    parallelTasks.emplace_back(
-        [&]()
-        {
-            //
-            // Diffuse water (Cost: 14)
-            //
+    //
+    // Diffuse water (Cost: 14)
+    //
+    // Split in as many tasks as the water flow parallelism
+    //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            auto startTimestamp2 = GameChronometer::Now();
-#endif
+    // - Inputs: Position, Water, WaterVelocity, WaterMomentum, ConnectedSprings
+    // - Outpus: Water, WaterVelocity, WaterMomentum
+    PrepareWaterFlow(simulationParameters);
+
+    mUpdateWaterVelocityTaskIds.clear();
+    for (size_t p = 0; p < mWaterFlowPartitions.size(); ++p)
+    {
+        mUpdateWaterVelocityTaskIds.emplace_back(mUpdateTaskGraph.AddTask(
+            [this, p]()
+            {
+                FS_PROFILE_ZONE("Ship::UpdateWaterVelocities");
 
-            float waterSplashedInStep = 0.f;
+                UpdateWaterVelocities(p);
+            }));
+    }
+
+    float waterSplashedInStep = 0.0f;
 
-            // - Inputs: Position, Water, WaterVelocity, WaterMomentum, ConnectedSprings
-            // - Outpus: Water, WaterVelocity, WaterMomentum
-            UpdateWaterVelocities(simulationParameters, waterSplashedInStep);
+    mUpdateTaskGraph.AddTask(
+        [&]()
+        {
+            // Complete water flow
+            {
+                FS_PROFILE_ZONE("Ship::CompleteWaterFlow");
 
-            // Notify
-            mSimulationEventHandler.OnWaterSplashed(waterSplashedInStep);
+                waterSplashedInStep = CompleteWaterFlow(threadManager);
+            }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedWaterDiffusion = GameChronometer::Now() - startTimestamp2;
-#endif
-        });
+            //
+            // Propagate heat (Cost: 4)
+            //
+            // Parallelized itself
+            //
 
-    parallelTasks.emplace_back(
+            {
+                FS_PROFILE_ZONE("Ship::PropagateHeat");
+
+                // - Inputs: P.Position, P.Temperature, P.ConnectedSprings, P.Water
+                // - Outputs: P.Temperature
+                PropagateHeat(
+                    currentSimulationTime,
+                    SimulationParameters::SimulationStepTimeDuration<float>,
+                    stormParameters,
+                    simulationParameters,
+                    threadManager);
+            }
+        },
+        mUpdateWaterVelocityTaskIds);
+
+    mUpdateTaskGraph.AddTask(
         [&]()
         {
             //
             // Equalize internal pressure (Cost: 1.5)
             //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            auto startTimestamp2 = GameChronometer::Now();
-#endif
-
-            // - Inputs: InternalPressure, ConnectedSprings
-            // - Outpus: InternalPressure
-            EqualizeInternalPressure(simulationParameters);
+            {
+                FS_PROFILE_ZONE("Ship::EqualizeInternalPressure");
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedEqualizeInternalPressure = GameChronometer::Now() - startTimestamp2;
-#endif
+                // - Inputs: InternalPressure, ConnectedSprings
+                // - Outpus: InternalPressure
+                EqualizeInternalPressure(simulationParameters);
+            }
 
             //
             // Apply static pressure forces (Cost: 10)
             //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-            startTimestamp2 = GameChronometer::Now();
-#endif
-
             if (simulationParameters.StaticPressureForceAdjustment > 0.0f)
             {
+                FS_PROFILE_ZONE("Ship::ApplyStaticPressureForces");
+
                 // - Inputs: frontiers, P.Position, P.InternalPressure
                 // - Outputs: P.DynamicForces
                 ApplyStaticPressureForces(
@@ -567,43 +602,19 @@ void Ship::Update(
                     effectiveWaterDensity,
                     simulationParameters);
             }
-
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedStaticPressure = GameChronometer::Now() - startTimestamp2;
-#endif
-
-            //
-            // Propagate heat (Cost: 4)
-            //
-
-#ifdef FS_PROFILE_SHIP_UPDATE
-            startTimestamp2 = GameChronometer::Now();
-#endif
-
-            // - Inputs: P.Position, P.Temperature, P.ConnectedSprings, P.Water
-            // - Outputs: P.Temperature
-            PropagateHeat(
-                currentSimulationTime,
-                SimulationParameters::SimulationStepTimeDuration<float>,
-                stormParameters,
-                simulationParameters);
-
-#ifdef FS_PROFILE_SHIP_UPDATE
-            elapsedHeatPropagation = GameChronometer::Now() - startTimestamp2;
-#endif
         });
 
-    threadManager.GetSimulationThreadPool().RunAndClear(parallelTasks);
+    threadManager.GetSimulationThreadPool().Run(mUpdateTaskGraph);
+    mUpdateTaskGraph.Clear();
+
+    // Notify water splashed
+    mSimulationEventHandler.OnWaterSplashed(waterSplashedInStep);
 
     // Publish static pressure stats
     mSimulationEventHandler.OnStaticPressureUpdated(
         mStaticPressureNetForceMagnitudeCount != 0.0f ? mStaticPressureNetForceMagnitudeSum / mStaticPressureNetForceMagnitudeCount : 0.0f,
         mStaticPressureIterationsCount != 0.0f ? mStaticPressureIterationsPercentagesSum / mStaticPressureIterationsCount : 0.0f);
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedParallel1 = GameChronometer::Now() - startTimestamp1;
-#endif
-
     ///////////////////////////////
     // Parallel run 1 END
     ///////////////////////////////
@@ -628,100 +639,94 @@ void Ship::Update(
     // Generate a new visit sequence number
     ++mCurrentElectricalVisitSequenceNumber;
 
-    mElectricalElements.Update(
-        currentWallClockTime,
-        currentSimulationTime,
-        mCurrentElectricalVisitSequenceNumber,
-        mPoints,
-        mSprings,
-        effectiveAirDensity,
-        effectiveWaterDensity,
-        stormParameters,
-        simulationParameters);
+    {
+        FS_PROFILE_ZONE("ElectricalElements::Update");
+
+        mElectricalElements.Update(
+            currentWallClockTime,
+            currentSimulationTime,
+            mCurrentElectricalVisitSequenceNumber,
+            mPoints,
+            mSprings,
+            effectiveAirDensity,
+            effectiveWaterDensity,
+            stormParameters,
+            simulationParameters);
+    }
 
     //
     // Diffuse light
     //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
+    {
+        FS_PROFILE_ZONE("Ship::DiffuseLight");
 
-    // - Inputs: P.Position, P.PlaneId, EL.AvailableLight
-    //      - EL.AvailableLight depends on electricals which depend on water
-    // - Outputs: P.Light
-    DiffuseLight(
-        simulationParameters,
-        threadManager);
+        // - Inputs: P.Position, P.PlaneId, EL.AvailableLight
+        //      - EL.AvailableLight depends on electricals which depend on water
+        // - Outputs: P.Light
+        DiffuseLight(threadManager);
+    }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedLightDiffusion = GameChronometer::Now() - startTimestamp1;
-#endif
+    {
+        FS_PROFILE_ZONE("Points::UpdateCombustion");
 
-    //
-    // Update slow combustion state machine
-    //
+        //
+        // Update slow combustion state machine
+        //
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
+        if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep1, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
+        {
+            mPoints.UpdateCombustionLowFrequency(
+                0,
+                4,
+                currentWallClockTimeFloat,
+                currentSimulationTime,
+                stormParameters,
+                simulationParameters);
+        }
+        else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep2, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
+        {
+            mPoints.UpdateCombustionLowFrequency(
+                1,
+                4,
+                currentWallClockTimeFloat,
+                currentSimulationTime,
+                stormParameters,
+                simulationParameters);
+        }
+        else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep3, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
+        {
+            mPoints.UpdateCombustionLowFrequency(
+                2,
+                4,
+                currentWallClockTimeFloat,
+                currentSimulationTime,
+                stormParameters,
+                simulationParameters);
+        }
+        else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep4, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
+        {
+            mPoints.UpdateCombustionLowFrequency(
+                3,
+                4,
+                currentWallClockTimeFloat,
+                currentSimulationTime,
+                stormParameters,
+                simulationParameters);
+        }
 
-    if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep1, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        mPoints.UpdateCombustionLowFrequency(
-            0,
-            4,
-            currentWallClockTimeFloat,
-            currentSimulationTime,
-            stormParameters,
-            simulationParameters);
-    }
-    else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep2, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        mPoints.UpdateCombustionLowFrequency(
-            1,
-            4,
-            currentWallClockTimeFloat,
-            currentSimulationTime,
-            stormParameters,
-            simulationParameters);
-    }
-    else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep3, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        mPoints.UpdateCombustionLowFrequency(
-            2,
-            4,
-            currentWallClockTimeFloat,
-            currentSimulationTime,
-            stormParameters,
-            simulationParameters);
-    }
-    else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep4, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        mPoints.UpdateCombustionLowFrequency(
-            3,
-            4,
-            currentWallClockTimeFloat,
+        //
+        // Update fast combustion state machine
+        //
+
+        mPoints.UpdateCombustionHighFrequency(
             currentSimulationTime,
-            stormParameters,
+            SimulationParameters::SimulationStepTimeDuration<float>,
+            mParentWorld.GetCurrentWindSpeed(),
+            mParentWorld.GetCurrentRadialWindField(),
             simulationParameters);
     }
 
-    //
-    // Update fast combustion state machine
-    //
-
-    mPoints.UpdateCombustionHighFrequency(
-        currentSimulationTime,
-        SimulationParameters::SimulationStepTimeDuration<float>,
-        mParentWorld.GetCurrentWindSpeed(),
-        mParentWorld.GetCurrentRadialWindField(),
-        simulationParameters);
-
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedCombustion = GameChronometer::Now() - startTimestamp1;
-#endif
-
     //
     // Update highlights
     //
@@ -738,10 +743,6 @@ void Ship::Update(
     // Update spring parameters
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
     if (mCurrentSimulationSequenceNumber.IsStepOf(SpringDecayAndTemperatureStep1, SimulationParameters::ParticleUpdateLowFrequencyPeriod))
     {
         mSprings.UpdateForDecayAndTemperature(
@@ -767,25 +768,17 @@ void Ship::Update(
             mPoints);
     }
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedUpdateSpringParameters = GameChronometer::Now() - startTimestamp1;
-#endif
-
     ///////////////////////////////////////////////////////////////////
     // Update ephemeral particles
     ///////////////////////////////////////////////////////////////////
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    startTimestamp1 = GameChronometer::Now();
-#endif
-
-    mPoints.UpdateEphemeralParticles(
-        currentSimulationTime,
-        simulationParameters);
+    {
+        FS_PROFILE_ZONE("Points::UpdateEphemeralParticles");
 
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const elapsedUpdateEphemeralParticles = GameChronometer::Now() - startTimestamp1;
-#endif
+        mPoints.UpdateEphemeralParticles(
+            currentSimulationTime,
+            simulationParameters);
+    }
 
     ///////////////////////////////////////////////////////////////////
     // Update cleanup
@@ -795,6 +788,22 @@ void Ship::Update(
     // it for use in the next simulation step
     mPoints.ResetTransientAdditionalMasses();
 
+    // Points have moved since any spatial query made during this step (e.g. by NPCs
+    // reacting to destroyed triangles), so have the NPC update - which comes next - see
+    // grids rebuilt with the final positions of this step
+    InvalidateSpatialGrids();
+
+    // Tools in use query points at each step; rebuilding the point grid costs about as much
+    // as a few scans of all points, hence we rebuild it here - once, for the next step's
+    // queries - only if this step had enough of them. Ephemeral particles created from now
+    // on are still seen, as they're not in the grid
+    if (mPointQueryCount >= MinPointGridQueriesPerStep)
+    {
+        RebuildPointGrid();
+    }
+
+    mPointQueryCount = 0;
+
     ///////////////////////////////////////////////////////////////////
     // Diagnostics
     ///////////////////////////////////////////////////////////////////
@@ -806,80 +815,6 @@ void Ship::Update(
     VerifyInvariants();
 
 #endif
-
-#ifdef FS_PROFILE_SHIP_UPDATE
-    auto const updateEndTimestamp = GameChronometer::Now();
-
-    static std::chrono::microseconds springRelaxationTotal{0};
-    static std::chrono::microseconds updateForStressTotal{0};
-    static std::chrono::microseconds rotPointsTotal{0};
-    static std::chrono::microseconds worldForcesTotal{0};
-    static std::chrono::microseconds waterDynamicsTotal{0};
-    static std::chrono::microseconds parallel1Total{0};
-    static std::chrono::microseconds lightDiffusionTotal{0};
-    static std::chrono::microseconds combustionTotal{0};
-    static std::chrono::microseconds updateSpringParametersTotal{0};
-    static std::chrono::microseconds waterDiffusionTotal{0};
-    static std::chrono::microseconds equalizeInternalPressureTotal{0};
-    static std::chrono::microseconds staticPressureTotal{0};
-    static std::chrono::microseconds heatPropagationTotal{0};
-    static std::chrono::microseconds ephemeralParticlesTotal{0};
-    static std::chrono::microseconds totalUpdateTotal{0};
-    static int profilingFrameCounter = 0;
-
-    springRelaxationTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedSpringRelaxation);
-    updateForStressTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedUpdateForStress);
-    rotPointsTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedRotPoints);
-    worldForcesTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedWorldForces);
-    waterDynamicsTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedWaterDynamics);
-    parallel1Total += std::chrono::duration_cast<std::chrono::microseconds>(elapsedParallel1);
-    lightDiffusionTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedLightDiffusion);
-    combustionTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedCombustion);
-    updateSpringParametersTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedUpdateSpringParameters);
-    waterDiffusionTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedWaterDiffusion);
-    equalizeInternalPressureTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedEqualizeInternalPressure);
-    staticPressureTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedStaticPressure);
-    heatPropagationTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedHeatPropagation);
-    ephemeralParticlesTotal += std::chrono::duration_cast<std::chrono::microseconds>(elapsedUpdateEphemeralParticles);
-    totalUpdateTotal += std::chrono::duration_cast<std::chrono::microseconds>(updateEndTimestamp - updateStartTimestamp);
-    ++profilingFrameCounter;
-
-    if (0 == (profilingFrameCounter % 40))
-    {
-        LogMessage("*** Ship update: springRelax=", springRelaxationTotal.count() / profilingFrameCounter / 1000.0f,
-                   " updateForStress=", updateForStressTotal.count() / profilingFrameCounter / 1000.0f,
-                   " rotPoints=", rotPointsTotal.count() / profilingFrameCounter / 1000.0f,
-                   " worldForces=", worldForcesTotal.count() / profilingFrameCounter / 1000.0f,
-                   " waterDynamics=", waterDynamicsTotal.count() / profilingFrameCounter / 1000.0f,
-                   " parallel1=", parallel1Total.count() / profilingFrameCounter / 1000.0f,
-                   " (waterDiffusion=", waterDiffusionTotal.count() / profilingFrameCounter / 1000.0f,
-                   " equalizeInternalPressure=", equalizeInternalPressureTotal.count() / profilingFrameCounter / 1000.0f,
-                   " staticPressure=", staticPressureTotal.count() / profilingFrameCounter / 1000.0f,
-                   " heatPropagation=", heatPropagationTotal.count() / profilingFrameCounter / 1000.0f, ")",
-                   " lightDiffusion=", lightDiffusionTotal.count() / profilingFrameCounter / 1000.0f,
-                   " combustion=", combustionTotal.count() / profilingFrameCounter / 1000.0f,
-                   " updateSpringParameters=", updateSpringParametersTotal.count() / profilingFrameCounter / 1000.0f,
-                   " ephemeralParticles=", ephemeralParticlesTotal.count() / profilingFrameCounter / 1000.0f,
-                   " total: ", totalUpdateTotal.count() / profilingFrameCounter / 1000.0f, "ms");
-
-        springRelaxationTotal = std::chrono::microseconds(0);
-        updateForStressTotal = std::chrono::microseconds(0);
-        rotPointsTotal = std::chrono::microseconds(0);
-        worldForcesTotal = std::chrono::microseconds(0);
-        waterDynamicsTotal = std::chrono::microseconds(0);
-        parallel1Total = std::chrono::microseconds(0);
-        lightDiffusionTotal = std::chrono::microseconds(0);
-        combustionTotal = std::chrono::microseconds(0);
-        updateSpringParametersTotal = std::chrono::microseconds(0);
-        waterDiffusionTotal = std::chrono::microseconds(0);
-        equalizeInternalPressureTotal = std::chrono::microseconds(0);
-        staticPressureTotal = std::chrono::microseconds(0);
-        heatPropagationTotal = std::chrono::microseconds(0);
-        ephemeralParticlesTotal = std::chrono::microseconds(0);
-        totalUpdateTotal = std::chrono::microseconds(0);
-        profilingFrameCounter = 0;
-    }
-#endif
 }
 
 void Ship::UpdateEnd()
@@ -913,7 +848,7 @@ void Ship::RenderUpload(RenderContext & renderContext)
     if (mIsStructureDirty)
     {
         // Re-calculate connected components
-        RunConnectivityVisit();
+        UpdateConnectivity();
 
         // Notify electrical elements
         mElectricalElements.OnPhysicalStructureChanged(mPoints);
@@ -2507,50 +2442,89 @@ void Ship::EqualizeInternalPressure(SimulationParameters const & /*simulationPar
     }
 }
 
-void Ship::UpdateWaterVelocities(
-    SimulationParameters const & simulationParameters,
-    float & waterSplashed)
+void Ship::RecalculateWaterFlowParallelism(
+    size_t simulationParallelism,
+    SimulationParameters const & simulationParameters)
 {
+    // Clear threading state
+    mWaterFlowPartitions.clear();
+    mWaterFlowMergeTasks.clear();
+
     //
-    // For each (non-ephemeral) point, move each spring's outgoing water momentum to
-    // its destination point
-    //
-    // Implementation of https://gabrielegiuseppini.wordpress.com/2018/09/08/momentum-based-simulation-of-water-flooding-2d-spaces/
+    // Given the available simulation parallelism as a constraint (max), calculate
+    // the best parallelism for the water flow algorithm
     //
 
-#ifdef _DEBUG
-    // We use cached springs vectors
-    assert(!mPoints.Diagnostic_ArePositionsDirty());
-#endif
+    ElementCount const numberOfPoints = mPoints.GetRawShipPointCount(); // Ephemeral points have no springs
 
-    // Calculate water momenta
-    mPoints.UpdateWaterMomentaFromVelocities();
+    ElementCount constexpr PointsPerThread = 2000;
 
-    // Source and result water buffers
-    auto oldPointWaterBuffer = mPoints.MakeWaterBufferCopy();
-    float const * restrict oldPointWaterBufferData = oldPointWaterBuffer->data();
-    float * restrict newPointWaterBufferData = mPoints.GetWaterBufferAsFloat();
-    vec2f * restrict oldPointWaterVelocityBufferData = mPoints.GetWaterVelocityBufferAsVec2();
-    vec2f * restrict newPointWaterMomentumBufferData = mPoints.GetWaterMomentumBufferAsVec2f();
+    size_t const waterFlowParallelism = simulationParameters.DoParallelWaterFlow
+        ? std::max(
+            std::min(static_cast<size_t>(numberOfPoints) / PointsPerThread, simulationParallelism),
+            size_t(1))
+        : size_t(1);
 
-    // Weights of outbound water flows along each spring, including impermeable ones;
-    // set to zero for springs whose resultant scalar water velocities are
-    // directed towards the point being visited
-    std::array<float, SimulationParameters::MaxSpringsPerPoint> springOutboundWaterFlowWeights;
+    LogMessage("Ship::RecalculateWaterFlowParallelism: points=", numberOfPoints, " simulationParallelism=", simulationParallelism,
+        " doParallelWaterFlow=", simulationParameters.DoParallelWaterFlow, " waterFlowParallelism=", waterFlowParallelism);
 
-    // Total weight
-    float totalOutboundWaterFlowWeight;
+    mPoints.SetWaterFlowParallelism(waterFlowParallelism);
 
-    // Resultant water velocities along each spring
-    std::array<vec2f, SimulationParameters::MaxSpringsPerPoint> springOutboundWaterVelocities;
+    //
+    // Prepare partitions
+    //
+
+    ElementCount const numberOfPointsPerThread = numberOfPoints / static_cast<ElementCount>(waterFlowParallelism);
+
+    ElementIndex pointStart = 0;
+    for (size_t t = 0; t < waterFlowParallelism; ++t)
+    {
+        ElementIndex const pointEnd = (t < waterFlowParallelism - 1)
+            ? pointStart + numberOfPointsPerThread
+            : numberOfPoints;
+
+        mWaterFlowPartitions.emplace_back(pointStart, pointEnd);
+
+        pointStart = pointEnd;
+    }
 
     //
-    // Quantities for water kinetic energy loss, used
-    // only for sound
+    // Prepare merge tasks
     //
-    // Not on Mobile (as it's a small feature that costs a lot!)
+    // These visit all points, ephemerals included, as they populate the whole
+    // water back buffer
     //
 
+    ElementCount const numberOfAllPoints = mPoints.GetElementCount();
+    ElementCount const numberOfAllPointsPerThread = numberOfAllPoints / static_cast<ElementCount>(waterFlowParallelism);
+
+    pointStart = 0;
+    for (size_t t = 0; t < waterFlowParallelism; ++t)
+    {
+        ElementIndex const pointEnd = (t < waterFlowParallelism - 1)
+            ? pointStart + numberOfAllPointsPerThread
+            : numberOfAllPoints;
+
+        mWaterFlowMergeTasks.emplace_back(
+            [this, pointStart, pointEnd]()
+            {
+                MergeWaterFlows(pointStart, pointEnd);
+            });
+
+        pointStart = pointEnd;
+    }
+}
+
+void Ship::PrepareWaterFlow(SimulationParameters const & simulationParameters)
+{
+#ifdef _DEBUG
+    // We use cached springs vectors
+    assert(!mPoints.Diagnostic_ArePositionsDirty());
+#endif
+
+    // Calculate water momenta
+    mPoints.UpdateWaterMomentaFromVelocities();
+
 #if !FS_IS_PLATFORM_MOBILE()
     //
     // Precalculate point "freeness factors", i.e. how much each point's
@@ -2560,17 +2534,71 @@ void Ship::UpdateWaterVelocities(
     //  0.0f: point has water
     //
 
-    auto pointFreenessFactorBuffer = mPoints.AllocateWorkBufferFloat();
-    float * restrict pointFreenessFactorBufferData = pointFreenessFactorBuffer->data();
+    float const * restrict const pointWaterBufferData = mPoints.GetWaterBufferAsFloat();
+
+    mWaterFlowStepParameters.PointFreenessFactorBuffer = mPoints.AllocateWorkBufferFloat();
+    float * restrict const pointFreenessFactorBufferData = mWaterFlowStepParameters.PointFreenessFactorBuffer->data();
     for (auto pointIndex : mPoints.RawShipPoints())
     {
         pointFreenessFactorBufferData[pointIndex] =
-            FastExp(-oldPointWaterBufferData[pointIndex] * 10.0f);
+            FastExp(-pointWaterBufferData[pointIndex] * 10.0f);
     }
+#endif
 
-    // Count of non-hull free and drowned neighbor points for a given point
-    float pointSplashNeighbors;
-    float pointSplashFreeNeighbors;
+    mWaterFlowStepParameters.WaterCrazyness = simulationParameters.WaterCrazyness;
+    mWaterFlowStepParameters.WaterDiffusionSpeedAdjustment = simulationParameters.WaterDiffusionSpeedAdjustment;
+}
+
+void Ship::UpdateWaterVelocities(size_t waterFlowPartitionIndex)
+{
+    //
+    // For each (non-ephemeral) point in the partition, move each spring's outgoing water momentum to
+    // its destination point
+    //
+    // Implementation of https://gabrielegiuseppini.wordpress.com/2018/09/08/momentum-based-simulation-of-water-flooding-2d-spaces/
+    //
+    // Destination points may belong to other partitions, hence each partition accumulates
+    // water deltas and momenta into its own buffers, which are merged back at the end
+    //
+
+    auto & partition = mWaterFlowPartitions[waterFlowPartitionIndex];
+
+    // Source water buffer, and result water delta buffer
+    float const * restrict oldPointWaterBufferData = mPoints.GetWaterBufferAsFloat();
+    float * restrict newPointWaterBufferData = mPoints.GetParallelWaterBuffer(waterFlowPartitionIndex);
+    vec2f const * restrict oldPointWaterVelocityBufferData = mPoints.GetWaterVelocityBufferAsVec2();
+    vec2f * restrict newPointWaterMomentumBufferData = mPoints.GetParallelWaterMomentumBuffer(waterFlowPartitionIndex);
+
+    float const waterCrazyness = mWaterFlowStepParameters.WaterCrazyness;
+    float const waterDiffusionSpeedAdjustment = mWaterFlowStepParameters.WaterDiffusionSpeedAdjustment;
+
+    // Weights of outbound water flows along each spring, including impermeable ones;
+    // set to zero for springs whose resultant scalar water velocities are
+    // directed towards the point being visited
+    std::array<float, SimulationParameters::MaxSpringsPerPoint> springOutboundWaterFlowWeights;
+
+    // Total weight
+    float totalOutboundWaterFlowWeight;
+
+    // Resultant water velocities along each spring
+    std::array<vec2f, SimulationParameters::MaxSpringsPerPoint> springOutboundWaterVelocities;
+
+    // Water splashed in this partition
+    float waterSplashed = 0.0f;
+
+    //
+    // Quantities for water kinetic energy loss, used
+    // only for sound
+    //
+    // Not on Mobile (as it's a small feature that costs a lot!)
+    //
+
+#if !FS_IS_PLATFORM_MOBILE()
+    float const * restrict pointFreenessFactorBufferData = mWaterFlowStepParameters.PointFreenessFactorBuffer->data();
+
+    // Count of non-hull free and drowned neighbor points for a given point
+    float pointSplashNeighbors;
+    float pointSplashFreeNeighbors;
 
     // Kinetic energy lost for a given point
     float pointKineticEnergyLoss;
@@ -2582,7 +2610,7 @@ void Ship::UpdateWaterVelocities(
     // No need to visit ephemeral points as they have no springs
     //
 
-    for (auto pointIndex : mPoints.RawShipPoints())
+    for (ElementIndex pointIndex = partition.StartPointIndex; pointIndex < partition.EndPointIndex; ++pointIndex)
     {
         //
         // 1) Calculate water momenta along *all* springs connected to this point,
@@ -2597,7 +2625,7 @@ void Ship::UpdateWaterVelocities(
         // WaterCrazyness=0   -> alpha=1
         // WaterCrazyness=0.5 -> alpha=0.5 + 0.5*Wh
         // WaterCrazyness=1   -> alpha=Wh
-        float const alphaCrazyness = 1.0f + simulationParameters.WaterCrazyness * (oldPointWaterBufferData[pointIndex] - 1.0f);
+        float const alphaCrazyness = 1.0f + waterCrazyness * (oldPointWaterBufferData[pointIndex] - 1.0f);
 
 #if !FS_IS_PLATFORM_MOBILE()
         pointSplashNeighbors = 0.0f;
@@ -2697,7 +2725,7 @@ void Ship::UpdateWaterVelocities(
         {
             waterQuantityNormalizationFactor =
                 oldPointWaterBufferData[pointIndex]
-                * mPoints.GetMaterialWaterDiffusionSpeed(pointIndex) * simulationParameters.WaterDiffusionSpeedAdjustment
+                * mPoints.GetMaterialWaterDiffusionSpeed(pointIndex) * waterDiffusionSpeedAdjustment
                 / totalOutboundWaterFlowWeight;
         }
 
@@ -2828,20 +2856,83 @@ void Ship::UpdateWaterVelocities(
 #endif
     }
 
+    partition.WaterSplashed = waterSplashed;
+}
+
+void Ship::MergeWaterFlows(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
+{
+    float const * restrict const oldWaterBufferData = mPoints.GetWaterBufferAsFloat();
+    float * restrict const newWaterBufferData = mPoints.GetWaterBackBufferAsFloat();
+    vec2f * restrict const waterMomentumBufferData = mPoints.GetParallelWaterMomentumBuffer(0);
+
+    // First partition: initializes new water
+    {
+        float * restrict const partitionWaterBufferData = mPoints.GetParallelWaterBuffer(0);
+
+        for (ElementIndex p = startPointIndex; p < endPointIndex; ++p)
+        {
+            newWaterBufferData[p] = oldWaterBufferData[p] + partitionWaterBufferData[p];
+
+            // Zero partition's buffer for next run
+            partitionWaterBufferData[p] = 0.0f;
+        }
+    }
+
+    // Other partitions
+    for (size_t t = 1; t < mWaterFlowPartitions.size(); ++t)
+    {
+        float * restrict const partitionWaterBufferData = mPoints.GetParallelWaterBuffer(t);
+        vec2f * restrict const partitionWaterMomentumBufferData = mPoints.GetParallelWaterMomentumBuffer(t);
+
+        for (ElementIndex p = startPointIndex; p < endPointIndex; ++p)
+        {
+            newWaterBufferData[p] += partitionWaterBufferData[p];
+            waterMomentumBufferData[p] += partitionWaterMomentumBufferData[p];
+
+            // Zero partition's buffers for next run
+            partitionWaterBufferData[p] = 0.0f;
+            partitionWaterMomentumBufferData[p] = vec2f::zero();
+        }
+    }
+}
+
+float Ship::CompleteWaterFlow(ThreadManager & threadManager)
+{
+    //
+    // Merge partitions' water and momenta, and make new water current
+    //
+
+    threadManager.GetSimulationThreadPool().Run(mWaterFlowMergeTasks);
+
+    mPoints.SwapWaterBuffers();
+
+    // Release step buffers
+    mWaterFlowStepParameters.PointFreenessFactorBuffer.reset();
+
+    float waterSplashed = 0.0f;
+
 #if !FS_IS_PLATFORM_MOBILE()
     //
     // Average kinetic energy loss
     //
 
+    for (auto const & partition : mWaterFlowPartitions)
+    {
+        waterSplashed += partition.WaterSplashed;
+    }
+
     waterSplashed = mWaterSplashedRunningAverage.Update(waterSplashed);
 #endif
 
-
     //
     // Transforming momenta into velocities
     //
 
     mPoints.UpdateWaterVelocitiesFromMomenta();
+
+    return waterSplashed;
 }
 
 void Ship::UpdateSinking(float currentSimulationTime)
@@ -2863,7 +2954,11 @@ void Ship::UpdateSinking(float currentSimulationTime)
         if (wetPointCount > mPoints.GetRawShipPointCount() * 3 / 10 + mPoints.GetTotalFactoryWetPoints()) // High watermark
         {
             // Started sinking
-            mParentWorld.GetNpcs().OnShipStartedSinking(mId, currentSimulationTime); // Tell NPCs
+            {
+                auto const lock = mParentWorld.LockForShipSideEffects();
+                mParentWorld.GetNpcs().OnShipStartedSinking(mId, currentSimulationTime); // Tell NPCs
+            }
+
             mSimulationEventHandler.OnSinkingBegin(mId);
             mIsSinking = true;
         }
@@ -2925,6 +3020,19 @@ void Ship::RecalculateLightDiffusionParallelism(size_t simulationParallelism)
         mLightDiffusionTasks.emplace_back(
             [this, pointStart, pointEnd]()
             {
+                if (mIsLightDiffusionBinned)
+                {
+                    Algorithms::DiffuseLight_Binned(
+                        pointStart,
+                        pointEnd,
+                        mPoints.GetPositionBufferAsVec2(),
+                        mPoints.GetPlaneIdBufferAsPlaneId(),
+                        mLampGrid,
+                        mPoints.GetLightBufferAsFloat());
+
+                    return;
+                }
+
                 Algorithms::DiffuseLight(
                     pointStart,
                     pointEnd,
@@ -2942,9 +3050,7 @@ void Ship::RecalculateLightDiffusionParallelism(size_t simulationParallelism)
     }
 }
 
-void Ship::DiffuseLight(
-    SimulationParameters const & simulationParameters,
-    ThreadManager & threadManager)
+void Ship::DiffuseLight(ThreadManager & threadManager)
 {
     //
     // Diffuse light from each lamp to all points on the same or lower plane ID,
@@ -2952,8 +3058,7 @@ void Ship::DiffuseLight(
     //
 
     // Shortcut
-    if (mElectricalElements.Lamps().empty()
-        || (simulationParameters.LuminiscenceAdjustment == 0.0f && mLastLuminiscenceAdjustmentDiffused == 0.0f))
+    if (mElectricalElements.Lamps().empty())
     {
         return;
     }
@@ -2980,45 +3085,204 @@ void Ship::DiffuseLight(
     }
 
     //
-    // 2. Diffuse light
+    // 2. Bin lit lamps
+    //
+    // Lamps light a small area of the ship each, hence with many lamps we only want
+    // to visit - for each point - the lamps near it; with few lamps, visiting all
+    // of them with the vectorized algorithm is cheaper than binning.
+    //
+    // Note: binning also skips the work for lamps that are not lit - e.g. because
+    // they're off, or because luminiscence adjustment is zero - and either way we
+    // skip the work altogether when no lamp is lit
+    //
+
+    ElementCount constexpr MinLampCountForBinning = 8; // Break-even, as measured by the DiffuseLight_Ship_* benchmarks
+
+    float const * const lampSpreadMaxDistances = mElectricalElements.GetLampLightSpreadMaxDistanceBufferAsFloat();
+
+    mIsLightDiffusionBinned = (lampCount >= MinLampCountForBinning);
+
+    bool areLampsLit;
+    if (mIsLightDiffusionBinned)
+    {
+        mLampGrid.Rebuild(
+            lampPositions.data(),
+            lampPlaneIds.data(),
+            lampDistanceCoeffs.data(),
+            lampSpreadMaxDistances,
+            lampCount);
+
+        areLampsLit = (mLampGrid.GetLitLampCount() > 0);
+    }
+    else
+    {
+        // Same criterion as the grid's
+        areLampsLit = false;
+        for (ElementIndex l = 0; l < lampCount; ++l)
+        {
+            if (lampDistanceCoeffs[l] > 0.0f && lampSpreadMaxDistances[l] > 0.0f)
+            {
+                areLampsLit = true;
+                break;
+            }
+        }
+    }
+
+    if (!areLampsLit && !mWereLampsLitAtLastLightDiffusion)
+    {
+        // Light buffer is already zero
+        return;
+    }
+
+    //
+    // 3. Diffuse light
     //
 
     threadManager.GetSimulationThreadPool().Run(mLightDiffusionTasks);
 
-    // Remember that we've diffused light with this luminiscence adjustment
-    mLastLuminiscenceAdjustmentDiffused = simulationParameters.LuminiscenceAdjustment;
+    // Remember whether we've diffused light from any lamp
+    mWereLampsLitAtLastLightDiffusion = areLampsLit;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////
 // Heat
 ///////////////////////////////////////////////////////////////////////////////////
 
+void Ship::RecalculateHeatPropagationParallelism(size_t simulationParallelism)
+{
+    // Clear threading state
+    mHeatOutflowNormalizationTasks.clear();
+    mHeatTransferAndDissipationTasks.clear();
+
+    //
+    // Given the available simulation parallelism as a constraint (max), calculate
+    // the best parallelism for the heat propagation algorithm
+    //
+
+    ElementCount const numberOfPoints = mPoints.GetElementCount(); // Ephemerals included, as they dissipate heat
+
+    ElementCount constexpr PointsPerThread = 2000;
+
+    size_t const heatPropagationParallelism = std::max(
+        std::min(static_cast<size_t>(numberOfPoints) / PointsPerThread, simulationParallelism),
+        size_t(1));
+
+    LogMessage("Ship::RecalculateHeatPropagationParallelism: points=", numberOfPoints, " simulationParallelism=", simulationParallelism,
+        " heatPropagationParallelism=", heatPropagationParallelism);
+
+    //
+    // Prepare tasks
+    //
+    // We want each thread to work on a multiple of our vectorization word size
+    //
+
+    assert(numberOfPoints >= static_cast<ElementCount>(heatPropagationParallelism) * vectorization_float_count<ElementCount>);
+    ElementCount const numberOfVecPointsPerThread = numberOfPoints / (static_cast<ElementCount>(heatPropagationParallelism) * vectorization_float_count<ElementCount>);
+
+    ElementIndex pointStart = 0;
+    for (size_t t = 0; t < heatPropagationParallelism; ++t)
+    {
+        ElementIndex const pointEnd = (t < heatPropagationParallelism - 1)
+            ? pointStart + numberOfVecPointsPerThread * vectorization_float_count<ElementCount>
+            : numberOfPoints;
+
+        assert(((pointEnd - pointStart) % vectorization_float_count<ElementCount>) == 0);
+
+        mHeatOutflowNormalizationTasks.emplace_back(
+            [this, pointStart, pointEnd]()
+            {
+                CalculateHeatOutflowNormalizationFactors(pointStart, pointEnd);
+            });
+
+        mHeatTransferAndDissipationTasks.emplace_back(
+            [this, pointStart, pointEnd]()
+            {
+                TransferAndDissipateHeat(pointStart, pointEnd);
+            });
+
+        pointStart = pointEnd;
+    }
+}
+
 void Ship::PropagateHeat(
     float /*currentSimulationTime*/,
     float dt,
     Storm::Parameters const & stormParameters,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     //
     // Propagate temperature (via heat), and dissipate temperature
     //
+    // Heat flows along each spring from the hotter to the colder endpoint, and the
+    // total heat leaving a point is normalized so that its temperature won't go
+    // below zero (Kelvin).
+    //
+    // We formulate this as a gather, so that each point only writes its own
+    // temperature and we may split points among threads:
+    //  1. Calculate the outflow normalization factor of each point;
+    //  2. Calculate each point's new temperature from its inflows - normalized with
+    //     the factors of the points they come from - and its normalized outflows,
+    //     and dissipate its heat into the environment.
+    //
+
+    // Temperatures are read from the temperature buffer, and the results are
+    // written into the temperature back buffer, which is then made current
+
+    //
+    // Prepare step parameters
+    //
 
-    // Source and result temperature buffers
-    auto oldPointTemperatureBuffer = mPoints.MakeTemperatureBufferCopy();
-    float const * restrict const oldPointTemperatureBufferData = oldPointTemperatureBuffer->data();
-    float * restrict const newPointTemperatureBufferData = mPoints.GetTemperatureBufferAsFloat();
+    mHeatPropagationStepParameters.ThermalConductivityFactor =
+        simulationParameters.ThermalConductivityAdjustment
+        * dt;
 
-    // Outbound heat flows along each spring
-    std::array<float, SimulationParameters::MaxSpringsPerPoint> springOutboundHeatFlows;
+    mHeatPropagationStepParameters.EffectiveWaterConvectiveHeatTransferCoefficient =
+        SimulationParameters::WaterConvectiveHeatTransferCoefficient
+        * dt
+        * simulationParameters.HeatDissipationAdjustment
+        * 2.0f; // We exaggerate a bit to take into account water wetting the material and thus making it more difficult for fire to re-kindle
+
+    // We include rain in air
+    mHeatPropagationStepParameters.EffectiveAirConvectiveHeatTransferCoefficient =
+        SimulationParameters::AirConvectiveHeatTransferCoefficient
+        * dt
+        * simulationParameters.HeatDissipationAdjustment
+        + FastPow(stormParameters.RainDensity, 0.3f) * mHeatPropagationStepParameters.EffectiveWaterConvectiveHeatTransferCoefficient;
+
+    mHeatPropagationStepParameters.SurfaceWaterTemperature = simulationParameters.WaterTemperature;
+
+    mHeatPropagationStepParameters.AirTemperature =
+        simulationParameters.AirTemperature
+        + stormParameters.AirTemperatureDelta;
 
     //
-    // Visit all non-ephemeral points
+    // Run phases
+    //
+
+    threadManager.GetSimulationThreadPool().Run(mHeatOutflowNormalizationTasks);
+
+    threadManager.GetSimulationThreadPool().Run(mHeatTransferAndDissipationTasks);
+
+    mPoints.SwapTemperatureBuffers();
+}
+
+void Ship::CalculateHeatOutflowNormalizationFactors(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
+{
+    float const * restrict const oldPointTemperatureBufferData = mPoints.GetTemperatureBufferAsFloat();
+    float * restrict const normalizationFactorBufferData = mHeatOutflowNormalizationFactorBuffer.data();
+    float const thermalConductivityFactor = mHeatPropagationStepParameters.ThermalConductivityFactor;
+
     //
-    // No particular reason to not do ephemeral points as well - it's just
-    // that at the moment ephemeral particles are not connected to each other
+    // Visit all points in the partition
+    //
+    // Ephemeral points are not connected to each other at the moment, hence
+    // they'll just end up with no outflows
     //
 
-    for (auto pointIndex : mPoints.RawShipPoints())
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
     {
         // Temperature of this point
         float const pointTemperature = oldPointTemperatureBufferData[pointIndex];
@@ -3030,28 +3294,17 @@ void Ship::PropagateHeat(
         float totalOutgoingHeat = 0.0f;
 
         // Visit all springs
-        size_t const connectedSpringCount = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size();
-        for (size_t s = 0; s < connectedSpringCount; ++s)
+        for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
         {
-            auto const & cs = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings[s];
-
             // Calculate outgoing heat flow per unit of time
             //
             // q = Ki * (Tp - Tpi) * dt / Li
-            float const outgoingHeatFlow =
-                mSprings.GetMaterialThermalConductivity(cs.SpringIndex) * simulationParameters.ThermalConductivityAdjustment
+            totalOutgoingHeat +=
+                mSprings.GetMaterialThermalConductivity(cs.SpringIndex) * thermalConductivityFactor
                 * std::max(pointTemperature - oldPointTemperatureBufferData[cs.OtherEndpointIndex], 0.0f) // DeltaT, positive if going out
-                * dt
                 / mSprings.GetFactoryRestLength(cs.SpringIndex);
-
-            // Store flow
-            springOutboundHeatFlows[s] = outgoingHeatFlow;
-
-            // Update total outgoing heat
-            totalOutgoingHeat += outgoingHeatFlow;
         }
 
-
         //
         // 2) Calculate normalization factor - to ensure that point's temperature won't go below zero (Kelvin)
         //
@@ -3073,58 +3326,73 @@ void Ship::PropagateHeat(
             normalizationFactor = 0.0f;
         }
 
-
-        //
-        // 3) Transfer outgoing heat, lowering temperature of point and increasing temperature of target points
-        //
-
-        for (size_t s = 0; s < connectedSpringCount; ++s)
-        {
-            auto const & cs = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings[s];
-
-            // Raise target temperature due to this flow
-            newPointTemperatureBufferData[cs.OtherEndpointIndex] +=
-                springOutboundHeatFlows[s] * normalizationFactor
-                * mPoints.GetMaterialHeatCapacityReciprocal(cs.OtherEndpointIndex);
-        }
-
-        // Update point's temperature due to total flow
-        newPointTemperatureBufferData[pointIndex] -=
-            totalOutgoingHeat * normalizationFactor
-            * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
+        normalizationFactorBufferData[pointIndex] = normalizationFactor;
     }
+}
 
-    //
-    // Dissipate heat
-    //
+void Ship::TransferAndDissipateHeat(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
+{
+    float const * restrict const oldPointTemperatureBufferData = mPoints.GetTemperatureBufferAsFloat();
+    float const * restrict const normalizationFactorBufferData = mHeatOutflowNormalizationFactorBuffer.data();
+    float * restrict const newPointTemperatureBufferData = mPoints.GetTemperatureBackBufferAsFloat();
+    float const thermalConductivityFactor = mHeatPropagationStepParameters.ThermalConductivityFactor;
 
-    float const effectiveWaterConvectiveHeatTransferCoefficient =
-        SimulationParameters::WaterConvectiveHeatTransferCoefficient
-        * dt
-        * simulationParameters.HeatDissipationAdjustment
-        * 2.0f; // We exaggerate a bit to take into account water wetting the material and thus making it more difficult for fire to re-kindle
+    float const effectiveWaterConvectiveHeatTransferCoefficient = mHeatPropagationStepParameters.EffectiveWaterConvectiveHeatTransferCoefficient;
+    float const effectiveAirConvectiveHeatTransferCoefficient = mHeatPropagationStepParameters.EffectiveAirConvectiveHeatTransferCoefficient;
 
     // Water temperature
     // We approximate the thermocline as a linear decrease of
     // temperature: 15 degrees in MaxSeaDepth meters
-    float const surfaceWaterTemperature = simulationParameters.WaterTemperature;
+    float const surfaceWaterTemperature = mHeatPropagationStepParameters.SurfaceWaterTemperature;
     float constexpr ThermoclineSlope = -15.0f / SimulationParameters::MaxSeaDepth;
 
-    // We include rain in air
-    float const effectiveAirConvectiveHeatTransferCoefficient =
-        SimulationParameters::AirConvectiveHeatTransferCoefficient
-        * dt
-        * simulationParameters.HeatDissipationAdjustment
-        + FastPow(stormParameters.RainDensity, 0.3f) * effectiveWaterConvectiveHeatTransferCoefficient;
-
-    float const airTemperature =
-        simulationParameters.AirTemperature
-        + stormParameters.AirTemperatureDelta;
+    float const airTemperature = mHeatPropagationStepParameters.AirTemperature;
 
-    // We also include ephemeral points, as they may be heated
-    // and have a temperature
-    for (auto pointIndex : mPoints)
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
     {
+        //
+        // Propagate heat
+        //
+
+        // Temperature of this point
+        float const pointTemperature = oldPointTemperatureBufferData[pointIndex];
+
+        float totalIncomingHeat = 0.0f;
+        float totalOutgoingHeat = 0.0f;
+
+        for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
+        {
+            // q = Ki * (Tpi - Tp) * dt / Li
+            float const deltaT = oldPointTemperatureBufferData[cs.OtherEndpointIndex] - pointTemperature; // Positive if coming in
+
+            float const springConductance =
+                mSprings.GetMaterialThermalConductivity(cs.SpringIndex) * thermalConductivityFactor
+                / mSprings.GetFactoryRestLength(cs.SpringIndex);
+
+            if (deltaT > 0.0f)
+            {
+                // Incoming flow, normalized by the other endpoint
+                totalIncomingHeat +=
+                    springConductance * deltaT
+                    * normalizationFactorBufferData[cs.OtherEndpointIndex];
+            }
+            else
+            {
+                totalOutgoingHeat += springConductance * (-deltaT);
+            }
+        }
+
+        float temperature =
+            pointTemperature
+            + (totalIncomingHeat - totalOutgoingHeat * normalizationFactorBufferData[pointIndex])
+            * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
+
+        //
+        // Dissipate heat
+        //
+
         float deltaT; // Temperature delta (particle - env)
         float heatLost; // Heat lost in this time quantum (positive when outgoing)
 
@@ -3133,13 +3401,13 @@ void Ship::PropagateHeat(
         {
             // Dissipation in water
             float const waterTemperature = surfaceWaterTemperature - Clamp(mPoints.GetPosition(pointIndex).y * ThermoclineSlope, 0.0f, surfaceWaterTemperature);
-            deltaT = newPointTemperatureBufferData[pointIndex] - waterTemperature;
+            deltaT = temperature - waterTemperature;
             heatLost = effectiveWaterConvectiveHeatTransferCoefficient * deltaT;
         }
         else
         {
             // Dissipation in air
-            deltaT = newPointTemperatureBufferData[pointIndex] - airTemperature;
+            deltaT = temperature - airTemperature;
             heatLost = effectiveAirConvectiveHeatTransferCoefficient * deltaT;
         }
 
@@ -3149,14 +3417,14 @@ void Ship::PropagateHeat(
         // Remove this heat from the point, making sure we don't overshoot
         if (deltaT >= 0)
         {
-            newPointTemperatureBufferData[pointIndex] -=
-                std::min(dissipationDeltaT, deltaT);
+            temperature -= std::min(dissipationDeltaT, deltaT);
         }
         else
         {
-            newPointTemperatureBufferData[pointIndex] -=
-                std::max(dissipationDeltaT, deltaT);
+            temperature -= std::max(dissipationDeltaT, deltaT);
         }
+
+        newPointTemperatureBufferData[pointIndex] = temperature;
     }
 }
 
@@ -3260,23 +3528,75 @@ void Ship::UpdateForSimulationParameters(
     ThreadManager & threadManager)
 {
     size_t const simulationParallelism = threadManager.GetSimulationParallelism();
-    if (simulationParallelism != mCurrentSimulationParallelism
-        || simulationParameters.SpringRelaxationParallelComputationMode != mCurrentSpringRelaxationParallelComputationMode)
+    bool const hasSimulationParallelismChanged = (simulationParallelism != mCurrentSimulationParallelism);
+
+    // The full-speed and hybrid modes have their tasks wait for each other, hence they need
+    // all of their tasks running at the same time; alongside other ships - which do the same -
+    // we can't count on that, while step-by-step tasks never wait for each other
+    SpringRelaxationParallelComputationModeType const springRelaxationParallelComputationMode = mParentWorld.AreShipsUpdatingAlongsideEachOther()
+        ? SpringRelaxationParallelComputationModeType::StepByStep
+        : simulationParameters.SpringRelaxationParallelComputationMode;
+
+    if (hasSimulationParallelismChanged
+        || springRelaxationParallelComputationMode != mCurrentSpringRelaxationParallelComputationMode)
     {
         // Re-calculate spring relaxation parallelism
-        RecalculateSpringRelaxationParallelism(simulationParallelism, simulationParameters);
+        RecalculateSpringRelaxationParallelism(simulationParallelism, springRelaxationParallelComputationMode, simulationParameters);
 
         // Re-calculate light diffusion parallelism
         RecalculateLightDiffusionParallelism(simulationParallelism);
 
+        // Re-calculate heat propagation parallelism
+        RecalculateHeatPropagationParallelism(simulationParallelism);
+
         // Remember new values
-        mCurrentSimulationParallelism = simulationParallelism;
-        mCurrentSpringRelaxationParallelComputationMode = simulationParameters.SpringRelaxationParallelComputationMode;
+        mCurrentSpringRelaxationParallelComputationMode = springRelaxationParallelComputationMode;
     }
+
+    if (hasSimulationParallelismChanged
+        || simulationParameters.DoParallelWaterFlow != mCurrentDoParallelWaterFlow)
+    {
+        // Re-calculate water flow parallelism
+        RecalculateWaterFlowParallelism(simulationParallelism, simulationParameters);
+
+        // Remember new values
+        mCurrentDoParallelWaterFlow = simulationParameters.DoParallelWaterFlow;
+    }
+
+    mCurrentSimulationParallelism = simulationParallelism;
 }
 
 //#define RENDER_FLOOD_DISTANCE
 
+void Ship::UpdateConnectivity()
+{
+    //
+    // Connectivity only changes because of springs being destroyed or restored.
+    //
+    // We re-label incrementally the components split by destroyed springs; restored
+    // springs - coming from repairs, which mostly re-join pieces to the largest
+    // component - are left to a full visit, as would most of a large batch of changes.
+    //
+
+    if (!mCanUpdateConnectivityIncrementally
+        || mConnectivityDirtyPoints.size() > static_cast<size_t>(mPoints.GetRawShipPointCount() / 4))
+    {
+        RunConnectivityVisit();
+    }
+    else
+    {
+        RunIncrementalConnectivityUpdate();
+
+#ifdef _DEBUG
+        VerifyConnectivity();
+#endif
+    }
+
+    mConnectivityDirtyPoints.clear();
+    mConnectivityPlaneTriangleCountChanges.assign(mPlaneTriangleIndicesToRender.size() - 1, 0);
+    mCanUpdateConnectivityIncrementally = true;
+}
+
 void Ship::RunConnectivityVisit()
 {
     //
@@ -3331,142 +3651,518 @@ void Ship::RunConnectivityVisit()
     // Visit all non-ephemeral points
     for (auto pointIndex : mPoints.RawShipPointsReverse())
     {
-        // Don't re-visit already-visited points
-        if (mPoints.GetCurrentConnectivityVisitSequenceNumber(pointIndex) != visitSequenceNumber)
-        {
-            //
-            // Flood a new plane from this point
-            //
+        // Don't re-visit already-visited points
+        if (mPoints.GetCurrentConnectivityVisitSequenceNumber(pointIndex) != visitSequenceNumber)
+        {
+            //
+            // Flood a new plane from this point
+            //
+
+            // Visit this point first
+            mPoints.SetPlaneId(pointIndex, currentPlaneId, currentPlaneIdFloat);
+            mPoints.SetConnectedComponentId(pointIndex, static_cast<ConnectedComponentId>(currentPlaneId));
+            mPoints.SetCurrentConnectivityVisitSequenceNumber(pointIndex, visitSequenceNumber);
+
+            // Add point to queue
+            assert(pointsToPropagateFrom.empty());
+            pointsToPropagateFrom.push(pointIndex);
+
+            // Visit all points reachable from this point via springs
+            while (!pointsToPropagateFrom.empty())
+            {
+                // Pop point that we have to propagate from
+                auto const currentPointIndex = pointsToPropagateFrom.front();
+                pointsToPropagateFrom.pop();
+
+                // This point has been visited already
+                assert(visitSequenceNumber == mPoints.GetCurrentConnectivityVisitSequenceNumber(currentPointIndex));
+
+#ifdef RENDER_FLOOD_DISTANCE
+                if (!floodDistanceColor)
+                {
+                    mPoints.GetColor(currentPointIndex) = vec4f(0.0f, 0.0f, 0.75f, 1.0f);
+                    floodDistanceColor = 0.0f;
+                }
+                else
+                    mPoints.GetColor(currentPointIndex) = vec4f(*floodDistanceColor, 0.0f, 0.0f, 1.0f);
+                floodDistanceColor = *floodDistanceColor + 1.0f / 128.0f;
+                if (*floodDistanceColor > 1.0f)
+                    floodDistanceColor = 0.0f;
+#endif
+
+                // Visit all its non-visited connected points
+                for (auto const & cs : mPoints.GetConnectedSprings(currentPointIndex).ConnectedSprings)
+                {
+                    if (visitSequenceNumber != mPoints.GetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex))
+                    {
+                        //
+                        // Visit point
+                        //
+
+                        mPoints.SetPlaneId(cs.OtherEndpointIndex, currentPlaneId, currentPlaneIdFloat);
+                        mPoints.SetConnectedComponentId(cs.OtherEndpointIndex, static_cast<ConnectedComponentId>(currentPlaneId));
+                        mPoints.SetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex, visitSequenceNumber);
+
+                        // Add point to queue
+                        pointsToPropagateFrom.push(cs.OtherEndpointIndex);
+
+                        // Update count of points in this connected component
+                        ++currentConnectedComponentPointCount;
+                    }
+                }
+
+                // Update count of triangles with this points's triangles
+                totalPlaneTrianglesCount += mPoints.GetConnectedOwnedTrianglesCount(currentPointIndex);
+            }
+
+            //
+            // Now, if we have visited a ral connected component (i.e. > 1 particles, implying there's
+            // at least one spring and thus a component), store its information and start a new connected
+            // component; otherwise, hold on to this plane, eventually adding more to it
+            //
+
+            if (currentConnectedComponentPointCount > 1)
+            {
+                // Remember count of points in this connected component
+                assert(mConnectedComponentSizes.size() == static_cast<size_t>(currentPlaneId));
+                mConnectedComponentSizes.push_back(currentConnectedComponentPointCount);
+
+                // Remember the starting index of the triangles in the next plane
+                assert(mPlaneTriangleIndicesToRender.size() == static_cast<size_t>(currentPlaneId + 1));
+                mPlaneTriangleIndicesToRender.push_back(totalPlaneTrianglesCount);
+
+                //
+                // Flood completed
+                //
+
+                // Remember max plane ID ever
+                mMaxMaxPlaneId = std::max(mMaxMaxPlaneId, currentPlaneId);
+
+                // Next we begin a new plane and connected component
+                ++currentPlaneId;
+                currentPlaneIdFloat = static_cast<float>(currentPlaneId);
+
+                // Initialize count of points in the new connected component
+                currentConnectedComponentPointCount = 1;
+
+                // No more deferred points
+                hasUnfinalizedConnectedComponent = false;
+            }
+            else
+            {
+                // Keep going, remembering that we are accumulating
+                hasUnfinalizedConnectedComponent = true;
+            }
+        }
+    }
+
+    if (hasUnfinalizedConnectedComponent)
+    {
+        //
+        // Finalize last connected component
+        //
+
+        // Remember count of points in this connected component
+        assert(mConnectedComponentSizes.size() == static_cast<size_t>(currentPlaneId));
+        mConnectedComponentSizes.push_back(currentConnectedComponentPointCount);
+
+        // Remember the starting index of the triangles in the next plane
+        assert(mPlaneTriangleIndicesToRender.size() == static_cast<size_t>(currentPlaneId + 1));
+        mPlaneTriangleIndicesToRender.push_back(totalPlaneTrianglesCount);
+
+        // Remember max plane ID ever
+        mMaxMaxPlaneId = std::max(mMaxMaxPlaneId, currentPlaneId);
+    }
+
+#ifdef RENDER_FLOOD_DISTANCE
+    // Remember colors are dirty
+    mPoints.MarkColorBufferAsDirty();
+#endif
+
+    // Remember non-ephemeral portion of plane IDs is dirty
+    mPoints.MarkPlaneIdBufferNonEphemeralAsDirty();
+
+    //
+    // Re-order burning points, as their plane IDs might have changed
+    //
+
+    mPoints.ReorderBurningPointsForDepth();
+}
+
+void Ship::RunIncrementalConnectivityUpdate()
+{
+    //
+    // Here we re-label the points of the connected components that might have been split by
+    // destroyed springs, leaving all other points untouched.
+    //
+    // At the last update each component had its own plane ID, except for orphaned points, which
+    // are free to share the plane ID of any component. Here we only look at the non-orphaned
+    // endpoints of the destroyed springs: each piece of a split component is bound to contain one
+    // of them, hence for each plane with two or more of these points we search for its pieces,
+    // and assign new plane IDs to all pieces but one.
+    //
+    // If any component has been split, or any point orphaned, we then re-number all planes the
+    // way a full visit would, so that the result - including the z-order of the pieces - is the
+    // same as if we had run one. Otherwise - as with most breaks - planes stay as they are, and we
+    // only need to account for the triangles that have been destroyed or restored.
+    //
+
+    auto & seedPoints = mConnectivityDirtyPoints;
+
+    auto const orphanedPointsBegin = std::remove_if(
+        seedPoints.begin(),
+        seedPoints.end(),
+        [this](ElementIndex p)
+        {
+            return mPoints.GetConnectedSprings(p).ConnectedSprings.empty();
+        });
+
+    // Orphaned points leave their components, changing their sizes and possibly their order
+    bool const haveOrphanedPoints = (orphanedPointsBegin != seedPoints.end());
+
+    seedPoints.erase(orphanedPointsBegin, seedPoints.end());
+
+    std::sort(
+        seedPoints.begin(),
+        seedPoints.end(),
+        [this](ElementIndex l, ElementIndex r)
+        {
+            return mPoints.GetPlaneId(l) < mPoints.GetPlaneId(r)
+                || (mPoints.GetPlaneId(l) == mPoints.GetPlaneId(r) && l < r);
+        });
+
+    seedPoints.erase(
+        std::unique(seedPoints.begin(), seedPoints.end()),
+        seedPoints.end());
+
+    bool hasSplit = false;
+
+    for (size_t s = 0; s < seedPoints.size(); )
+    {
+        PlaneId const planeId = mPoints.GetPlaneId(seedPoints[s]);
+
+        size_t planeSeedPointCount = 1;
+        while (s + planeSeedPointCount < seedPoints.size() && mPoints.GetPlaneId(seedPoints[s + planeSeedPointCount]) == planeId)
+        {
+            ++planeSeedPointCount;
+        }
+
+        if (planeSeedPointCount > 1)
+        {
+            hasSplit |= SplitConnectedComponent(
+                &(seedPoints[s]),
+                planeSeedPointCount);
+        }
+
+        s += planeSeedPointCount;
+    }
+
+    bool haveLabelsChanged = hasSplit;
+
+    if (hasSplit || haveOrphanedPoints)
+    {
+        // Also re-calculates the triangles of each plane
+        haveLabelsChanged |= RenumberPlanes();
+    }
+    else
+    {
+        ApplyPlaneTriangleCountChanges();
+    }
+
+    if (haveLabelsChanged)
+    {
+        // Remember non-ephemeral portion of plane IDs is dirty
+        mPoints.MarkPlaneIdBufferNonEphemeralAsDirty();
+
+        //
+        // Re-order burning points, as their plane IDs might have changed
+        //
+
+        mPoints.ReorderBurningPointsForDepth();
+    }
+}
+
+bool Ship::SplitConnectedComponent(
+    ElementIndex const * seedPoints,
+    size_t seedPointCount)
+{
+    //
+    // We run one breadth-first search ("front") from each seed point, one step at a time for
+    // each front in turn. Fronts that meet are in the same piece, and form a group; a group whose
+    // fronts are all exhausted has visited a whole piece. We stop as soon as at most one group is
+    // left that is not exhausted, which then keeps the component's plane ID; hence we only ever
+    // visit (roughly) as many points as there are in the pieces that have been split off.
+    //
+
+    auto const visitSequenceNumber = ++mCurrentConnectivityVisitSequenceNumber;
+
+    auto const findGroup = [this](size_t f)
+    {
+        while (mConnectivitySearchFronts[f].Group != f)
+        {
+            mConnectivitySearchFronts[f].Group = mConnectivitySearchFronts[mConnectivitySearchFronts[f].Group].Group;
+            f = mConnectivitySearchFronts[f].Group;
+        }
+
+        return f;
+    };
+
+    //
+    // Start one front from each seed point
+    //
+
+    size_t const frontCount = seedPointCount;
+
+    if (mConnectivitySearchFronts.size() < frontCount)
+    {
+        mConnectivitySearchFronts.resize(frontCount);
+    }
+
+    for (size_t f = 0; f < frontCount; ++f)
+    {
+        auto & front = mConnectivitySearchFronts[f];
+        front.VisitedPoints.clear();
+        front.VisitedPoints.push_back(seedPoints[f]);
+        front.Head = 0;
+        front.Group = f;
+        front.GroupPendingFrontCount = 1;
+        front.GroupPointCount = 1;
+        front.GroupNewPlaneId = NonePlaneId;
+
+        mPoints.SetCurrentConnectivityVisitSequenceNumber(seedPoints[f], visitSequenceNumber);
+        mConnectivitySearchFrontIndices[seedPoints[f]] = f;
+    }
 
-            // Visit this point first
-            mPoints.SetPlaneId(pointIndex, currentPlaneId, currentPlaneIdFloat);
-            mPoints.SetConnectedComponentId(pointIndex, static_cast<ConnectedComponentId>(currentPlaneId));
-            mPoints.SetCurrentConnectivityVisitSequenceNumber(pointIndex, visitSequenceNumber);
+    size_t activeGroupCount = frontCount;
 
-            // Add point to queue
-            assert(pointsToPropagateFrom.empty());
-            pointsToPropagateFrom.push(pointIndex);
+    //
+    // Advance fronts
+    //
 
-            // Visit all points reachable from this point via springs
-            while (!pointsToPropagateFrom.empty())
+    while (activeGroupCount > 1)
+    {
+        for (size_t f = 0; f < frontCount && activeGroupCount > 1; ++f)
+        {
+            if (mConnectivitySearchFronts[f].Head == mConnectivitySearchFronts[f].VisitedPoints.size())
             {
-                // Pop point that we have to propagate from
-                auto const currentPointIndex = pointsToPropagateFrom.front();
-                pointsToPropagateFrom.pop();
+                // Exhausted already
+                continue;
+            }
 
-                // This point has been visited already
-                assert(visitSequenceNumber == mPoints.GetCurrentConnectivityVisitSequenceNumber(currentPointIndex));
+            ElementIndex const pointIndex = mConnectivitySearchFronts[f].VisitedPoints[mConnectivitySearchFronts[f].Head++];
 
-#ifdef RENDER_FLOOD_DISTANCE
-                if (!floodDistanceColor)
+            for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
+            {
+                if (mPoints.GetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex) != visitSequenceNumber)
                 {
-                    mPoints.GetColor(currentPointIndex) = vec4f(0.0f, 0.0f, 0.75f, 1.0f);
-                    floodDistanceColor = 0.0f;
+                    // Visit point
+                    mPoints.SetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex, visitSequenceNumber);
+                    mConnectivitySearchFrontIndices[cs.OtherEndpointIndex] = f;
+                    mConnectivitySearchFronts[f].VisitedPoints.push_back(cs.OtherEndpointIndex);
+                    ++(mConnectivitySearchFronts[findGroup(f)].GroupPointCount);
                 }
                 else
-                    mPoints.GetColor(currentPointIndex) = vec4f(*floodDistanceColor, 0.0f, 0.0f, 1.0f);
-                floodDistanceColor = *floodDistanceColor + 1.0f / 128.0f;
-                if (*floodDistanceColor > 1.0f)
-                    floodDistanceColor = 0.0f;
-#endif
-
-                // Visit all its non-visited connected points
-                for (auto const & cs : mPoints.GetConnectedSprings(currentPointIndex).ConnectedSprings)
                 {
-                    if (visitSequenceNumber != mPoints.GetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex))
+                    // Fronts met, join their groups
+                    size_t const group = findGroup(f);
+                    size_t const otherGroup = findGroup(mConnectivitySearchFrontIndices[cs.OtherEndpointIndex]);
+                    if (otherGroup != group)
                     {
-                        //
-                        // Visit point
-                        //
-
-                        mPoints.SetPlaneId(cs.OtherEndpointIndex, currentPlaneId, currentPlaneIdFloat);
-                        mPoints.SetConnectedComponentId(cs.OtherEndpointIndex, static_cast<ConnectedComponentId>(currentPlaneId));
-                        mPoints.SetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex, visitSequenceNumber);
+                        // This group is not exhausted, as f is running; the other one can't be either,
+                        // or it would have met us already
+                        assert(mConnectivitySearchFronts[otherGroup].GroupPendingFrontCount > 0);
 
-                        // Add point to queue
-                        pointsToPropagateFrom.push(cs.OtherEndpointIndex);
+                        mConnectivitySearchFronts[otherGroup].Group = group;
+                        mConnectivitySearchFronts[group].GroupPendingFrontCount += mConnectivitySearchFronts[otherGroup].GroupPendingFrontCount;
+                        mConnectivitySearchFronts[group].GroupPointCount += mConnectivitySearchFronts[otherGroup].GroupPointCount;
 
-                        // Update count of points in this connected component
-                        ++currentConnectedComponentPointCount;
+                        --activeGroupCount;
                     }
                 }
+            }
 
-                // Update count of triangles with this points's triangles
-                totalPlaneTrianglesCount += mPoints.GetConnectedOwnedTrianglesCount(currentPointIndex);
+            if (mConnectivitySearchFronts[f].Head == mConnectivitySearchFronts[f].VisitedPoints.size())
+            {
+                // This front is now exhausted
+                size_t const group = findGroup(f);
+                assert(mConnectivitySearchFronts[group].GroupPendingFrontCount > 0);
+                if (--(mConnectivitySearchFronts[group].GroupPendingFrontCount) == 0)
+                {
+                    // ...and so is its group: we've visited a whole piece
+                    --activeGroupCount;
+                }
             }
+        }
+    }
 
-            //
-            // Now, if we have visited a ral connected component (i.e. > 1 particles, implying there's
-            // at least one spring and thus a component), store its information and start a new connected
-            // component; otherwise, hold on to this plane, eventually adding more to it
-            //
+    //
+    // Choose the group that keeps the plane ID: the one that's still running,
+    // if any, or else the largest one
+    //
 
-            if (currentConnectedComponentPointCount > 1)
-            {
-                // Remember count of points in this connected component
-                assert(mConnectedComponentSizes.size() == static_cast<size_t>(currentPlaneId));
-                mConnectedComponentSizes.push_back(currentConnectedComponentPointCount);
+    std::optional<size_t> keeperGroup;
+    for (size_t f = 0; f < frontCount; ++f)
+    {
+        if (findGroup(f) == f
+            && (!keeperGroup
+                || mConnectivitySearchFronts[f].GroupPendingFrontCount > 0
+                || (mConnectivitySearchFronts[*keeperGroup].GroupPendingFrontCount == 0
+                    && mConnectivitySearchFronts[f].GroupPointCount > mConnectivitySearchFronts[*keeperGroup].GroupPointCount)))
+        {
+            keeperGroup = f;
+        }
+    }
 
-                // Remember the starting index of the triangles in the next plane
-                assert(mPlaneTriangleIndicesToRender.size() == static_cast<size_t>(currentPlaneId + 1));
-                mPlaneTriangleIndicesToRender.push_back(totalPlaneTrianglesCount);
+    assert(keeperGroup.has_value());
 
-                //
-                // Flood completed
-                //
+    //
+    // Assign new plane IDs to all other groups
+    //
 
-                // Remember max plane ID ever
-                mMaxMaxPlaneId = std::max(mMaxMaxPlaneId, currentPlaneId);
+    bool hasSplit = false;
 
-                // Next we begin a new plane and connected component
-                ++currentPlaneId;
-                currentPlaneIdFloat = static_cast<float>(currentPlaneId);
+    for (size_t f = 0; f < frontCount; ++f)
+    {
+        size_t const group = findGroup(f);
+        if (group == *keeperGroup)
+        {
+            continue;
+        }
 
-                // Initialize count of points in the new connected component
-                currentConnectedComponentPointCount = 1;
+        assert(mConnectivitySearchFronts[group].GroupPendingFrontCount == 0);
 
-                // No more deferred points
-                hasUnfinalizedConnectedComponent = false;
-            }
-            else
+        if (mConnectivitySearchFronts[group].GroupNewPlaneId == NonePlaneId)
+        {
+            PlaneId const newPlaneId = static_cast<PlaneId>(mConnectedComponentSizes.size());
+            mConnectivitySearchFronts[group].GroupNewPlaneId = newPlaneId;
+
+            // Provisional - sizes and final plane IDs are settled by RenumberPlanes()
+            mConnectedComponentSizes.push_back(mConnectivitySearchFronts[group].GroupPointCount);
+
+            hasSplit = true;
+        }
+
+        PlaneId const newPlaneId = mConnectivitySearchFronts[group].GroupNewPlaneId;
+        float const newPlaneIdFloat = static_cast<float>(newPlaneId);
+
+        for (ElementIndex const pointIndex : mConnectivitySearchFronts[f].VisitedPoints)
+        {
+            mPoints.SetPlaneId(pointIndex, newPlaneId, newPlaneIdFloat);
+            mPoints.SetConnectedComponentId(pointIndex, static_cast<ConnectedComponentId>(newPlaneId));
+        }
+    }
+
+    return hasSplit;
+}
+
+bool Ship::RenumberPlanes()
+{
+    //
+    // Here we assign plane IDs in the same order as a full visit does: each component gets the
+    // next plane ID when we first meet one of its points while walking the points in reverse,
+    // and orphaned points get the plane ID of the next component we meet - or of an extra plane
+    // at the end, if there's none.
+    //
+    // We also piggyback this pass to re-calculate the sizes of the connected components, and
+    // the counts of triangles in each plane - each triangle belonging to the plane of its owner
+    // point (i.e. its point A).
+    //
+
+    size_t const oldPlaneCount = mConnectedComponentSizes.size();
+
+    // Each component has its own plane ID, hence we may only gain the extra plane for orphans
+    mConnectivityPlaneIdRemap.assign(oldPlaneCount, NonePlaneId);
+    mPlaneTriangleIndicesToRender.assign(oldPlaneCount + 2, 0);
+
+    mConnectedComponentSizes.clear();
+
+    PlaneId currentPlaneId = 0;
+    bool hasUnfinalizedConnectedComponent = false;
+    bool haveLabelsChanged = false;
+
+    for (auto pointIndex : mPoints.RawShipPointsReverse())
+    {
+        PlaneId const oldPlaneId = mPoints.GetPlaneId(pointIndex);
+        PlaneId newPlaneId;
+
+        if (mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.empty())
+        {
+            // Orphaned point, joins the next component
+            newPlaneId = currentPlaneId;
+            hasUnfinalizedConnectedComponent = true;
+        }
+        else
+        {
+            assert(oldPlaneId < oldPlaneCount);
+
+            if (mConnectivityPlaneIdRemap[oldPlaneId] == NonePlaneId)
             {
-                // Keep going, remembering that we are accumulating
-                hasUnfinalizedConnectedComponent = true;
+                // First point of this component
+                mConnectivityPlaneIdRemap[oldPlaneId] = currentPlaneId;
+                mConnectedComponentSizes.push_back(0);
+
+                ++currentPlaneId;
+                hasUnfinalizedConnectedComponent = false;
             }
+
+            newPlaneId = mConnectivityPlaneIdRemap[oldPlaneId];
+
+            ++(mConnectedComponentSizes[newPlaneId]);
+        }
+
+        if (newPlaneId != oldPlaneId)
+        {
+            mPoints.SetPlaneId(pointIndex, newPlaneId, static_cast<float>(newPlaneId));
+            mPoints.SetConnectedComponentId(pointIndex, static_cast<ConnectedComponentId>(newPlaneId));
+
+            haveLabelsChanged = true;
         }
+
+        mPlaneTriangleIndicesToRender[newPlaneId + 1] += mPoints.GetConnectedOwnedTrianglesCount(pointIndex);
     }
 
     if (hasUnfinalizedConnectedComponent)
     {
-        //
-        // Finalize last connected component
-        //
-
-        // Remember count of points in this connected component
-        assert(mConnectedComponentSizes.size() == static_cast<size_t>(currentPlaneId));
-        mConnectedComponentSizes.push_back(currentConnectedComponentPointCount);
+        // Plane of trailing orphaned points, which a full visit counts as one point
+        mConnectedComponentSizes.push_back(1);
+    }
 
-        // Remember the starting index of the triangles in the next plane
-        assert(mPlaneTriangleIndicesToRender.size() == static_cast<size_t>(currentPlaneId + 1));
-        mPlaneTriangleIndicesToRender.push_back(totalPlaneTrianglesCount);
+    size_t const planeCount = mConnectedComponentSizes.size();
+    assert(planeCount <= oldPlaneCount + 1);
 
-        // Remember max plane ID ever
-        mMaxMaxPlaneId = std::max(mMaxMaxPlaneId, currentPlaneId);
+    // Make counts into starting indices
+    mPlaneTriangleIndicesToRender.resize(planeCount + 1);
+    for (size_t p = 1; p <= planeCount; ++p)
+    {
+        mPlaneTriangleIndicesToRender[p] += mPlaneTriangleIndicesToRender[p - 1];
     }
 
-#ifdef RENDER_FLOOD_DISTANCE
-    // Remember colors are dirty
-    mPoints.MarkColorBufferAsDirty();
-#endif
+    // Remember max plane ID ever
+    if (planeCount > 0)
+    {
+        mMaxMaxPlaneId = std::max(mMaxMaxPlaneId, static_cast<PlaneId>(planeCount - 1));
+    }
 
-    // Remember non-ephemeral portion of plane IDs is dirty
-    mPoints.MarkPlaneIdBufferNonEphemeralAsDirty();
+    return haveLabelsChanged;
+}
 
+void Ship::ApplyPlaneTriangleCountChanges()
+{
     //
-    // Re-order burning points, as their plane IDs might have changed
+    // Shift the starting indices of the triangles of each plane by the changes in the triangles
+    // of all the planes before it
     //
 
-    mPoints.ReorderBurningPointsForDepth();
+    assert(mConnectivityPlaneTriangleCountChanges.size() + 1 == mPlaneTriangleIndicesToRender.size());
+
+    std::ptrdiff_t cumulativeChange = 0;
+    for (size_t p = 0; p < mConnectivityPlaneTriangleCountChanges.size(); ++p)
+    {
+        cumulativeChange += mConnectivityPlaneTriangleCountChanges[p];
+
+        assert(static_cast<std::ptrdiff_t>(mPlaneTriangleIndicesToRender[p + 1]) + cumulativeChange >= 0);
+        mPlaneTriangleIndicesToRender[p + 1] = static_cast<size_t>(static_cast<std::ptrdiff_t>(mPlaneTriangleIndicesToRender[p + 1]) + cumulativeChange);
+    }
 }
 
 void Ship::SetAndPropagateResultantPointHullness(
@@ -3854,7 +4550,11 @@ void Ship::HandlePointRestore(
     // Notify if we've just completely restored the ship
     if (mDamagedPointsCount == 0 && mBrokenSpringsCount == 0 && mBrokenTrianglesCount == 0)
     {
-        mParentWorld.GetNpcs().OnShipRepaired(mId, currentSimulationTime); // Tell NPCs
+        {
+            auto const lock = mParentWorld.LockForShipSideEffects();
+            mParentWorld.GetNpcs().OnShipRepaired(mId, currentSimulationTime); // Tell NPCs
+        }
+
         mSimulationEventHandler.OnShipRepaired(mId);
     }
 }
@@ -3954,6 +4654,22 @@ void Ship::HandleSpringDestroy(
     // Remember our structure is now dirty
     mIsStructureDirty = true;
 
+    // Remember the endpoints for the next connectivity update - unless
+    // we've got so many that it'll be a full visit anyway
+    if (mCanUpdateConnectivityIncrementally)
+    {
+        if (mConnectivityDirtyPoints.size() < static_cast<size_t>(mPoints.GetRawShipPointCount() / 2))
+        {
+            mConnectivityDirtyPoints.push_back(pointAIndex);
+            mConnectivityDirtyPoints.push_back(pointBIndex);
+        }
+        else
+        {
+            mCanUpdateConnectivityIncrementally = false;
+            mConnectivityDirtyPoints.clear();
+        }
+    }
+
     // Update count of broken springs
     ++mBrokenSpringsCount;
 }
@@ -4017,6 +4733,10 @@ void Ship::HandleSpringRestore(
     // Remember our structure is now dirty
     mIsStructureDirty = true;
 
+    // Joining components is left to a full visit
+    mCanUpdateConnectivityIncrementally = false;
+    mConnectivityDirtyPoints.clear();
+
     // Update count of broken springs
     assert(mBrokenSpringsCount > 0);
     --mBrokenSpringsCount;
@@ -4067,13 +4787,25 @@ void Ship::HandleTriangleDestroy(ElementIndex triangleElementIndex)
     /////////////////////////////////////////////////////////
 
     // Notify NPCs
-    mParentWorld.GetNpcs().OnShipTriangleDestroyed(
-        mId,
-        triangleElementIndex);
+    {
+        auto const lock = mParentWorld.LockForShipSideEffects();
+
+        mParentWorld.GetNpcs().OnShipTriangleDestroyed(
+            mId,
+            triangleElementIndex);
+    }
 
     // Remember our structure is now dirty
     mIsStructureDirty = true;
 
+    // Remember the change in the triangles of its plane - i.e. of the plane of its owner -
+    // for the next connectivity update, unless that's going to be a full visit anyway
+    if (mCanUpdateConnectivityIncrementally)
+    {
+        assert(mPoints.GetPlaneId(mTriangles.GetPointAIndex(triangleElementIndex)) < mConnectivityPlaneTriangleCountChanges.size());
+        --(mConnectivityPlaneTriangleCountChanges[mPoints.GetPlaneId(mTriangles.GetPointAIndex(triangleElementIndex))]);
+    }
+
     // Update count of broken triangles
     ++mBrokenTrianglesCount;
 }
@@ -4112,6 +4844,9 @@ void Ship::HandleTriangleRestore(ElementIndex triangleElementIndex)
         mSprings.AddSuperTriangle(subSpringIndex, triangleElementIndex);
     }
 
+    // The triangle grid only contains non-deleted triangles
+    mTriangleGrid.Invalidate();
+
     /////////////////////////////////////////////////////////
 
     // Fire event - using point A's properties (quite arbitrarily)
@@ -4124,6 +4859,13 @@ void Ship::HandleTriangleRestore(ElementIndex triangleElementIndex)
     // Remember our structure is now dirty
     mIsStructureDirty = true;
 
+    // Remember the change in the triangles of its plane for the next connectivity update
+    if (mCanUpdateConnectivityIncrementally)
+    {
+        assert(mPoints.GetPlaneId(endpointAIndex) < mConnectivityPlaneTriangleCountChanges.size());
+        ++(mConnectivityPlaneTriangleCountChanges[mPoints.GetPlaneId(endpointAIndex)]);
+    }
+
     // Update count of broken triangles
     assert(mBrokenTrianglesCount > 0);
     --mBrokenTrianglesCount;
@@ -4296,12 +5038,16 @@ void Ship::DoAntiMatterBombPreimplosion(
     }
 
     // Also apply to NPCs
-    mParentWorld.GetNpcs().ApplyAntiMatterBombPreimplosion(
-        mId,
-        centerPosition,
-        radius,
-        RadiusThickness,
-        simulationParameters);
+    {
+        auto const lock = mParentWorld.LockForShipSideEffects();
+
+        mParentWorld.GetNpcs().ApplyAntiMatterBombPreimplosion(
+            mId,
+            centerPosition,
+            radius,
+            RadiusThickness,
+            simulationParameters);
+    }
 
     // Scare fishes
     mParentWorld.DisturbOceanAt(
@@ -4352,11 +5098,15 @@ void Ship::DoAntiMatterBombImplosion(
     }
 
     // Also apply to NPCs
-    mParentWorld.GetNpcs().ApplyAntiMatterBombImplosion(
-        mId,
-        centerPosition,
-        sequenceProgress,
-        simulationParameters);
+    {
+        auto const lock = mParentWorld.LockForShipSideEffects();
+
+        mParentWorld.GetNpcs().ApplyAntiMatterBombImplosion(
+            mId,
+            centerPosition,
+            sequenceProgress,
+            simulationParameters);
+    }
 }
 
 void Ship::DoAntiMatterBombExplosion(
@@ -4392,10 +5142,14 @@ void Ship::DoAntiMatterBombExplosion(
         }
 
         // Also apply to NPCs
-        mParentWorld.GetNpcs().ApplyAntiMatterBombExplosion(
-            mId,
-            centerPosition,
-            simulationParameters);
+        {
+            auto const lock = mParentWorld.LockForShipSideEffects();
+
+            mParentWorld.GetNpcs().ApplyAntiMatterBombExplosion(
+                mId,
+                centerPosition,
+                simulationParameters);
+        }
 
         // Scare fishes
         mParentWorld.DisturbOceanAt(
@@ -4615,5 +5369,69 @@ void Ship::VerifyInvariants()
         mSprings,
         mTriangles);
 }
+
+void Ship::VerifyConnectivity()
+{
+    //
+    // Verifies the incrementally-maintained planes against a full visit: points connected to
+    // each other share the same plane, distinct components have distinct planes, and each plane's
+    // triangles are where we'll upload them
+    //
+
+    size_t const planeCount = mConnectedComponentSizes.size();
+
+    auto const visitSequenceNumber = ++mCurrentConnectivityVisitSequenceNumber;
+
+    std::vector<bool> isPlaneTaken(planeCount, false);
+    std::vector<size_t> planeTriangleCounts(planeCount, 0);
+
+    std::queue<ElementIndex> pointsToPropagateFrom;
+
+    for (auto pointIndex : mPoints.RawShipPoints())
+    {
+        PlaneId const planeId = mPoints.GetPlaneId(pointIndex);
+        Verify(planeId < planeCount);
+        Verify(mPoints.GetConnectedComponentId(pointIndex) == static_cast<ConnectedComponentId>(planeId));
+
+        planeTriangleCounts[planeId] += mPoints.GetConnectedOwnedTrianglesCount(pointIndex);
+
+        if (mPoints.GetCurrentConnectivityVisitSequenceNumber(pointIndex) == visitSequenceNumber
+            || mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.empty())
+        {
+            // Already visited, or orphaned - free to share any plane
+            continue;
+        }
+
+        // New component: its plane may not belong to any other component
+        Verify(!isPlaneTaken[planeId]);
+        isPlaneTaken[planeId] = true;
+
+        mPoints.SetCurrentConnectivityVisitSequenceNumber(pointIndex, visitSequenceNumber);
+        pointsToPropagateFrom.push(pointIndex);
+
+        while (!pointsToPropagateFrom.empty())
+        {
+            auto const currentPointIndex = pointsToPropagateFrom.front();
+            pointsToPropagateFrom.pop();
+
+            for (auto const & cs : mPoints.GetConnectedSprings(currentPointIndex).ConnectedSprings)
+            {
+                Verify(mPoints.GetPlaneId(cs.OtherEndpointIndex) == planeId);
+
+                if (mPoints.GetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex) != visitSequenceNumber)
+                {
+                    mPoints.SetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex, visitSequenceNumber);
+                    pointsToPropagateFrom.push(cs.OtherEndpointIndex);
+                }
+            }
+        }
+    }
+
+    Verify(mPlaneTriangleIndicesToRender.size() == planeCount + 1);
+    for (size_t p = 0; p < planeCount; ++p)
+    {
+        Verify(mPlaneTriangleIndicesToRender[p + 1] - mPlaneTriangleIndicesToRender[p] == planeTriangleCounts[p]);
+    }
+}
 #endif
 }
\ No newline at end of file
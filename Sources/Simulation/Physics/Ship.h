@@ -20,11 +20,15 @@
 
 #include <Core/AABBSet.h>
 #include <Core/Buffer.h>
+#include <Core/GameRandomEngine.h>
 #include <Core/GameTypes.h>
 #include <Core/ImageData.h>
+#include <Core/LampGrid.h>
 #include <Core/PerfStats.h>
 #include <Core/RunningAverage.h>
 #include <Core/ThreadManager.h>
+#include <Core/UniformPointGrid.h>
+#include <Core/UniformTriangleGrid.h>
 #include <Core/Vectors.h>
 
 #include <atomic>
@@ -33,6 +37,10 @@
 #include <optional>
 #include <vector>
 
+// Benchmarks and tests of the ship's internals
+class ShipSubsystemsBenchmark;
+class ShipConnectivityTests;
+
 namespace Physics
 {
 
@@ -77,6 +85,33 @@ public:
 
     Triangles const & GetTriangles() const { return mTriangles; }
 
+    /*
+     * Returns - in ascending index order - a superset of the triangles containing the position,
+     * possibly including deleted triangles; callers test the candidates against the points'
+     * current positions.
+     *
+     * Rebuilds the triangle grid first, if it's been invalidated since the last query.
+     */
+    UniformTriangleGrid::CellTriangles GetTriangleCandidatesAt(vec2f const & position) const
+    {
+        if (!mTriangleGrid.IsValid())
+        {
+            mTriangleGrid.Rebuild(
+                mPoints.GetPositionBufferAsVec2(),
+                mTriangles.GetElementCount(),
+                [this](ElementIndex t) -> auto const &
+                {
+                    return mTriangles.GetPointIndices(t);
+                },
+                [this](ElementIndex t)
+                {
+                    return !mTriangles.IsDeleted(t);
+                });
+        }
+
+        return mTriangleGrid.GetCellTriangles(position);
+    }
+
     bool IsUnderwater(ElementIndex pointElementIndex) const
     {
         return mParentWorld.GetOceanSurface().IsUnderwater(mPoints.GetPosition(pointElementIndex));
@@ -522,6 +557,7 @@ private:
 
     void RecalculateSpringRelaxationParallelism(
         size_t simulationParallelism,
+        SpringRelaxationParallelComputationModeType springRelaxationParallelComputationMode,
         SimulationParameters const & simulationParameters);
 
     void RecalculateSpringRelaxationParallelism_FullSpeed(
@@ -608,9 +644,19 @@ private:
 
     void EqualizeInternalPressure(SimulationParameters const & simulationParameters);
 
-    void UpdateWaterVelocities(
-        SimulationParameters const & simulationParameters,
-        float & waterSplashed);
+    void RecalculateWaterFlowParallelism(
+        size_t simulationParallelism,
+        SimulationParameters const & simulationParameters);
+
+    void PrepareWaterFlow(SimulationParameters const & simulationParameters);
+
+    void UpdateWaterVelocities(size_t waterFlowPartitionIndex);
+
+    void MergeWaterFlows(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex);
+
+    float CompleteWaterFlow(ThreadManager & threadManager);
 
     void UpdateSinking(float currentSimulationTime);
 
@@ -618,17 +664,26 @@ private:
 
     void RecalculateLightDiffusionParallelism(size_t simulationParallelism);
 
-    void DiffuseLight(
-        SimulationParameters const & simulationParameters,
-        ThreadManager & threadManager);
+    void DiffuseLight(ThreadManager & threadManager);
 
     // Heat
 
+    void RecalculateHeatPropagationParallelism(size_t simulationParallelism);
+
     void PropagateHeat(
         float currentSimulationTime,
         float dt,
 		Storm::Parameters const & stormParameters,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
+
+    void CalculateHeatOutflowNormalizationFactors(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex);
+
+    void TransferAndDissipateHeat(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex);
 
     // Misc
 
@@ -656,8 +711,20 @@ private:
         SimulationParameters const & simulationParameters,
         ThreadManager & threadManager);
 
+    void UpdateConnectivity();
+
     void RunConnectivityVisit();
 
+    void RunIncrementalConnectivityUpdate();
+
+    bool SplitConnectedComponent(
+        ElementIndex const * seedPoints,
+        size_t seedPointCount);
+
+    bool RenumberPlanes();
+
+    void ApplyPlaneTriangleCountChanges();
+
     inline void SetAndPropagateResultantPointHullness(
         ElementIndex pointElementIndex,
         bool isHull);
@@ -723,6 +790,80 @@ private:
             simulationParameters);
     }
 
+    /*
+     * Visits the active points - ship and ephemeral - strictly within the radius,
+     * in ascending index order, with their square distance from the center.
+     *
+     * Ship points are looked up in the point grid when it's valid, i.e. when it's been rebuilt
+     * at the end of the last step and points haven't moved since; ephemeral particles - which
+     * come and go throughout the step, and are at most MaxEphemeralParticles - are checked
+     * directly. Otherwise, all points are scanned.
+     */
+    template<typename TVisitor>
+    inline void VisitActivePointsInRadius(
+        vec2f const & center,
+        float radius,
+        TVisitor && visitor) const
+    {
+        ++mPointQueryCount;
+
+        float const squareRadius = radius * radius;
+
+        if (mPointGrid.IsValid())
+        {
+            mPointGrid.VisitPointsInRadius(
+                mPoints.GetPositionBufferAsVec2(),
+                center,
+                radius,
+                visitor);
+
+            // Ephemeral particles come after all ship points, hence the order is preserved
+            for (auto const pointIndex : mPoints.EphemeralPoints())
+            {
+                if (mPoints.IsActive(pointIndex))
+                {
+                    float const squareDistance = (mPoints.GetPosition(pointIndex) - center).squareLength();
+                    if (squareDistance < squareRadius)
+                    {
+                        visitor(pointIndex, squareDistance);
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (auto const pointIndex : mPoints)
+            {
+                if (mPoints.IsActive(pointIndex))
+                {
+                    float const squareDistance = (mPoints.GetPosition(pointIndex) - center).squareLength();
+                    if (squareDistance < squareRadius)
+                    {
+                        visitor(pointIndex, squareDistance);
+                    }
+                }
+            }
+        }
+    }
+
+    inline void RebuildPointGrid()
+    {
+        mPointGrid.Rebuild(
+            mPoints.GetPositionBufferAsVec2(),
+            mPoints.GetRawShipPointCount(),
+            [](ElementIndex)
+            {
+                // Ship points are always active
+                return true;
+            });
+    }
+
+    inline void InvalidateSpatialGrids()
+    {
+        mPointGrid.Invalidate();
+        mTriangleGrid.Invalidate();
+    }
+
 public:
 
     /////////////////////////////////////////////////////////////////////////
@@ -810,6 +951,8 @@ private:
 
 #ifdef _DEBUG
     void VerifyInvariants();
+
+    void VerifyConnectivity();
 #endif
 
 private:
@@ -890,6 +1033,9 @@ private:
     SimulationEventDispatcher & mSimulationEventHandler;
     EventRecorder * mEventRecorder;
 
+    // Our own, so that our updates do not depend on the thread they run on
+    GameRandomEngine mRandomEngine;
+
     // All the ship elements - never removed, the repositories maintain their own size forever
     Points mPoints;
     Springs mSprings;
@@ -931,6 +1077,42 @@ private:
     // to the rendering context
     bool mIsStructureDirty;
 
+    // The endpoints of the springs destroyed since the last connectivity update; the next update
+    // only re-labels the connected components these points belong to
+    std::vector<ElementIndex> mConnectivityDirtyPoints;
+
+    // The net number of triangles destroyed (negative) or restored (positive) in each plane since
+    // the last connectivity update; only needed by updates that leave planes as they are
+    std::vector<std::ptrdiff_t> mConnectivityPlaneTriangleCountChanges;
+
+    // Cleared by changes that the next connectivity update may only handle with a full visit
+    bool mCanUpdateConnectivityIncrementally;
+
+    // Scratch state of incremental connectivity updates: a set of concurrent breadth-first searches,
+    // started from different points of a connected component that might have been split
+    struct ConnectivitySearchFront
+    {
+        std::vector<ElementIndex> VisitedPoints; // Also the search queue, from Head onwards
+        size_t Head;
+        size_t Group; // Union-find parent; fronts that meet are in the same piece of the component
+        size_t GroupPendingFrontCount; // Group roots only: number of fronts not yet exhausted
+        size_t GroupPointCount; // Group roots only
+        PlaneId GroupNewPlaneId; // Group roots only
+
+        ConnectivitySearchFront()
+            : VisitedPoints()
+            , Head(0)
+            , Group(0)
+            , GroupPendingFrontCount(0)
+            , GroupPointCount(0)
+            , GroupNewPlaneId(NonePlaneId)
+        {}
+    };
+
+    std::vector<ConnectivitySearchFront> mConnectivitySearchFronts;
+    std::vector<size_t> mConnectivitySearchFrontIndices; // Index of the front that visited each point
+    std::vector<PlaneId> mConnectivityPlaneIdRemap; // New plane ID of each old plane ID
+
     // Counts of elements currently broken - updated each time an element is broken
     // or restored
     ElementCount mDamagedPointsCount;
@@ -943,10 +1125,10 @@ private:
     // Water splashes
     RunningAverage<30> mWaterSplashedRunningAverage;
 
-    // Last luminiscence adjustment that we've run the light diffusion algorithm with;
-    // used to avoid running diffusion when luminiscence adjustment is zero and we've
-    // already ran once with zero (so to zero out buffer)
-    float mLastLuminiscenceAdjustmentDiffused;
+    // Whether any lamp was lit the last time we've run the light diffusion algorithm;
+    // used to avoid running diffusion when no lamps are lit and we've already ran
+    // once with no lamps lit (so to zero out buffer)
+    bool mWereLampsLitAtLastLightDiffusion;
 
     // Normally at 1.0, set to 0.0 during repair to turn off updates that hinder the
     // repair process
@@ -955,6 +1137,17 @@ private:
     // Index of last-queried point - used as an aid to debugging
     ElementIndex mutable mLastQueriedPointIndex;
 
+    // Spatial index of the ship points, used by interactions to avoid visiting all points;
+    // rebuilt at the end of the ship's update, but only when the last step had enough queries
+    // to pay for it (see MinPointGridQueriesPerStep)
+    UniformPointGrid mPointGrid;
+    size_t mutable mPointQueryCount; // Since the last rebuild opportunity
+
+    // Spatial index of the non-deleted triangles, used to locate triangles containing a
+    // position (e.g. for NPCs); invalidated whenever points move or triangles are restored,
+    // and rebuilt lazily at the next query
+    UniformTriangleGrid mutable mTriangleGrid;
+
     // Counter of created bubble ephemeral particles
     std::uint64_t mAirBubblesCreatedCount;
 
@@ -991,7 +1184,8 @@ private:
     // The signals for completions for threads to synchronize with each other
     std::atomic<int> mSpringRelaxation_Hybrid_IterationCompleted;
 
-    // The last spring relaxation computation parameters; used to detect changes
+    // The spring relaxation mode we've prepared tasks for - the parameters' one, unless ships
+    // are updating alongside each other; used to detect changes
     std::optional<SpringRelaxationParallelComputationModeType> mCurrentSpringRelaxationParallelComputationMode;
 
     //
@@ -1034,6 +1228,83 @@ private:
     // The light diffusion tasks
     std::vector<typename ThreadPool::Task> mLightDiffusionTasks;
 
+    // The lit lamps, binned by the cells they light; used instead of
+    // visiting all lamps when there are many of them
+    LampGrid mLampGrid;
+    bool mIsLightDiffusionBinned;
+
+    //
+    // Water flow
+    //
+
+    // The parameters of the current water flow step, shared by all water flow tasks
+    struct WaterFlowStepParameters
+    {
+        std::shared_ptr<Buffer<float>> PointFreenessFactorBuffer; // Not on mobile
+        float WaterCrazyness;
+        float WaterDiffusionSpeedAdjustment;
+    };
+
+    WaterFlowStepParameters mWaterFlowStepParameters;
+
+    // The point ranges into which water flow is split, one for each thread;
+    // each partition accumulates water deltas into its own Points' parallel water buffer,
+    // and momenta into its own Points' parallel water momentum buffer
+    struct WaterFlowPartition
+    {
+        ElementIndex StartPointIndex;
+        ElementIndex EndPointIndex;
+        float WaterSplashed; // Result
+
+        WaterFlowPartition(
+            ElementIndex startPointIndex,
+            ElementIndex endPointIndex)
+            : StartPointIndex(startPointIndex)
+            , EndPointIndex(endPointIndex)
+            , WaterSplashed(0.0f)
+        {}
+    };
+
+    std::vector<WaterFlowPartition> mWaterFlowPartitions;
+
+    // The tasks merging the partitions' water buffers into the water back buffer
+    std::vector<typename ThreadPool::Task> mWaterFlowMergeTasks;
+
+    // The last water flow computation parameters; used to detect changes
+    std::optional<bool> mCurrentDoParallelWaterFlow;
+
+    //
+    // Heat propagation
+    //
+
+    // The parameters of the current heat propagation step, shared by all heat propagation tasks
+    struct HeatPropagationStepParameters
+    {
+        float ThermalConductivityFactor; // Adjustment * dt
+        float EffectiveWaterConvectiveHeatTransferCoefficient;
+        float EffectiveAirConvectiveHeatTransferCoefficient;
+        float SurfaceWaterTemperature;
+        float AirTemperature;
+    };
+
+    HeatPropagationStepParameters mHeatPropagationStepParameters;
+
+    // For each point, the fraction of its outgoing heat flows that may actually leave it
+    Buffer<float> mHeatOutflowNormalizationFactorBuffer;
+
+    // The heat propagation tasks, one set for each of the two (sequential) phases
+    std::vector<typename ThreadPool::Task> mHeatOutflowNormalizationTasks;
+    std::vector<typename ThreadPool::Task> mHeatTransferAndDissipationTasks;
+
+    //
+    // Update
+    //
+
+    // The graph of the parallel run of Update(); re-built at each step,
+    // reusing its storage
+    ThreadPool::TaskGraph mUpdateTaskGraph;
+    std::vector<ThreadPool::TaskGraph::TaskId> mUpdateWaterVelocityTaskIds;
+
     //
     // Render members
     //
@@ -1045,6 +1316,11 @@ private:
     // Initial indices of the triangles for each plane ID;
     // last extra element contains total number of triangles
     std::vector<size_t> mPlaneTriangleIndicesToRender;
+
+private:
+
+    friend class ::ShipSubsystemsBenchmark;
+    friend class ::ShipConnectivityTests;
 };
 
 }
\ No newline at end of file
@@ -112,6 +112,8 @@ void Ship::MoveBy(
         }
     }
 
+    InvalidateSpatialGrids();
+
     TrimForWorldBounds(simulationParameters);
 }
 
@@ -142,6 +144,8 @@ void Ship::MoveBy(
         dynamicForceBuffer[p] = vec2f::zero();
     }
 
+    InvalidateSpatialGrids();
+
     TrimForWorldBounds(simulationParameters);
 }
 
@@ -184,6 +188,8 @@ void Ship::RotateBy(
         }
     }
 
+    InvalidateSpatialGrids();
+
     TrimForWorldBounds(simulationParameters);
 }
 
@@ -224,6 +230,8 @@ void Ship::RotateBy(
         dynamicForceBuffer[p] = vec2f::zero();
     }
 
+    InvalidateSpatialGrids();
+
     TrimForWorldBounds(simulationParameters);
 }
 
@@ -301,6 +309,8 @@ void Ship::MoveGrippedBy(
         }
     }
 
+    InvalidateSpatialGrids();
+
     // The promise is that we leave every particle within world bounds
     TrimForWorldBounds(simulationParameters);
 }
@@ -366,6 +376,8 @@ void Ship::RotateGrippedBy(
         }
     }
 
+    InvalidateSpatialGrids();
+
     // The promise is that we leave every particle within world bounds
     TrimForWorldBounds(simulationParameters);
 }
@@ -387,23 +399,21 @@ std::optional<ElementIndex> Ship::PickObjectForPickAndPull(
     // Find closest point - of any type - within the search radius
     //
 
-    float const squareSearchRadius = searchRadius * searchRadius;
-
     float bestSquareDistance = std::numeric_limits<float>::max();
     ElementIndex bestPoint = NoneElementIndex;
 
-    for (auto p : mPoints)
-    {
-        float const squareDistance = (mPoints.GetPosition(p) - pickPosition).squareLength();
-        if (squareDistance < squareSearchRadius
-            && squareDistance < bestSquareDistance
-            && mPoints.IsActive(p)
-            && !mPoints.IsPinned(p))
+    VisitActivePointsInRadius(
+        pickPosition,
+        searchRadius,
+        [&](ElementIndex p, float squareDistance)
         {
-            bestSquareDistance = squareDistance;
-            bestPoint = p;
-        }
-    }
+            if (squareDistance < bestSquareDistance
+                && !mPoints.IsPinned(p))
+            {
+                bestSquareDistance = squareDistance;
+                bestPoint = p;
+            }
+        });
 
     if (bestPoint != NoneElementIndex)
         return bestPoint;
@@ -550,13 +560,17 @@ bool Ship::DestroyAt(
     float const largerSearchSquareRadius = std::max(squareRadius, FallbackSquareRadius);
 
     // Detach/destroy all active, attached points within the radius
-    for (auto const pointIndex : mPoints)
-    {
-        float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-
-        if (mPoints.IsActive(pointIndex)
-            && pointSquareDistance < largerSearchSquareRadius)
+    VisitActivePointsInRadius(
+        targetPos,
+        std::sqrt(largerSearchSquareRadius),
+        [&](ElementIndex pointIndex, float pointSquareDistance)
         {
+            // Might have been destroyed since the point grid was last rebuilt
+            if (!mPoints.IsActive(pointIndex))
+            {
+                return;
+            }
+
             //
             // - Air bubble ephemeral points: destroy
             // - Non-ephemeral, attached points: detach probabilistically
@@ -599,8 +613,7 @@ bool Ship::DestroyAt(
 
                 hasDestroyed = true;
             }
-        }
-    }
+        });
 
     // Make sure we always destroy something, if we had a particle in-radius
     if (!hasDestroyed && NoneElementIndex != nearestFallbackPointInRadiusIndex)
@@ -693,17 +706,14 @@ bool Ship::ApplyHeatBlasterAt(
         * SimulationParameters::SimulationStepTimeDuration<float>
         * (action == HeatBlasterActionType::Cool ? -1.0f : 1.0f); // Heat vs. Cool
 
-    float const squareRadius = radius * radius;
-
     // Search all points within the radius
     //
     // We also do ephemeral points in order to change buoyancy of air bubbles
     bool atLeastOnePointFound = false;
-    for (auto const pointIndex : mPoints)
-    {
-        float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-        if (pointSquareDistance < squareRadius
-            && mPoints.IsActive(pointIndex))
+    VisitActivePointsInRadius(
+        targetPos,
+        radius,
+        [&](ElementIndex pointIndex, float pointSquareDistance)
         {
             //
             // Inject/remove heat at this point
@@ -728,8 +738,7 @@ bool Ship::ApplyHeatBlasterAt(
 
             // Remember we've found a point
             atLeastOnePointFound = true;
-        }
-    }
+        });
 
     return atLeastOnePointFound;
 }
@@ -752,11 +761,16 @@ bool Ship::ExtinguishFireAt(
     // No real reason to ignore ephemeral points, other than they're currently
     // not expected to burn
     bool atLeastOnePointFound = false;
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-        if (pointSquareDistance < squareRadius)
+    VisitActivePointsInRadius(
+        targetPos,
+        radius,
+        [&](ElementIndex pointIndex, float pointSquareDistance)
         {
+            if (mPoints.IsEphemeral(pointIndex))
+            {
+                return;
+            }
+
             // Check if the point is in a state in which we can smother its combustion
             if (mPoints.IsBurningForSmothering(pointIndex))
             {
@@ -783,8 +797,7 @@ bool Ship::ExtinguishFireAt(
 
             // Remember we've found a point
             atLeastOnePointFound = true;
-        }
-    }
+        });
 
     return atLeastOnePointFound;
 }
@@ -1040,19 +1053,24 @@ std::optional<ToolApplicationLocus> Ship::InjectPressureAt(
     // Find closest (non-ephemeral) non-hull point in the radius
     //
 
-    float bestSquareDistance = 1.2f;
+    float constexpr SearchSquareRadius = 1.2f;
+
+    float bestSquareDistance = SearchSquareRadius;
     ElementIndex bestPointIndex = NoneElementIndex;
 
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        float const squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-        if (squareDistance < bestSquareDistance
-            && !mPoints.GetIsHull(pointIndex))
+    VisitActivePointsInRadius(
+        targetPos,
+        std::sqrt(SearchSquareRadius),
+        [&](ElementIndex pointIndex, float squareDistance)
         {
-            bestSquareDistance = squareDistance;
-            bestPointIndex = pointIndex;
-        }
-    }
+            if (!mPoints.IsEphemeral(pointIndex)
+                && squareDistance < bestSquareDistance
+                && !mPoints.GetIsHull(pointIndex))
+            {
+                bestSquareDistance = squareDistance;
+                bestPointIndex = pointIndex;
+            }
+        });
 
     if (bestPointIndex == NoneElementIndex)
     {
@@ -1159,15 +1177,14 @@ bool Ship::FloodAt(
     // Find the (non-ephemeral) non-hull points in the radius
     //
 
-    float const searchSquareRadius = radius * radius;
-
     bool anyWasApplied = false;
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        if (!mPoints.GetIsHull(pointIndex))
+    VisitActivePointsInRadius(
+        targetPos,
+        radius,
+        [&](ElementIndex pointIndex, float /*squareDistance*/)
         {
-            float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-            if (squareDistance < searchSquareRadius)
+            if (!mPoints.IsEphemeral(pointIndex)
+                && !mPoints.GetIsHull(pointIndex))
             {
                 //
                 // Update water
@@ -1206,8 +1223,7 @@ bool Ship::FloodAt(
 
                 anyWasApplied = true;
             }
-        }
-    }
+        });
 
     return anyWasApplied;
 }
@@ -1471,23 +1487,20 @@ ElementIndex Ship::GetNearestPointAt(
     vec2f const & targetPos,
     float radius) const
 {
-    float const squareRadius = radius * radius;
-
     ElementIndex bestPointIndex = NoneElementIndex;
     float bestSquareDistance = std::numeric_limits<float>::max();
 
-    for (auto const pointIndex : mPoints)
-    {
-        if (mPoints.IsActive(pointIndex))
+    VisitActivePointsInRadius(
+        targetPos,
+        radius,
+        [&](ElementIndex pointIndex, float squareDistance)
         {
-            float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-            if (squareDistance < squareRadius && squareDistance < bestSquareDistance)
+            if (squareDistance < bestSquareDistance)
             {
                 bestPointIndex = pointIndex;
                 bestSquareDistance = squareDistance;
             }
-        }
-    }
+        });
 
     return bestPointIndex;
 }
@@ -1502,23 +1515,7 @@ bool Ship::QueryNearestPointAt(
 
     bool pointWasFound = false;
 
-    float const squareRadius = radius * radius;
-
-    ElementIndex bestPointIndex = NoneElementIndex;
-    float bestSquareDistance = std::numeric_limits<float>::max();
-
-    for (auto const pointIndex : mPoints)
-    {
-        if (mPoints.IsActive(pointIndex))
-        {
-            float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-            if (squareDistance < squareRadius && squareDistance < bestSquareDistance)
-            {
-                bestPointIndex = pointIndex;
-                bestSquareDistance = squareDistance;
-            }
-        }
-    }
+    ElementIndex const bestPointIndex = GetNearestPointAt(targetPos, radius);
 
     if (NoneElementIndex != bestPointIndex)
     {
@@ -173,6 +173,9 @@ void Ship::RepairAt(
 
     // Reset grace period
     mRepairGracePeriodMultiplier = 0.0f;
+
+    // We've moved points
+    InvalidateSpatialGrids();
 }
 
 void Ship::StraightenOneSpringChains(ElementIndex pointIndex)
@@ -12,9 +12,10 @@ namespace Physics {
 
 void Ship::RecalculateSpringRelaxationParallelism(
     size_t simulationParallelism,
+    SpringRelaxationParallelComputationModeType springRelaxationParallelComputationMode,
     SimulationParameters const & simulationParameters)
 {
-    switch (simulationParameters.SpringRelaxationParallelComputationMode)
+    switch (springRelaxationParallelComputationMode)
     {
         case SpringRelaxationParallelComputationModeType::FullSpeed:
         {
@@ -264,7 +265,10 @@ void Ship::RunSpringRelaxation(
     ThreadManager & threadManager,
     SimulationParameters const & simulationParameters)
 {
-    switch (simulationParameters.SpringRelaxationParallelComputationMode)
+    // The mode we've prepared tasks for
+    assert(mCurrentSpringRelaxationParallelComputationMode.has_value());
+
+    switch (*mCurrentSpringRelaxationParallelComputationMode)
     {
         case SpringRelaxationParallelComputationModeType::FullSpeed:
         {
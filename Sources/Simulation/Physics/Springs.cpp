@@ -280,24 +280,26 @@ void Springs::InternalUpdateForStrainsAndCacheSpringVectors(
 
     // Visit all springs
     assert(is_aligned_to_float_element_count(GetBufferElementCount()));
-    for (ElementIndex s_0 = 0; s_0 < GetBufferElementCount(); s_0 += 4)
+    for (ElementIndex s_0 = 0; s_0 < GetBufferElementCount(); )
     {
         //
-        // Calculate and cache vector info for these four springs
+        // Calculate and cache vector info for the next block of (four or eight) springs
         //
 
-        Algorithms::CalculateSpringVectors(
+        ElementCount const blockSpringCount = Algorithms::CalculateSpringVectors(
             s_0,
+            GetBufferElementCount(),
             positionBuffer,
             endpointsBuffer,
             cachedLengthBuffer,
             cachedNormalizedVectorBuffer);
 
         //
-        // Do strain checks on these four springs now
+        // Do strain checks on these springs now
         //
 
-        for (ElementIndex s = s_0, i = 0; i < 4; ++i, ++s)
+        ElementIndex const s_end = s_0 + blockSpringCount;
+        for (ElementIndex s = s_0; s < s_end; ++s)
         {
             // Avoid breaking deleted springs
             if (!mIsDeletedBuffer[s])
@@ -376,6 +378,8 @@ void Springs::InternalUpdateForStrainsAndCacheSpringVectors(
                 }
             }
         }
+
+        s_0 = s_end;
     }
 }
 
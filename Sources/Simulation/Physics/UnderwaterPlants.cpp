@@ -29,6 +29,7 @@ UnderwaterPlants::UnderwaterPlants(size_t speciesCount)
     , mCurrentDensity(0.0f)
     , mCurrentSizeMultiplier(0.0f)
     , mCurrentWindBaseSpeedMagnitude(0.0f)
+    , mCurrentOceanSurfaceSamplesCount(0)
 {
 }
 
@@ -49,6 +50,7 @@ void UnderwaterPlants::Update(
 
         mCurrentDensity = simulationParameters.UnderwaterPlantsDensity;
         mCurrentSizeMultiplier = simulationParameters.UnderwaterPlantSizeMultiplier;
+        mCurrentOceanSurfaceSamplesCount = oceanSurface.GetSamplesCount();
 
         mArePlantsDirtyForRendering = true;
     }
@@ -69,6 +71,13 @@ void UnderwaterPlants::Update(
 
             mArePlantsDirtyForRendering = true;
         }
+
+        if (mCurrentOceanSurfaceSamplesCount != oceanSurface.GetSamplesCount())
+        {
+            RecalculateOceanSurfaceCoordinatesProxies(oceanSurface);
+
+            mCurrentOceanSurfaceSamplesCount = oceanSurface.GetSamplesCount();
+        }
     }
 
     assert(mOceanSurfaceCoordinatesProxies.size() == mPlants.size());
@@ -302,6 +311,16 @@ void UnderwaterPlants::RepopulatePlants(
     assert(mOceanDepths.size() == plantCount);
 }
 
+void UnderwaterPlants::RecalculateOceanSurfaceCoordinatesProxies(OceanSurface const & oceanSurface)
+{
+    assert(mOceanSurfaceCoordinatesProxies.size() == mPlants.size());
+
+    for (size_t i = 0; i < mPlants.size(); ++i)
+    {
+        mOceanSurfaceCoordinatesProxies[i] = oceanSurface.GetCoordinatesProxyAt(mPlants[i].CenterX);
+    }
+}
+
 void UnderwaterPlants::RecalculateBottomYs(OceanFloor const & oceanFloor)
 {
     for (auto & plant : mPlants)
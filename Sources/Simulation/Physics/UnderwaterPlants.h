@@ -43,6 +43,8 @@ private:
         OceanFloor const & oceanFloor,
         SimulationParameters const & simulationParameters);
 
+    void RecalculateOceanSurfaceCoordinatesProxies(OceanSurface const & oceanSurface);
+
     void RecalculateBottomYs(OceanFloor const & oceanFloor);
 
     static inline float CalculateBottomY(float x, OceanFloor const & oceanFloor);
@@ -112,6 +114,7 @@ private:
     float mCurrentDensity;
     float mCurrentSizeMultiplier;
     float mCurrentWindBaseSpeedMagnitude;
+    size_t mCurrentOceanSurfaceSamplesCount;
 };
 
 }
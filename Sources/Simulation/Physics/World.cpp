@@ -6,6 +6,7 @@
 #include "Physics.h"
 
 #include <Core/GameRandomEngine.h>
+#include <Core/Profiler.h>
 
 #include <algorithm>
 #include <cassert>
@@ -19,7 +20,8 @@ World::World(
     size_t underwaterPlantsSpeciesCount,
     NpcDatabase const & npcDatabase,
     SimulationEventDispatcher & simulationEventDispatcher,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
     : mCurrentSimulationTime(0.0f)
     //
     , mSimulationEventHandler(simulationEventDispatcher)
@@ -30,20 +32,32 @@ World::World(
     , mStorm(*this, mSimulationEventHandler)
     , mWind(mSimulationEventHandler)
     , mClouds()
-    , mOceanSurface(*this, mSimulationEventHandler)
+    , mOceanSurface(*this, mSimulationEventHandler, simulationParameters)
     , mOceanFloor(std::move(oceanFloorHeightMap))
     , mFishes(fishSpeciesDatabase, mSimulationEventHandler)
     , mUnderwaterPlants(underwaterPlantsSpeciesCount)
     , mNpcs(std::make_unique<Npcs>(*this, npcDatabase, mSimulationEventHandler, simulationParameters))
     //
     , mAllShipExternalAABBs()
+    //
+    , mAreShipsUpdatingConcurrently(false)
+    , mAreShipsUpdatingAlongsideEachOther(false)
+    , mShipSideEffectsLock()
+    , mPerShipExternalAABBs()
+    , mShipUpdateOrder()
+    , mShipUpdateTasks()
+    //
+    , mPreviousShipExternalAABBs()
+    , mAreFishesUpdatingConcurrently(false)
+    , mDeferredOceanDisturbances()
+    , mSubsystemUpdateTaskGraph()
 {
     // Initialize world pieces that need to be initialized now
     mStars.Update(mCurrentSimulationTime, simulationParameters);
     mStorm.Update(simulationParameters);
     mWind.Update(mStorm.GetParameters(), simulationParameters);
     mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), simulationParameters);
-    mOceanSurface.Update(mCurrentSimulationTime, mWind, simulationParameters);
+    mOceanSurface.Update(mCurrentSimulationTime, mWind, simulationParameters, threadManager);
     mOceanFloor.Update(simulationParameters);
     mUnderwaterPlants.Update(mCurrentSimulationTime, mWind, mOceanSurface, mOceanFloor, simulationParameters);
 }
@@ -120,6 +134,18 @@ size_t World::GetShipPointCount(ShipId shipId) const
     return mAllShips[shipId]->GetPointCount();
 }
 
+size_t World::GetAllShipPointCount() const
+{
+    return std::accumulate(
+        mAllShips.cbegin(),
+        mAllShips.cend(),
+        size_t(0),
+        [](size_t total, auto const & ship)
+        {
+            return total + ship->GetPointCount();
+        });
+}
+
 size_t World::GetAllShipSpringCount() const
 {
     return std::accumulate(
@@ -188,6 +214,9 @@ void World::OnBlast(
     ExplosionType explosionType,
     SimulationParameters const & simulationParameters)
 {
+    // Might be invoked by concurrently-updating ships
+    auto const lock = LockForShipSideEffects();
+
     //
     // Blast NPCs
     //
@@ -241,8 +270,8 @@ void World::OnBlast(
         for (float r = 0.0f; r <= radius; r += 0.5f)
         {
             float const d = displacement * (1.0f - r / radius);
-            DisplaceOceanSurfaceAt(centerPosition.x - r, d);
-            DisplaceOceanSurfaceAt(centerPosition.x + r, d);
+            mOceanSurface.DisplaceAt(centerPosition.x - r, d);
+            mOceanSurface.DisplaceAt(centerPosition.x + r, d);
         }
     }
 
@@ -250,7 +279,7 @@ void World::OnBlast(
     // Scare fishes
     //
 
-    DisturbOceanAt(
+    DisturbOceanAtWhileLocked(
         centerPosition,
         blastForceRadius * 125.0f,
         std::chrono::milliseconds(150));
@@ -1482,73 +1511,406 @@ void World::Update(
     ThreadManager & threadManager,
     PerfStats & perfStats)
 {
+    FS_PROFILE_ZONE("World::Update");
+
     // Update current time
     mCurrentSimulationTime += SimulationParameters::SimulationStepTimeDuration<float>;
 
-    // Prepare all AABBs
+    // Prepare all AABBs, remembering the previous step's for those
+    // who can't wait for ships to be done
+    std::swap(mPreviousShipExternalAABBs, mAllShipExternalAABBs);
     mAllShipExternalAABBs.Clear();
 
     //
     // Update all subsystems
     //
 
-    mStars.Update(mCurrentSimulationTime, simulationParameters);
+    if (ShouldUpdateSubsystemsConcurrently(simulationParameters, threadManager))
+    {
+        UpdateSubsystemsConcurrently(
+            simulationParameters,
+            viewModel,
+            stressRenderMode,
+            threadManager,
+            perfStats);
+    }
+    else
+    {
+        //
+        // Serial: one subsystem after the other
+        //
 
-    mStorm.Update(simulationParameters);
+        {
+            FS_PROFILE_ZONE("World::UpdateSky");
 
-    mWind.Update(mStorm.GetParameters(), simulationParameters);
+            mStars.Update(mCurrentSimulationTime, simulationParameters);
 
-    mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), simulationParameters);
+            mStorm.Update(simulationParameters);
 
-    mOceanSurface.Update(mCurrentSimulationTime, mWind, simulationParameters);
+            mWind.Update(mStorm.GetParameters(), simulationParameters);
 
-    mOceanFloor.Update(simulationParameters);
+            mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), simulationParameters);
+        }
+
+        UpdateOceanSurface(simulationParameters, threadManager, perfStats);
+
+        mOceanFloor.Update(simulationParameters);
+
+        UpdateShips(simulationParameters, stressRenderMode, threadManager, perfStats);
+
+        UpdateNpcs(simulationParameters, threadManager, perfStats);
+
+        UpdateFishes(simulationParameters, viewModel, mAllShipExternalAABBs, perfStats);
+
+        mFishes.ApplyOceanSurfaceDisplacements(mOceanSurface);
+
+        UpdateUnderwaterPlants(simulationParameters);
+    }
+
+    //
+    // Signal update end (for quantities/state that needed to persist during whole Update cycle)
+    //
+
+    mWind.UpdateEnd();
 
     for (auto & ship : mAllShips)
     {
-        ship->Update(
-            mCurrentSimulationTime,
-            mStorm.GetParameters(),
+        ship->UpdateEnd();
+    }
+
+    mNpcs->UpdateEnd();
+
+    mOceanFloor.UpdateEnd();
+}
+
+bool World::ShouldUpdateSubsystemsConcurrently(
+    SimulationParameters const & simulationParameters,
+    ThreadManager const & threadManager) const
+{
+    return simulationParameters.DoConcurrentWorldUpdates
+        && threadManager.GetSimulationParallelism() >= 2;
+}
+
+void World::UpdateSubsystemsConcurrently(
+    SimulationParameters const & simulationParameters,
+    ViewModel const & viewModel,
+    StressRenderModeType stressRenderMode,
+    ThreadManager & threadManager,
+    PerfStats & perfStats)
+{
+    //
+    // Storm and wind drive most of the others, hence they go first; the rest
+    // runs as a graph:
+    //
+    //  OceanSurface, OceanFloor --> Ships --> Npcs
+    //  OceanSurface, OceanFloor --> Fishes
+    //  OceanSurface, OceanFloor --> UnderwaterPlants
+    //  Stars, Clouds
+    //
+    // Differences wrt the serial update:
+    //  - Fishes avoid the ships' AABBs as of the previous step;
+    //  - Fish disturbances made while fishes might be updating (by ships, tsunamis) are
+    //    delivered to fishes at the end of the update, and so are the ocean surface
+    //    displacements made by fishes;
+    //  - Ships' side effects are serialized and events are deferred, as for concurrent
+    //    ship updates
+    //
+
+    {
+        FS_PROFILE_ZONE("World::UpdateSky");
+
+        mStorm.Update(simulationParameters);
+
+        mWind.Update(mStorm.GetParameters(), simulationParameters);
+    }
+
+    assert(mSubsystemUpdateTaskGraph.IsEmpty());
+
+    auto const oceanSurfaceTaskId = mSubsystemUpdateTaskGraph.AddTask(
+        [this, &simulationParameters, &threadManager, &perfStats]()
+        {
+            UpdateOceanSurface(simulationParameters, threadManager, perfStats);
+        });
+
+    auto const oceanFloorTaskId = mSubsystemUpdateTaskGraph.AddTask(
+        [this, &simulationParameters]()
+        {
+            mOceanFloor.Update(simulationParameters);
+        });
+
+    auto const shipsTaskId = mSubsystemUpdateTaskGraph.AddTask(
+        [this, &simulationParameters, stressRenderMode, &threadManager, &perfStats]()
+        {
+            UpdateShips(simulationParameters, stressRenderMode, threadManager, perfStats);
+        },
+        { oceanSurfaceTaskId, oceanFloorTaskId });
+
+    mSubsystemUpdateTaskGraph.AddTask(
+        [this, &simulationParameters, &threadManager, &perfStats]()
+        {
+            UpdateNpcs(simulationParameters, threadManager, perfStats);
+        },
+        { shipsTaskId });
+
+    mSubsystemUpdateTaskGraph.AddTask(
+        [this, &simulationParameters, &viewModel, &perfStats]()
+        {
+            UpdateFishes(simulationParameters, viewModel, mPreviousShipExternalAABBs, perfStats);
+        },
+        { oceanSurfaceTaskId, oceanFloorTaskId });
+
+    mSubsystemUpdateTaskGraph.AddTask(
+        [this, &simulationParameters]()
+        {
+            UpdateUnderwaterPlants(simulationParameters);
+        },
+        { oceanSurfaceTaskId, oceanFloorTaskId });
+
+    mSubsystemUpdateTaskGraph.AddTask(
+        [this, &simulationParameters]()
+        {
+            FS_PROFILE_ZONE("World::UpdateStarsAndClouds");
+
+            mStars.Update(mCurrentSimulationTime, simulationParameters);
+
+            mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), simulationParameters);
+        });
+
+    mAreShipsUpdatingConcurrently = true;
+    mAreFishesUpdatingConcurrently = true;
+    mSimulationEventHandler.StartDeferringSinkCalls();
+
+    threadManager.GetSimulationThreadPool().Run(mSubsystemUpdateTaskGraph);
+    mSubsystemUpdateTaskGraph.Clear();
+
+    mSimulationEventHandler.StopDeferringSinkCalls();
+    mAreFishesUpdatingConcurrently = false;
+    mAreShipsUpdatingConcurrently = false;
+
+    // Deliver disturbances to fishes, in the order in which they were made
+    for (auto const & disturbance : mDeferredOceanDisturbances)
+    {
+        if (disturbance.Position.has_value())
+        {
+            mFishes.DisturbAt(*disturbance.Position, disturbance.FishScareRadius, disturbance.Delay);
+        }
+        else
+        {
+            mFishes.TriggerWidespreadPanic(disturbance.Delay);
+        }
+    }
+
+    mDeferredOceanDisturbances.clear();
+
+    // Now that nobody else is displacing the ocean surface
+    mFishes.ApplyOceanSurfaceDisplacements(mOceanSurface);
+}
+
+void World::UpdateOceanSurface(
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager,
+    PerfStats & perfStats)
+{
+    FS_PROFILE_ZONE("OceanSurface::Update");
+
+    auto const startTime = std::chrono::steady_clock::now();
+
+    mOceanSurface.Update(mCurrentSimulationTime, mWind, simulationParameters, threadManager);
+
+    perfStats.Update<PerfMeasurement::TotalOceanSurfaceUpdate>(std::chrono::steady_clock::now() - startTime);
+}
+
+void World::UpdateShips(
+    SimulationParameters const & simulationParameters,
+    StressRenderModeType stressRenderMode,
+    ThreadManager & threadManager,
+    PerfStats & perfStats)
+{
+    FS_PROFILE_ZONE("World::UpdateShips");
+
+    auto const startTime = std::chrono::steady_clock::now();
+
+    if (ShouldUpdateShipsConcurrently(simulationParameters, threadManager))
+    {
+        UpdateShipsConcurrently(
             simulationParameters,
             stressRenderMode,
-            mAllShipExternalAABBs,
             threadManager,
             perfStats);
     }
-
+    else
     {
-        auto const startTime = std::chrono::steady_clock::now();
+        for (auto & ship : mAllShips)
+        {
+            ship->Update(
+                mCurrentSimulationTime,
+                mStorm.GetParameters(),
+                simulationParameters,
+                stressRenderMode,
+                mAllShipExternalAABBs,
+                threadManager,
+                perfStats);
+        }
+    }
 
-        assert(mNpcs);
-        mNpcs->Update(mCurrentSimulationTime, mStorm.GetParameters(), simulationParameters);
+    perfStats.Update<PerfMeasurement::TotalShipsUpdate>(std::chrono::steady_clock::now() - startTime);
+}
 
-        perfStats.Update<PerfMeasurement::TotalNpcUpdate>(std::chrono::steady_clock::now() - startTime);
-    }
+void World::UpdateNpcs(
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager,
+    PerfStats & perfStats)
+{
+    FS_PROFILE_ZONE("Npcs::Update");
+
+    auto const startTime = std::chrono::steady_clock::now();
+
+    assert(mNpcs);
+    mNpcs->Update(mCurrentSimulationTime, mStorm.GetParameters(), simulationParameters, threadManager);
+
+    perfStats.Update<PerfMeasurement::TotalNpcUpdate>(std::chrono::steady_clock::now() - startTime);
+}
+
+void World::UpdateFishes(
+    SimulationParameters const & simulationParameters,
+    ViewModel const & viewModel,
+    Geometry::ShipAABBSet const & shipExternalAABBs,
+    PerfStats & perfStats)
+{
+    FS_PROFILE_ZONE("Fishes::Update");
+
+    auto const startTime = std::chrono::steady_clock::now();
 
+    mFishes.Update(mCurrentSimulationTime, mOceanSurface, mOceanFloor, simulationParameters, viewModel.GetVisibleWorld(), shipExternalAABBs);
+
+    perfStats.Update<PerfMeasurement::TotalFishUpdate>(std::chrono::steady_clock::now() - startTime);
+}
+
+void World::UpdateUnderwaterPlants(SimulationParameters const & simulationParameters)
+{
+    FS_PROFILE_ZONE("UnderwaterPlants::Update");
+
+    mUnderwaterPlants.Update(mCurrentSimulationTime, mWind, mOceanSurface, mOceanFloor, simulationParameters);
+}
+
+bool World::ShouldUpdateShipsConcurrently(
+    SimulationParameters const & simulationParameters,
+    ThreadManager const & threadManager) const
+{
+    size_t const simulationParallelism = threadManager.GetSimulationParallelism();
+
+    if (!simulationParameters.DoConcurrentShipUpdates
+        || mAllShips.size() < 2
+        || simulationParallelism < 2)
     {
-        auto const startTime = std::chrono::steady_clock::now();
+        return false;
+    }
 
-        mFishes.Update(mCurrentSimulationTime, mOceanSurface, mOceanFloor, simulationParameters, viewModel.GetVisibleWorld(), mAllShipExternalAABBs);
+    //
+    // Ships parallelize internally over their points, hence a ship that is large enough
+    // to keep all threads busy on its own - and that makes for most of the work - gains
+    // nothing from running alongside the others; otherwise, small ships leave threads idle
+    //
+
+    size_t constexpr PointsPerThread = 2000; // Same as ships' own partitioning
 
-        perfStats.Update<PerfMeasurement::TotalFishUpdate>(std::chrono::steady_clock::now() - startTime);
+    size_t totalPointCount = 0;
+    size_t maxShipPointCount = 0;
+    for (auto const & ship : mAllShips)
+    {
+        size_t const shipPointCount = ship->GetPointCount();
+        totalPointCount += shipPointCount;
+        maxShipPointCount = std::max(maxShipPointCount, shipPointCount);
     }
 
-    mUnderwaterPlants.Update(mCurrentSimulationTime, mWind, mOceanSurface, mOceanFloor, simulationParameters);
+    bool const isLargestShipSaturating = maxShipPointCount >= PointsPerThread * simulationParallelism;
+    bool const isLargestShipDominating = maxShipPointCount * 2 >= totalPointCount;
+
+    return !(isLargestShipSaturating && isLargestShipDominating);
+}
 
+void World::UpdateShipsConcurrently(
+    SimulationParameters const & simulationParameters,
+    StressRenderModeType stressRenderMode,
+    ThreadManager & threadManager,
+    PerfStats & perfStats)
+{
     //
-    // Signal update end (for quantities/state that needed to persist during whole Update cycle)
+    // Each ship is a task, which in turn runs its own parallel tasks on the same pool;
+    // while ships are updating:
+    //  - Each ship outputs its AABBs into its own set;
+    //  - Changes to world-level state are serialized (see LockForShipSideEffects());
+    //  - Events are queued, and delivered to sinks by this thread;
+    //  - Each ship draws random numbers from its own engine, as it does when updated serially
     //
 
-    mWind.UpdateEnd();
+    mPerShipExternalAABBs.resize(mAllShips.size());
 
-    for (auto & ship : mAllShips)
+    // Largest ships first, so that they're picked up first; ties keep their ship order,
+    // as a stable sort would, without the latter's temporary buffer
+    mShipUpdateOrder.resize(mAllShips.size());
+    std::iota(mShipUpdateOrder.begin(), mShipUpdateOrder.end(), 0);
+    std::sort(
+        mShipUpdateOrder.begin(),
+        mShipUpdateOrder.end(),
+        [this](size_t l, size_t r)
+        {
+            auto const lPointCount = mAllShips[l]->GetPointCount();
+            auto const rPointCount = mAllShips[r]->GetPointCount();
+            return lPointCount > rPointCount
+                || (lPointCount == rPointCount && l < r);
+        });
+
+    assert(mShipUpdateTasks.empty());
+    for (size_t const s : mShipUpdateOrder)
     {
-        ship->UpdateEnd();
+        mPerShipExternalAABBs[s].Clear();
+
+        mShipUpdateTasks.emplace_back(
+            [&, s]()
+            {
+                FS_PROFILE_ZONE("World::UpdateShip");
+
+                mAllShips[s]->Update(
+                    mCurrentSimulationTime,
+                    mStorm.GetParameters(),
+                    simulationParameters,
+                    stressRenderMode,
+                    mPerShipExternalAABBs[s],
+                    threadManager,
+                    perfStats);
+            });
     }
 
-    mNpcs->UpdateEnd();
+    // Already so when all subsystems are updating concurrently
+    bool const isNested = mAreShipsUpdatingConcurrently;
 
-    mOceanFloor.UpdateEnd();
+    if (!isNested)
+    {
+        mAreShipsUpdatingConcurrently = true;
+        mSimulationEventHandler.StartDeferringSinkCalls();
+    }
+
+    mAreShipsUpdatingAlongsideEachOther = true;
+
+    threadManager.GetSimulationThreadPool().RunAndClear(mShipUpdateTasks);
+
+    mAreShipsUpdatingAlongsideEachOther = false;
+
+    if (!isNested)
+    {
+        mSimulationEventHandler.StopDeferringSinkCalls();
+        mAreShipsUpdatingConcurrently = false;
+    }
+
+    // Merge AABBs in ship order, as if ships had been updated serially
+    for (auto const & shipExternalAABBs : mPerShipExternalAABBs)
+    {
+        for (auto const & aabb : shipExternalAABBs.GetItems())
+        {
+            mAllShipExternalAABBs.Add(aabb);
+        }
+    }
 }
 
 void World::RenderUpload(
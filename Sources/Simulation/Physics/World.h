@@ -28,10 +28,14 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <vector>
 
+// Tests of the world's internals
+class WorldTests;
+
 namespace Physics
 {
 
@@ -45,7 +49,8 @@ public:
         size_t underwaterPlantsSpeciesCount,
         NpcDatabase const & npcDatabase,
         SimulationEventDispatcher & simulationEventDispatcher,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
     ShipId GetNextShipId() const;
 
@@ -68,6 +73,8 @@ public:
 
     size_t GetShipPointCount(ShipId shipId) const;
 
+    size_t GetAllShipPointCount() const;
+
     size_t GetAllShipSpringCount() const;
 
     size_t GetAllShipTriangleCount() const;
@@ -88,6 +95,9 @@ public:
         return *mNpcs;
     }
 
+    /*
+     * During their update, ships must modify NPCs while holding LockForShipSideEffects().
+     */
     Npcs & GetNpcs()
     {
         assert(!!mNpcs);
@@ -95,12 +105,35 @@ public:
         return *mNpcs;
     }
 
+    /*
+     * Serializes changes to world-level state - NPCs, fishes, ocean surface - made by ships
+     * during their update, as ships might be updating concurrently - with each other or with
+     * other subsystems; a no-op otherwise.
+     */
+    inline std::unique_lock<std::mutex> LockForShipSideEffects()
+    {
+        return mAreShipsUpdatingConcurrently
+            ? std::unique_lock<std::mutex>(mShipSideEffectsLock)
+            : std::unique_lock<std::mutex>();
+    }
+
+    /*
+     * Whether ships are being updated alongside each other, in which case none of them
+     * may count on having all simulation threads to itself.
+     */
+    bool AreShipsUpdatingAlongsideEachOther() const
+    {
+        return mAreShipsUpdatingAlongsideEachOther;
+    }
+
     inline void DisturbOceanAt(
         vec2f const & position,
         float fishScareRadius,
         std::chrono::milliseconds delay)
     {
-        mFishes.DisturbAt(
+        auto const lock = LockForShipSideEffects();
+
+        DisturbOceanAtWhileLocked(
             position,
             fishScareRadius,
             delay);
@@ -108,7 +141,16 @@ public:
 
     inline void DisturbOcean(std::chrono::milliseconds delay)
     {
-        mFishes.TriggerWidespreadPanic(delay);
+        auto const lock = LockForShipSideEffects();
+
+        if (mAreFishesUpdatingConcurrently)
+        {
+            mDeferredOceanDisturbances.push_back({ std::nullopt, 0.0f, delay });
+        }
+        else
+        {
+            mFishes.TriggerWidespreadPanic(delay);
+        }
     }
 
     OceanSurface const & GetOceanSurface() const
@@ -122,6 +164,8 @@ public:
         float x,
         float yOffset)
     {
+        auto const lock = LockForShipSideEffects();
+
         mOceanSurface.DisplaceAt(x, yOffset);
     }
 
@@ -504,6 +548,72 @@ public:
         SimulationParameters const & simulationParameters,
         RenderContext & renderContext);
 
+private:
+
+    bool ShouldUpdateSubsystemsConcurrently(
+        SimulationParameters const & simulationParameters,
+        ThreadManager const & threadManager) const;
+
+    void UpdateSubsystemsConcurrently(
+        SimulationParameters const & simulationParameters,
+        ViewModel const & viewModel,
+        StressRenderModeType stressRenderMode,
+        ThreadManager & threadManager,
+        PerfStats & perfStats);
+
+    void UpdateOceanSurface(
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager,
+        PerfStats & perfStats);
+
+    void UpdateShips(
+        SimulationParameters const & simulationParameters,
+        StressRenderModeType stressRenderMode,
+        ThreadManager & threadManager,
+        PerfStats & perfStats);
+
+    void UpdateNpcs(
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager,
+        PerfStats & perfStats);
+
+    void UpdateFishes(
+        SimulationParameters const & simulationParameters,
+        ViewModel const & viewModel,
+        Geometry::ShipAABBSet const & shipExternalAABBs,
+        PerfStats & perfStats);
+
+    void UpdateUnderwaterPlants(SimulationParameters const & simulationParameters);
+
+    bool ShouldUpdateShipsConcurrently(
+        SimulationParameters const & simulationParameters,
+        ThreadManager const & threadManager) const;
+
+    void UpdateShipsConcurrently(
+        SimulationParameters const & simulationParameters,
+        StressRenderModeType stressRenderMode,
+        ThreadManager & threadManager,
+        PerfStats & perfStats);
+
+    // Requires the lock for ship side effects to be held, if needed
+    inline void DisturbOceanAtWhileLocked(
+        vec2f const & position,
+        float fishScareRadius,
+        std::chrono::milliseconds delay)
+    {
+        if (mAreFishesUpdatingConcurrently)
+        {
+            mDeferredOceanDisturbances.push_back({ position, fishScareRadius, delay });
+        }
+        else
+        {
+            mFishes.DisturbAt(
+                position,
+                fishScareRadius,
+                delay);
+        }
+    }
+
 private:
 
     // The current simulation time
@@ -530,6 +640,43 @@ private:
     // The set of all ships' external AABB's in the world, updated at each
     // simulation cycle and at each ship addition
     Geometry::ShipAABBSet mAllShipExternalAABBs;
+
+    //
+    // Concurrent ship updates
+    //
+
+    bool mAreShipsUpdatingConcurrently;
+    bool mAreShipsUpdatingAlongsideEachOther;
+    std::mutex mShipSideEffectsLock;
+
+    // One per ship, merged into mAllShipExternalAABBs in ship order
+    std::vector<Geometry::ShipAABBSet> mPerShipExternalAABBs;
+    std::vector<size_t> mShipUpdateOrder;
+    std::vector<ThreadPool::Task> mShipUpdateTasks;
+
+    //
+    // Concurrent subsystem updates
+    //
+
+    // The ships' external AABBs as of the previous simulation step
+    Geometry::ShipAABBSet mPreviousShipExternalAABBs;
+
+    struct DeferredOceanDisturbance
+    {
+        std::optional<vec2f> Position; // None for widespread panic
+        float FishScareRadius;
+        std::chrono::milliseconds Delay;
+    };
+
+    // While fishes are updating alongside ships, disturbances are queued here
+    bool mAreFishesUpdatingConcurrently;
+    std::vector<DeferredOceanDisturbance> mDeferredOceanDisturbances;
+
+    ThreadPool::TaskGraph mSubsystemUpdateTaskGraph;
+
+private:
+
+    friend class ::WorldTests;
 };
 
 }
@@ -13,6 +13,7 @@
 #include <Core/GameMath.h>
 #include <Core/ImageTools.h>
 #include <Core/Log.h>
+#include <Core/TaskThread.h>
 
 #include <algorithm>
 #include <cassert>
@@ -35,10 +36,21 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
     ShipStrengthRandomizer const & shipStrengthRandomizer,
     SimulationEventDispatcher & simulationEventDispatcher,
     IAssetManager const & assetManager,
-    SimulationParameters const & simulationParameters)
+    SimulationParameters const & simulationParameters,
+    ThreadManager & threadManager)
 {
     auto const totalStartTime = GameChronometer::Now();
 
+    // Timings of the load stages, logged at the end
+    std::vector<std::pair<char const *, GameChronometer::duration>> stageDurations;
+    auto stageStartTime = totalStartTime;
+    auto const completeStage = [&](char const * stageName)
+    {
+        auto const now = GameChronometer::Now();
+        stageDurations.emplace_back(stageName, now - stageStartTime);
+        stageStartTime = now;
+    };
+
     //
     // Process load options
     //
@@ -61,6 +73,75 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         shipDefinition.Layers.Rotate90(RotationDirectionType::Clockwise);
     }
 
+    //
+    // Create exterior and interior textures - on a separate thread, as they
+    // only depend on the structural layer, which from now on is read-only
+    //
+
+    // Load the material textures that auto-texturization will need - concurrently, while
+    // the thread pool is still free
+    if (!shipDefinition.Layers.ExteriorTextureLayer || !shipDefinition.Layers.InteriorTextureLayer)
+    {
+        shipTexturizer.PreloadMaterialTextures(
+            *shipDefinition.Layers.StructuralLayer,
+            assetManager,
+            threadManager.GetSimulationThreadPool());
+    }
+
+    completeStage("materialTextures");
+
+    std::optional<RgbaImageData> exteriorTextureImage;
+    std::optional<RgbaImageData> interiorTextureImage;
+    GameChronometer::duration texturizationDuration;
+
+    TaskThread texturizationThread(
+        ThreadManager::ThreadTaskKind::Other,
+        "FS ShipTexturizationThread",
+        0,
+        threadManager.GetSimulationParallelism() > 1,
+        threadManager);
+
+    auto const texturizationCompletionIndicator = texturizationThread.QueueTask(
+        [&]()
+        {
+            auto const texturizationStartTime = GameChronometer::Now();
+
+            //
+            // Create exterior texture
+            //
+
+            exteriorTextureImage.emplace(shipDefinition.Layers.ExteriorTextureLayer
+                ? std::move(shipDefinition.Layers.ExteriorTextureLayer->Buffer) // Use provided texture
+                : shipTexturizer.MakeAutoTexture(
+                    *shipDefinition.Layers.StructuralLayer,
+                    shipDefinition.AutoTexturizationSettings, // Auto-texturize
+                    ShipTexturizer::MaxHighDefinitionTextureSize,
+                    assetManager));
+
+            //
+            // Create interior texture
+            //
+
+            interiorTextureImage.emplace(shipDefinition.Layers.InteriorTextureLayer
+                ? std::move(shipDefinition.Layers.InteriorTextureLayer->Buffer) // Use provided texture
+                : shipTexturizer.MakeAutoTexture(
+                    *shipDefinition.Layers.StructuralLayer,
+                    ShipAutoTexturizationSettings( // Custom
+                        ShipAutoTexturizationModeType::MaterialTextures,
+                        0.15f,
+                        0.45f),
+                    ShipTexturizer::MaxHighDefinitionTextureSize,
+                    assetManager));
+
+            // Whiteout
+            ImageTools::BlendWithColor(
+                *interiorTextureImage,
+                rgbColor(rgbColor::data_type_max, rgbColor::data_type_max, rgbColor::data_type_max),
+                0.5f);
+
+            texturizationDuration = GameChronometer::Now() - texturizationStartTime;
+        });
+
     //
     // Process structural ship layer and:
     // - Create ShipFactoryPoint's for each particle, including ropes' endpoints
@@ -204,6 +285,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         }
     }
 
+    completeStage("points");
+
     //
     // Process the rope endpoints and:
     // - Fill-in points between the endpoints, creating additional ShipFactoryPoint's for them
@@ -214,6 +297,7 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
     std::vector<ShipFactorySpring> springInfos1;
 
     ShipFactoryPointPairToIndexMap pointPairToSpringIndex1Map;
+    pointPairToSpringIndex1Map.Reserve(pointInfos1.size() * 4); // Up to four springs per point, plus ropes'
 
     if (shipDefinition.Layers.RopesLayer)
     {
@@ -224,6 +308,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
             pointInfos1,
             springInfos1,
             pointPairToSpringIndex1Map);
+
+        completeStage("ropes");
     }
 
     //
@@ -244,7 +330,10 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         springInfos1,
         pointPairToSpringIndex1Map,
         triangleInfos,
-        leakingPointsCount);
+        leakingPointsCount,
+        threadManager.GetSimulationThreadPool());
+
+    completeStage("elementInfos");
 
     //
     // Filter out redundant triangles
@@ -263,6 +352,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         pointInfos1,
         triangleInfos);
 
+    completeStage("triangles");
+
     //
     // Optimize order of ShipFactoryPoint's and ShipFactorySpring's for our spring
     // relaxation algorithm - and hopefully to improve cache hits
@@ -273,6 +364,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         pointInfos1,
         springInfos1);
 
+    completeStage("layout");
+
     // Note: we don't optimize triangles, as tests indicate that performance gets (marginally) worse,
     // and at the same time, it makes sense to use the natural order of the triangles as it ensures
     // that higher elements in the ship cover lower elements when they are semi-detached.
@@ -286,6 +379,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         triangleInfos,
         pointIndexRemap);
 
+    completeStage("springsAndTriangles");
+
     //
     // Create frontiers
     //
@@ -298,6 +393,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         pointPairToSpringIndex1Map,
         springIndexRemap);
 
+    completeStage("frontiers");
+
     //
     // Randomize strength
     //
@@ -312,6 +409,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         triangleInfos,
         shipFactoryFrontiers);
 
+    completeStage("strength");
+
     //
     // Create floorplan
     //
@@ -324,6 +423,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         pointIndexRemap,
         springInfos2);
 
+    completeStage("floorplan");
+
     //
     // Visit all ShipFactoryPoint's and create Points, i.e. the entire set of points
     //
@@ -387,38 +488,18 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         points,
         springs);
 
-    //
-    // Create exterior texture
-    //
-
-    RgbaImageData exteriorTextureImage = shipDefinition.Layers.ExteriorTextureLayer
-        ? std::move(shipDefinition.Layers.ExteriorTextureLayer->Buffer) // Use provided texture
-        : shipTexturizer.MakeAutoTexture(
-            *shipDefinition.Layers.StructuralLayer,
-            shipDefinition.AutoTexturizationSettings, // Auto-texturize
-            ShipTexturizer::MaxHighDefinitionTextureSize,
-            assetManager);
+    completeStage("elements");
 
     //
-    // Create interior texture
+    // Wait for textures
     //
 
-    RgbaImageData interiorTextureImage = shipDefinition.Layers.InteriorTextureLayer
-        ? std::move(shipDefinition.Layers.InteriorTextureLayer->Buffer) // Use provided texture
-        : shipTexturizer.MakeAutoTexture(
-            *shipDefinition.Layers.StructuralLayer,
-            ShipAutoTexturizationSettings( // Custom
-                ShipAutoTexturizationModeType::MaterialTextures,
-                0.15f,
-                0.45f),
-            ShipTexturizer::MaxHighDefinitionTextureSize,
-            assetManager);
+    texturizationCompletionIndicator->Wait();
 
-    // Whiteout
-    ImageTools::BlendWithColor(
-        interiorTextureImage,
-        rgbColor(rgbColor::data_type_max, rgbColor::data_type_max, rgbColor::data_type_max),
-        0.5f);
+    assert(exteriorTextureImage.has_value());
+    assert(interiorTextureImage.has_value());
+
+    completeStage("texturizationWait");
 
     //
     // Create interior view
@@ -428,7 +509,9 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         triangles,
         points,
         shipSize,
-        interiorTextureImage);
+        *interiorTextureImage);
+
+    completeStage("interiorView");
 
     //
     // We're done!
@@ -448,7 +531,18 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         electricalElements.GetElementCount(), " electrical elements (", electricalElements.GetLampCount(), " lamps), ",
         frontiers.GetElementCount(), " frontiers.");
 
-    LogMessage("             Exterior texture: W=", exteriorTextureImage.Size.width, " H=", exteriorTextureImage.Size.height);
+    LogMessage("             Exterior texture: W=", exteriorTextureImage->Size.width, " H=", exteriorTextureImage->Size.height);
+
+    {
+        std::stringstream ss;
+        for (auto const & [stageName, stageDuration] : stageDurations)
+        {
+            ss << " " << stageName << "=" << std::chrono::duration_cast<std::chrono::microseconds>(stageDuration).count() << "us";
+        }
+
+        LogMessage("             Stages:", ss.str(), " (texturization=",
+            std::chrono::duration_cast<std::chrono::microseconds>(texturizationDuration).count(), "us, concurrently)");
+    }
 
     auto ship = std::make_unique<Ship>(
         shipId,
@@ -460,14 +554,14 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData, RgbaImageData> ShipFac
         std::move(triangles),
         std::move(electricalElements),
         std::move(frontiers),
-        std::move(interiorTextureImage));
+        std::move(*interiorTextureImage));
 
     LogMessage("ShipFactory: Create() took ",
         std::chrono::duration_cast<std::chrono::microseconds>(GameChronometer::Now() - totalStartTime).count(), "us");
 
     return std::make_tuple(
         std::move(ship),
-        std::move(exteriorTextureImage),
+        std::move(*exteriorTextureImage),
         std::move(interiorViewImage));
 }
 
@@ -642,7 +736,7 @@ void ShipFactory::AppendRopes(
                 factoryDirectionStart);
 
             // Add spring to point pair map
-            auto const [_, isInserted] = pointPairToSpringIndex1Map.try_emplace({ curStartPointIndex1 , newPointIndex1 }, springIndex1);
+            bool const isInserted = pointPairToSpringIndex1Map.TryAdd({ curStartPointIndex1 , newPointIndex1 }, springIndex1);
             assert(isInserted);
             (void)isInserted;
 
@@ -681,7 +775,7 @@ void ShipFactory::AppendRopes(
             factoryDirectionStart);
 
         // Add spring to point pair map
-        auto const [_, isInserted] = pointPairToSpringIndex1Map.try_emplace(
+        bool const isInserted = pointPairToSpringIndex1Map.TryAdd(
             { curStartPointIndex1, pointBIndex1 },
             lastSpringIndex1);
         assert(isInserted);
@@ -699,7 +793,8 @@ void ShipFactory::CreateShipElementInfos(
     std::vector<ShipFactorySpring> & springInfos1,
     ShipFactoryPointPairToIndexMap & pointPairToSpringIndex1Map,
     std::vector<ShipFactoryTriangle> & triangleInfos1,
-    size_t & leakingPointsCount)
+    size_t & leakingPointsCount,
+    ThreadPool & threadPool)
 {
     //
     // Visit point matrix and:
@@ -707,227 +802,247 @@ void ShipFactory::CreateShipElementInfos(
     //  - Detect springs and create ShipFactorySpring's for them (additional to ropes)
     //  - Do tessellation and create ShipFactoryTriangle's
     //
+    // Rows are independent of each other, hence we visit them in parallel, and then
+    // we concatenate their elements from bottom to top - so that elements come out
+    // in the same order as if we had visited rows serially
+    //
+
+    static size_t constexpr MinRowsPerThread = 16;
+
+    std::vector<RowElementInfos> rowElementInfos(pointIndexMatrix.height);
+
+    threadPool.ParallelFor(
+        1, // Excluding extras at boundaries
+        pointIndexMatrix.height - 1,
+        MinRowsPerThread,
+        [&pointIndexMatrix, &pointInfos1, &rowElementInfos](size_t startY, size_t endY)
+        {
+            for (size_t y = startY; y < endY; ++y)
+            {
+                CreateRowElementInfos(
+                    static_cast<int>(y),
+                    pointIndexMatrix,
+                    pointInfos1,
+                    rowElementInfos[y]);
+            }
+        });
 
     // Initialize count of leaking points
     leakingPointsCount = 0;
 
-    // From bottom to top - excluding extras at boundaries
-    for (int y = 1; y < pointIndexMatrix.height - 1; ++y)
+    // From bottom to top
+    for (auto const & row : rowElementInfos)
     {
-        // We're starting a new row, so we're not in a ship now
-        bool isRowInShip = false;
+        for (auto const & springInfo : row.SpringInfos1)
+        {
+            // Add spring to spring infos
+            ElementIndex const springIndex1 = static_cast<ElementIndex>(springInfos1.size());
+            springInfos1.push_back(springInfo);
+
+            // Add spring to point pair map
+            bool const isInserted = pointPairToSpringIndex1Map.TryAdd(
+                { springInfo.PointAIndex, springInfo.PointBIndex },
+                springIndex1);
+            assert(isInserted);
+            (void)isInserted;
+
+            // Add the spring to its endpoints
+            pointInfos1[springInfo.PointAIndex].AddConnectedSpring1(springIndex1);
+            pointInfos1[springInfo.PointBIndex].AddConnectedSpring1(springIndex1);
+        }
+
+        triangleInfos1.insert(
+            triangleInfos1.end(),
+            row.TriangleInfos1.cbegin(),
+            row.TriangleInfos1.cend());
+
+        leakingPointsCount += row.LeakingPointsCount;
+    }
+}
 
-        // From left to right - excluding extras at boundaries
-        for (int x = 1; x < pointIndexMatrix.width - 1; ++x)
+void ShipFactory::CreateRowElementInfos(
+    int y,
+    ShipFactoryPointIndexMatrix const & pointIndexMatrix,
+    std::vector<ShipFactoryPoint> & pointInfos1,
+    RowElementInfos & rowElementInfos)
+{
+    //
+    // Note: we only modify points of this row
+    //
+
+    auto & springInfos1 = rowElementInfos.SpringInfos1;
+    auto & triangleInfos1 = rowElementInfos.TriangleInfos1;
+
+    // We're starting a new row, so we're not in a ship now
+    bool isRowInShip = false;
+
+    // From left to right - excluding extras at boundaries
+    for (int x = 1; x < pointIndexMatrix.width - 1; ++x)
+    {
+        if (!!pointIndexMatrix[{x, y}])
         {
-            if (!!pointIndexMatrix[{x, y}])
-            {
-                //
-                // A point exists at these coordinates
-                //
+            //
+            // A point exists at these coordinates
+            //
 
-                ElementIndex pointIndex1 = *pointIndexMatrix[{x, y}];
+            ElementIndex pointIndex1 = *pointIndexMatrix[{x, y}];
 
-                // If a non-hull node has empty space on one of its four sides, it is leaking.
-                // Check if a is leaking; a is leaking if:
-                // - a is not hull, AND
-                // - there is at least a hole at E, S, W, N
-                if (!pointInfos1[pointIndex1].StructuralMtl.IsHull)
+            // If a non-hull node has empty space on one of its four sides, it is leaking.
+            // Check if a is leaking; a is leaking if:
+            // - a is not hull, AND
+            // - there is at least a hole at E, S, W, N
+            if (!pointInfos1[pointIndex1].StructuralMtl.IsHull)
+            {
+                if (!pointIndexMatrix[{x + 1, y}]
+                    || !pointIndexMatrix[{x, y + 1}]
+                    || !pointIndexMatrix[{x - 1, y}]
+                    || !pointIndexMatrix[{x, y - 1}])
                 {
-                    if (!pointIndexMatrix[{x + 1, y}]
-                        || !pointIndexMatrix[{x, y + 1}]
-                        || !pointIndexMatrix[{x - 1, y}]
-                        || !pointIndexMatrix[{x, y - 1}])
-                    {
-                        pointInfos1[pointIndex1].IsLeaking = true;
-                        ++leakingPointsCount;
-                    }
+                    pointInfos1[pointIndex1].IsLeaking = true;
+                    ++(rowElementInfos.LeakingPointsCount);
                 }
+            }
 
-                //
-                // Springs
-                //
+            //
+            // Springs
+            //
 
-                // First four directions out of 8: from 0 deg (+x) through to 225 deg (-x -y),
-                // i.e. E, SE, S, SW - this covers each pair of points in each direction
-                for (int i = 0; i < 4; ++i)
-                {
-                    int adjx1 = x + TessellationCircularOrderDirections[i][0];
-                    int adjy1 = y + TessellationCircularOrderDirections[i][1];
+            // First four directions out of 8: from 0 deg (+x) through to 225 deg (-x -y),
+            // i.e. E, SE, S, SW - this covers each pair of points in each direction
+            for (int i = 0; i < 4; ++i)
+            {
+                int adjx1 = x + TessellationCircularOrderDirections[i][0];
+                int adjy1 = y + TessellationCircularOrderDirections[i][1];
 
-                    if (!!pointIndexMatrix[{adjx1, adjy1}])
-                    {
-                        // This point is adjacent to the first point at one of E, SE, S, SW
+                if (!!pointIndexMatrix[{adjx1, adjy1}])
+                {
+                    // This point is adjacent to the first point at one of E, SE, S, SW
 
-                        //
-                        // Create ShipFactorySpring
-                        //
+                    //
+                    // Create ShipFactorySpring
+                    //
 
-                        ElementIndex const otherEndpointIndex1 = *pointIndexMatrix[{adjx1, adjy1}];
+                    ElementIndex const otherEndpointIndex1 = *pointIndexMatrix[{adjx1, adjy1}];
 
-                        // Add spring to spring infos
-                        ElementIndex const springIndex1 = static_cast<ElementIndex>(springInfos1.size());
-                        springInfos1.emplace_back(
-                            pointIndex1,
-                            i,
-                            otherEndpointIndex1,
-                            (i + 4) % 8);
-
-                        // Add spring to point pair map
-                        auto [_, isInserted] = pointPairToSpringIndex1Map.try_emplace(
-                            { pointIndex1, otherEndpointIndex1 },
-                            springIndex1);
-                        assert(isInserted);
-                        (void)isInserted;
-
-                        // Add the spring to its endpoints
-                        pointInfos1[pointIndex1].AddConnectedSpring1(springIndex1);
-                        pointInfos1[otherEndpointIndex1].AddConnectedSpring1(springIndex1);
-                    }
+                    // Add spring to this row's spring infos; it will get its index
+                    // - and its endpoints - when we concatenate rows
+                    springInfos1.emplace_back(
+                        pointIndex1,
+                        i,
+                        otherEndpointIndex1,
+                        (i + 4) % 8);
                 }
+            }
 
-                //
-                // Triangles
-                //
+            //
+            // Triangles
+            //
 
-                //              P
-                //  W (4) o --- * --- o  E (0)
-                //            / | \
-                //           /  |  \
-                //          /   |   \
-                //  SW (3) o    o    o SE (1)
-                //             S (2)
-                //
+            //              P
+            //  W (4) o --- * --- o  E (0)
+            //            / | \
+            //           /  |  \
+            //          /   |   \
+            //  SW (3) o    o    o SE (1)
+            //             S (2)
+            //
 
-                // - If this is the first point in the row that is in a ship, we check from E CW all the way up to SW;
-                // - Else, we check only up to S, so to avoid covering areas already covered by the triangulation
-                //   at the previous point
-                //
+            // - If this is the first point in the row that is in a ship, we check from E CW all the way up to SW;
+            // - Else, we check only up to S, so to avoid covering areas already covered by the triangulation
+            //   at the previous point
+            //
 
-                //
-                // Quad: P - E - SE - S
-                //
+            //
+            // Quad: P - E - SE - S
+            //
 
-                auto const pointECoordinates = vec2i(x + TessellationCircularOrderDirections[0][0], y + TessellationCircularOrderDirections[0][1]);
-                auto const & pointE = pointIndexMatrix[pointECoordinates];
-                auto const pointSECoordinates = vec2i(x + TessellationCircularOrderDirections[1][0], y + TessellationCircularOrderDirections[1][1]);
-                auto const & pointSE = pointIndexMatrix[pointSECoordinates];
-                auto const pointSCoordinates = vec2i(x + TessellationCircularOrderDirections[2][0], y + TessellationCircularOrderDirections[2][1]);
-                auto const & pointS = pointIndexMatrix[pointSCoordinates];
+            auto const pointECoordinates = vec2i(x + TessellationCircularOrderDirections[0][0], y + TessellationCircularOrderDirections[0][1]);
+            auto const & pointE = pointIndexMatrix[pointECoordinates];
+            auto const pointSECoordinates = vec2i(x + TessellationCircularOrderDirections[1][0], y + TessellationCircularOrderDirections[1][1]);
+            auto const & pointSE = pointIndexMatrix[pointSECoordinates];
+            auto const pointSCoordinates = vec2i(x + TessellationCircularOrderDirections[2][0], y + TessellationCircularOrderDirections[2][1]);
+            auto const & pointS = pointIndexMatrix[pointSCoordinates];
 
-                if (pointE.has_value())
+            if (pointE.has_value())
+            {
+                if (pointSE.has_value())
                 {
-                    if (pointSE.has_value())
+                    if (pointS.has_value())
                     {
-                        if (pointS.has_value())
-                        {
-                            //
-                            // We can choose if two triangles along P-SE diagonal, or two triangles along S-E diagonal;
-                            // we prioritize the one that is hull, so we honor hull edges for NPC floors (since floors
-                            // may only exist on hull springs)
-                            //
+                        //
+                        // We can choose if two triangles along P-SE diagonal, or two triangles along S-E diagonal;
+                        // we prioritize the one that is hull, so we honor hull edges for NPC floors (since floors
+                        // may only exist on hull springs)
+                        //
 
-                            bool const isP_SE_hull = pointInfos1[pointIndex1].StructuralMtl.IsHull && pointInfos1[*pointSE].StructuralMtl.IsHull;
-                            bool const isS_E_hull = pointInfos1[*pointS].StructuralMtl.IsHull && pointInfos1[*pointE].StructuralMtl.IsHull;
+                        bool const isP_SE_hull = pointInfos1[pointIndex1].StructuralMtl.IsHull && pointInfos1[*pointSE].StructuralMtl.IsHull;
+                        bool const isS_E_hull = pointInfos1[*pointS].StructuralMtl.IsHull && pointInfos1[*pointE].StructuralMtl.IsHull;
 
-                            if (isS_E_hull)
+                        if (isS_E_hull)
+                        {
+                            if (isP_SE_hull)
                             {
-                                if (isP_SE_hull)
+                                // Both are hull - the one with the most "continuations" wins
+
+                                // S-E
+                                int seCount = 0;
+                                // S.SW
+                                auto contCoord = vec2i(pointSCoordinates.x + TessellationCircularOrderDirections[3][0], pointSCoordinates.y + TessellationCircularOrderDirections[3][1]);
+                                if (pointIndexMatrix[contCoord].has_value()
+                                    && pointInfos1[*pointIndexMatrix[contCoord]].StructuralMtl.IsHull)
+                                    ++seCount;
+                                // E.NE
+                                contCoord = vec2i(pointECoordinates.x + TessellationCircularOrderDirections[7][0], pointECoordinates.y + TessellationCircularOrderDirections[7][1]);
+                                if (pointIndexMatrix[contCoord].has_value()
+                                    && pointInfos1[*pointIndexMatrix[contCoord]].StructuralMtl.IsHull)
+                                    ++seCount;
+
+                                // P-SE
+                                int pseCount = 0;
+                                // P.NW
+                                contCoord = vec2i(x + TessellationCircularOrderDirections[5][0], y + TessellationCircularOrderDirections[5][1]);
+                                if (pointIndexMatrix[contCoord].has_value()
+                                    && pointInfos1[*pointIndexMatrix[contCoord]].StructuralMtl.IsHull)
+                                    ++pseCount;
+                                // SE.SE
+                                contCoord = vec2i(pointSECoordinates.x + TessellationCircularOrderDirections[1][0], pointSECoordinates.y + TessellationCircularOrderDirections[1][1]);
+                                if (pointIndexMatrix[contCoord].has_value()
+                                    && pointInfos1[*pointIndexMatrix[contCoord]].StructuralMtl.IsHull)
+                                    ++pseCount;
+
+                                if (pseCount >= seCount)
                                 {
-                                    // Both are hull - the one with the most "continuations" wins
-
-                                    // S-E
-                                    int seCount = 0;
-                                    // S.SW
-                                    auto contCoord = vec2i(pointSCoordinates.x + TessellationCircularOrderDirections[3][0], pointSCoordinates.y + TessellationCircularOrderDirections[3][1]);
-                                    if (pointIndexMatrix[contCoord].has_value()
-                                        && pointInfos1[*pointIndexMatrix[contCoord]].StructuralMtl.IsHull)
-                                        ++seCount;
-                                    // E.NE
-                                    contCoord = vec2i(pointECoordinates.x + TessellationCircularOrderDirections[7][0], pointECoordinates.y + TessellationCircularOrderDirections[7][1]);
-                                    if (pointIndexMatrix[contCoord].has_value()
-                                        && pointInfos1[*pointIndexMatrix[contCoord]].StructuralMtl.IsHull)
-                                        ++seCount;
-
-                                    // P-SE
-                                    int pseCount = 0;
-                                    // P.NW
-                                    contCoord = vec2i(x + TessellationCircularOrderDirections[5][0], y + TessellationCircularOrderDirections[5][1]);
-                                    if (pointIndexMatrix[contCoord].has_value()
-                                        && pointInfos1[*pointIndexMatrix[contCoord]].StructuralMtl.IsHull)
-                                        ++pseCount;
-                                    // SE.SE
-                                    contCoord = vec2i(pointSECoordinates.x + TessellationCircularOrderDirections[1][0], pointSECoordinates.y + TessellationCircularOrderDirections[1][1]);
-                                    if (pointIndexMatrix[contCoord].has_value()
-                                        && pointInfos1[*pointIndexMatrix[contCoord]].StructuralMtl.IsHull)
-                                        ++pseCount;
-
-                                    if (pseCount >= seCount)
-                                    {
-                                        // P - E - SE
-
-                                        //
-                                        // Create ShipFactoryTriangle
-                                        //
-
-                                        triangleInfos1.emplace_back(
-                                            std::array<ElementIndex, 3>( // Points are in CW order
-                                                {
-                                                    pointIndex1,
-                                                    *pointE,
-                                                    *pointSE
-                                                }));
-
-                                        // P - SE - S
-
-                                        //
-                                        // Create ShipFactoryTriangle
-                                        //
-
-                                        triangleInfos1.emplace_back(
-                                            std::array<ElementIndex, 3>( // Points are in CW order
-                                                {
-                                                    pointIndex1,
-                                                    *pointSE,
-                                                    *pointS
-                                                }));
-
-                                    }
-                                    else
-                                    {
-                                        // P - E - S
-
-                                        //
-                                        // Create ShipFactoryTriangle
-                                        //
-
-                                        triangleInfos1.emplace_back(
-                                            std::array<ElementIndex, 3>( // Points are in CW order
-                                                {
-                                                    pointIndex1,
-                                                    *pointE,
-                                                    *pointS
-                                                }));
-
-                                        // S - E - SE
-
-                                        //
-                                        // Create ShipFactoryTriangle
-                                        //
-
-                                        triangleInfos1.emplace_back(
-                                            std::array<ElementIndex, 3>( // Points are in CW order
-                                                {
-                                                    *pointS,
-                                                    *pointE,
-                                                    *pointSE
-                                                }));
-                                    }
+                                    // P - E - SE
+
+                                    //
+                                    // Create ShipFactoryTriangle
+                                    //
+
+                                    triangleInfos1.emplace_back(
+                                        std::array<ElementIndex, 3>( // Points are in CW order
+                                            {
+                                                pointIndex1,
+                                                *pointE,
+                                                *pointSE
+                                            }));
+
+                                    // P - SE - S
+
+                                    //
+                                    // Create ShipFactoryTriangle
+                                    //
+
+                                    triangleInfos1.emplace_back(
+                                        std::array<ElementIndex, 3>( // Points are in CW order
+                                            {
+                                                pointIndex1,
+                                                *pointSE,
+                                                *pointS
+                                            }));
+
                                 }
                                 else
                                 {
-                                    // Only S-E is hull
-
                                     // P - E - S
 
                                     //
@@ -959,9 +1074,9 @@ void ShipFactory::CreateShipElementInfos(
                             }
                             else
                             {
-                                // Only P-SE is hull or neither is hull; in the last case P-SE wins arbitrarily
+                                // Only S-E is hull
 
-                                // P - E - SE
+                                // P - E - S
 
                                 //
                                 // Create ShipFactoryTriangle
@@ -972,10 +1087,10 @@ void ShipFactory::CreateShipElementInfos(
                                         {
                                             pointIndex1,
                                             *pointE,
-                                            *pointSE
+                                            *pointS
                                         }));
 
-                                // P - SE - S
+                                // S - E - SE
 
                                 //
                                 // Create ShipFactoryTriangle
@@ -984,14 +1099,16 @@ void ShipFactory::CreateShipElementInfos(
                                 triangleInfos1.emplace_back(
                                     std::array<ElementIndex, 3>( // Points are in CW order
                                         {
-                                            pointIndex1,
-                                            *pointSE,
-                                            *pointS
+                                            *pointS,
+                                            *pointE,
+                                            *pointSE
                                         }));
                             }
                         }
                         else
                         {
+                            // Only P-SE is hull or neither is hull; in the last case P-SE wins arbitrarily
+
                             // P - E - SE
 
                             //
@@ -1005,11 +1122,25 @@ void ShipFactory::CreateShipElementInfos(
                                         *pointE,
                                         *pointSE
                                     }));
+
+                            // P - SE - S
+
+                            //
+                            // Create ShipFactoryTriangle
+                            //
+
+                            triangleInfos1.emplace_back(
+                                std::array<ElementIndex, 3>( // Points are in CW order
+                                    {
+                                        pointIndex1,
+                                        *pointSE,
+                                        *pointS
+                                    }));
                         }
                     }
-                    else if (pointS.has_value())
+                    else
                     {
-                        // P - E - S
+                        // P - E - SE
 
                         //
                         // Create ShipFactoryTriangle
@@ -1020,13 +1151,13 @@ void ShipFactory::CreateShipElementInfos(
                                 {
                                     pointIndex1,
                                     *pointE,
-                                    *pointS
+                                    *pointSE
                                 }));
                     }
                 }
-                else if (pointSE.has_value() && pointS.has_value())
+                else if (pointS.has_value())
                 {
-                    // P - SE - S
+                    // P - E - S
 
                     //
                     // Create ShipFactoryTriangle
@@ -1036,47 +1167,63 @@ void ShipFactory::CreateShipElementInfos(
                         std::array<ElementIndex, 3>( // Points are in CW order
                             {
                                 pointIndex1,
-                                *pointSE,
+                                *pointE,
                                 *pointS
                             }));
                 }
+            }
+            else if (pointSE.has_value() && pointS.has_value())
+            {
+                // P - SE - S
 
                 //
-                // Triangle: P - S - SW
+                // Create ShipFactoryTriangle
                 //
 
-                if (!isRowInShip)
-                {
-                    auto const & pointSW = pointIndexMatrix[{x + TessellationCircularOrderDirections[3][0], y + TessellationCircularOrderDirections[3][1]}];
-
-                    if (pointS.has_value() && pointSW.has_value())
-                    {
-                        //
-                        // Create ShipFactoryTriangle
-                        //
+                triangleInfos1.emplace_back(
+                    std::array<ElementIndex, 3>( // Points are in CW order
+                        {
+                            pointIndex1,
+                            *pointSE,
+                            *pointS
+                        }));
+            }
 
-                        triangleInfos1.emplace_back(
-                            std::array<ElementIndex, 3>( // Points are in CW order
-                                {
-                                    pointIndex1,
-                                    *pointS,
-                                    *pointSW
-                                }));
-                    }
-                }
+            //
+            // Triangle: P - S - SW
+            //
 
-                // Remember now that we're in a ship
-                isRowInShip = true;
-            }
-            else
+            if (!isRowInShip)
             {
-                //
-                // No point exists at these coordinates
-                //
+                auto const & pointSW = pointIndexMatrix[{x + TessellationCircularOrderDirections[3][0], y + TessellationCircularOrderDirections[3][1]}];
 
-                // From now on we're not in a ship anymore
-                isRowInShip = false;
+                if (pointS.has_value() && pointSW.has_value())
+                {
+                    //
+                    // Create ShipFactoryTriangle
+                    //
+
+                    triangleInfos1.emplace_back(
+                        std::array<ElementIndex, 3>( // Points are in CW order
+                            {
+                                pointIndex1,
+                                *pointS,
+                                *pointSW
+                            }));
+                }
             }
+
+            // Remember now that we're in a ship
+            isRowInShip = true;
+        }
+        else
+        {
+            //
+            // No point exists at these coordinates
+            //
+
+            // From now on we're not in a ship anymore
+            isRowInShip = false;
         }
     }
 }
@@ -1143,12 +1290,12 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
 
     // Build Point Pair (Old) -> Spring Index (Old) table
     ShipFactoryPointPairToIndexMap pointPair1ToSpringIndex1Map;
+    pointPair1ToSpringIndex1Map.Reserve(springInfos1.size());
     for (ElementIndex s = 0; s < springInfos1.size(); ++s)
     {
-        pointPair1ToSpringIndex1Map.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(springInfos1[s].PointAIndex, springInfos1[s].PointBIndex),
-            std::forward_as_tuple(s));
+        pointPair1ToSpringIndex1Map.TryAdd(
+            { springInfos1[s].PointAIndex, springInfos1[s].PointBIndex },
+            s);
     }
 
     //
@@ -1196,10 +1343,10 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
                 // Check existence - and availability - of all springs now
 
                 ElementIndex crossSpringACIndex;
-                if (auto const springIt = pointPair1ToSpringIndex1Map.find({ a, c });
-                    springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
+                if (auto const springIndex1 = pointPair1ToSpringIndex1Map.Find({ a, c });
+                    springIndex1.has_value() && !remappedSpringMask[*springIndex1])
                 {
-                    crossSpringACIndex = springIt->second;
+                    crossSpringACIndex = *springIndex1;
                 }
                 else
                 {
@@ -1207,10 +1354,10 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
                 }
 
                 ElementIndex crossSpringBDIndex;
-                if (auto const springIt = pointPair1ToSpringIndex1Map.find({ b, d });
-                    springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
+                if (auto const springIndex1 = pointPair1ToSpringIndex1Map.Find({ b, d });
+                    springIndex1.has_value() && !remappedSpringMask[*springIndex1])
                 {
-                    crossSpringBDIndex = springIt->second;
+                    crossSpringBDIndex = *springIndex1;
                 }
                 else
                 {
@@ -1222,10 +1369,10 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
                     // Even: check AD, BC
 
                     ElementIndex sideSpringADIndex;
-                    if (auto const springIt = pointPair1ToSpringIndex1Map.find({ a, d });
-                        springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
+                    if (auto const springIndex1 = pointPair1ToSpringIndex1Map.Find({ a, d });
+                        springIndex1.has_value() && !remappedSpringMask[*springIndex1])
                     {
-                        sideSpringADIndex = springIt->second;
+                        sideSpringADIndex = *springIndex1;
                     }
                     else
                     {
@@ -1233,10 +1380,10 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
                     }
 
                     ElementIndex sideSpringBCIndex;
-                    if (auto const springIt = pointPair1ToSpringIndex1Map.find({ b, c });
-                        springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
+                    if (auto const springIndex1 = pointPair1ToSpringIndex1Map.Find({ b, c });
+                        springIndex1.has_value() && !remappedSpringMask[*springIndex1])
                     {
-                        sideSpringBCIndex = springIt->second;
+                        sideSpringBCIndex = *springIndex1;
                     }
                     else
                     {
@@ -1288,10 +1435,10 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
                     // Odd: check AB, CD
 
                     ElementIndex sideSpringABIndex;
-                    if (auto const springIt = pointPair1ToSpringIndex1Map.find({ a, b });
-                        springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
+                    if (auto const springIndex1 = pointPair1ToSpringIndex1Map.Find({ a, b });
+                        springIndex1.has_value() && !remappedSpringMask[*springIndex1])
                     {
-                        sideSpringABIndex = springIt->second;
+                        sideSpringABIndex = *springIndex1;
                     }
                     else
                     {
@@ -1299,10 +1446,10 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
                     }
 
                     ElementIndex sideSpringCDIndex;
-                    if (auto const springIt = pointPair1ToSpringIndex1Map.find({ c, d });
-                        springIt != pointPair1ToSpringIndex1Map.cend() && !remappedSpringMask[springIt->second])
+                    if (auto const springIndex1 = pointPair1ToSpringIndex1Map.Find({ c, d });
+                        springIndex1.has_value() && !remappedSpringMask[*springIndex1])
                     {
-                        sideSpringCDIndex = springIt->second;
+                        sideSpringCDIndex = *springIndex1;
                     }
                     else
                     {
@@ -1454,13 +1601,13 @@ void ShipFactory::ConnectSpringsAndTriangles(
     //
 
     ShipFactoryPointPairToIndexMap pointPair1ToSpring2Map;
+    pointPair1ToSpring2Map.Reserve(springInfos2.size());
 
     for (ElementIndex s = 0; s < springInfos2.size(); ++s)
     {
-        pointPair1ToSpring2Map.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(pointIndexRemap.NewToOld(springInfos2[s].PointAIndex), pointIndexRemap.NewToOld(springInfos2[s].PointBIndex)),
-            std::forward_as_tuple(s));
+        pointPair1ToSpring2Map.TryAdd(
+            { pointIndexRemap.NewToOld(springInfos2[s].PointAIndex), pointIndexRemap.NewToOld(springInfos2[s].PointBIndex) },
+            s);
     }
 
     //
@@ -1479,10 +1626,10 @@ void ShipFactory::ConnectSpringsAndTriangles(
                 : triangleInfos2[t].PointIndices1[0];
 
             // Lookup spring for this pair
-            auto const springIt = pointPair1ToSpring2Map.find({ endpointIndex1, nextEndpointIndex1 });
-            assert(springIt != pointPair1ToSpring2Map.end());
+            auto const springIndex2Opt = pointPair1ToSpring2Map.Find({ endpointIndex1, nextEndpointIndex1 });
+            assert(springIndex2Opt.has_value());
 
-            ElementIndex const springIndex2 = springIt->second;
+            ElementIndex const springIndex2 = *springIndex2Opt;
 
             // Tell this spring that it has this additional triangle
             springInfos2[springIndex2].Triangles.push_back(t);
@@ -1557,22 +1704,22 @@ void ShipFactory::ConnectSpringsAndTriangles(
             // See if there's a B-C spring
             //
 
-            auto const traverseSpringIt = pointPair1ToSpring2Map.find({ endpoint1Index, endpoint2Index });
-            if (traverseSpringIt != pointPair1ToSpring2Map.end())
+            auto const traverseSpringIndex2 = pointPair1ToSpring2Map.Find({ endpoint1Index, endpoint2Index });
+            if (traverseSpringIndex2.has_value())
             {
                 // We have a traverse spring
 
-                assert(0 == springInfos2[traverseSpringIt->second].Triangles.size());
+                assert(0 == springInfos2[*traverseSpringIndex2].Triangles.size());
 
                 // Tell the traverse spring that it has these 2 covering triangles
-                springInfos2[traverseSpringIt->second].CoveringTrianglesCount += 2;
-                assert(springInfos2[traverseSpringIt->second].CoveringTrianglesCount == 2);
+                springInfos2[*traverseSpringIndex2].CoveringTrianglesCount += 2;
+                assert(springInfos2[*traverseSpringIndex2].CoveringTrianglesCount == 2);
 
                 // Tell the triangles that they're covering this spring
                 assert(!triangle1.CoveredTraverseSpringIndex2.has_value());
-                triangle1.CoveredTraverseSpringIndex2 = traverseSpringIt->second;
+                triangle1.CoveredTraverseSpringIndex2 = *traverseSpringIndex2;
                 assert(!triangle2.CoveredTraverseSpringIndex2.has_value());
-                triangle2.CoveredTraverseSpringIndex2 = traverseSpringIt->second;
+                triangle2.CoveredTraverseSpringIndex2 = *traverseSpringIndex2;
             }
         }
     }
@@ -1586,16 +1733,14 @@ std::vector<ShipFactoryFrontier> ShipFactory::CreateShipFrontiers(
     ShipFactoryPointPairToIndexMap const & pointPairToSpringIndex1Map,
     IndexRemap const & springIndexRemap)
 {
-    auto const startTime = GameChronometer::Now();
-
     //
     // Detect and create frontiers
     //
 
     std::vector<ShipFactoryFrontier> shipFactoryFrontiers;
 
-    // Set that flags edges (2) that have become frontiers
-    std::set<ElementIndex> frontierEdges2;
+    // Flags edges (2) that have become frontiers
+    std::vector<bool> frontierEdges2(springInfos2.size(), false);
 
     // From left to right, skipping padding columns
     for (int x = 1; x < pointIndexMatrix.width - 1; ++x)
@@ -1627,15 +1772,15 @@ std::vector<ShipFactoryFrontier> ShipFactory::CreateShipFrontiers(
                 {
                     ElementIndex const pointIndex1 = *pointIndexMatrix[{x, y}];
 
-                    auto const springIndex1It = pointPairToSpringIndex1Map.find({ previousPointIndex1, pointIndex1 });
-                    if (springIndex1It == pointPairToSpringIndex1Map.cend())
+                    auto const springIndex1 = pointPairToSpringIndex1Map.Find({ previousPointIndex1, pointIndex1 });
+                    if (!springIndex1.has_value())
                     {
                         // No spring along <previous_point>-<point>
                         isInFrontierablePointsRegion = false;
                     }
                     else
                     {
-                        ElementIndex const springIndex2 = springIndexRemap.OldToNew(springIndex1It->second);
+                        ElementIndex const springIndex2 = springIndexRemap.OldToNew(*springIndex1);
                         if (springInfos2[springIndex2].Triangles.empty())
                         {
                             // No triangles along this spring
@@ -1720,9 +1865,6 @@ std::vector<ShipFactoryFrontier> ShipFactory::CreateShipFrontiers(
         }
     }
 
-    LogMessage("ShipFactory: completed frontiers:",
-        " time=", std::chrono::duration_cast<std::chrono::microseconds>(GameChronometer::Now() - startTime).count(), "us");
-
     return shipFactoryFrontiers;
 }
 
@@ -1731,7 +1873,7 @@ std::vector<ElementIndex> ShipFactory::PropagateFrontier(
     vec2i startPointCoordinates,
     Octant startOctant,
     ShipFactoryPointIndexMatrix const & pointIndexMatrix,
-    std::set<ElementIndex> & frontierEdges2,
+    std::vector<bool> & frontierEdges2,
     std::vector<ShipFactorySpring> const & springInfos2,
     ShipFactoryPointPairToIndexMap const & pointPairToSpringIndex1Map,
     IndexRemap const & springIndexRemap)
@@ -1796,14 +1938,14 @@ std::vector<ElementIndex> ShipFactory::PropagateFrontier(
 
             nextPointIndex1 = *pointIndexMatrix[nextPointCoords];
 
-            auto const springIndex1It = pointPairToSpringIndex1Map.find({ pointIndex1, nextPointIndex1 });
-            if (springIndex1It == pointPairToSpringIndex1Map.cend())
+            auto const springIndex1 = pointPairToSpringIndex1Map.Find({ pointIndex1, nextPointIndex1 });
+            if (!springIndex1.has_value())
             {
                 // No spring here
                 continue;
             }
 
-            springIndex2 = springIndexRemap.OldToNew(springIndex1It->second);
+            springIndex2 = springIndexRemap.OldToNew(*springIndex1);
             if (springInfos2[springIndex2].Triangles.size() != 1)
             {
                 // No triangles along this spring, or two triangles along it
@@ -1826,8 +1968,7 @@ std::vector<ElementIndex> ShipFactory::PropagateFrontier(
         // and if not, flag it
         //
 
-        auto [_, isInserted] = frontierEdges2.insert(springIndex2);
-        if (!isInserted)
+        if (frontierEdges2[springIndex2])
         {
             // This may only happen at the beginning
             assert(edgeIndices.empty());
@@ -1836,6 +1977,8 @@ std::vector<ElementIndex> ShipFactory::PropagateFrontier(
             break;
         }
 
+        frontierEdges2[springIndex2] = true;
+
         //
         // Store edge
         //
@@ -18,6 +18,7 @@
 
 #include <Core/GameTypes.h>
 #include <Core/IndexRemap.h>
+#include <Core/ThreadManager.h>
 
 #include <cstdint>
 #include <memory>
@@ -42,7 +43,8 @@ public:
         ShipStrengthRandomizer const & shipStrengthRandomizer,
         SimulationEventDispatcher & simulationEventDispatcher,
         IAssetManager const & assetManager,
-        SimulationParameters const & simulationParameters);
+        SimulationParameters const & simulationParameters,
+        ThreadManager & threadManager);
 
 private:
 
@@ -112,7 +114,28 @@ private:
         std::vector<ShipFactorySpring> & springInfos1,
         ShipFactoryPointPairToIndexMap & pointPairToSpringIndex1Map,
         std::vector<ShipFactoryTriangle> & triangleInfos1,
-        size_t & leakingPointsCount);
+        size_t & leakingPointsCount,
+        ThreadPool & threadPool);
+
+    // The springs and triangles found in one row of the point matrix
+    struct RowElementInfos
+    {
+        std::vector<ShipFactorySpring> SpringInfos1;
+        std::vector<ShipFactoryTriangle> TriangleInfos1;
+        size_t LeakingPointsCount;
+
+        RowElementInfos()
+            : SpringInfos1()
+            , TriangleInfos1()
+            , LeakingPointsCount(0)
+        {}
+    };
+
+    static void CreateRowElementInfos(
+        int y,
+        ShipFactoryPointIndexMatrix const & pointIndexMatrix,
+        std::vector<ShipFactoryPoint> & pointInfos1,
+        RowElementInfos & rowElementInfos);
 
     static std::vector<ShipFactoryTriangle> FilterOutRedundantTriangles(
         std::vector<ShipFactoryTriangle> const & triangleInfos1,
@@ -148,7 +171,7 @@ private:
         vec2i startPointCoordinates,
         Octant startOctant,
         ShipFactoryPointIndexMatrix const & pointIndexMatrix,
-        std::set<ElementIndex> & frontierEdges2,
+        std::vector<bool> & frontierEdges2,
         std::vector<ShipFactorySpring> const & springInfos2,
         ShipFactoryPointPairToIndexMap const & pointPairToSpringIndex1Map,
         IndexRemap const & springIndexRemap);
@@ -15,6 +15,8 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <unordered_map>
@@ -179,7 +181,159 @@ struct ShipFactoryPointPair
     };
 };
 
-using ShipFactoryPointPairToIndexMap = std::unordered_map<ShipFactoryPointPair, ElementIndex, ShipFactoryPointPair::Hasher>;
+/*
+ * A map from point pairs to element indices, used while building ships with millions of
+ * springs; a flat, open-addressing hash table with linear probing, as node-based maps
+ * spend most of their time allocating and chasing pointers.
+ */
+class ShipFactoryPointPairToIndexMap
+{
+public:
+
+    ShipFactoryPointPairToIndexMap()
+        : mEntries()
+        , mMask(0)
+        , mShift(64)
+        , mCount(0)
+    {
+        Rehash(MinCapacity);
+    }
+
+    size_t GetCount() const
+    {
+        return mCount;
+    }
+
+    /*
+     * Makes room for the specified number of entries, so that adding them does not rehash.
+     */
+    void Reserve(size_t count)
+    {
+        size_t capacity = MinCapacity;
+        while (capacity < count * 2)
+        {
+            capacity *= 2;
+        }
+
+        if (capacity > mEntries.size())
+        {
+            Rehash(capacity);
+        }
+    }
+
+    /*
+     * Returns false - and leaves the map untouched - if the pair is already in the map.
+     */
+    bool TryAdd(
+        ShipFactoryPointPair const & pointPair,
+        ElementIndex index)
+    {
+        if ((mCount + 1) * 2 > mEntries.size())
+        {
+            Rehash(mEntries.size() * 2);
+        }
+
+        uint64_t const key = MakeKey(pointPair);
+        for (size_t e = HashToEntry(key); ; e = (e + 1) & mMask)
+        {
+            if (mEntries[e].Key == EmptyKey)
+            {
+                mEntries[e] = Entry(key, index);
+                ++mCount;
+                return true;
+            }
+            else if (mEntries[e].Key == key)
+            {
+                return false;
+            }
+        }
+    }
+
+    std::optional<ElementIndex> Find(ShipFactoryPointPair const & pointPair) const
+    {
+        uint64_t const key = MakeKey(pointPair);
+        for (size_t e = HashToEntry(key); ; e = (e + 1) & mMask)
+        {
+            if (mEntries[e].Key == key)
+            {
+                return mEntries[e].Index;
+            }
+            else if (mEntries[e].Key == EmptyKey)
+            {
+                return std::nullopt;
+            }
+        }
+    }
+
+private:
+
+    struct Entry
+    {
+        uint64_t Key;
+        ElementIndex Index;
+
+        Entry()
+            : Key(EmptyKey)
+            , Index(NoneElementIndex)
+        {}
+
+        Entry(
+            uint64_t key,
+            ElementIndex index)
+            : Key(key)
+            , Index(index)
+        {}
+    };
+
+    static uint64_t constexpr EmptyKey = std::numeric_limits<uint64_t>::max(); // Would be a pair of NoneElementIndex's
+
+    static size_t constexpr MinCapacity = 16;
+
+    static inline uint64_t MakeKey(ShipFactoryPointPair const & pointPair)
+    {
+        return (static_cast<uint64_t>(pointPair.Endpoint1Index) << 32) | static_cast<uint64_t>(pointPair.Endpoint2Index);
+    }
+
+    inline size_t HashToEntry(uint64_t key) const
+    {
+        // Fibonacci hashing - the top bits are well mixed
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> mShift);
+    }
+
+    void Rehash(size_t capacity)
+    {
+        assert(capacity >= MinCapacity && (capacity & (capacity - 1)) == 0);
+
+        std::vector<Entry> oldEntries(capacity);
+        oldEntries.swap(mEntries);
+
+        mMask = capacity - 1;
+        mShift = 64;
+        for (size_t c = capacity; c > 1; c >>= 1)
+        {
+            --mShift;
+        }
+
+        for (Entry const & entry : oldEntries)
+        {
+            if (entry.Key != EmptyKey)
+            {
+                size_t e = HashToEntry(entry.Key);
+                while (mEntries[e].Key != EmptyKey)
+                {
+                    e = (e + 1) & mMask;
+                }
+
+                mEntries[e] = entry;
+            }
+        }
+    }
+
+    std::vector<Entry> mEntries; // Capacity is a power of two, and at least twice the count
+    size_t mMask;
+    unsigned int mShift;
+    size_t mCount;
+};
 
 struct ShipFactoryFloorInfo
 {
@@ -8,10 +8,12 @@
 #include <Core/GameChronometer.h>
 #include <Core/GameException.h>
 #include <Core/GameMath.h>
+#include <Core/ImageBatchLoader.h>
 #include <Core/Log.h>
 
 #include <algorithm>
 #include <chrono>
+#include <unordered_set>
 
 size_t constexpr MaterialTextureCacheSizeHighWatermark = 40;
 size_t constexpr MaterialTextureCacheSizeLowWatermark = 25;
@@ -112,6 +114,74 @@ RgbaImageData ShipTexturizer::MakeAutoTexture(
     return texture;
 }
 
+void ShipTexturizer::PreloadMaterialTextures(
+    StructuralLayerData const & structuralLayer,
+    IAssetManager const & assetManager,
+    ThreadPool & threadPool) const
+{
+    auto const startTime = GameChronometer::Now();
+
+    //
+    // Find the textures that are used and not cached yet
+    //
+
+    std::unordered_set<StructuralMaterial const *> materials;
+    for (size_t i = 0; i < structuralLayer.Buffer.Size.GetLinearSize(); ++i)
+    {
+        if (structuralLayer.Buffer.Data[i].Material != nullptr)
+        {
+            materials.insert(structuralLayer.Buffer.Data[i].Material);
+        }
+    }
+
+    std::vector<std::string> textureNames;
+    for (StructuralMaterial const * material : materials)
+    {
+        std::string const textureName = material->MaterialTextureName.value_or(MaterialTextureNameNone);
+        if (mMaterialTextureCache.count(textureName) == 0
+            && std::find(textureNames.cbegin(), textureNames.cend(), textureName) == textureNames.cend())
+        {
+            textureNames.push_back(textureName);
+        }
+    }
+
+    // Make room in the cache, without exceeding it; textures that don't fit will
+    // be loaded on-demand
+    if (mMaterialTextureCache.size() + textureNames.size() >= MaterialTextureCacheSizeHighWatermark)
+    {
+        PurgeMaterialTextureCache(MaterialTextureCacheSizeLowWatermark);
+    }
+
+    size_t const maxTextureCount = MaterialTextureCacheSizeHighWatermark - 1 - std::min(mMaterialTextureCache.size(), MaterialTextureCacheSizeHighWatermark - 1);
+    if (textureNames.size() > maxTextureCount)
+    {
+        textureNames.resize(maxTextureCount);
+    }
+
+    //
+    // Load them
+    //
+
+    auto textures = ImageBatchLoader::Load<Vec2fImageData>(
+        textureNames.size(),
+        [&](size_t t)
+        {
+            assert(mMaterialTextureNameToTextureRelativePathMap.count(textureNames[t]) > 0);
+            return MakeMaterialTexture(assetManager.LoadMaterialTexture(mMaterialTextureNameToTextureRelativePathMap.at(textureNames[t])));
+        },
+        threadPool);
+
+    for (size_t t = 0; t < textureNames.size(); ++t)
+    {
+        mMaterialTextureCache.emplace(
+            textureNames[t],
+            std::move(textures[t]));
+    }
+
+    LogMessage("ShipTexturizer: preloaded ", textureNames.size(), " material textures:",
+        " time=", std::chrono::duration_cast<std::chrono::microseconds>(GameChronometer::Now() - startTime).count(), "us");
+}
+
 void ShipTexturizer::AutoTexturizeInto(
     StructuralLayerData const & structuralLayer,
     ShipSpaceRect const & structuralLayerRegion,
@@ -729,23 +799,10 @@ ShipTexturizer::Vec2fImageData const & ShipTexturizer::GetMaterialTexture(
         assert(mMaterialTextureNameToTextureRelativePathMap.count(actualTextureName) > 0);
         RgbImageData texture = assetManager.LoadMaterialTexture(mMaterialTextureNameToTextureRelativePathMap.at(actualTextureName));
 
-        // Convert to vec2f
-        auto const pixelCount = texture.Size.GetLinearSize();
-        std::unique_ptr<vec2f[]> vec2fTexture = std::make_unique<vec2f[]>(pixelCount);
-        for (size_t p = 0; p < pixelCount; ++p)
-        {
-            assert(texture.Data[p].r == texture.Data[p].g);
-            assert(texture.Data[p].r == texture.Data[p].b);
-
-            vec2fTexture[p] = vec2f(
-                static_cast<float>(texture.Data[p].r) / 255.0f,
-                1.0f); // Alpha: at this moment we hardcode it as opaque, we'll think whether we want to make transparent chains
-        }
-
         // Insert texture into cache
         auto const inserted = mMaterialTextureCache.emplace(
             actualTextureName,
-            Vec2fImageData(texture.Size, std::move(vec2fTexture)));
+            MakeMaterialTexture(texture));
 
         assert(inserted.second);
 
@@ -753,6 +810,24 @@ ShipTexturizer::Vec2fImageData const & ShipTexturizer::GetMaterialTexture(
     }
 }
 
+ShipTexturizer::Vec2fImageData ShipTexturizer::MakeMaterialTexture(RgbImageData const & texture)
+{
+    // Convert to vec2f
+    auto const pixelCount = texture.Size.GetLinearSize();
+    std::unique_ptr<vec2f[]> vec2fTexture = std::make_unique<vec2f[]>(pixelCount);
+    for (size_t p = 0; p < pixelCount; ++p)
+    {
+        assert(texture.Data[p].r == texture.Data[p].g);
+        assert(texture.Data[p].r == texture.Data[p].b);
+
+        vec2fTexture[p] = vec2f(
+            static_cast<float>(texture.Data[p].r) / 255.0f,
+            1.0f); // Alpha: at this moment we hardcode it as opaque, we'll think whether we want to make transparent chains
+    }
+
+    return Vec2fImageData(texture.Size, std::move(vec2fTexture));
+}
+
 void ShipTexturizer::ResetMaterialTextureCacheUseCounts() const
 {
     std::for_each(
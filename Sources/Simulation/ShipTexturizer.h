@@ -13,6 +13,7 @@
 #include <Core/GameTypes.h>
 #include <Core/IAssetManager.h>
 #include <Core/ImageData.h>
+#include <Core/ThreadPool.h>
 #include <Core/Vectors.h>
 
 #include <cassert>
@@ -41,6 +42,16 @@ public:
         int maxTextureSize,
         IAssetManager const & assetManager) const;
 
+    /*
+     * Loads into the cache - concurrently - the material textures that auto-texturizing
+     * the specified structural layer would need, so that texturization does not have to
+     * load them one by one.
+     */
+    void PreloadMaterialTextures(
+        StructuralLayerData const & structuralLayer,
+        IAssetManager const & assetManager,
+        ThreadPool & threadPool) const;
+
     void AutoTexturizeInto(
         StructuralLayerData const & structuralLayer,
         ShipSpaceRect const & structuralLayerRegion,
@@ -129,6 +140,8 @@ private:
         std::optional<std::string> const & textureName,
         IAssetManager const & assetManager) const;
 
+    static Vec2fImageData MakeMaterialTexture(RgbImageData const & texture);
+
     void ResetMaterialTextureCacheUseCounts() const;
 
     void PurgeMaterialTextureCache(size_t maxSize) const;
@@ -7,15 +7,20 @@
 
 #include "ISimulationEventHandlers.h"
 
+#include <Core/InplaceFunction.h>
 #include <Core/Log.h>
 #include <Core/TupleKeys.h>
 
 #include <algorithm>
+#include <cassert>
+#include <mutex>
 #include <optional>
 #include <vector>
 
 /*
  * Dispatches events to multiple sinks, aggregating some events in the process.
+ *
+ * Safe for concurrent producers only while deferring sink calls.
  */
 class SimulationEventDispatcher final
     : public IStructuralShipEventHandler
@@ -60,6 +65,10 @@ public:
         , mAtmosphereSinks()
         , mElectricalElementSinks()
         , mNpcSinks()
+        // Concurrency
+        , mIsDeferringSinkCalls(false)
+        , mDeferredSinkCalls()
+        , mLock()
     {
     }
 
@@ -79,6 +88,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mStressEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
@@ -87,6 +98,8 @@ public:
         bool isUnderwater,
         float kineticEnergy) override
     {
+        std::lock_guard const lock{ mLock };
+
         mImpactEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += kineticEnergy;
     }
 
@@ -95,6 +108,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mBreakEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
@@ -103,6 +118,12 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=, &structuralMaterial]() { OnDestroy(structuralMaterial, isUnderwater, size); });
+            return;
+        }
+
         for (auto sink : mStructuralShipSinks)
         {
             sink->OnDestroy(structuralMaterial, isUnderwater, size);
@@ -114,6 +135,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mSpringRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
@@ -122,6 +145,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mTriangleRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
@@ -129,6 +154,12 @@ public:
         bool isMetal,
         unsigned int size) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnSawed(isMetal, size); });
+            return;
+        }
+
         for (auto sink : mStructuralShipSinks)
         {
             sink->OnSawed(isMetal, size);
@@ -137,6 +168,8 @@ public:
 
     virtual void OnLaserCut(unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mLaserCutEvents += size;
     }
 
@@ -146,6 +179,12 @@ public:
 
     void OnSinkingBegin(ShipId shipId) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnSinkingBegin(shipId); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnSinkingBegin(shipId);
@@ -154,6 +193,12 @@ public:
 
     void OnSinkingEnd(ShipId shipId) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnSinkingEnd(shipId); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnSinkingEnd(shipId);
@@ -162,6 +207,12 @@ public:
 
     void OnShipRepaired(ShipId shipId) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnShipRepaired(shipId); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnShipRepaired(shipId);
@@ -172,6 +223,12 @@ public:
         bool isPinned,
         bool isUnderwater) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnPinToggled(isPinned, isUnderwater); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnPinToggled(isPinned, isUnderwater);
@@ -180,6 +237,12 @@ public:
 
     void OnWaterTaken(float waterTaken) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnWaterTaken(waterTaken); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnWaterTaken(waterTaken);
@@ -188,6 +251,12 @@ public:
 
     void OnWaterSplashed(float waterSplashed) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnWaterSplashed(waterSplashed); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnWaterSplashed(waterSplashed);
@@ -196,11 +265,15 @@ public:
 
     void OnWaterDisplaced(float waterDisplacedMagnitude) override
     {
+        std::lock_guard const lock{ mLock };
+
         mWaterDisplacedEvents += waterDisplacedMagnitude;
     }
 
     void OnAirBubbleSurfaced(unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mAirBubbleSurfacedEvents += size;
     }
 
@@ -208,6 +281,12 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnWaterReaction(isUnderwater, size); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnWaterReaction(isUnderwater, size);
@@ -218,6 +297,12 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnWaterReactionExplosion(isUnderwater, size); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnWaterReactionExplosion(isUnderwater, size);
@@ -230,6 +315,12 @@ public:
         float depth,
         float pressure) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnPhysicsProbeReading(velocity, temperature, depth, pressure); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnPhysicsProbeReading(
@@ -244,6 +335,12 @@ public:
         std::string const & name,
         float value) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnCustomProbe(name, value); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnCustomProbe(
@@ -257,6 +354,12 @@ public:
         GadgetType gadgetType,
         bool isUnderwater) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnGadgetPlaced(gadgetId, gadgetType, isUnderwater); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnGadgetPlaced(
@@ -271,6 +374,12 @@ public:
         GadgetType gadgetType,
         std::optional<bool> isUnderwater) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnGadgetRemoved(gadgetId, gadgetType, isUnderwater); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnGadgetRemoved(
@@ -285,6 +394,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mBombExplosionEvents[std::make_tuple(gadgetType, isUnderwater)] += size;
     }
 
@@ -292,6 +403,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mRCBombPingEvents[std::make_tuple(isUnderwater)] += size;
     }
 
@@ -299,6 +412,12 @@ public:
         GlobalGadgetId gadgetId,
         std::optional<bool> isFast) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnTimerBombFuse(gadgetId, isFast); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnTimerBombFuse(
@@ -311,6 +430,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mTimerBombDefusedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
@@ -318,6 +439,12 @@ public:
         GlobalGadgetId gadgetId,
         bool isContained) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnAntiMatterBombContained(gadgetId, isContained); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnAntiMatterBombContained(
@@ -328,6 +455,12 @@ public:
 
     void OnAntiMatterBombPreImploding() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnAntiMatterBombPreImploding(); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnAntiMatterBombPreImploding();
@@ -336,6 +469,12 @@ public:
 
     void OnAntiMatterBombImploding() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnAntiMatterBombImploding(); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnAntiMatterBombImploding();
@@ -346,6 +485,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mWatertightDoorOpenedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
@@ -353,11 +494,19 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mWatertightDoorClosedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnFishCountUpdated(size_t count) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnFishCountUpdated(count); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnFishCountUpdated(count);
@@ -366,6 +515,12 @@ public:
 
     void OnPhysicsProbePanelOpened() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnPhysicsProbePanelOpened(); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnPhysicsProbePanelOpened();
@@ -374,6 +529,12 @@ public:
 
     void OnPhysicsProbePanelClosed() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnPhysicsProbePanelClosed(); });
+            return;
+        }
+
         for (auto sink : mGenericShipSinks)
         {
             sink->OnPhysicsProbePanelClosed();
@@ -386,6 +547,12 @@ public:
 
     void OnTsunami(float x) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnTsunami(x); });
+            return;
+        }
+
         for (auto sink : mWavePhenomenaSinks)
         {
             sink->OnTsunami(x);
@@ -398,6 +565,12 @@ public:
 
     void OnPointCombustionBegin() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnPointCombustionBegin(); });
+            return;
+        }
+
         for (auto sink : mCombustionSinks)
         {
             sink->OnPointCombustionBegin();
@@ -406,6 +579,12 @@ public:
 
     void OnPointCombustionEnd() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnPointCombustionEnd(); });
+            return;
+        }
+
         for (auto sink : mCombustionSinks)
         {
             sink->OnPointCombustionEnd();
@@ -414,6 +593,12 @@ public:
 
     void OnCombustionSmothered() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnCombustionSmothered(); });
+            return;
+        }
+
         for (auto sink : mCombustionSinks)
         {
             sink->OnCombustionSmothered();
@@ -424,6 +609,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mCombustionExplosionEvents[std::make_tuple(isUnderwater)] += size;
     }
 
@@ -435,6 +622,12 @@ public:
         float netForce,
         float complexity) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnStaticPressureUpdated(netForce, complexity); });
+            return;
+        }
+
         for (auto sink : mSimulationStatisticsSinks)
         {
             sink->OnStaticPressureUpdated(
@@ -449,6 +642,12 @@ public:
 
     void OnStormBegin() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnStormBegin(); });
+            return;
+        }
+
         for (auto sink : mAtmosphereSinks)
         {
             sink->OnStormBegin();
@@ -457,6 +656,12 @@ public:
 
     void OnStormEnd() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnStormEnd(); });
+            return;
+        }
+
         for (auto sink : mAtmosphereSinks)
         {
             sink->OnStormEnd();
@@ -471,6 +676,12 @@ public:
         float const maxSpeedMagnitude,
         vec2f const & windSpeed) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnWindSpeedUpdated(zeroSpeedMagnitude, baseSpeedMagnitude, baseAndStormSpeedMagnitude, preMaxSpeedMagnitude, maxSpeedMagnitude, windSpeed); });
+            return;
+        }
+
         for (auto sink : mAtmosphereSinks)
         {
             sink->OnWindSpeedUpdated(
@@ -485,6 +696,12 @@ public:
 
     void OnRainUpdated(float const density) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnRainUpdated(density); });
+            return;
+        }
+
         for (auto sink : mAtmosphereSinks)
         {
             sink->OnRainUpdated(density);
@@ -493,6 +710,12 @@ public:
 
     void OnThunder() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnThunder(); });
+            return;
+        }
+
         for (auto sink : mAtmosphereSinks)
         {
             sink->OnThunder();
@@ -501,6 +724,12 @@ public:
 
     void OnLightning() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnLightning(); });
+            return;
+        }
+
         for (auto sink : mAtmosphereSinks)
         {
             sink->OnLightning();
@@ -509,6 +738,8 @@ public:
 
     void OnLightningHit(StructuralMaterial const & structuralMaterial) override
     {
+        std::lock_guard const lock{ mLock };
+
         mLightningHitEvents[std::make_tuple(&structuralMaterial)] += 1;
     }
 
@@ -520,6 +751,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mLampBrokenEvents[std::make_tuple(isUnderwater)] += size;
     }
 
@@ -527,6 +760,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mLampExplodedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
@@ -534,6 +769,8 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mLampImplodedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
@@ -542,11 +779,19 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
+        std::lock_guard const lock{ mLock };
+
         mLightFlickerEvents[std::make_tuple(duration, isUnderwater)] += size;
     }
 
     void OnElectricalElementAnnouncementsBegin() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnElectricalElementAnnouncementsBegin(); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnElectricalElementAnnouncementsBegin();
@@ -561,6 +806,12 @@ public:
         ElectricalMaterial const & electricalMaterial,
         std::optional<ElectricalPanel::ElementMetadata> const & panelElementMetadata) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=, &electricalMaterial]() { OnSwitchCreated(electricalElementId, instanceIndex, type, state, electricalMaterial, panelElementMetadata); });
+            return;
+        }
+
         LogMessage("OnSwitchCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), "): State=", static_cast<bool>(state));
 
         for (auto sink : mElectricalElementSinks)
@@ -577,6 +828,12 @@ public:
         ElectricalMaterial const & electricalMaterial,
         std::optional<ElectricalPanel::ElementMetadata> const & panelElementMetadata) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=, &electricalMaterial]() { OnPowerProbeCreated(electricalElementId, instanceIndex, type, state, electricalMaterial, panelElementMetadata); });
+            return;
+        }
+
         LogMessage("OnPowerProbeCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), "): State=", static_cast<bool>(state));
 
         for (auto sink : mElectricalElementSinks)
@@ -591,6 +848,12 @@ public:
         ElectricalMaterial const & electricalMaterial,
         std::optional<ElectricalPanel::ElementMetadata> const & panelElementMetadata) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=, &electricalMaterial]() { OnEngineControllerCreated(electricalElementId, instanceIndex, electricalMaterial, panelElementMetadata); });
+            return;
+        }
+
         LogMessage("OnEngineControllerCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), ")");
 
         for (auto sink : mElectricalElementSinks)
@@ -607,6 +870,12 @@ public:
         ElectricalMaterial const & electricalMaterial,
         std::optional<ElectricalPanel::ElementMetadata> const & panelElementMetadata) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=, &electricalMaterial]() { OnEngineMonitorCreated(electricalElementId, instanceIndex, thrustMagnitude, rpm, electricalMaterial, panelElementMetadata); });
+            return;
+        }
+
         LogMessage("OnEngineMonitorCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), "): Thrust=", thrustMagnitude, " RPM=", rpm);
 
         for (auto sink : mElectricalElementSinks)
@@ -622,6 +891,12 @@ public:
         ElectricalMaterial const & electricalMaterial,
         std::optional<ElectricalPanel::ElementMetadata> const & panelElementMetadata) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=, &electricalMaterial]() { OnWaterPumpCreated(electricalElementId, instanceIndex, normalizedForce, electricalMaterial, panelElementMetadata); });
+            return;
+        }
+
         LogMessage("OnWaterPumpCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), ")");
 
         for (auto sink : mElectricalElementSinks)
@@ -637,6 +912,12 @@ public:
         ElectricalMaterial const & electricalMaterial,
         std::optional<ElectricalPanel::ElementMetadata> const & panelElementMetadata) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=, &electricalMaterial]() { OnWatertightDoorCreated(electricalElementId, instanceIndex, isOpen, electricalMaterial, panelElementMetadata); });
+            return;
+        }
+
         LogMessage("OnWatertightDoorCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), ")");
 
         for (auto sink : mElectricalElementSinks)
@@ -647,6 +928,12 @@ public:
 
     void OnElectricalElementAnnouncementsEnd() override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([this]() { OnElectricalElementAnnouncementsEnd(); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnElectricalElementAnnouncementsEnd();
@@ -657,6 +944,12 @@ public:
         GlobalElectricalElementId electricalElementId,
         bool isEnabled) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnSwitchEnabled(electricalElementId, isEnabled); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnSwitchEnabled(electricalElementId, isEnabled);
@@ -667,6 +960,12 @@ public:
         GlobalElectricalElementId electricalElementId,
         ElectricalState newState) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnSwitchToggled(electricalElementId, newState); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnSwitchToggled(electricalElementId, newState);
@@ -677,6 +976,12 @@ public:
         GlobalElectricalElementId electricalElementId,
         ElectricalState newState) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnPowerProbeToggled(electricalElementId, newState); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnPowerProbeToggled(electricalElementId, newState);
@@ -687,6 +992,12 @@ public:
         GlobalElectricalElementId electricalElementId,
         bool isEnabled) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnEngineControllerEnabled(electricalElementId, isEnabled); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnEngineControllerEnabled(electricalElementId, isEnabled);
@@ -699,6 +1010,12 @@ public:
         float oldControllerValue,
         float newControllerValue) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=, &electricalMaterial]() { OnEngineControllerUpdated(electricalElementId, electricalMaterial, oldControllerValue, newControllerValue); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnEngineControllerUpdated(electricalElementId, electricalMaterial, oldControllerValue, newControllerValue);
@@ -710,6 +1027,12 @@ public:
         float thrustMagnitude,
         float rpm) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnEngineMonitorUpdated(electricalElementId, thrustMagnitude, rpm); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnEngineMonitorUpdated(electricalElementId, thrustMagnitude, rpm);
@@ -722,6 +1045,12 @@ public:
         bool isPlaying,
         bool isUnderwater) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=, &electricalMaterial]() { OnShipSoundUpdated(electricalElementId, electricalMaterial, isPlaying, isUnderwater); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnShipSoundUpdated(electricalElementId, electricalMaterial, isPlaying, isUnderwater);
@@ -732,6 +1061,12 @@ public:
         GlobalElectricalElementId electricalElementId,
         bool isEnabled) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnWaterPumpEnabled(electricalElementId, isEnabled); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnWaterPumpEnabled(electricalElementId, isEnabled);
@@ -742,6 +1077,12 @@ public:
         GlobalElectricalElementId electricalElementId,
         float normalizedForce) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnWaterPumpUpdated(electricalElementId, normalizedForce); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnWaterPumpUpdated(electricalElementId, normalizedForce);
@@ -752,6 +1093,12 @@ public:
         GlobalElectricalElementId electricalElementId,
         bool isEnabled) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnWatertightDoorEnabled(electricalElementId, isEnabled); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnWatertightDoorEnabled(electricalElementId, isEnabled);
@@ -762,6 +1109,12 @@ public:
         GlobalElectricalElementId electricalElementId,
         bool isOpen) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnWatertightDoorUpdated(electricalElementId, isOpen); });
+            return;
+        }
+
         for (auto sink : mElectricalElementSinks)
         {
             sink->OnWatertightDoorUpdated(electricalElementId, isOpen);
@@ -775,6 +1128,12 @@ public:
     void OnNpcSelectionChanged(
         std::optional<NpcId> selectedNpc) override
     {
+        if (mIsDeferringSinkCalls)
+        {
+            DeferSinkCall([=]() { OnNpcSelectionChanged(selectedNpc); });
+            return;
+        }
+
         for (auto sink : mNpcSinks)
         {
             sink->OnNpcSelectionChanged(selectedNpc);
@@ -784,6 +1143,8 @@ public:
     void OnNpcCountsUpdated(
         size_t totalNpcCount) override
     {
+        std::lock_guard const lock{ mLock };
+
         mLastNpcCountsUpdated = totalNpcCount;
     }
 
@@ -791,11 +1152,42 @@ public:
         size_t insideShipCount,
         size_t outsideShipCount) override
     {
+        std::lock_guard const lock{ mLock };
+
         mLastHumanNpcCountsUpdated = { insideShipCount, outsideShipCount };
     }
 
 public:
 
+    /*
+     * While deferring, events are not forwarded to sinks but queued instead, so that
+     * events may be produced concurrently while sinks are only invoked by the thread
+     * that stops deferring - in the order in which the events were produced.
+     */
+    void StartDeferringSinkCalls()
+    {
+        assert(!mIsDeferringSinkCalls);
+        mIsDeferringSinkCalls = true;
+    }
+
+    bool IsDeferringSinkCalls() const
+    {
+        return mIsDeferringSinkCalls;
+    }
+
+    void StopDeferringSinkCalls()
+    {
+        assert(mIsDeferringSinkCalls);
+        mIsDeferringSinkCalls = false;
+
+        for (auto const & deferredSinkCall : mDeferredSinkCalls)
+        {
+            deferredSinkCall();
+        }
+
+        mDeferredSinkCalls.clear();
+    }
+
     /*
      * Flushes all events aggregated so far and clears the state.
      */
@@ -1033,4 +1425,26 @@ private:
     std::vector<IAtmosphereEventHandler *> mAtmosphereSinks;
     std::vector<IElectricalElementEventHandler *> mElectricalElementSinks;
     std::vector<INpcEventHandler *> mNpcSinks;
+
+    //
+    // Concurrency
+    //
+
+    // Stores its captures in-place; together with the retained capacity of the
+    // deferred calls' vector, deferring calls does not allocate in steady state
+    using DeferredSinkCall = InplaceFunction<void(), 128>; // Fits the largest, i.e. the creation of panel elements
+
+    template<typename TSinkCall>
+    void DeferSinkCall(TSinkCall && sinkCall)
+    {
+        std::lock_guard const lock{ mLock };
+
+        mDeferredSinkCalls.emplace_back(std::forward<TSinkCall>(sinkCall));
+    }
+
+    bool mIsDeferringSinkCalls;
+    std::vector<DeferredSinkCall> mDeferredSinkCalls;
+
+    // Protects aggregations and deferred calls
+    std::mutex mLock;
 };
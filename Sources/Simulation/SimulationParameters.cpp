@@ -51,6 +51,7 @@ SimulationParameters::SimulationParameters()
     , DoDisplaceWater(true)
     , WaterDisplacementWaveHeightAdjustment(1.0f)
     , WaveSmoothnessAdjustment(0.203125f)
+    , OceanSurfaceSamplesCount(16384u)
     // Storm
     , StormRate(60)
     , StormDuration(60 * 4) // 4 minutes
@@ -136,5 +137,9 @@ SimulationParameters::SimulationParameters()
     , MoveToolInertia(3.0f)
     // Computation
     , SpringRelaxationParallelComputationMode(SpringRelaxationParallelComputationModeType::Hybrid)
+    , DoParallelWaterFlow(true)
+    , DoConcurrentShipUpdates(false)
+    , DoConcurrentWorldUpdates(false)
+    , DoConcurrentNpcUpdates(false)
 {
 }
\ No newline at end of file
@@ -295,6 +295,10 @@ struct SimulationParameters
     static float constexpr MinWaveSmoothnessAdjustment = 0.0f;
     static float constexpr MaxWaveSmoothnessAdjustment = 1.0f;
 
+    size_t OceanSurfaceSamplesCount; // Power of two; the resolution of the ocean surface across the entire world width
+    static size_t constexpr MinOceanSurfaceSamplesCount = 2048u;
+    static size_t constexpr MaxOceanSurfaceSamplesCount = 16384u;
+
     // Storm
 
     std::chrono::minutes StormRate;
@@ -696,6 +700,17 @@ struct SimulationParameters
 
     SpringRelaxationParallelComputationModeType SpringRelaxationParallelComputationMode;
 
+    bool DoParallelWaterFlow;
+
+    // Note: runs are only reproducible when none of the following is done concurrently,
+    // hence they are all off by default
+
+    bool DoConcurrentShipUpdates;
+
+    bool DoConcurrentWorldUpdates; // When false, world subsystems are updated one after the other
+
+    bool DoConcurrentNpcUpdates; // When true, the NPCs of different ships are updated concurrently
+
     //
     // Limits
     //
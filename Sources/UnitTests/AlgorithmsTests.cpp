@@ -1,11 +1,13 @@
 #include <Core/Algorithms.h>
 
+#include <Core/Buffer.h>
 #include <Core/GameGeometry.h>
 #include <Core/GameTypes.h>
 #include <Core/Vectors.h>
 
 #include <array>
 #include <cmath>
+#include <vector>
 
 #include "TestingUtils.h"
 
@@ -415,6 +417,144 @@ TEST(AlgorithmsTests, DiffuseLight_NeonVectorized_8Lamps)
 }
 #endif
 
+TEST(AlgorithmsTests, DiffuseLight_Binned_4Lamps)
+{
+    aligned_to_vword vec2f pointPositions[] = { { 1.0f, 2.0f}, {2.0f, 4.0f}, {10.0f, 5.0f}, {3.0f, 4.0f} };
+    aligned_to_vword PlaneId pointPlaneIds[] = { 1, 1, 2, 3 };
+
+    aligned_to_vword vec2f lampPositions[] = { { 4.0f, 2.0f}, {1.0f, 2.0f}, {100.0f, 100.0f}, {200.0f, 200.0f} };
+    aligned_to_vword PlaneId lampPlaneIds[] = { 3, 2, 10, 10 };
+    aligned_to_vword float lampDistanceCoeffs[] = { 0.1f, 0.2f, 10.0f, 20.0f };
+    aligned_to_vword float lampSpreadMaxDistances[] = { 4.0f, 6.0f, 1.0f, 2.0f };
+
+    LampGrid lampGrid(64);
+    lampGrid.Rebuild(
+        lampPositions,
+        lampPlaneIds,
+        lampDistanceCoeffs,
+        lampSpreadMaxDistances,
+        4);
+
+    aligned_to_vword float outLightBuffer[4];
+
+    Algorithms::DiffuseLight_Binned(
+        0,
+        4,
+        pointPositions,
+        pointPlaneIds,
+        lampGrid,
+        outLightBuffer);
+
+    EXPECT_FLOAT_EQ(1.0f, outLightBuffer[0]);
+    EXPECT_FLOAT_EQ(0.7527864f, outLightBuffer[1]);
+    EXPECT_FLOAT_EQ(0.0f, outLightBuffer[2]);
+    EXPECT_FLOAT_EQ(0.17639320225f, outLightBuffer[3]);
+}
+
+TEST(AlgorithmsTests, DiffuseLight_Binned_MatchesNaive)
+{
+    // A 100x40 ship with 200 lamps scattered over it, some of which are off
+
+    size_t constexpr PointCount = 100 * 40;
+    size_t constexpr LampCount = 200;
+
+    std::vector<vec2f> pointPositions;
+    std::vector<PlaneId> pointPlaneIds;
+    for (size_t p = 0; p < PointCount; ++p)
+    {
+        pointPositions.emplace_back(
+            static_cast<float>(p % 100) + 0.3f * static_cast<float>((p * 7) % 3),
+            static_cast<float>(p / 100) - 0.2f * static_cast<float>((p * 13) % 5));
+        pointPlaneIds.push_back(static_cast<PlaneId>((p * 31) % 4));
+    }
+
+    std::vector<vec2f> lampPositions;
+    std::vector<PlaneId> lampPlaneIds;
+    std::vector<float> lampDistanceCoeffs;
+    std::vector<float> lampSpreadMaxDistances;
+    for (size_t l = 0; l < LampCount; ++l)
+    {
+        lampPositions.emplace_back(
+            static_cast<float>((l * 37) % 101) - 0.5f,
+            static_cast<float>((l * 17) % 41));
+        lampPlaneIds.push_back(static_cast<PlaneId>((l * 7) % 4));
+        lampSpreadMaxDistances.push_back(0.5f + static_cast<float>((l * 11) % 9));
+        lampDistanceCoeffs.push_back((l % 5) == 0 ? 0.0f : 1.0f / lampSpreadMaxDistances.back());
+    }
+
+    std::vector<float> expectedLightBuffer(PointCount);
+    Algorithms::DiffuseLight_Naive(
+        pointPositions.data(),
+        pointPlaneIds.data(),
+        static_cast<ElementIndex>(PointCount),
+        lampPositions.data(),
+        lampPlaneIds.data(),
+        lampDistanceCoeffs.data(),
+        lampSpreadMaxDistances.data(),
+        static_cast<ElementIndex>(LampCount),
+        expectedLightBuffer.data());
+
+    LampGrid lampGrid(64);
+    lampGrid.Rebuild(
+        lampPositions.data(),
+        lampPlaneIds.data(),
+        lampDistanceCoeffs.data(),
+        lampSpreadMaxDistances.data(),
+        static_cast<ElementCount>(LampCount));
+
+    EXPECT_EQ(lampGrid.GetLitLampCount(), LampCount - LampCount / 5);
+
+    std::vector<float> outLightBuffer(PointCount, -1.0f);
+    Algorithms::DiffuseLight_Binned(
+        0,
+        static_cast<ElementIndex>(PointCount),
+        pointPositions.data(),
+        pointPlaneIds.data(),
+        lampGrid,
+        outLightBuffer.data());
+
+    for (size_t p = 0; p < PointCount; ++p)
+    {
+        EXPECT_FLOAT_EQ(expectedLightBuffer[p], outLightBuffer[p]) << "Point " << p;
+    }
+}
+
+TEST(AlgorithmsTests, DiffuseLight_Binned_NoLitLamps)
+{
+    aligned_to_vword vec2f pointPositions[] = { { 1.0f, 2.0f}, {2.0f, 4.0f}, {10.0f, 5.0f}, {3.0f, 4.0f} };
+    aligned_to_vword PlaneId pointPlaneIds[] = { 1, 1, 2, 3 };
+
+    aligned_to_vword vec2f lampPositions[] = { { 4.0f, 2.0f}, {1.0f, 2.0f}, {100.0f, 100.0f}, {200.0f, 200.0f} };
+    aligned_to_vword PlaneId lampPlaneIds[] = { 3, 2, 10, 10 };
+    aligned_to_vword float lampDistanceCoeffs[] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    aligned_to_vword float lampSpreadMaxDistances[] = { 4.0f, 6.0f, 1.0f, 2.0f };
+
+    LampGrid lampGrid(64);
+    lampGrid.Rebuild(
+        lampPositions,
+        lampPlaneIds,
+        lampDistanceCoeffs,
+        lampSpreadMaxDistances,
+        4);
+
+    EXPECT_EQ(lampGrid.GetLitLampCount(), 0u);
+
+    aligned_to_vword float outLightBuffer[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    Algorithms::DiffuseLight_Binned(
+        0,
+        4,
+        pointPositions,
+        pointPlaneIds,
+        lampGrid,
+        outLightBuffer);
+
+    EXPECT_FLOAT_EQ(0.0f, outLightBuffer[0]);
+    EXPECT_FLOAT_EQ(0.0f, outLightBuffer[1]);
+    EXPECT_FLOAT_EQ(0.0f, outLightBuffer[2]);
+    EXPECT_FLOAT_EQ(0.0f, outLightBuffer[3]);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // BufferSmoothing
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -534,14 +674,165 @@ TEST(AlgorithmsTests, SmoothBufferAndAdd_16_5_NeonVectorized)
 }
 #endif
 
+TEST(AlgorithmsTests, SmoothBufferAndAdd_Sections_MatchWhole)
+{
+    // Smoothing a buffer one section at a time - as done by each thread - is the same
+    // as smoothing the whole buffer at once
+
+    size_t constexpr BufferSize = 64;
+    size_t constexpr BufferPrefixSize = make_aligned_float_element_count(5 / 2);
+
+    Buffer<float> inBuffer(BufferPrefixSize + BufferSize + 5 / 2, 0, 0.0f);
+    for (size_t i = 0; i < BufferSize; ++i)
+    {
+        inBuffer[BufferPrefixSize + i] = static_cast<float>((i * 37) % 11) - 5.0f;
+    }
+
+    Buffer<float> wholeOutBuffer(BufferSize, 0, 1.0f);
+    Algorithms::SmoothBufferAndAdd<5>(inBuffer.data() + BufferPrefixSize, wholeOutBuffer.data(), BufferSize);
+
+    Buffer<float> sectionsOutBuffer(BufferSize, 0, 1.0f);
+    Algorithms::SmoothBufferAndAdd<5>(inBuffer.data() + BufferPrefixSize, sectionsOutBuffer.data(), 16);
+    Algorithms::SmoothBufferAndAdd<5>(inBuffer.data() + BufferPrefixSize + 16, sectionsOutBuffer.data() + 16, 32);
+    Algorithms::SmoothBufferAndAdd<5>(inBuffer.data() + BufferPrefixSize + 48, sectionsOutBuffer.data() + 48, 16);
+
+    for (size_t i = 0; i < BufferSize; ++i)
+    {
+        EXPECT_FLOAT_EQ(wholeOutBuffer[i], sectionsOutBuffer[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// SWE
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace /* anonymous */ {
+
+    // One vectorization word before and after the "body", to allow for the neighbors of
+    // the first and last samples
+    size_t constexpr SWEBufferPrefixSize = vectorization_float_count<size_t>;
+    size_t constexpr SWEBufferSize = 32;
+
+    size_t constexpr SWETotalBufferSize = SWEBufferPrefixSize + SWEBufferSize + vectorization_float_count<size_t>;
+
+    Buffer<float> MakeSWEBuffer(float offset)
+    {
+        Buffer<float> buffer(SWETotalBufferSize);
+        for (size_t i = 0; i < SWETotalBufferSize; ++i)
+        {
+            buffer[i] = offset + std::sin(static_cast<float>(i) * 0.7f);
+        }
+
+        return buffer;
+    }
+}
+
+template<typename Algorithm>
+void RunUpdateSWEHeightFieldTest(Algorithm algorithm)
+{
+    float constexpr DtOverDx = 0.025f;
+
+    Buffer<float> heightField = MakeSWEBuffer(50.0f);
+    Buffer<float> const velocityField = MakeSWEBuffer(0.0f);
+
+    Buffer<float> const expectedHeightField = MakeSWEBuffer(50.0f);
+
+    algorithm(
+        heightField.data() + SWEBufferPrefixSize,
+        velocityField.data() + SWEBufferPrefixSize,
+        SWEBufferSize,
+        DtOverDx);
+
+    for (size_t i = 0; i < SWETotalBufferSize; ++i)
+    {
+        if (i >= SWEBufferPrefixSize && i < SWEBufferPrefixSize + SWEBufferSize)
+        {
+            EXPECT_FLOAT_EQ(
+                expectedHeightField[i] * (1.0f + DtOverDx * (velocityField[i] - velocityField[i + 1])),
+                heightField[i]);
+        }
+        else
+        {
+            EXPECT_EQ(expectedHeightField[i], heightField[i]);
+        }
+    }
+}
+
+TEST(AlgorithmsTests, UpdateSWEHeightField_Naive)
+{
+    RunUpdateSWEHeightFieldTest(Algorithms::UpdateSWEHeightField_Naive);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+TEST(AlgorithmsTests, UpdateSWEHeightField_SSEVectorized)
+{
+    RunUpdateSWEHeightFieldTest(Algorithms::UpdateSWEHeightField_SSEVectorized);
+}
+#endif
+
+template<typename Algorithm>
+void RunUpdateSWEVelocityFieldTest(Algorithm algorithm)
+{
+    float constexpr PreviousVWeight1 = 0.8f;
+    float constexpr PreviousVWeight2 = 0.1f;
+    float constexpr GDtOverDx = 0.25f;
+
+    Buffer<float> const heightField = MakeSWEBuffer(50.0f);
+    Buffer<float> const velocityField = MakeSWEBuffer(0.0f);
+    Buffer<float> outVelocityField(SWETotalBufferSize, 0, 1000.0f);
+
+    algorithm(
+        heightField.data() + SWEBufferPrefixSize,
+        velocityField.data() + SWEBufferPrefixSize,
+        outVelocityField.data() + SWEBufferPrefixSize,
+        SWEBufferSize,
+        PreviousVWeight1,
+        PreviousVWeight2,
+        GDtOverDx);
+
+    for (size_t i = 0; i < SWETotalBufferSize; ++i)
+    {
+        if (i >= SWEBufferPrefixSize && i < SWEBufferPrefixSize + SWEBufferSize)
+        {
+            // Only uses velocities of the previous step
+            float const previousV =
+                PreviousVWeight1 * velocityField[i]
+                + PreviousVWeight2 * (velocityField[i - 1] + velocityField[i + 1]);
+
+            EXPECT_NEAR(
+                previousV - GDtOverDx * (heightField[i] - heightField[i - 1]),
+                outVelocityField[i],
+                0.00001f);
+        }
+        else
+        {
+            EXPECT_EQ(1000.0f, outVelocityField[i]);
+        }
+    }
+}
+
+TEST(AlgorithmsTests, UpdateSWEVelocityField_Naive)
+{
+    RunUpdateSWEVelocityFieldTest(Algorithms::UpdateSWEVelocityField_Naive);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+TEST(AlgorithmsTests, UpdateSWEVelocityField_SSEVectorized)
+{
+    RunUpdateSWEVelocityFieldTest(Algorithms::UpdateSWEVelocityField_SSEVectorized);
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // CalculateSpringVectors
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Algorithm>
-void RunCalculateSpringVectorsTest(Algorithm algorithm)
+void RunCalculateSpringVectorsTest(
+    Algorithm algorithm,
+    size_t calculatedSpringCount)
 {
-    static size_t constexpr NumSprings = 5; // Plus one at end
+    static size_t constexpr NumSprings = 9; // Plus one at end
 
     static std::array<vec2f, NumSprings * 2> const positions = {
         vec2f(0.0f, 0.0f),
@@ -552,6 +843,14 @@ void RunCalculateSpringVectorsTest(Algorithm algorithm)
         vec2f(0.2f, 0.7f),
         vec2f(1000.0f, 2000.0f),
         vec2f(10000.0f, 20000.0f),
+        vec2f(5.0f, 5.0f),
+        vec2f(-5.0f, 5.0f),
+        vec2f(0.0f, 3.0f),
+        vec2f(4.0f, 0.0f),
+        vec2f(-1.0f, -2.0f),
+        vec2f(-3.0f, -7.0f),
+        vec2f(7.0f, 7.0f),
+        vec2f(7.0f, 7.5f),
         vec2f(10.0f, 20.0f),
         vec2f(20.0f, 30.0f)
     };
@@ -561,11 +860,17 @@ void RunCalculateSpringVectorsTest(Algorithm algorithm)
         SpringEndpoints{2, 3},
         SpringEndpoints{4, 5},
         SpringEndpoints{6, 7},
-        SpringEndpoints{8, 9}
+        SpringEndpoints{8, 9},
+        SpringEndpoints{10, 11},
+        SpringEndpoints{12, 13},
+        SpringEndpoints{14, 15},
+        SpringEndpoints{16, 17}
     };
 
-    std::array<float, NumSprings> lengths;
-    std::array<vec2f, NumSprings> normalizedVectors;
+    aligned_to_vword std::array<float, NumSprings> lengths;
+    aligned_to_vword std::array<vec2f, NumSprings> normalizedVectors;
+
+    lengths[calculatedSpringCount] = -1.0f;
 
     algorithm(
         0,
@@ -574,7 +879,7 @@ void RunCalculateSpringVectorsTest(Algorithm algorithm)
         lengths.data(),
         normalizedVectors.data());
 
-    for (size_t s = 0; s < 4; ++s)
+    for (size_t s = 0; s < calculatedSpringCount; ++s)
     {
         vec2f const dis = (positions[endpoints[s].PointBIndex] - positions[endpoints[s].PointAIndex]);
 
@@ -582,24 +887,37 @@ void RunCalculateSpringVectorsTest(Algorithm algorithm)
         EXPECT_TRUE(ApproxEquals(normalizedVectors[s].x, dis.normalise().x, 0.001f));
         EXPECT_TRUE(ApproxEquals(normalizedVectors[s].y, dis.normalise().y, 0.001f));
     }
+
+    // Make sure the spring past the block is untouched
+    EXPECT_EQ(lengths[calculatedSpringCount], -1.0f);
 }
 
 TEST(AlgorithmsTests, CalculateSpringVectors_Naive)
 {
-    RunCalculateSpringVectorsTest(Algorithms::CalculateSpringVectors_Naive<SpringEndpoints>);
+    RunCalculateSpringVectorsTest(Algorithms::CalculateSpringVectors_Naive<SpringEndpoints>, 4);
 }
 
 #if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
 TEST(AlgorithmsTests, CalculateSpringVectors_SSEVectorized)
 {
-    RunCalculateSpringVectorsTest(Algorithms::CalculateSpringVectors_SSEVectorized<SpringEndpoints>);
+    RunCalculateSpringVectorsTest(Algorithms::CalculateSpringVectors_SSEVectorized<SpringEndpoints>, 4);
+}
+
+TEST(AlgorithmsTests, CalculateSpringVectors_AVX2Vectorized)
+{
+    if (!is_avx2_fma_supported())
+    {
+        GTEST_SKIP() << "AVX2/FMA not supported";
+    }
+
+    RunCalculateSpringVectorsTest(Algorithms::CalculateSpringVectors_AVX2Vectorized<SpringEndpoints>, 8);
 }
 #endif
 
 #if FS_IS_ARM_NEON()
 TEST(AlgorithmsTests, CalculateSpringVectors_NeonVectorized)
 {
-    RunCalculateSpringVectorsTest(Algorithms::CalculateSpringVectors_NeonVectorized<SpringEndpoints>);
+    RunCalculateSpringVectorsTest(Algorithms::CalculateSpringVectors_NeonVectorized<SpringEndpoints>, 4);
 }
 #endif
 
@@ -735,6 +1053,16 @@ TEST(AlgorithmsTests, RunIntegrateAndResetDynamicForcesTest_2_SSEVectorized)
 {
     RunIntegrateAndResetDynamicForcesTest_2(Algorithms::IntegrateAndResetDynamicForces_SSEVectorized<IntegrateAndResetDynamicForcesPoints>);
 }
+
+TEST(AlgorithmsTests, RunIntegrateAndResetDynamicForcesTest_2_AVX2Vectorized)
+{
+    if (!is_avx2_fma_supported())
+    {
+        GTEST_SKIP() << "AVX2/FMA not supported";
+    }
+
+    RunIntegrateAndResetDynamicForcesTest_2(Algorithms::IntegrateAndResetDynamicForces_AVX2Vectorized<IntegrateAndResetDynamicForcesPoints>);
+}
 #endif
 
 #if FS_IS_ARM_NEON()
@@ -1053,6 +1381,16 @@ TEST(AlgorithmsTests, RunApplySpringForcesTest_SSEVectorized)
 {
     RunApplySpringForcesTest(Algorithms::ApplySpringsForces_SSEVectorized<ApplySpringForcesPoints, ApplySpringForcesSprings>);
 }
+
+TEST(AlgorithmsTests, RunApplySpringForcesTest_AVX2Vectorized)
+{
+    if (!is_avx2_fma_supported())
+    {
+        GTEST_SKIP() << "AVX2/FMA not supported";
+    }
+
+    RunApplySpringForcesTest(Algorithms::ApplySpringsForces_AVX2Vectorized<ApplySpringForcesPoints, ApplySpringForcesSprings>);
+}
 #endif
 
 #if FS_IS_ARM_NEON()
@@ -0,0 +1,110 @@
+#include <Core/Buffer2DRegionDelta.h>
+
+#include "gtest/gtest.h"
+
+using TestBuffer = Buffer2D<int, struct IntegralTag>;
+using TestDelta = Buffer2DRegionDelta<TestBuffer>;
+
+static TestBuffer MakeTestBuffer(int width, int height)
+{
+    TestBuffer buffer(width, height, 0);
+
+    int iVal = 100;
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            buffer[IntegralCoordinates(x, y)] = iVal++;
+        }
+    }
+
+    return buffer;
+}
+
+static void VerifyRegion(
+    TestBuffer const & expected,
+    TestBuffer const & actual)
+{
+    ASSERT_EQ(actual.Size, expected.Size);
+
+    for (int y = 0; y < expected.Size.height; ++y)
+    {
+        for (int x = 0; x < expected.Size.width; ++x)
+        {
+            EXPECT_EQ(actual[IntegralCoordinates(x, y)], expected[IntegralCoordinates(x, y)]);
+        }
+    }
+}
+
+TEST(Buffer2DRegionDeltaTests, NoChanges)
+{
+    TestBuffer const reference = MakeTestBuffer(8, 6);
+    IntegralCoordinates const regionOrigin(2, 1);
+    TestBuffer const region = reference.CloneRegion(IntegralRect(regionOrigin, IntegralRectSize(4, 3)));
+
+    auto const delta = TestDelta::Make(region, reference, regionOrigin);
+
+    EXPECT_EQ(delta.GetSize(), IntegralRectSize(4, 3));
+    EXPECT_EQ(delta.GetChangedElementCount(), 0u);
+    EXPECT_EQ(delta.GetByteSize(), 0u);
+
+    VerifyRegion(region, delta.MakeRegionBuffer(reference, regionOrigin));
+}
+
+TEST(Buffer2DRegionDeltaTests, ScatteredChanges)
+{
+    TestBuffer const original = MakeTestBuffer(8, 6);
+    IntegralCoordinates const regionOrigin(2, 1);
+    TestBuffer const region = original.CloneRegion(IntegralRect(regionOrigin, IntegralRectSize(4, 3)));
+
+    // Edit some elements, within and outside the region
+    TestBuffer edited = original.Clone();
+    edited[IntegralCoordinates(2, 1)] = 1; // First of region
+    edited[IntegralCoordinates(4, 2)] = 2;
+    edited[IntegralCoordinates(5, 2)] = 3; // Last of row
+    edited[IntegralCoordinates(2, 3)] = 4; // First of row, adjacent to previous
+    edited[IntegralCoordinates(0, 0)] = 5; // Outside region
+
+    auto const delta = TestDelta::Make(region, edited, regionOrigin);
+
+    EXPECT_EQ(delta.GetChangedElementCount(), 4u);
+    EXPECT_LT(delta.GetByteSize(), region.GetByteSize());
+
+    VerifyRegion(region, delta.MakeRegionBuffer(edited, regionOrigin));
+}
+
+TEST(Buffer2DRegionDeltaTests, AllChanged)
+{
+    TestBuffer const original = MakeTestBuffer(5, 5);
+    TestBuffer const region = original.Clone();
+
+    TestBuffer const edited(5, 5, -1);
+
+    auto const delta = TestDelta::Make(region, edited, IntegralCoordinates(0, 0));
+
+    EXPECT_EQ(delta.GetChangedElementCount(), 25u);
+
+    VerifyRegion(region, delta.MakeRegionBuffer(edited, IntegralCoordinates(0, 0)));
+}
+
+TEST(Buffer2DRegionDeltaTests, ReferenceChangedAtUnchangedElements)
+{
+    TestBuffer const original = MakeTestBuffer(4, 4);
+    TestBuffer const region = original.Clone();
+
+    TestBuffer edited = original.Clone();
+    edited[IntegralCoordinates(1, 1)] = 1;
+
+    auto const delta = TestDelta::Make(region, edited, IntegralCoordinates(0, 0));
+
+    // Change the reference further, at an element that was not changed by the first edit
+    edited[IntegralCoordinates(3, 3)] = 2;
+
+    auto const rebuiltRegion = delta.MakeRegionBuffer(edited, IntegralCoordinates(0, 0));
+
+    // Changed element is restored...
+    EXPECT_EQ(rebuiltRegion[IntegralCoordinates(1, 1)], original[IntegralCoordinates(1, 1)]);
+
+    // ...while the other one is taken from the reference
+    EXPECT_EQ(rebuiltRegion[IntegralCoordinates(3, 3)], 2);
+}
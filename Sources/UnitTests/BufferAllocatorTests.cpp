@@ -0,0 +1,52 @@
+#include <Core/BufferAllocator.h>
+
+#include "TestingUtils.h"
+
+#include "gtest/gtest.h"
+
+TEST(BufferAllocatorTests, RecyclesBuffers)
+{
+    BufferAllocator<float> allocator(16);
+
+    Buffer<float> const * firstBufferPtr;
+
+    {
+        auto buffer = allocator.Allocate();
+        EXPECT_EQ(buffer->GetSize(), 16u);
+
+        firstBufferPtr = buffer.get();
+    }
+
+    {
+        auto buffer1 = allocator.Allocate();
+        EXPECT_EQ(buffer1.get(), firstBufferPtr);
+
+        auto buffer2 = allocator.Allocate();
+        EXPECT_NE(buffer2.get(), firstBufferPtr);
+    }
+}
+
+TEST(BufferAllocatorTests, SteadyStateAllocations_DoNotAllocate)
+{
+    BufferAllocator<float> allocator(16);
+
+    // Warm-up
+    {
+        auto buffer1 = allocator.Allocate();
+        auto buffer2 = allocator.Allocate();
+    }
+
+    {
+        ScopedAllocationCounter allocationCounter;
+
+        for (int i = 0; i < 10; ++i)
+        {
+            auto buffer1 = allocator.Allocate();
+            auto buffer2 = allocator.Allocate();
+
+            auto buffer2Copy = buffer2;
+        }
+
+        EXPECT_EQ(allocationCounter.GetCount(), 0u);
+    }
+}
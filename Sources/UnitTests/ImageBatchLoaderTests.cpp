@@ -0,0 +1,104 @@
+#include <Core/ImageBatchLoader.h>
+
+#include <Core/GameException.h>
+#include <Core/ImageData.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+class ImageBatchLoaderTests : public testing::Test
+{
+protected:
+
+    ThreadManager mThreadManager{ false, 4, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+};
+
+TEST_F(ImageBatchLoaderTests, Empty)
+{
+    auto const images = ImageBatchLoader::Load<RgbaImageData>(
+        0,
+        [](size_t) -> RgbaImageData
+        {
+            EXPECT_TRUE(false);
+            return RgbaImageData(1, 1);
+        },
+        mThreadManager.GetSimulationThreadPool());
+
+    EXPECT_TRUE(images.empty());
+}
+
+TEST_F(ImageBatchLoaderTests, ImagesAreInBatchOrder)
+{
+    size_t constexpr Count = 100;
+
+    auto const images = ImageBatchLoader::Load<RgbaImageData>(
+        Count,
+        [](size_t i)
+        {
+            return RgbaImageData(
+                static_cast<int>(i) + 1,
+                2,
+                rgbaColor(static_cast<rgbaColor::data_type>(i), 0x00, 0x00, 0xff));
+        },
+        mThreadManager.GetSimulationThreadPool());
+
+    ASSERT_EQ(Count, images.size());
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        EXPECT_EQ(ImageSize(static_cast<int>(i) + 1, 2), images[i].Size);
+        EXPECT_EQ(rgbaColor(static_cast<rgbaColor::data_type>(i), 0x00, 0x00, 0xff), images[i].Data[0]);
+    }
+}
+
+TEST_F(ImageBatchLoaderTests, FailureOfOneImageFailsBatch)
+{
+    try
+    {
+        ImageBatchLoader::Load<RgbImageData>(
+            10,
+            [](size_t i)
+            {
+                if (i == 7)
+                {
+                    throw GameException("Cannot decode image 7");
+                }
+
+                return RgbImageData(1, 1);
+            },
+            mThreadManager.GetSimulationThreadPool());
+
+        FAIL();
+    }
+    catch (GameException const & ex)
+    {
+        EXPECT_EQ(std::string("Cannot decode image 7"), std::string(ex.what()));
+    }
+}
+
+TEST_F(ImageBatchLoaderTests, FirstFailureIsReported)
+{
+    try
+    {
+        ImageBatchLoader::Load<RgbImageData>(
+            10,
+            [](size_t i)
+            {
+                if (i >= 3)
+                {
+                    throw GameException("Cannot decode image " + std::to_string(i));
+                }
+
+                return RgbImageData(1, 1);
+            },
+            mThreadManager.GetSimulationThreadPool());
+
+        FAIL();
+    }
+    catch (GameException const & ex)
+    {
+        EXPECT_EQ(std::string("Cannot decode image 3"), std::string(ex.what()));
+    }
+}
@@ -0,0 +1,99 @@
+#include <Core/InplaceFunction.h>
+
+#include "TestingUtils.h"
+
+#include <memory>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+TEST(InplaceFunctionTests, DefaultIsEmpty)
+{
+    InplaceFunction<void(), 32> f;
+    EXPECT_FALSE(f);
+
+    InplaceFunction<void(), 32> g = nullptr;
+    EXPECT_FALSE(g);
+}
+
+TEST(InplaceFunctionTests, Invokes)
+{
+    int state = 4;
+
+    InplaceFunction<int(int, int), 32> f = [&state](int a, int b)
+    {
+        state += a;
+        return state * b;
+    };
+
+    ASSERT_TRUE(f);
+    EXPECT_EQ(f(1, 10), 50);
+    EXPECT_EQ(state, 5);
+}
+
+TEST(InplaceFunctionTests, InvokesMutableCallable)
+{
+    InplaceFunction<int(), 32> f = [counter = 0]() mutable
+    {
+        return ++counter;
+    };
+
+    EXPECT_EQ(f(), 1);
+    EXPECT_EQ(f(), 2);
+}
+
+TEST(InplaceFunctionTests, CopiesAndMoves)
+{
+    auto const token = std::make_shared<int>(42);
+
+    InplaceFunction<int(), 32> f = [token]() { return *token; };
+    EXPECT_EQ(token.use_count(), 2);
+
+    InplaceFunction<int(), 32> g = f;
+    EXPECT_EQ(token.use_count(), 3);
+    EXPECT_EQ(g(), 42);
+
+    InplaceFunction<int(), 32> h = std::move(g);
+    EXPECT_EQ(h(), 42);
+
+    // The moved-from function holds a moved-from callable
+    g = nullptr;
+    EXPECT_EQ(token.use_count(), 3);
+
+    h = nullptr;
+    EXPECT_FALSE(h);
+    EXPECT_EQ(token.use_count(), 2);
+
+    f = [token]() { return *token + 1; };
+    EXPECT_EQ(f(), 43);
+    EXPECT_EQ(token.use_count(), 2);
+}
+
+TEST(InplaceFunctionTests, DestroysCallable)
+{
+    auto const token = std::make_shared<int>(42);
+
+    {
+        InplaceFunction<void(), 32> f = [token]() {};
+        EXPECT_EQ(token.use_count(), 2);
+    }
+
+    EXPECT_EQ(token.use_count(), 1);
+}
+
+TEST(InplaceFunctionTests, DoesNotAllocate)
+{
+    int a = 1;
+    int b = 2;
+    double c = 3.0;
+
+    ScopedAllocationCounter allocationCounter;
+
+    InplaceFunction<double(), 32> f = [&a, &b, c]() { return a + b + c; };
+    InplaceFunction<double(), 32> g = f;
+    InplaceFunction<double(), 32> h = std::move(g);
+
+    EXPECT_EQ(h(), 6.0);
+
+    EXPECT_EQ(allocationCounter.GetCount(), 0u);
+}
@@ -0,0 +1,123 @@
+#include <Core/Profiler.h>
+
+#include <picojson.h>
+
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+    size_t CountZones(
+        picojson::value const & trace,
+        std::string const & name)
+    {
+        size_t count = 0;
+        for (auto const & event : trace.get<picojson::object>().at("traceEvents").get<picojson::array>())
+        {
+            auto const & eventObj = event.get<picojson::object>();
+            if (eventObj.at("ph").get<std::string>() == "X"
+                && eventObj.at("name").get<std::string>() == name)
+            {
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
+    picojson::value ParseTrace(std::string const & traceJson)
+    {
+        picojson::value trace;
+        std::string const error = picojson::parse(trace, traceJson);
+        EXPECT_TRUE(error.empty());
+
+        return trace;
+    }
+}
+
+TEST(ProfilerTests, RecordsZonesOnlyWhileRunning)
+{
+    {
+        FS_PROFILE_ZONE("ProfilerTests::Before");
+    }
+
+    Profiler::GetInstance().Start();
+
+    {
+        FS_PROFILE_ZONE("ProfilerTests::Outer");
+
+        {
+            FS_PROFILE_ZONE("ProfilerTests::Inner");
+        }
+
+        {
+            FS_PROFILE_ZONE("ProfilerTests::Inner");
+        }
+    }
+
+    Profiler::GetInstance().Stop();
+
+    {
+        FS_PROFILE_ZONE("ProfilerTests::After");
+    }
+
+    auto const trace = ParseTrace(Profiler::GetInstance().MakeChromeTrace());
+
+    EXPECT_EQ(0u, CountZones(trace, "ProfilerTests::Before"));
+    EXPECT_EQ(1u, CountZones(trace, "ProfilerTests::Outer"));
+    EXPECT_EQ(2u, CountZones(trace, "ProfilerTests::Inner"));
+    EXPECT_EQ(0u, CountZones(trace, "ProfilerTests::After"));
+}
+
+TEST(ProfilerTests, RestartDiscardsPreviousZones)
+{
+    Profiler::GetInstance().Start();
+
+    {
+        FS_PROFILE_ZONE("ProfilerTests::FirstRun");
+    }
+
+    Profiler::GetInstance().Stop();
+    Profiler::GetInstance().Start();
+
+    {
+        FS_PROFILE_ZONE("ProfilerTests::SecondRun");
+    }
+
+    Profiler::GetInstance().Stop();
+
+    auto const trace = ParseTrace(Profiler::GetInstance().MakeChromeTrace());
+
+    EXPECT_EQ(0u, CountZones(trace, "ProfilerTests::FirstRun"));
+    EXPECT_EQ(1u, CountZones(trace, "ProfilerTests::SecondRun"));
+}
+
+TEST(ProfilerTests, RecordsZonesFromMultipleThreads)
+{
+    Profiler::GetInstance().Start();
+
+    {
+        FS_PROFILE_ZONE("ProfilerTests::MainThread");
+    }
+
+    std::thread worker(
+        []()
+        {
+            Profiler::GetInstance().SetThisThreadName("ProfilerTests Worker");
+
+            FS_PROFILE_ZONE("ProfilerTests::WorkerThread");
+        });
+
+    worker.join();
+
+    Profiler::GetInstance().Stop();
+
+    auto const traceJson = Profiler::GetInstance().MakeChromeTrace();
+    auto const trace = ParseTrace(traceJson);
+
+    EXPECT_EQ(1u, CountZones(trace, "ProfilerTests::MainThread"));
+    EXPECT_EQ(1u, CountZones(trace, "ProfilerTests::WorkerThread"));
+    EXPECT_NE(std::string::npos, traceJson.find("ProfilerTests Worker"));
+}
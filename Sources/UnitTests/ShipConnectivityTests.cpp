@@ -0,0 +1,305 @@
+#include "TestingWorld.h"
+
+#include <Simulation/Physics/Physics.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+/*
+ * Reaches into the ship's internals.
+ */
+class ShipConnectivityTests
+{
+public:
+
+    struct Connectivity
+    {
+        std::vector<PlaneId> PlaneIds;
+        std::vector<ConnectedComponentId> ConnectedComponentIds;
+        std::vector<size_t> ConnectedComponentSizes;
+        std::vector<size_t> PlaneTriangleIndices;
+    };
+
+    // Takes the positions of the spring's endpoints in ship space
+    using SpringSelector = std::function<bool(vec2f const & endpointAPosition, vec2f const & endpointBPosition)>;
+
+    static void DestroySprings(
+        Physics::Ship & ship,
+        SpringSelector const & selector,
+        TestingWorld & world)
+    {
+        vec2f const origin = GetShipOrigin(ship);
+
+        for (auto springIndex : ship.mSprings)
+        {
+            if (!ship.mSprings.IsDeleted(springIndex)
+                && selector(
+                    ship.mSprings.GetEndpointAPosition(springIndex, ship.mPoints) - origin,
+                    ship.mSprings.GetEndpointBPosition(springIndex, ship.mPoints) - origin))
+            {
+                ship.mSprings.Destroy(
+                    springIndex,
+                    Physics::Springs::DestroyOptions::DoNotFireBreakEvent
+                    | Physics::Springs::DestroyOptions::DestroyAllTriangles,
+                    0.0f,
+                    world.Parameters,
+                    ship.mPoints);
+            }
+        }
+
+        world.EventDispatcher.Flush();
+    }
+
+    static void RestoreAllSprings(
+        Physics::Ship & ship,
+        TestingWorld & world)
+    {
+        for (auto springIndex : ship.mSprings)
+        {
+            if (ship.mSprings.IsDeleted(springIndex))
+            {
+                ship.mSprings.Restore(
+                    springIndex,
+                    world.Parameters,
+                    ship.mPoints);
+            }
+        }
+
+        world.EventDispatcher.Flush();
+    }
+
+    static bool CanUpdateConnectivityIncrementally(Physics::Ship const & ship)
+    {
+        return ship.mCanUpdateConnectivityIncrementally;
+    }
+
+    static Connectivity UpdateConnectivity(Physics::Ship & ship)
+    {
+        ship.UpdateConnectivity();
+        return GetConnectivity(ship);
+    }
+
+    static Connectivity RunConnectivityVisit(Physics::Ship & ship)
+    {
+        ship.RunConnectivityVisit();
+        return GetConnectivity(ship);
+    }
+
+private:
+
+    static vec2f GetShipOrigin(Physics::Ship const & ship)
+    {
+        vec2f origin(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        for (auto pointIndex : ship.mPoints.RawShipPoints())
+        {
+            origin.x = std::min(origin.x, ship.mPoints.GetPosition(pointIndex).x);
+            origin.y = std::min(origin.y, ship.mPoints.GetPosition(pointIndex).y);
+        }
+
+        return origin;
+    }
+
+    static Connectivity GetConnectivity(Physics::Ship const & ship)
+    {
+        Connectivity connectivity;
+
+        for (auto pointIndex : ship.mPoints.RawShipPoints())
+        {
+            connectivity.PlaneIds.push_back(ship.mPoints.GetPlaneId(pointIndex));
+            connectivity.ConnectedComponentIds.push_back(ship.mPoints.GetConnectedComponentId(pointIndex));
+        }
+
+        connectivity.ConnectedComponentSizes = ship.mConnectedComponentSizes;
+        connectivity.PlaneTriangleIndices = ship.mPlaneTriangleIndicesToRender;
+
+        return connectivity;
+    }
+};
+
+namespace {
+
+    ShipSpaceSize constexpr ShipSize(48, 24);
+
+    bool IsAcross(float a, float b, float cut)
+    {
+        return (a - cut) * (b - cut) < 0.0f;
+    }
+
+    bool IsAt(vec2f const & position, vec2f const & target)
+    {
+        return (position - target).length() < 0.1f;
+    }
+
+    // Updates the ship's connectivity incrementally, and verifies that the outcome is the same as a full visit's
+    ShipConnectivityTests::Connectivity VerifyIncrementalConnectivityUpdate(Physics::Ship & ship)
+    {
+        EXPECT_TRUE(ShipConnectivityTests::CanUpdateConnectivityIncrementally(ship));
+
+        auto const incrementalConnectivity = ShipConnectivityTests::UpdateConnectivity(ship);
+        auto const fullConnectivity = ShipConnectivityTests::RunConnectivityVisit(ship);
+
+        EXPECT_EQ(incrementalConnectivity.PlaneIds, fullConnectivity.PlaneIds);
+        EXPECT_EQ(incrementalConnectivity.ConnectedComponentIds, fullConnectivity.ConnectedComponentIds);
+        EXPECT_EQ(incrementalConnectivity.ConnectedComponentSizes, fullConnectivity.ConnectedComponentSizes);
+        EXPECT_EQ(incrementalConnectivity.PlaneTriangleIndices, fullConnectivity.PlaneTriangleIndices);
+
+        return incrementalConnectivity;
+    }
+}
+
+TEST(ShipConnectivityTests, IncrementalUpdate_MatchesVisit_AfterSplits)
+{
+    TestingWorld world(SimulationParameters(), 1);
+    Physics::Ship & ship = world.AddShip(ShipSize, vec2f(0.0f, -8.0f));
+
+    // First update is a full visit
+    auto connectivity = ShipConnectivityTests::UpdateConnectivity(ship);
+    EXPECT_EQ(connectivity.ConnectedComponentSizes.size(), 1u);
+
+    // Cut in two halves
+    ShipConnectivityTests::DestroySprings(
+        ship,
+        [](vec2f const & a, vec2f const & b)
+        {
+            return IsAcross(a.x, b.x, 23.5f);
+        },
+        world);
+
+    connectivity = VerifyIncrementalConnectivityUpdate(ship);
+    EXPECT_EQ(connectivity.ConnectedComponentSizes.size(), 2u);
+
+    // Cut the right half in two, and a piece of the upper deck out of the left half
+    ShipConnectivityTests::DestroySprings(
+        ship,
+        [](vec2f const & a, vec2f const & b)
+        {
+            return (a.x > 23.5f && IsAcross(a.y, b.y, 11.5f))
+                || (std::abs(a.y - 16.0f) < 0.1f && (IsAcross(a.x, b.x, 2.5f) || IsAcross(a.x, b.x, 5.5f)));
+        },
+        world);
+
+    connectivity = VerifyIncrementalConnectivityUpdate(ship);
+    EXPECT_EQ(connectivity.ConnectedComponentSizes.size(), 4u);
+
+    // Orphan a point of the lower deck
+    ShipConnectivityTests::DestroySprings(
+        ship,
+        [](vec2f const & a, vec2f const & b)
+        {
+            return IsAt(a, vec2f(5.0f, 8.0f)) || IsAt(b, vec2f(5.0f, 8.0f));
+        },
+        world);
+
+    VerifyIncrementalConnectivityUpdate(ship);
+}
+
+TEST(ShipConnectivityTests, IncrementalUpdate_MatchesVisit_AfterRestores)
+{
+    TestingWorld world(SimulationParameters(), 1);
+    Physics::Ship & ship = world.AddShip(ShipSize, vec2f(0.0f, -8.0f));
+
+    ShipConnectivityTests::UpdateConnectivity(ship);
+
+    ShipConnectivityTests::DestroySprings(
+        ship,
+        [](vec2f const & a, vec2f const & b)
+        {
+            return IsAcross(a.x, b.x, 23.5f);
+        },
+        world);
+
+    VerifyIncrementalConnectivityUpdate(ship);
+
+    // Restoring springs forces a full visit
+    ShipConnectivityTests::RestoreAllSprings(ship, world);
+
+    EXPECT_FALSE(ShipConnectivityTests::CanUpdateConnectivityIncrementally(ship));
+    auto connectivity = ShipConnectivityTests::UpdateConnectivity(ship);
+    EXPECT_EQ(connectivity.ConnectedComponentSizes.size(), 1u);
+
+    // ...after which we're back to incremental updates
+    ShipConnectivityTests::DestroySprings(
+        ship,
+        [](vec2f const & a, vec2f const & b)
+        {
+            return IsAcross(a.x, b.x, 8.5f) || IsAcross(a.x, b.x, 39.5f);
+        },
+        world);
+
+    connectivity = VerifyIncrementalConnectivityUpdate(ship);
+    EXPECT_EQ(connectivity.ConnectedComponentSizes.size(), 3u);
+
+    ShipConnectivityTests::RestoreAllSprings(ship, world);
+
+    ShipConnectivityTests::UpdateConnectivity(ship);
+
+    ShipConnectivityTests::DestroySprings(
+        ship,
+        [](vec2f const & a, vec2f const & b)
+        {
+            return IsAcross(a.y, b.y, 4.5f) || IsAcross(a.y, b.y, 12.5f);
+        },
+        world);
+
+    connectivity = VerifyIncrementalConnectivityUpdate(ship);
+    EXPECT_EQ(connectivity.ConnectedComponentSizes.size(), 3u);
+}
+
+TEST(ShipConnectivityTests, IncrementalUpdate_MatchesVisit_AfterBreaksWithoutSplits)
+{
+    TestingWorld world(SimulationParameters(), 1);
+    Physics::Ship & ship = world.AddShip(ShipSize, vec2f(0.0f, -8.0f));
+
+    ShipConnectivityTests::UpdateConnectivity(ship);
+
+    // Deck springs next to a bulkhead, together with the triangles around their endpoints;
+    // planes stay as they are, but lose some triangles
+    ShipConnectivityTests::DestroySprings(
+        ship,
+        [](vec2f const & a, vec2f const & b)
+        {
+            return std::abs(a.y - 8.0f) < 0.1f
+                && std::abs(b.y - 8.0f) < 0.1f
+                && IsAcross(a.x, b.x, 16.5f);
+        },
+        world);
+
+    auto connectivity = VerifyIncrementalConnectivityUpdate(ship);
+    EXPECT_EQ(connectivity.ConnectedComponentSizes.size(), 1u);
+
+    // Triangles alone
+    std::vector<GlobalElementId> triangleIds;
+    for (auto triangleIndex : ship.GetTriangles())
+    {
+        if (!ship.GetTriangles().IsDeleted(triangleIndex) && triangleIds.size() < 4)
+        {
+            triangleIds.emplace_back(ship.GetId(), triangleIndex);
+        }
+    }
+
+    ASSERT_FALSE(triangleIds.empty());
+
+    for (auto const & triangleId : triangleIds)
+    {
+        EXPECT_TRUE(world.World->DestroyTriangle(triangleId));
+    }
+
+    world.EventDispatcher.Flush();
+
+    VerifyIncrementalConnectivityUpdate(ship);
+
+    for (auto const & triangleId : triangleIds)
+    {
+        EXPECT_TRUE(world.World->RestoreTriangle(triangleId));
+    }
+
+    world.EventDispatcher.Flush();
+
+    connectivity = VerifyIncrementalConnectivityUpdate(ship);
+    EXPECT_EQ(connectivity.ConnectedComponentSizes.size(), 1u);
+}
@@ -0,0 +1,107 @@
+#include <Simulation/ShipFactoryTypes.h>
+
+#include "gtest/gtest.h"
+
+TEST(ShipFactoryTypesTests, PointPairToIndexMap_Empty)
+{
+    ShipFactoryPointPairToIndexMap map;
+
+    EXPECT_EQ(0u, map.GetCount());
+    EXPECT_FALSE(map.Find({ 0, 1 }).has_value());
+}
+
+TEST(ShipFactoryTypesTests, PointPairToIndexMap_AddAndFind)
+{
+    ShipFactoryPointPairToIndexMap map;
+
+    EXPECT_TRUE(map.TryAdd({ 4, 7 }, 10));
+    EXPECT_TRUE(map.TryAdd({ 0, 5 }, 11));
+
+    EXPECT_EQ(2u, map.GetCount());
+
+    ASSERT_TRUE(map.Find({ 4, 7 }).has_value());
+    EXPECT_EQ(ElementIndex(10), *map.Find({ 4, 7 }));
+    ASSERT_TRUE(map.Find({ 0, 5 }).has_value());
+    EXPECT_EQ(ElementIndex(11), *map.Find({ 0, 5 }));
+
+    EXPECT_FALSE(map.Find({ 4, 5 }).has_value());
+    EXPECT_FALSE(map.Find({ 0, 7 }).has_value());
+}
+
+TEST(ShipFactoryTypesTests, PointPairToIndexMap_PairIsUnordered)
+{
+    ShipFactoryPointPairToIndexMap map;
+
+    EXPECT_TRUE(map.TryAdd({ 7, 4 }, 10));
+
+    ASSERT_TRUE(map.Find({ 4, 7 }).has_value());
+    EXPECT_EQ(ElementIndex(10), *map.Find({ 4, 7 }));
+    ASSERT_TRUE(map.Find({ 7, 4 }).has_value());
+    EXPECT_EQ(ElementIndex(10), *map.Find({ 7, 4 }));
+}
+
+TEST(ShipFactoryTypesTests, PointPairToIndexMap_DuplicateIsNotAdded)
+{
+    ShipFactoryPointPairToIndexMap map;
+
+    EXPECT_TRUE(map.TryAdd({ 4, 7 }, 10));
+    EXPECT_FALSE(map.TryAdd({ 7, 4 }, 11));
+
+    EXPECT_EQ(1u, map.GetCount());
+    ASSERT_TRUE(map.Find({ 4, 7 }).has_value());
+    EXPECT_EQ(ElementIndex(10), *map.Find({ 4, 7 }));
+}
+
+TEST(ShipFactoryTypesTests, PointPairToIndexMap_Grows)
+{
+    ShipFactoryPointPairToIndexMap map;
+
+    // Pairs of neighbors in a grid, as the ship factory does
+    ElementIndex constexpr Width = 100;
+    ElementIndex constexpr Height = 100;
+    ElementIndex index = 0;
+    for (ElementIndex y = 0; y < Height; ++y)
+    {
+        for (ElementIndex x = 0; x < Width - 1; ++x)
+        {
+            EXPECT_TRUE(map.TryAdd({ y * Width + x, y * Width + x + 1 }, index++));
+        }
+    }
+
+    EXPECT_EQ(size_t(index), map.GetCount());
+
+    index = 0;
+    for (ElementIndex y = 0; y < Height; ++y)
+    {
+        for (ElementIndex x = 0; x < Width - 1; ++x)
+        {
+            auto const result = map.Find({ y * Width + x + 1, y * Width + x });
+            ASSERT_TRUE(result.has_value());
+            EXPECT_EQ(index++, *result);
+        }
+
+        EXPECT_FALSE(map.Find({ y * Width, y * Width + 2 }).has_value());
+    }
+}
+
+TEST(ShipFactoryTypesTests, PointPairToIndexMap_Reserve)
+{
+    ShipFactoryPointPairToIndexMap map;
+
+    EXPECT_TRUE(map.TryAdd({ 1, 2 }, 3));
+
+    map.Reserve(1000);
+
+    EXPECT_EQ(1u, map.GetCount());
+    ASSERT_TRUE(map.Find({ 1, 2 }).has_value());
+    EXPECT_EQ(ElementIndex(3), *map.Find({ 1, 2 }));
+
+    for (ElementIndex i = 0; i < 1000; ++i)
+    {
+        map.TryAdd({ i, i + 10000 }, i);
+    }
+
+    EXPECT_EQ(1001u, map.GetCount());
+    ASSERT_TRUE(map.Find({ 999, 10999 }).has_value());
+    EXPECT_EQ(ElementIndex(999), *map.Find({ 999, 10999 }));
+}
@@ -133,4 +133,44 @@ TEST(SimulationEventDispatcherTests, ClearsStateAtUpdate)
     dispatcher.Flush();
 
     Mock::VerifyAndClear(&handler);
-}
\ No newline at end of file
+}
+
+TEST(SimulationEventDispatcherTests, DefersSinkCalls)
+{
+    MockHandler handler;
+
+    SimulationEventDispatcher dispatcher;
+    dispatcher.RegisterGenericShipEventHandler(&handler);
+
+    EXPECT_CALL(handler, OnSinkingBegin(_)).Times(0);
+
+    EXPECT_FALSE(dispatcher.IsDeferringSinkCalls());
+
+    dispatcher.StartDeferringSinkCalls();
+
+    EXPECT_TRUE(dispatcher.IsDeferringSinkCalls());
+
+    dispatcher.OnSinkingBegin(7);
+    dispatcher.OnSinkingBegin(3);
+
+    Mock::VerifyAndClear(&handler);
+
+    {
+        InSequence s;
+
+        EXPECT_CALL(handler, OnSinkingBegin(7)).Times(1);
+        EXPECT_CALL(handler, OnSinkingBegin(3)).Times(1);
+    }
+
+    dispatcher.StopDeferringSinkCalls();
+
+    Mock::VerifyAndClear(&handler);
+
+    EXPECT_FALSE(dispatcher.IsDeferringSinkCalls());
+
+    EXPECT_CALL(handler, OnSinkingBegin(5)).Times(1);
+
+    dispatcher.OnSinkingBegin(5);
+
+    Mock::VerifyAndClear(&handler);
+}
@@ -2,11 +2,103 @@
 
 #include <Core/Utils.h>
 
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <cstdlib>
+#include <new>
 #include <set>
 #include <stdexcept>
 
+////////////////////////////////////
+// Allocation counting
+////////////////////////////////////
+
+namespace /* anonymous */ {
+
+    std::atomic<bool> IsCountingAllocations{ false };
+    std::atomic<size_t> AllocationCount{ 0 };
+
+    void * CountedAllocate(size_t size)
+    {
+        if (IsCountingAllocations.load(std::memory_order_relaxed))
+        {
+            AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void * const ptr = std::malloc(size > 0 ? size : 1);
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        return ptr;
+    }
+
+    void * CountedAlignedAllocate(size_t size, std::align_val_t alignment)
+    {
+        if (IsCountingAllocations.load(std::memory_order_relaxed))
+        {
+            AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        size_t const align = static_cast<size_t>(alignment);
+#ifdef _MSC_VER
+        void * const ptr = _aligned_malloc(size > 0 ? size : 1, align);
+#else
+        void * const ptr = std::aligned_alloc(align, ((size > 0 ? size : 1) + align - 1) / align * align);
+#endif
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        return ptr;
+    }
+
+    void AlignedFree(void * ptr)
+    {
+#ifdef _MSC_VER
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+}
+
+void * operator new(size_t size) { return CountedAllocate(size); }
+void * operator new[](size_t size) { return CountedAllocate(size); }
+void * operator new(size_t size, std::align_val_t alignment) { return CountedAlignedAllocate(size, alignment); }
+void * operator new[](size_t size, std::align_val_t alignment) { return CountedAlignedAllocate(size, alignment); }
+void operator delete(void * ptr) noexcept { std::free(ptr); }
+void operator delete[](void * ptr) noexcept { std::free(ptr); }
+void operator delete(void * ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void * ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void * ptr, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete[](void * ptr, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete(void * ptr, size_t, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete[](void * ptr, size_t, std::align_val_t) noexcept { AlignedFree(ptr); }
+
+ScopedAllocationCounter::ScopedAllocationCounter()
+{
+    assert(!IsCountingAllocations.load());
+
+    AllocationCount = 0;
+    IsCountingAllocations = true;
+}
+
+ScopedAllocationCounter::~ScopedAllocationCounter()
+{
+    IsCountingAllocations = false;
+}
+
+size_t ScopedAllocationCounter::GetCount() const
+{
+    return AllocationCount.load();
+}
+
+////////////////////////////////////
+
 picojson::value TestAssetManager::LoadTetureDatabaseSpecification(std::string const & databaseName) const
 {
     return Utils::ParseJSONString(GetDatabase(databaseName).DatabaseJson);
@@ -28,10 +120,10 @@ ImageSize TestAssetManager::GetTextureDatabaseFrameSize(std::string const & data
 
 RgbaImageData TestAssetManager::LoadTextureDatabaseFrameRGBA(std::string const & databaseName, std::string const & frameRelativePath) const
 {
-    assert(false); // Not needed by tests, so far
-    (void)databaseName;
-    (void)frameRelativePath;
-    return RgbaImageData(0, 0);
+    // A plain frame
+    return RgbaImageData(
+        GetTextureDatabaseFrameSize(databaseName, frameRelativePath),
+        rgbaColor(0x10, 0x20, 0x30, 0xff));
 }
 
 std::vector<IAssetManager::AssetDescriptor> TestAssetManager::EnumerateTextureDatabaseFrames(std::string const & databaseName) const
@@ -79,6 +171,39 @@ RgbaImageData TestAssetManager::LoadTextureAtlasImageRGBA(std::string const & te
     return RgbaImageData(0, 0);
 }
 
+std::string TestAssetManager::GetTextureDatabaseFingerprint(std::string const & databaseName) const
+{
+    (void)databaseName;
+    return TestTextureDatabaseFingerprint;
+}
+
+std::optional<picojson::value> TestAssetManager::LoadCachedTextureAtlasSpecification(std::string const & textureDatabaseName) const
+{
+    auto const it = TestTextureAtlasCache.find(textureDatabaseName);
+    if (it == TestTextureAtlasCache.cend())
+    {
+        return std::nullopt;
+    }
+
+    return it->second.Specification;
+}
+
+RgbaImageData TestAssetManager::LoadCachedTextureAtlasImageRGBA(std::string const & textureDatabaseName) const
+{
+    return TestTextureAtlasCache.at(textureDatabaseName).Image.Clone();
+}
+
+void TestAssetManager::SaveCachedTextureAtlas(
+    std::string const & textureDatabaseName,
+    picojson::value const & specification,
+    RgbaImageData const & image) const
+{
+    TestTextureAtlasCache.erase(textureDatabaseName);
+    TestTextureAtlasCache.emplace(
+        textureDatabaseName,
+        TestCachedTextureAtlas{ specification, image.Clone() });
+}
+
 std::vector<IAssetManager::AssetDescriptor> TestAssetManager::EnumerateShaders(std::string const & shaderSetName) const
 {
     assert(false); // Not needed by tests, so far
@@ -13,6 +13,21 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+// Counts the heap allocations made - on any thread - during its lifetime;
+// only one may exist at any given moment
+class ScopedAllocationCounter final
+{
+public:
+
+    ScopedAllocationCounter();
+    ~ScopedAllocationCounter();
+
+    ScopedAllocationCounter(ScopedAllocationCounter const &) = delete;
+    ScopedAllocationCounter & operator=(ScopedAllocationCounter const &) = delete;
+
+    size_t GetCount() const;
+};
+
 // Test texture database in storage
 struct TestTextureDatabase
 {
@@ -33,6 +48,17 @@ public:
 
     std::vector<TestTextureDatabase> TestTextureDatabases;
 
+    // The texture atlas cache, by database name; tests may tamper with it
+    struct TestCachedTextureAtlas
+    {
+        picojson::value Specification;
+        RgbaImageData Image;
+    };
+
+    mutable std::map<std::string, TestCachedTextureAtlas> TestTextureAtlasCache;
+
+    std::string TestTextureDatabaseFingerprint;
+
 public:
 
     TestAssetManager() = default;
@@ -48,6 +74,11 @@ public:
     picojson::value LoadTetureAtlasSpecification(std::string const & textureDatabaseName) const override;
     RgbaImageData LoadTextureAtlasImageRGBA(std::string const & textureDatabaseName) const override;
 
+    std::string GetTextureDatabaseFingerprint(std::string const & databaseName) const override;
+    std::optional<picojson::value> LoadCachedTextureAtlasSpecification(std::string const & textureDatabaseName) const override;
+    RgbaImageData LoadCachedTextureAtlasImageRGBA(std::string const & textureDatabaseName) const override;
+    void SaveCachedTextureAtlas(std::string const & textureDatabaseName, picojson::value const & specification, RgbaImageData const & image) const override;
+
     std::vector<AssetDescriptor> EnumerateShaders(std::string const & shaderSetName) const override;
     std::string LoadShader(std::string const & shaderSetName, std::string const & shaderRelativePath) const override;
 
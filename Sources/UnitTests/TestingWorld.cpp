@@ -0,0 +1,198 @@
+#include "TestingWorld.h"
+
+#include <Simulation/Layers.h>
+#include <Simulation/OceanFloorHeightMap.h>
+#include <Simulation/ShipDefinition.h>
+#include <Simulation/ShipFactory.h>
+#include <Simulation/ShipLoadOptions.h>
+#include <Simulation/ShipStrengthRandomizer.h>
+#include <Simulation/ShipTexturizer.h>
+
+#include <Core/GameException.h>
+#include <Core/TextureDatabase.h>
+
+#include <filesystem>
+#include <string>
+
+TestingDatabases const & TestingDatabases::GetInstance()
+{
+    static TestingDatabases const instance;
+    return instance;
+}
+
+TestingDatabases::TestingDatabases()
+    // The asset manager takes the path of a file in the game's root
+    : AssetManager((std::filesystem::path(TESTING_GAME_ROOT) / "Data").string())
+    , Materials(MaterialDatabase::Load(AssetManager))
+    , FishSpecies(FishSpeciesDatabase::Load(AssetManager))
+    , NpcTextureAtlas(TextureAtlas<GameTextureDatabases::NpcTextureDatabase>::Deserialize(AssetManager))
+    , Npcs(NpcDatabase::Load(AssetManager, Materials, NpcTextureAtlas))
+    , UnderwaterPlantsSpeciesCount(
+        TextureDatabase<GameTextureDatabases::GenericLinearTextureDatabase>::Load(AssetManager)
+            .GetGroup(GameTextureDatabases::GenericLinearTextureGroups::UnderwaterPlant)
+            .GetFrameCount())
+{
+}
+
+static ElectricalMaterial const & GetElectricalMaterial(
+    std::string const & name,
+    MaterialDatabase const & materials)
+{
+    for (auto const & [_, material] : materials.GetElectricalMaterialColorMap())
+    {
+        if (material.Name == name)
+        {
+            return material;
+        }
+    }
+
+    throw GameException("Cannot find electrical material \"" + name + "\"");
+}
+
+static ShipDefinition MakeShipDefinition(
+    ShipSpaceSize const & shipSize,
+    vec2f const & position,
+    MaterialDatabase const & materials)
+{
+    StructuralMaterial const * const hullMaterial = &materials.GetStructuralMaterial("Steel Hull");
+    StructuralMaterial const * const leakingHullMaterial = &materials.GetStructuralMaterial("Low-Grade Steel");
+    StructuralMaterial const * const deckMaterial = &materials.GetStructuralMaterial("Light Steel Bulkhead");
+
+    ElectricalMaterial const * const generatorMaterial = &GetElectricalMaterial("Non-Instanced Generator", materials);
+    ElectricalMaterial const * const cableMaterial = &GetElectricalMaterial("Electrical Cable", materials);
+    ElectricalMaterial const * const lampMaterial = &GetElectricalMaterial("Low Lamp", materials);
+
+    auto structuralLayer = std::make_unique<StructuralLayerData>(shipSize);
+    auto electricalLayer = std::make_unique<ElectricalLayerData>(shipSize);
+
+    for (int y = 0; y < shipSize.height; ++y)
+    {
+        for (int x = 0; x < shipSize.width; ++x)
+        {
+            bool const isShell = (x == 0 || x == shipSize.width - 1 || y == 0 || y == shipSize.height - 1);
+            bool const isDeck = !isShell && (y % 8) == 0;
+            bool const isBulkhead = !isShell && (x % 16) == 0;
+
+            StructuralMaterial const * material = nullptr;
+            if (isShell)
+            {
+                material = (y == 0 && (x % 32) == 16)
+                    ? leakingHullMaterial
+                    : hullMaterial;
+            }
+            else if (isDeck || isBulkhead)
+            {
+                material = deckMaterial;
+            }
+
+            structuralLayer->Buffer[{x, y}] = StructuralElement(material);
+
+            if (isDeck)
+            {
+                ElectricalMaterial const * const electricalMaterial = (x == 1)
+                    ? generatorMaterial
+                    : ((x % 8) == 4 ? lampMaterial : cableMaterial);
+
+                electricalLayer->Buffer[{x, y}] = ElectricalElement(electricalMaterial, NoneElectricalElementInstanceIndex);
+            }
+        }
+    }
+
+    // Plain textures, as auto-texturization would take longer than most tests and benchmarks;
+    // a few pixels per ship cell - as real ships have - as the interior view draws floors
+    // a couple of pixels thick around each cell's center
+    int constexpr TextureMagnification = 4;
+    ImageSize const textureSize(shipSize.width * TextureMagnification, shipSize.height * TextureMagnification);
+    auto exteriorTextureLayer = std::make_unique<TextureLayerData>(RgbaImageData(textureSize, rgbaColor(0x60, 0x60, 0x60, 0xff)));
+    auto interiorTextureLayer = std::make_unique<TextureLayerData>(RgbaImageData(textureSize, rgbaColor(0xa0, 0xa0, 0xa0, 0xff)));
+
+    return ShipDefinition(
+        ShipLayers(
+            shipSize,
+            std::move(structuralLayer),
+            std::move(electricalLayer),
+            nullptr,
+            std::move(exteriorTextureLayer),
+            std::move(interiorTextureLayer)),
+        ShipMetadata("Test Ship"),
+        ShipPhysicsData(position, 1.0f),
+        std::nullopt);
+}
+
+TestingWorld::TestingWorld(
+    SimulationParameters const & parameters,
+    size_t simulationParallelism)
+    : Databases(TestingDatabases::GetInstance())
+    , Parameters(parameters)
+    , EventDispatcher()
+    , Threads(
+        false,
+        simulationParallelism,
+        [](ThreadManager::ThreadTaskKind, std::string const &, size_t)
+        {
+            // No platform-specific initialization
+        })
+    , View(
+        FloatSize(SimulationParameters::MaxWorldWidth, SimulationParameters::MaxWorldHeight),
+        1.0f,
+        vec2f::zero(),
+        DisplayLogicalSize(1920, 1080),
+        1)
+    , Stats()
+    , World()
+{
+    Threads.InitializeThisThread(ThreadManager::ThreadTaskKind::MainAndSimulation, "Test Thread", 0);
+
+    World = std::make_unique<Physics::World>(
+        OceanFloorHeightMap::LoadFromImage(Databases.AssetManager.LoadPngImageRgb(Databases.AssetManager.GetDefaultOceanFloorHeightMapFilePath())),
+        Databases.FishSpecies,
+        Databases.UnderwaterPlantsSpeciesCount,
+        Databases.Npcs,
+        EventDispatcher,
+        Parameters,
+        Threads);
+}
+
+Physics::Ship & TestingWorld::AddShip(
+    ShipSpaceSize const & shipSize,
+    vec2f const & position)
+{
+    ShipTexturizer const shipTexturizer(Databases.Materials, Databases.AssetManager);
+    ShipStrengthRandomizer const shipStrengthRandomizer;
+
+    auto [ship, exteriorTextureImage, interiorViewImage] = ShipFactory::Create(
+        World->GetNextShipId(),
+        *World,
+        MakeShipDefinition(shipSize, position, Databases.Materials),
+        ShipLoadOptions(),
+        Databases.Materials,
+        shipTexturizer,
+        shipStrengthRandomizer,
+        EventDispatcher,
+        Databases.AssetManager,
+        Parameters,
+        Threads);
+
+    Physics::Ship & shipRef = *ship;
+    World->AddShip(std::move(ship));
+
+    World->Announce();
+    EventDispatcher.Flush();
+
+    return shipRef;
+}
+
+void TestingWorld::Update(size_t stepCount)
+{
+    for (size_t s = 0; s < stepCount; ++s)
+    {
+        World->Update(
+            Parameters,
+            View,
+            StressRenderModeType::None,
+            Threads,
+            Stats);
+
+        EventDispatcher.Flush();
+    }
+}
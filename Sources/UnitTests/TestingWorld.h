@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Game/GameAssetManager.h>
+
+#include <Simulation/FishSpeciesDatabase.h>
+#include <Simulation/MaterialDatabase.h>
+#include <Simulation/NpcDatabase.h>
+#include <Simulation/SimulationEventDispatcher.h>
+#include <Simulation/SimulationParameters.h>
+#include <Simulation/Physics/Physics.h>
+
+#include <Render/GameTextureDatabases.h>
+#include <Render/ViewModel.h>
+
+#include <Core/GameTypes.h>
+#include <Core/PerfStats.h>
+#include <Core/TextureAtlas.h>
+#include <Core/ThreadManager.h>
+
+#include <memory>
+
+//
+// A world made with the real databases from the Data folder, to which tests and
+// benchmarks may add synthetic ships.
+//
+// Each ship is a box of the requested size - a steel hull with some leaking plates
+// at the bottom, decks every eight rows and bulkheads every sixteen columns inside,
+// and on each deck a generator powering a row of lamps.
+//
+
+struct TestingDatabases
+{
+    GameAssetManager const AssetManager;
+    MaterialDatabase const Materials;
+    FishSpeciesDatabase const FishSpecies;
+    TextureAtlas<GameTextureDatabases::NpcTextureDatabase> const NpcTextureAtlas;
+    NpcDatabase const Npcs;
+    size_t const UnderwaterPlantsSpeciesCount;
+
+    // Loaded once, at first use
+    static TestingDatabases const & GetInstance();
+
+private:
+
+    TestingDatabases();
+};
+
+struct TestingWorld
+{
+    TestingDatabases const & Databases;
+    SimulationParameters Parameters;
+    SimulationEventDispatcher EventDispatcher;
+    ThreadManager Threads;
+    ViewModel const View;
+    PerfStats Stats;
+    std::unique_ptr<Physics::World> World;
+
+    TestingWorld(
+        SimulationParameters const & parameters,
+        size_t simulationParallelism);
+
+    /*
+     * Adds a ship with the middle of its bottom at the specified world position.
+     */
+    Physics::Ship & AddShip(
+        ShipSpaceSize const & shipSize,
+        vec2f const & position);
+
+    void Update(size_t stepCount);
+};
@@ -611,3 +611,173 @@ TEST(TextureAtlasTests, Placement_Duplicates)
         atlas.Metadata.GetFrameMetadata({ MyTestTextureDatabase::MyTextureGroups::MyTestGroup1, 1 }).TextureCoordinatesTopRight,
         atlas.Metadata.GetFrameMetadata({ MyTestTextureDatabase::MyTextureGroups::MyTestGroup1, 2 }).TextureCoordinatesTopRight);
 }
+
+static TestAssetManager MakeCachingTestAssetManager()
+{
+    TestAssetManager testAssetManager;
+    testAssetManager.TestTextureDatabases =
+    {
+        TestTextureDatabase{
+            MyTestTextureDatabase::DatabaseName,
+            {
+                TestTextureDatabase::DatabaseFrameInfo{{"George_0", "George_0.png", "George_0.png"}, ImageSize(4, 4)},
+                TestTextureDatabase::DatabaseFrameInfo{{"George_1", "George_1.png", "George_1.png"}, ImageSize(8, 2)},
+            },
+            R"xxx(
+[
+    {
+	    "group_name": "MyTestGroup1",
+	    "has_own_ambient_light": false,
+	    "frames":[
+		    {
+			    "world_width": 10.0,
+			    "world_height": 20.0,
+			    "frame_name_pattern": "George_\\d+"
+		    }
+	    ]
+    }
+]
+                )xxx"
+            }
+    };
+
+    testAssetManager.TestTextureDatabaseFingerprint = "Fingerprint1";
+
+    return testAssetManager;
+}
+
+TEST(TextureAtlasTests, Cache_BuildsAndCachesWhenEmpty)
+{
+    TestAssetManager testAssetManager = MakeCachingTestAssetManager();
+    ThreadManager threadManager(false, 4, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+
+    auto const atlas = TextureAtlasBuilder<MyTestTextureDatabase>::BuildCachedAtlas(
+        TextureAtlasOptions::None,
+        1.0f,
+        testAssetManager,
+        threadManager.GetSimulationThreadPool(),
+        SimpleProgressCallback::Dummy());
+
+    EXPECT_EQ(2u, atlas.Metadata.GetFrameCount());
+
+    ASSERT_EQ(1u, testAssetManager.TestTextureAtlasCache.count(MyTestTextureDatabase::DatabaseName));
+    EXPECT_EQ(atlas.Image.Size, testAssetManager.TestTextureAtlasCache.at(MyTestTextureDatabase::DatabaseName).Image.Size);
+}
+
+TEST(TextureAtlasTests, Cache_UsesCacheWhenDatabaseIsUnchanged)
+{
+    TestAssetManager testAssetManager = MakeCachingTestAssetManager();
+    ThreadManager threadManager(false, 4, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+
+    TextureAtlasBuilder<MyTestTextureDatabase>::BuildCachedAtlas(
+        TextureAtlasOptions::None,
+        1.0f,
+        testAssetManager,
+        threadManager.GetSimulationThreadPool(),
+        SimpleProgressCallback::Dummy());
+
+    // Tamper with the cached image, so that we can tell whether it's used
+    auto & cachedImage = testAssetManager.TestTextureAtlasCache.at(MyTestTextureDatabase::DatabaseName).Image;
+    cachedImage[ImageCoordinates(0, 0)] = rgbaColor(0xaa, 0xbb, 0xcc, 0xdd);
+
+    auto const atlas = TextureAtlasBuilder<MyTestTextureDatabase>::BuildCachedAtlas(
+        TextureAtlasOptions::None,
+        1.0f,
+        testAssetManager,
+        threadManager.GetSimulationThreadPool(),
+        SimpleProgressCallback::Dummy());
+
+    EXPECT_EQ(2u, atlas.Metadata.GetFrameCount());
+    EXPECT_EQ(rgbaColor(0xaa, 0xbb, 0xcc, 0xdd), atlas.Image[ImageCoordinates(0, 0)]);
+}
+
+TEST(TextureAtlasTests, Cache_RebuildsWhenDatabaseChanges)
+{
+    TestAssetManager testAssetManager = MakeCachingTestAssetManager();
+    ThreadManager threadManager(false, 4, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+
+    TextureAtlasBuilder<MyTestTextureDatabase>::BuildCachedAtlas(
+        TextureAtlasOptions::None,
+        1.0f,
+        testAssetManager,
+        threadManager.GetSimulationThreadPool(),
+        SimpleProgressCallback::Dummy());
+
+    auto & cachedImage = testAssetManager.TestTextureAtlasCache.at(MyTestTextureDatabase::DatabaseName).Image;
+    cachedImage[ImageCoordinates(0, 0)] = rgbaColor(0xaa, 0xbb, 0xcc, 0xdd);
+
+    testAssetManager.TestTextureDatabaseFingerprint = "Fingerprint2";
+
+    auto const atlas = TextureAtlasBuilder<MyTestTextureDatabase>::BuildCachedAtlas(
+        TextureAtlasOptions::None,
+        1.0f,
+        testAssetManager,
+        threadManager.GetSimulationThreadPool(),
+        SimpleProgressCallback::Dummy());
+
+    EXPECT_NE(rgbaColor(0xaa, 0xbb, 0xcc, 0xdd), atlas.Image[ImageCoordinates(0, 0)]);
+
+    // And it has been re-cached
+    EXPECT_NE(rgbaColor(0xaa, 0xbb, 0xcc, 0xdd), testAssetManager.TestTextureAtlasCache.at(MyTestTextureDatabase::DatabaseName).Image[ImageCoordinates(0, 0)]);
+}
+
+TEST(TextureAtlasTests, Cache_RebuildsWhenOptionsChange)
+{
+    TestAssetManager testAssetManager = MakeCachingTestAssetManager();
+    ThreadManager threadManager(false, 4, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+
+    TextureAtlasBuilder<MyTestTextureDatabase>::BuildCachedAtlas(
+        TextureAtlasOptions::None,
+        1.0f,
+        testAssetManager,
+        threadManager.GetSimulationThreadPool(),
+        SimpleProgressCallback::Dummy());
+
+    auto & cachedImage = testAssetManager.TestTextureAtlasCache.at(MyTestTextureDatabase::DatabaseName).Image;
+    cachedImage[ImageCoordinates(0, 0)] = rgbaColor(0xaa, 0xbb, 0xcc, 0xdd);
+
+    auto const atlas = TextureAtlasBuilder<MyTestTextureDatabase>::BuildCachedAtlas(
+        TextureAtlasOptions::MipMappable,
+        1.0f,
+        testAssetManager,
+        threadManager.GetSimulationThreadPool(),
+        SimpleProgressCallback::Dummy());
+
+    EXPECT_NE(rgbaColor(0xaa, 0xbb, 0xcc, 0xdd), atlas.Image[ImageCoordinates(0, 0)]);
+}
+
+TEST(TextureAtlasTests, BuildAtlas_Concurrent_SameAsSerial)
+{
+    TestAssetManager testAssetManager = MakeCachingTestAssetManager();
+    ThreadManager threadManager(false, 4, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {});
+
+    auto const database = TextureDatabase<MyTestTextureDatabase>::Load(testAssetManager);
+
+    auto const serialAtlas = TextureAtlasBuilder<MyTestTextureDatabase>::BuildAtlas(
+        database,
+        TextureAtlasOptions::None,
+        1.0f,
+        testAssetManager,
+        SimpleProgressCallback::Dummy());
+
+    auto const concurrentAtlas = TextureAtlasBuilder<MyTestTextureDatabase>::BuildAtlas(
+        database,
+        TextureAtlasOptions::None,
+        1.0f,
+        testAssetManager,
+        threadManager.GetSimulationThreadPool(),
+        SimpleProgressCallback::Dummy());
+
+    ASSERT_EQ(serialAtlas.Image.Size, concurrentAtlas.Image.Size);
+    EXPECT_EQ(serialAtlas.Image.Hash(), concurrentAtlas.Image.Hash());
+
+    ASSERT_EQ(serialAtlas.Metadata.GetFrameCount(), concurrentAtlas.Metadata.GetFrameCount());
+    for (TextureFrameIndex f = 0; f < 2; ++f)
+    {
+        auto const & serialFrameMetadata = serialAtlas.Metadata.GetFrameMetadata(MyTestTextureDatabase::MyTextureGroups::MyTestGroup1, f);
+        auto const & concurrentFrameMetadata = concurrentAtlas.Metadata.GetFrameMetadata(MyTestTextureDatabase::MyTextureGroups::MyTestGroup1, f);
+
+        EXPECT_EQ(serialFrameMetadata.TextureCoordinatesBottomLeft, concurrentFrameMetadata.TextureCoordinatesBottomLeft);
+        EXPECT_EQ(serialFrameMetadata.FrameMetadata.FrameName, concurrentFrameMetadata.FrameMetadata.FrameName);
+    }
+}
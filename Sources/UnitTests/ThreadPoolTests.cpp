@@ -1,6 +1,10 @@
 #include <Core/ThreadPool.h>
 
+#include "TestingUtils.h"
+
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <vector>
 
@@ -96,4 +100,261 @@ TEST_P(ThreadPoolTests_FourRuns, Four_Runs)
     t.Run(tasks);
 
     ASSERT_TRUE(std::all_of(results.cbegin(), results.cend(), [](bool b) { return b; }));
-}
\ No newline at end of file
+}
+class ThreadPoolTests_Parallelism : public testing::TestWithParam<size_t>
+{
+public:
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+protected:
+
+    ThreadManager mThreadManager{ false, 16, [](ThreadManager::ThreadTaskKind, std::string const &, size_t) {} };
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    ThreadPoolTests_Parallelism,
+    ThreadPoolTests_Parallelism,
+    ::testing::Values(
+        1,
+        2,
+        4,
+        7
+    ));
+
+TEST_P(ThreadPoolTests_Parallelism, Run_ManyBatches)
+{
+    ThreadPool t(ThreadManager::ThreadTaskKind::MainAndSimulation, GetParam(), mThreadManager);
+
+    std::atomic<size_t> counter{ 0 };
+
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t i = 0; i < 13; ++i)
+    {
+        tasks.emplace_back(
+            [&counter]()
+            {
+                ++counter;
+            });
+    }
+
+    for (size_t b = 0; b < 500; ++b)
+    {
+        t.Run(tasks);
+
+        ASSERT_EQ(counter.load(), (b + 1) * tasks.size());
+    }
+}
+
+TEST_P(ThreadPoolTests_Parallelism, ParallelFor_VisitsEachIndexOnce)
+{
+    ThreadPool t(ThreadManager::ThreadTaskKind::MainAndSimulation, GetParam(), mThreadManager);
+
+    for (size_t const count : { 0, 1, 3, 4, 5, 100, 1023, 4096 })
+    {
+        for (size_t const minChunkSize : { 1, 4, 64 })
+        {
+            std::vector<std::atomic<int>> visits(count + 10);
+            for (auto & v : visits)
+            {
+                v = 0;
+            }
+
+            t.ParallelFor(
+                10,
+                10 + count,
+                minChunkSize,
+                [&](size_t begin, size_t end)
+                {
+                    ASSERT_LT(begin, end);
+                    ASSERT_EQ((begin - 10) % minChunkSize, 0u);
+
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        ++visits[i];
+                    }
+                });
+
+            for (size_t i = 0; i < visits.size(); ++i)
+            {
+                EXPECT_EQ(visits[i].load(), i < 10 ? 0 : 1);
+            }
+        }
+    }
+}
+
+TEST_P(ThreadPoolTests_Parallelism, TaskGraph_HonorsDependencies)
+{
+    ThreadPool t(ThreadManager::ThreadTaskKind::MainAndSimulation, GetParam(), mThreadManager);
+
+    //
+    // 0 --> 1 --> 3 --> 5
+    //  \--> 2 --/      /
+    // 4 --------------/
+    //
+
+    std::atomic<int> sequence{ 0 };
+    std::vector<int> startSequences(6, -1);
+    std::vector<int> endSequences(6, -1);
+
+    ThreadPool::TaskGraph graph;
+
+    auto const makeTask = [&](size_t idx)
+    {
+        return [&, idx]()
+        {
+            startSequences[idx] = sequence++;
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            endSequences[idx] = sequence++;
+        };
+    };
+
+    auto const t0 = graph.AddTask(makeTask(0));
+    auto const t1 = graph.AddTask(makeTask(1), { t0 });
+    auto const t2 = graph.AddTask(makeTask(2), { t0 });
+    auto const t3 = graph.AddTask(makeTask(3), { t1, t2 });
+    auto const t4 = graph.AddTask(makeTask(4));
+    graph.AddTask(makeTask(5), { t3, t4 });
+
+    ASSERT_EQ(graph.GetTaskCount(), 6u);
+
+    for (int r = 0; r < 20; ++r)
+    {
+        sequence = 0;
+
+        t.Run(graph);
+
+        EXPECT_EQ(sequence.load(), 12);
+
+        EXPECT_GT(startSequences[1], endSequences[0]);
+        EXPECT_GT(startSequences[2], endSequences[0]);
+        EXPECT_GT(startSequences[3], endSequences[1]);
+        EXPECT_GT(startSequences[3], endSequences[2]);
+        EXPECT_GT(startSequences[5], endSequences[3]);
+        EXPECT_GT(startSequences[5], endSequences[4]);
+    }
+}
+
+TEST_P(ThreadPoolTests_Parallelism, NestedBatches)
+{
+    ThreadPool t(ThreadManager::ThreadTaskKind::MainAndSimulation, GetParam(), mThreadManager);
+
+    size_t constexpr OuterCount = 8;
+    size_t constexpr InnerCount = 1000;
+
+    std::vector<std::atomic<int>> visits(OuterCount * InnerCount);
+    for (auto & v : visits)
+    {
+        v = 0;
+    }
+
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t o = 0; o < OuterCount; ++o)
+    {
+        tasks.emplace_back(
+            [&, o]()
+            {
+                t.ParallelFor(
+                    o * InnerCount,
+                    (o + 1) * InnerCount,
+                    16,
+                    [&](size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            ++visits[i];
+                        }
+                    });
+            });
+    }
+
+    t.Run(tasks);
+
+    EXPECT_TRUE(std::all_of(visits.cbegin(), visits.cend(), [](std::atomic<int> const & v) { return v.load() == 1; }));
+}
+
+TEST_P(ThreadPoolTests_Parallelism, SteadyStateRuns_DoNotAllocate)
+{
+    ThreadPool t(ThreadManager::ThreadTaskKind::MainAndSimulation, GetParam(), mThreadManager);
+
+    std::vector<std::atomic<int>> visits(64);
+    for (auto & v : visits)
+    {
+        v = 0;
+    }
+
+    std::vector<ThreadPool::Task> tasks;
+    ThreadPool::TaskGraph graph;
+    std::vector<ThreadPool::TaskGraph::TaskId> dependencies;
+
+    // Mimics a simulation step: the task graph and the task list are
+    // re-built at each step, capturing the step's locals
+    auto const runStep = [&](int step)
+    {
+        dependencies.clear();
+        for (size_t i = 0; i < 8; ++i)
+        {
+            dependencies.emplace_back(graph.AddTask(
+                [&, i, step]()
+                {
+                    visits[i] += step;
+                }));
+        }
+
+        auto const parallelForTaskId = graph.AddTask(
+            [&, step]()
+            {
+                t.ParallelFor(
+                    8,
+                    visits.size(),
+                    4,
+                    [&, step](size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            visits[i] += step;
+                        }
+                    });
+            },
+            dependencies);
+
+        graph.AddTask(
+            [&, step]()
+            {
+                visits[0] -= step;
+            },
+            { dependencies.front(), parallelForTaskId });
+
+        t.Run(graph);
+        graph.Clear();
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            tasks.emplace_back(
+                [&, step]()
+                {
+                    visits[0] -= step;
+                });
+        }
+
+        t.RunAndClear(tasks);
+    };
+
+    // Warm-up, reaching steady-state sizes
+    runStep(0);
+    runStep(0);
+
+    {
+        ScopedAllocationCounter allocationCounter;
+
+        for (int s = 1; s <= 10; ++s)
+        {
+            runStep(s);
+        }
+
+        EXPECT_EQ(allocationCounter.GetCount(), 0u);
+    }
+
+    EXPECT_EQ(visits[0].load(), 55 - 5 * 55);
+    EXPECT_TRUE(std::all_of(visits.cbegin() + 1, visits.cend(), [](std::atomic<int> const & v) { return v.load() == 55; }));
+}
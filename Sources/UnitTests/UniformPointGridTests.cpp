@@ -0,0 +1,130 @@
+#include <Core/UniformPointGrid.h>
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace /* anonymous */ {
+
+    std::vector<ElementIndex> Query(
+        UniformPointGrid const & grid,
+        std::vector<vec2f> const & positions,
+        vec2f const & center,
+        float radius)
+    {
+        std::vector<ElementIndex> result;
+        grid.VisitPointsInRadius(
+            positions.data(),
+            center,
+            radius,
+            [&](ElementIndex p, float squareDistance)
+            {
+                EXPECT_FLOAT_EQ(squareDistance, (positions[p] - center).squareLength());
+                result.push_back(p);
+            });
+
+        return result;
+    }
+
+    std::vector<ElementIndex> BruteForceQuery(
+        std::vector<vec2f> const & positions,
+        vec2f const & center,
+        float radius)
+    {
+        std::vector<ElementIndex> result;
+        for (ElementIndex p = 0; p < positions.size(); ++p)
+        {
+            if ((positions[p] - center).squareLength() < radius * radius)
+            {
+                result.push_back(p);
+            }
+        }
+
+        return result;
+    }
+}
+
+TEST(UniformPointGridTests, Empty)
+{
+    std::vector<vec2f> positions;
+
+    UniformPointGrid grid(2.0f, 16);
+    EXPECT_FALSE(grid.IsValid());
+
+    grid.Rebuild(positions.data(), 0, [](ElementIndex) { return true; });
+    EXPECT_TRUE(grid.IsValid());
+
+    EXPECT_TRUE(Query(grid, positions, vec2f(0.0f, 0.0f), 10.0f).empty());
+}
+
+TEST(UniformPointGridTests, MatchesBruteForce)
+{
+    std::vector<vec2f> positions;
+    for (int y = 0; y < 40; ++y)
+    {
+        for (int x = 0; x < 30; ++x)
+        {
+            positions.emplace_back(
+                -20.0f + static_cast<float>(x) * 1.3f + static_cast<float>(y % 3) * 0.1f,
+                10.0f - static_cast<float>(y) * 0.7f);
+        }
+    }
+
+    // One outlier, far away
+    positions.emplace_back(1000.0f, -500.0f);
+
+    UniformPointGrid grid(2.0f, 64);
+    grid.Rebuild(positions.data(), static_cast<ElementCount>(positions.size()), [](ElementIndex) { return true; });
+
+    for (auto const & center : { vec2f(0.0f, 0.0f), vec2f(-20.0f, 10.0f), vec2f(15.0f, -18.0f), vec2f(-100.0f, -100.0f), vec2f(999.0f, -499.0f) })
+    {
+        for (float const radius : { 0.5f, 1.0f, 3.7f, 12.0f, 2000.0f })
+        {
+            EXPECT_EQ(Query(grid, positions, center, radius), BruteForceQuery(positions, center, radius));
+        }
+    }
+}
+
+TEST(UniformPointGridTests, ExcludesPoints)
+{
+    std::vector<vec2f> positions = {
+        vec2f(0.0f, 0.0f),
+        vec2f(0.5f, 0.0f),
+        vec2f(1.0f, 0.0f),
+        vec2f(1.5f, 0.0f)
+    };
+
+    UniformPointGrid grid(2.0f, 16);
+    grid.Rebuild(positions.data(), static_cast<ElementCount>(positions.size()), [](ElementIndex p) { return p % 2 == 0; });
+
+    EXPECT_EQ(Query(grid, positions, vec2f(0.75f, 0.0f), 5.0f), std::vector<ElementIndex>({ 0, 2 }));
+}
+
+TEST(UniformPointGridTests, UsesCurrentPositions)
+{
+    std::vector<vec2f> positions = {
+        vec2f(0.0f, 0.0f),
+        vec2f(10.0f, 0.0f),
+        vec2f(10.0f, 10.0f)
+    };
+
+    UniformPointGrid grid(2.0f, 16);
+    grid.Rebuild(positions.data(), static_cast<ElementCount>(positions.size()), [](ElementIndex) { return true; });
+
+    EXPECT_EQ(Query(grid, positions, vec2f(10.0f, 0.0f), 1.0f), std::vector<ElementIndex>({ 1 }));
+
+    // Move within its cell
+    positions[1] = vec2f(10.5f, 0.5f);
+    EXPECT_EQ(Query(grid, positions, vec2f(10.0f, 0.0f), 0.5f), std::vector<ElementIndex>({}));
+    EXPECT_EQ(Query(grid, positions, vec2f(10.0f, 0.0f), 1.0f), std::vector<ElementIndex>({ 1 }));
+
+    // Move far away - needs a rebuild to be found again
+    positions[1] = vec2f(0.0f, 10.0f);
+    EXPECT_EQ(Query(grid, positions, vec2f(0.0f, 10.0f), 1.0f), std::vector<ElementIndex>({}));
+
+    grid.Invalidate();
+    EXPECT_FALSE(grid.IsValid());
+
+    grid.Rebuild(positions.data(), static_cast<ElementCount>(positions.size()), [](ElementIndex) { return true; });
+    EXPECT_EQ(Query(grid, positions, vec2f(0.0f, 10.0f), 1.0f), std::vector<ElementIndex>({ 1 }));
+}
@@ -0,0 +1,200 @@
+#include <Core/UniformTriangleGrid.h>
+
+#include <Core/GameGeometry.h>
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <vector>
+
+namespace /* anonymous */ {
+
+    using TriangleEndpoints = std::array<ElementIndex, 3>;
+
+    // A W x H grid of points, with two CW triangles per square
+    void MakeMesh(
+        int width,
+        int height,
+        std::vector<vec2f> & positions,
+        std::vector<TriangleEndpoints> & triangles)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                positions.emplace_back(
+                    -10.0f + static_cast<float>(x) + static_cast<float>(y % 2) * 0.2f,
+                    5.0f + static_cast<float>(y) * 0.9f);
+            }
+        }
+
+        for (int y = 0; y < height - 1; ++y)
+        {
+            for (int x = 0; x < width - 1; ++x)
+            {
+                ElementIndex const bl = static_cast<ElementIndex>(y * width + x);
+                ElementIndex const br = bl + 1;
+                ElementIndex const tl = bl + static_cast<ElementIndex>(width);
+                ElementIndex const tr = tl + 1;
+
+                triangles.push_back({ bl, tl, tr });
+                triangles.push_back({ bl, tr, br });
+            }
+        }
+    }
+
+    void Rebuild(
+        UniformTriangleGrid & grid,
+        std::vector<vec2f> const & positions,
+        std::vector<TriangleEndpoints> const & triangles,
+        std::vector<bool> const & isIncluded)
+    {
+        grid.Rebuild(
+            positions.data(),
+            static_cast<ElementCount>(triangles.size()),
+            [&](ElementIndex t) -> auto const &
+            {
+                return triangles[t];
+            },
+            [&](ElementIndex t)
+            {
+                return bool(isIncluded[t]);
+            });
+    }
+
+    std::vector<ElementIndex> Query(
+        UniformTriangleGrid const & grid,
+        std::vector<vec2f> const & positions,
+        std::vector<TriangleEndpoints> const & triangles,
+        vec2f const & position)
+    {
+        std::vector<ElementIndex> result;
+        for (ElementIndex const t : grid.GetCellTriangles(position))
+        {
+            if (Geometry::IsPointInTriangle(position, positions[triangles[t][0]], positions[triangles[t][1]], positions[triangles[t][2]]))
+            {
+                result.push_back(t);
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<ElementIndex> BruteForceQuery(
+        std::vector<vec2f> const & positions,
+        std::vector<TriangleEndpoints> const & triangles,
+        std::vector<bool> const & isIncluded,
+        vec2f const & position)
+    {
+        std::vector<ElementIndex> result;
+        for (ElementIndex t = 0; t < triangles.size(); ++t)
+        {
+            if (isIncluded[t]
+                && Geometry::IsPointInTriangle(position, positions[triangles[t][0]], positions[triangles[t][1]], positions[triangles[t][2]]))
+            {
+                result.push_back(t);
+            }
+        }
+
+        return result;
+    }
+}
+
+TEST(UniformTriangleGridTests, Empty)
+{
+    std::vector<vec2f> positions;
+    std::vector<TriangleEndpoints> triangles;
+
+    UniformTriangleGrid grid(2.0f, 16);
+    EXPECT_FALSE(grid.IsValid());
+
+    Rebuild(grid, positions, triangles, {});
+    EXPECT_TRUE(grid.IsValid());
+
+    EXPECT_TRUE(grid.GetCellTriangles(vec2f(0.0f, 0.0f)).empty());
+}
+
+TEST(UniformTriangleGridTests, MatchesBruteForce)
+{
+    std::vector<vec2f> positions;
+    std::vector<TriangleEndpoints> triangles;
+    MakeMesh(30, 40, positions, triangles);
+
+    std::vector<bool> isIncluded(triangles.size(), true);
+
+    UniformTriangleGrid grid(2.0f, 64);
+    Rebuild(grid, positions, triangles, isIncluded);
+
+    for (float y = 0.0f; y < 50.0f; y += 0.53f)
+    {
+        for (float x = -15.0f; x < 25.0f; x += 0.61f)
+        {
+            vec2f const position(x, y);
+
+            auto const result = Query(grid, positions, triangles, position);
+            EXPECT_EQ(result, BruteForceQuery(positions, triangles, isIncluded, position));
+        }
+    }
+
+    // Vertices are contained in all their triangles
+    EXPECT_EQ(Query(grid, positions, triangles, positions[31]), BruteForceQuery(positions, triangles, isIncluded, positions[31]));
+    EXPECT_EQ(Query(grid, positions, triangles, positions[31]).size(), 6u);
+}
+
+TEST(UniformTriangleGridTests, ExcludesTriangles)
+{
+    std::vector<vec2f> positions;
+    std::vector<TriangleEndpoints> triangles;
+    MakeMesh(10, 10, positions, triangles);
+
+    std::vector<bool> isIncluded(triangles.size());
+    for (size_t t = 0; t < triangles.size(); ++t)
+    {
+        isIncluded[t] = (t % 3) != 0;
+    }
+
+    UniformTriangleGrid grid(2.0f, 64);
+    Rebuild(grid, positions, triangles, isIncluded);
+
+    size_t foundCount = 0;
+    for (float y = 4.0f; y < 15.0f; y += 0.23f)
+    {
+        for (float x = -11.0f; x < 1.0f; x += 0.29f)
+        {
+            vec2f const position(x, y);
+
+            auto const result = Query(grid, positions, triangles, position);
+            EXPECT_EQ(result, BruteForceQuery(positions, triangles, isIncluded, position));
+
+            foundCount += result.size();
+        }
+    }
+
+    EXPECT_GT(foundCount, 0u);
+}
+
+TEST(UniformTriangleGridTests, ClampsToMaxCells)
+{
+    std::vector<vec2f> positions;
+    std::vector<TriangleEndpoints> triangles;
+    MakeMesh(30, 40, positions, triangles);
+
+    // One far away triangle
+    positions.emplace_back(1000.0f, 1000.0f);
+    positions.emplace_back(1000.0f, 1001.0f);
+    positions.emplace_back(1001.0f, 1001.0f);
+    ElementIndex const p = static_cast<ElementIndex>(positions.size());
+    triangles.push_back({ p - 3, p - 2, p - 1 });
+
+    std::vector<bool> isIncluded(triangles.size(), true);
+
+    UniformTriangleGrid grid(0.1f, 4);
+    Rebuild(grid, positions, triangles, isIncluded);
+
+    for (auto const & position : { vec2f(0.0f, 10.0f), vec2f(1000.2f, 1000.7f), vec2f(1001.0f, 1001.0f), vec2f(1001.1f, 1001.0f), vec2f(-100.0f, 10.0f) })
+    {
+        EXPECT_EQ(Query(grid, positions, triangles, position), BruteForceQuery(positions, triangles, isIncluded, position));
+    }
+
+    EXPECT_EQ(Query(grid, positions, triangles, vec2f(1000.2f, 1000.7f)), std::vector<ElementIndex>({ static_cast<ElementIndex>(triangles.size() - 1) }));
+}
@@ -0,0 +1,263 @@
+#include "TestingUtils.h"
+#include "TestingWorld.h"
+
+#include <Simulation/ISimulationEventHandlers.h>
+#include <Simulation/Physics/Physics.h>
+
+#include <Core/GameRandomEngine.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+/*
+ * Reaches into the world's internals.
+ */
+class WorldTests
+{
+public:
+
+    static bool ShouldUpdateSubsystemsConcurrently(TestingWorld const & world)
+    {
+        return world.World->ShouldUpdateSubsystemsConcurrently(world.Parameters, world.Threads);
+    }
+
+    static size_t GetDeferredOceanDisturbanceCount(TestingWorld const & world)
+    {
+        return world.World->mDeferredOceanDisturbances.size();
+    }
+
+    // Disturbances that fishes have been told about, but have not yet enacted
+    static size_t CountPendingFishDisturbancesAt(
+        vec2f const & position,
+        TestingWorld const & world)
+    {
+        size_t count = 0;
+        for (auto const & interaction : world.World->mFishes.mInteractions)
+        {
+            if (interaction.Type == Physics::Fishes::Interaction::InteractionType::Disturbance
+                && interaction.Area.has_value()
+                && (interaction.Area->Position - position).length() < interaction.Area->Radius)
+            {
+                ++count;
+            }
+        }
+
+        return count;
+    }
+};
+
+namespace {
+
+    ShipSpaceSize constexpr ShipSize(48, 24);
+
+    size_t CountNpcsIn(
+        vec2f const & corner1,
+        vec2f const & corner2,
+        TestingWorld const & world)
+    {
+        return world.World->ProbeNpcsInRect(corner1, corner2).size();
+    }
+
+    SimulationParameters MakeConcurrentParameters()
+    {
+        SimulationParameters parameters;
+        parameters.DoConcurrentShipUpdates = true;
+        parameters.DoConcurrentWorldUpdates = true;
+        parameters.DoConcurrentNpcUpdates = true;
+
+        return parameters;
+    }
+
+    class GenericShipEventCounter final : public IGenericShipEventHandler
+    {
+    public:
+
+        size_t WaterSplashedCount{ 0 };
+        size_t BombExplosionCount{ 0 };
+
+        void OnWaterSplashed(float /*waterSplashed*/) override
+        {
+            ++WaterSplashedCount;
+        }
+
+        void OnBombExplosion(
+            GadgetType /*gadgetType*/,
+            bool /*isUnderwater*/,
+            unsigned int /*size*/) override
+        {
+            ++BombExplosionCount;
+        }
+    };
+
+    // The state of the ship's points after some steps, in a world whose randomness only
+    // depends on the specified seed
+    std::vector<vec2f> RunSeededShip(
+        SimulationParameters const & parameters,
+        unsigned int seed,
+        size_t stepCount)
+    {
+        auto randomEngine = GameRandomEngine::MakeObjectInstance(seed);
+        GameRandomEngine::ScopedThreadInstance const randomEngineScope(randomEngine);
+
+        TestingWorld world(parameters, 4);
+        Physics::Ship & ship = world.AddShip(ShipSize, vec2f(0.0f, -8.0f));
+
+        world.Update(stepCount);
+
+        std::vector<vec2f> state;
+        for (auto pointIndex : ship.GetPoints().RawShipPoints())
+        {
+            state.push_back(ship.GetPoints().GetPosition(pointIndex));
+            state.push_back(ship.GetPoints().GetVelocity(pointIndex));
+        }
+
+        return state;
+    }
+}
+
+TEST(WorldTests, UpdatesSubsystemsConcurrently_WithNpcsOnManyShips)
+{
+    SimulationParameters parameters = MakeConcurrentParameters();
+    parameters.NpcsPerGroup = 16;
+
+    TestingWorld world(parameters, 4);
+
+    world.AddShip(ShipSize, vec2f(-50.0f, -8.0f));
+    world.AddShip(ShipSize, vec2f(50.0f, -8.0f));
+
+    ASSERT_TRUE(WorldTests::ShouldUpdateSubsystemsConcurrently(world));
+
+    vec2f const ship1Corner1(-80.0f, -20.0f);
+    vec2f const ship1Corner2(-20.0f, 30.0f);
+    vec2f const ship2Corner1(20.0f, -20.0f);
+    vec2f const ship2Corner2(80.0f, 30.0f);
+
+    VisibleWorld const visibleWorld{
+        vec2f(0.0f, 5.0f),
+        160.0f,
+        50.0f,
+        vec2f(-80.0f, 30.0f),
+        vec2f(80.0f, -20.0f) };
+
+    // Each group goes to a random ship; we want NPCs on both, and enough of them to
+    // be updated concurrently
+    for (int g = 0; g < 16; ++g)
+    {
+        if (CountNpcsIn(ship1Corner1, ship1Corner2, world) > 0
+            && CountNpcsIn(ship2Corner1, ship2Corner2, world) > 0
+            && CountNpcsIn(ship1Corner1, ship2Corner2, world) >= 32)
+        {
+            break;
+        }
+
+        world.World->AddNpcGroup(NpcKindType::Human, visibleWorld, world.Parameters);
+    }
+
+    ASSERT_GT(CountNpcsIn(ship1Corner1, ship1Corner2, world), 0u);
+    ASSERT_GT(CountNpcsIn(ship2Corner1, ship2Corner2, world), 0u);
+
+    size_t const npcCount = CountNpcsIn(ship1Corner1, ship2Corner2, world);
+    ASSERT_GE(npcCount, 32u);
+
+    GenericShipEventCounter eventCounter;
+    world.EventDispatcher.RegisterGenericShipEventHandler(&eventCounter);
+
+    // Ships, their NPCs, and NPCs of different ships are all updated concurrently,
+    // inside the world's graph
+    world.Update(30);
+
+    EXPECT_FALSE(world.EventDispatcher.IsDeferringSinkCalls());
+    EXPECT_EQ(CountNpcsIn(ship1Corner1, ship2Corner2, world), npcCount);
+
+    // Each ship notifies splashed water once per step, and its notifications - deferred
+    // while in the graph - reach the sinks once
+    EXPECT_EQ(eventCounter.WaterSplashedCount, 2u * 30u);
+}
+
+TEST(WorldTests, UpdatesSubsystemsConcurrently_AppliesDeferredOceanDisturbances)
+{
+    TestingWorld world(MakeConcurrentParameters(), 4);
+
+    world.AddShip(ShipSize, vec2f(0.0f, -8.0f));
+
+    ASSERT_TRUE(WorldTests::ShouldUpdateSubsystemsConcurrently(world));
+
+    GenericShipEventCounter eventCounter;
+    world.EventDispatcher.RegisterGenericShipEventHandler(&eventCounter);
+
+    // On the upper deck
+    vec2f const bombPosition(0.0f, 8.0f);
+    world.World->ToggleRCBombAt(bombPosition, world.Parameters);
+    world.Update(1);
+    world.World->DetonateRCBombs(world.Parameters);
+
+    // The bomb goes through a (wall-clock) lead-in before exploding; its blast disturbs
+    // fishes from within the ship's update, i.e. while fishes are being updated
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (eventCounter.BombExplosionCount == 0
+        || WorldTests::CountPendingFishDisturbancesAt(bombPosition, world) == 0)
+    {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+
+        world.Update(1);
+
+        EXPECT_EQ(WorldTests::GetDeferredOceanDisturbanceCount(world), 0u);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(eventCounter.BombExplosionCount, 1u);
+}
+
+TEST(WorldTests, UpdatesSubsystemsConcurrently_SameShipStateAsSerialUpdates)
+{
+    SimulationParameters concurrentParameters = MakeConcurrentParameters();
+
+    // Hybrid relaxation spin-waits for all of its threads at each iteration, which is slow
+    // on machines with fewer cores than threads; besides, it's not what's being tested here
+    concurrentParameters.SpringRelaxationParallelComputationMode = SpringRelaxationParallelComputationModeType::StepByStep;
+
+    // Only the world's subsystems differ
+    SimulationParameters serialParameters = concurrentParameters;
+    serialParameters.DoConcurrentWorldUpdates = false;
+
+    auto const concurrentState = RunSeededShip(concurrentParameters, 42, 60);
+    auto const serialState = RunSeededShip(serialParameters, 42, 60);
+
+    ASSERT_EQ(concurrentState.size(), serialState.size());
+    for (size_t i = 0; i < concurrentState.size(); ++i)
+    {
+        EXPECT_EQ(concurrentState[i], serialState[i]) << "at " << i;
+    }
+}
+
+TEST(WorldTests, Update_DoesNotAllocate_InSteadyState)
+{
+    TestingWorld world(MakeConcurrentParameters(), 4);
+
+    world.AddShip(ShipSize, vec2f(-50.0f, -8.0f));
+    world.AddShip(ShipSize, vec2f(50.0f, -8.0f));
+
+    ASSERT_TRUE(WorldTests::ShouldUpdateSubsystemsConcurrently(world));
+
+    // Let buffers - including those of the events deferred while in the world's graph -
+    // grow to their steady-state sizes
+    world.Update(30);
+
+    ScopedAllocationCounter allocationCounter;
+
+    for (int s = 0; s < 10; ++s)
+    {
+        world.World->Update(
+            world.Parameters,
+            world.View,
+            StressRenderModeType::None,
+            world.Threads,
+            world.Stats);
+    }
+
+    EXPECT_EQ(allocationCounter.GetCount(), 0u);
+}